@@ -0,0 +1,1168 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file                                       
+///                                               
+///  Automatically generated template             
+///  specialisations for backend functors.        
+///                                               
+///  This file was automatically generated by     
+///  module_harvester.py. Do not modify.          
+///                                               
+///  The content is harvested from:               
+///   - rollcall headers in module_rollcall.hpp   
+///   - frontend headers in backend_rollcall.hpp  
+///   - types registered in types_rollcall.hpp    
+///                                               
+///  *********************************************
+///                                               
+///  Authors:                                     
+///                                               
+///  \author The GAMBIT Collaboration            
+///  \date 06:54PM on October 16, 2026
+///                                               
+///  *********************************************
+                                                  
+#ifndef __backend_functor_types_hpp__             
+#define __backend_functor_types_hpp__             
+                                                  
+#include "gambit/Elements/types_rollcall.hpp"   
+#include "gambit/Elements/functor_definitions.hpp"
+                                                  
+namespace Gambit                                  
+{                                                 
+  template class backend_functor_common<void(*)(nuisance*,const parameters*),void,nuisance*,const parameters*>;
+  template class backend_functor<void(*)(nuisance*,const parameters*),void,nuisance*,const parameters*>;
+
+  template class backend_functor_common<double(*)(const double&,const double&,const double&,const double&,const int&),double,const double&,const double&,const double&,const double&,const int&>;
+  template class backend_functor<double(*)(const double&,const double&,const double&,const double&,const int&),double,const double&,const double&,const double&,const double&,const int&>;
+
+  template class backend_functor_common<double(*)(Farray<Fdouble,1,3>&),double,Farray<Fdouble,1,3>&>;
+  template class backend_functor<double(*)(Farray<Fdouble,1,3>&),double,Farray<Fdouble,1,3>&>;
+
+  template class backend_functor_common<sd_neut2bodygrav_type*(*)(),sd_neut2bodygrav_type*>;
+  template class backend_functor<sd_neut2bodygrav_type*(*)(),sd_neut2bodygrav_type*>;
+
+  template class backend_functor_common<void(*)(double&,double),void,double&,double>;
+  template class backend_functor<void(*)(double&,double),void,double&,double>;
+
+  template class backend_functor_common<void(*)(int&,Farray<fh_complex,1,681>&,Farray<fh_complex,1,231>&,Farray<fh_real,1,978>&,Farray<fh_real,1,250>&,int&),void,int&,Farray<fh_complex,1,681>&,Farray<fh_complex,1,231>&,Farray<fh_real,1,978>&,Farray<fh_real,1,250>&,int&>;
+  template class backend_functor<void(*)(int&,Farray<fh_complex,1,681>&,Farray<fh_complex,1,231>&,Farray<fh_real,1,978>&,Farray<fh_real,1,250>&,int&),void,int&,Farray<fh_complex,1,681>&,Farray<fh_complex,1,231>&,Farray<fh_real,1,978>&,Farray<fh_real,1,250>&,int&>;
+
+  template class backend_functor_common<map_str_int(*)(),map_str_int>;
+  template class backend_functor<map_str_int(*)(),map_str_int>;
+
+  template class backend_functor_common<char**(*)(),char**>;
+  template class backend_functor<char**(*)(),char**>;
+
+  template class backend_functor_common<void(*)(const double&,const double&,const double&,double&,double&),void,const double&,const double&,const double&,double&,double&>;
+  template class backend_functor<void(*)(const double&,const double&,const double&,double&,double&),void,const double&,const double&,const double&,double&,double&>;
+
+  template class backend_functor_common<Farray_particle23_1_6*(*)(),Farray_particle23_1_6*>;
+  template class backend_functor<Farray_particle23_1_6*(*)(),Farray_particle23_1_6*>;
+
+  template class backend_functor_common<Farray_Fstring60_1_22*(*)(),Farray_Fstring60_1_22*>;
+  template class backend_functor<Farray_Fstring60_1_22*(*)(),Farray_Fstring60_1_22*>;
+
+  template class backend_functor_common<Spectrum(*)(const Finputs&),Spectrum,const Finputs&>;
+  template class backend_functor<Spectrum(*)(const Finputs&),Spectrum,const Finputs&>;
+
+  template class backend_functor_common<double(*)(clik_object*,double*,clik_error**),double,clik_object*,double*,clik_error**>;
+  template class backend_functor<double(*)(clik_object*,double*,clik_error**),double,clik_object*,double*,clik_error**>;
+
+  template class backend_functor_common<sd_supwidth_type*(*)(),sd_supwidth_type*>;
+  template class backend_functor<sd_supwidth_type*(*)(),sd_supwidth_type*>;
+
+  template class backend_functor_common<DS_HMISODF*(*)(),DS_HMISODF*>;
+  template class backend_functor<DS_HMISODF*(*)(),DS_HMISODF*>;
+
+  template class backend_functor_common<DS5_NUCOM*(*)(),DS5_NUCOM*>;
+  template class backend_functor<DS5_NUCOM*(*)(),DS5_NUCOM*>;
+
+  template class backend_functor_common<libFarrayTest_CB2_type*(*)(),libFarrayTest_CB2_type*>;
+  template class backend_functor<libFarrayTest_CB2_type*(*)(),libFarrayTest_CB2_type*>;
+
+  template class backend_functor_common<Farray_particle23_1_4*(*)(),Farray_particle23_1_4*>;
+  template class backend_functor<Farray_particle23_1_4*(*)(),Farray_particle23_1_4*>;
+
+  template class backend_functor_common<void(*)(const int&,const double&),void,const int&,const double&>;
+  template class backend_functor<void(*)(const int&,const double&),void,const int&,const double&>;
+
+  template class backend_functor_common<void(*)(std::vector<std::string>&,std::string&),void,std::vector<std::string>&,std::string&>;
+  template class backend_functor<void(*)(std::vector<std::string>&,std::string&),void,std::vector<std::string>&,std::string&>;
+
+  template class backend_functor_common<PyDict(*)(iipair&,double&,double&),PyDict,iipair&,double&,double&>;
+  template class backend_functor<PyDict(*)(iipair&,double&,double&),PyDict,iipair&,double&,double&>;
+
+  template class backend_functor_common<void(*)(const char*),void,const char*>;
+  template class backend_functor<void(*)(const char*),void,const char*>;
+
+  template class backend_functor_common<sd_leshouches2_type*(*)(),sd_leshouches2_type*>;
+  template class backend_functor<sd_leshouches2_type*(*)(),sd_leshouches2_type*>;
+
+  template class backend_functor_common<bool(*)(),bool>;
+  template class backend_functor<bool(*)(),bool>;
+
+  template class backend_functor_common<double(*)(const MPLike_data_container&,pybind11::object&,std::string&),double,const MPLike_data_container&,pybind11::object&,std::string&>;
+  template class backend_functor<double(*)(const MPLike_data_container&,pybind11::object&,std::string&),double,const MPLike_data_container&,pybind11::object&,std::string&>;
+
+  template class backend_functor_common<double(*)(int,...),double,int>;
+  template class backend_functor<double(*)(int,...),double,int>;
+
+  template class backend_functor_common<double(*)(double,int,parameters*),double,double,int,parameters*>;
+  template class backend_functor<double(*)(double,int,parameters*),double,double,int,parameters*>;
+
+  template class backend_functor_common<void(*)(const Spectrum&,std::vector<SpectrumParameter>),void,const Spectrum&,std::vector<SpectrumParameter>>;
+  template class backend_functor<void(*)(const Spectrum&,std::vector<SpectrumParameter>),void,const Spectrum&,std::vector<SpectrumParameter>>;
+
+  template class backend_functor_common<double(*)(PyDict&,const std::string&),double,PyDict&,const std::string&>;
+  template class backend_functor<double(*)(PyDict&,const std::string&),double,PyDict&,const std::string&>;
+
+  template class backend_functor_common<DS_NUCOM*(*)(),DS_NUCOM*>;
+  template class backend_functor<DS_NUCOM*(*)(),DS_NUCOM*>;
+
+  template class backend_functor_common<double(*)(int&,const double&),double,int&,const double&>;
+  template class backend_functor<double(*)(int&,const double&),double,int&,const double&>;
+
+  template class backend_functor_common<NREO_DM_nucleon_couplings(*)(map_str_dbl&,double&,int&,std::string&,map_str_dbl&),NREO_DM_nucleon_couplings,map_str_dbl&,double&,int&,std::string&,map_str_dbl&>;
+  template class backend_functor<NREO_DM_nucleon_couplings(*)(map_str_dbl&,double&,int&,std::string&,map_str_dbl&),NREO_DM_nucleon_couplings,map_str_dbl&,double&,int&,std::string&,map_str_dbl&>;
+
+  template class backend_functor_common<widthhc_hdec_type*(*)(),widthhc_hdec_type*>;
+  template class backend_functor<widthhc_hdec_type*(*)(),widthhc_hdec_type*>;
+
+  template class backend_functor_common<Farray_particle23_1_3*(*)(),Farray_particle23_1_3*>;
+  template class backend_functor<Farray_particle23_1_3*(*)(),Farray_particle23_1_3*>;
+
+  template class backend_functor_common<void(*)(SLHAstruct ,double,double),void,SLHAstruct ,double,double>;
+  template class backend_functor<void(*)(SLHAstruct ,double,double),void,SLHAstruct ,double,double>;
+
+  template class backend_functor_common<int(*)(double(*)(double,double,double,double),double*,double*,double*,double*),int,double(*)(double,double,double,double),double*,double*,double*,double*>;
+  template class backend_functor<int(*)(double(*)(double,double,double,double),double*,double*,double*,double*),int,double(*)(double,double,double,double),double*,double*,double*,double*>;
+
+  template class backend_functor_common<void(*)(const int&,const double&,const double&,const double&,const double&,const double&),void,const int&,const double&,const double&,const double&,const double&,const double&>;
+  template class backend_functor<void(*)(const int&,const double&,const double&,const double&,const double&,const double&),void,const int&,const double&,const double&,const double&,const double&,const double&>;
+
+  template class backend_functor_common<DS5_RDMGEV*(*)(),DS5_RDMGEV*>;
+  template class backend_functor<DS5_RDMGEV*(*)(),DS5_RDMGEV*>;
+
+  template class backend_functor_common<void(*)(const std::string&),void,const std::string&>;
+  template class backend_functor<void(*)(const std::string&),void,const std::string&>;
+
+  template class backend_functor_common<widthhl_hdec_type*(*)(),widthhl_hdec_type*>;
+  template class backend_functor<widthhl_hdec_type*(*)(),widthhl_hdec_type*>;
+
+  template class backend_functor_common<double(*)(double*),double,double*>;
+  template class backend_functor<double(*)(double*),double,double*>;
+
+  template class backend_functor_common<void(*)(int&,int&,Farray<fh_real,1,2,1,5,1,3>&,Farray<fh_complex,1,2,1,2,1,5,1,3>&,Farray<fh_real,1,6,1,5>&,Farray<fh_complex,1,36,1,5>&,Farray<fh_real,1,2>&,Farray<fh_complex,1,4>&,Farray<fh_complex,1,4>&,Farray<fh_real,1,4>&,Farray<fh_complex,1,16>&,fh_complex&,fh_real&,Farray<fh_real,1,4>&,fh_real&),void,int&,int&,Farray<fh_real,1,2,1,5,1,3>&,Farray<fh_complex,1,2,1,2,1,5,1,3>&,Farray<fh_real,1,6,1,5>&,Farray<fh_complex,1,36,1,5>&,Farray<fh_real,1,2>&,Farray<fh_complex,1,4>&,Farray<fh_complex,1,4>&,Farray<fh_real,1,4>&,Farray<fh_complex,1,16>&,fh_complex&,fh_real&,Farray<fh_real,1,4>&,fh_real&>;
+  template class backend_functor<void(*)(int&,int&,Farray<fh_real,1,2,1,5,1,3>&,Farray<fh_complex,1,2,1,2,1,5,1,3>&,Farray<fh_real,1,6,1,5>&,Farray<fh_complex,1,36,1,5>&,Farray<fh_real,1,2>&,Farray<fh_complex,1,4>&,Farray<fh_complex,1,4>&,Farray<fh_real,1,4>&,Farray<fh_complex,1,16>&,fh_complex&,fh_real&,Farray<fh_real,1,4>&,fh_real&),void,int&,int&,Farray<fh_real,1,2,1,5,1,3>&,Farray<fh_complex,1,2,1,2,1,5,1,3>&,Farray<fh_real,1,6,1,5>&,Farray<fh_complex,1,36,1,5>&,Farray<fh_real,1,2>&,Farray<fh_complex,1,4>&,Farray<fh_complex,1,4>&,Farray<fh_real,1,4>&,Farray<fh_complex,1,16>&,fh_complex&,fh_real&,Farray<fh_real,1,4>&,fh_real&>;
+
+  template class backend_functor_common<double(*)(double,double,int),double,double,double,int>;
+  template class backend_functor<double(*)(double,double,int),double,double,double,int>;
+
+  template class backend_functor_common<obscura_1_1_0::obscura::DM_Detector_Crystal(*)(),obscura_1_1_0::obscura::DM_Detector_Crystal>;
+  template class backend_functor<obscura_1_1_0::obscura::DM_Detector_Crystal(*)(),obscura_1_1_0::obscura::DM_Detector_Crystal>;
+
+  template class backend_functor_common<MicrOmegas::MOcommonSTR*(*)(),MicrOmegas::MOcommonSTR*>;
+  template class backend_functor<MicrOmegas::MOcommonSTR*(*)(),MicrOmegas::MOcommonSTR*>;
+
+  template class backend_functor_common<void(*)(const Finputs&),void,const Finputs&>;
+  template class backend_functor<void(*)(const Finputs&),void,const Finputs&>;
+
+  template class backend_functor_common<Farray_Fstring60_1_9*(*)(),Farray_Fstring60_1_9*>;
+  template class backend_functor<Farray_Fstring60_1_9*(*)(),Farray_Fstring60_1_9*>;
+
+  template class backend_functor_common<sd_charwidth_type*(*)(),sd_charwidth_type*>;
+  template class backend_functor<sd_charwidth_type*(*)(),sd_charwidth_type*>;
+
+  template class backend_functor_common<void(*)(int&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&),void,int&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&>;
+  template class backend_functor<void(*)(int&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&),void,int&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&>;
+
+  template class backend_functor_common<void(*)(int&,double(&)[1000],double(&)[1000],int&,double(&)[1000],double(&)[1000],int&,double(&)[1000]),void,int&,double(&)[1000],double(&)[1000],int&,double(&)[1000],double(&)[1000],int&,double(&)[1000]>;
+  template class backend_functor<void(*)(int&,double(&)[1000],double(&)[1000],int&,double(&)[1000],double(&)[1000],int&,double(&)[1000]),void,int&,double(&)[1000],double(&)[1000],int&,double(&)[1000],double(&)[1000],int&,double(&)[1000]>;
+
+  template class backend_functor_common<void(*)(double(*)(int&),int&),void,double(*)(int&),int&>;
+  template class backend_functor<void(*)(double(*)(int&),int&),void,double(*)(int&),int&>;
+
+  template class backend_functor_common<libFarrayTest_CB_type*(*)(),libFarrayTest_CB_type*>;
+  template class backend_functor<libFarrayTest_CB_type*(*)(),libFarrayTest_CB_type*>;
+
+  template class backend_functor_common<gambit_inflation_observables(*)(int&,int&,int&,int&,double*,double*,double*,double&,double&,double&,int&,double&,double&,int&,int&,int&,int&),gambit_inflation_observables,int&,int&,int&,int&,double*,double*,double*,double&,double&,double&,int&,double&,double&,int&,int&,int&,int&>;
+  template class backend_functor<gambit_inflation_observables(*)(int&,int&,int&,int&,double*,double*,double*,double&,double&,double&,int&,double&,double&,int&,int&,int&,int&),gambit_inflation_observables,int&,int&,int&,int&,double*,double*,double*,double&,double&,double&,int&,double&,double&,int&,int&,int&,int&>;
+
+  template class backend_functor_common<obscura_1_1_0::obscura::DM_Detector_Ionization_Migdal(*)(),obscura_1_1_0::obscura::DM_Detector_Ionization_Migdal>;
+  template class backend_functor<obscura_1_1_0::obscura::DM_Detector_Ionization_Migdal(*)(),obscura_1_1_0::obscura::DM_Detector_Ionization_Migdal>;
+
+  template class backend_functor_common<sd_sntauwidth_type*(*)(),sd_sntauwidth_type*>;
+  template class backend_functor<sd_sntauwidth_type*(*)(),sd_sntauwidth_type*>;
+
+  template class backend_functor_common<DS_VRTXS*(*)(),DS_VRTXS*>;
+  template class backend_functor<DS_VRTXS*(*)(),DS_VRTXS*>;
+
+  template class backend_functor_common<DS_RDLUN*(*)(),DS_RDLUN*>;
+  template class backend_functor<DS_RDLUN*(*)(),DS_RDLUN*>;
+
+  template class backend_functor_common<Contur_output(*)(std::string&,std::vector<std::string>&),Contur_output,std::string&,std::vector<std::string>&>;
+  template class backend_functor<Contur_output(*)(std::string&,std::vector<std::string>&),Contur_output,std::string&,std::vector<std::string>&>;
+
+  template class backend_functor_common<double(*)(const double&,const double&,const double&),double,const double&,const double&,const double&>;
+  template class backend_functor<double(*)(const double&,const double&,const double&),double,const double&,const double&,const double&>;
+
+  template class backend_functor_common<widtha_hdec_type*(*)(),widtha_hdec_type*>;
+  template class backend_functor<widtha_hdec_type*(*)(),widtha_hdec_type*>;
+
+  template class backend_functor_common<double(*)(double,double,int,int),double,double,double,int,int>;
+  template class backend_functor<double(*)(double,double,int,int),double,double,double,int,int>;
+
+  template class backend_functor_common<void(*)(int&,int&,int&,int&),void,int&,int&,int&,int&>;
+  template class backend_functor<void(*)(int&,int&,int&,int&),void,int&,int&,int&,int&>;
+
+  template class backend_functor_common<void(*)(Fstring<500>&),void,Fstring<500>&>;
+  template class backend_functor<void(*)(Fstring<500>&),void,Fstring<500>&>;
+
+  template class backend_functor_common<char*(*)(int),char*,int>;
+  template class backend_functor<char*(*)(int),char*,int>;
+
+  template class backend_functor_common<void(*)(double(*)(double&),double&,double&,int&,int&,int&),void,double(*)(double&),double&,double&,int&,int&,int&>;
+  template class backend_functor<void(*)(double(*)(double&),double&,double&,int&,int&,int&),void,double(*)(double&),double&,double&,int&,int&,int&>;
+
+  template class backend_functor_common<int(*)(AlterBBN_2_2::relicparam*,double*),int,AlterBBN_2_2::relicparam*,double*>;
+  template class backend_functor<int(*)(AlterBBN_2_2::relicparam*,double*),int,AlterBBN_2_2::relicparam*,double*>;
+
+  template class backend_functor_common<void(*)(char**,int*,double**,const parameters*,const nuisance*),void,char**,int*,double**,const parameters*,const nuisance*>;
+  template class backend_functor<void(*)(char**,int*,double**,const parameters*,const nuisance*),void,char**,int*,double**,const parameters*,const nuisance*>;
+
+  template class backend_functor_common<dblarr*(*)(),dblarr*>;
+  template class backend_functor<dblarr*(*)(),dblarr*>;
+
+  template class backend_functor_common<double(*)(const int&,const int&),double,const int&,const int&>;
+  template class backend_functor<double(*)(const int&,const int&),double,const int&,const int&>;
+
+  template class backend_functor_common<int(*)(const int&,const int&),int,const int&,const int&>;
+  template class backend_functor<int(*)(const int&,const int&),int,const int&,const int&>;
+
+  template class backend_functor_common<void(*)(int&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_creal&,fh_creal&,fh_creal&),void,int&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_creal&,fh_creal&,fh_creal&>;
+  template class backend_functor<void(*)(int&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_creal&,fh_creal&,fh_creal&),void,int&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_creal&,fh_creal&,fh_creal&>;
+
+  template class backend_functor_common<bool(*)(const std::string&),bool,const std::string&>;
+  template class backend_functor<bool(*)(const std::string&),bool,const std::string&>;
+
+  template class backend_functor_common<double(*)(const gm2calc_1_3_0::gm2calc::MSSMNoFV_onshell&),double,const gm2calc_1_3_0::gm2calc::MSSMNoFV_onshell&>;
+  template class backend_functor<double(*)(const gm2calc_1_3_0::gm2calc::MSSMNoFV_onshell&),double,const gm2calc_1_3_0::gm2calc::MSSMNoFV_onshell&>;
+
+  template class backend_functor_common<void(*)(const double&,const double&,const int&,const int&,const int&,const double&,double&),void,const double&,const double&,const int&,const int&,const int&,const double&,double&>;
+  template class backend_functor<void(*)(const double&,const double&,const int&,const int&,const int&,const double&,double&),void,const double&,const double&,const int&,const int&,const int&,const double&,double&>;
+
+  template class backend_functor_common<DS_an_how*(*)(),DS_an_how*>;
+  template class backend_functor<DS_an_how*(*)(),DS_an_how*>;
+
+  template class backend_functor_common<void(*)(const int&,const double&,const double&,const double&,const double&),void,const int&,const double&,const double&,const double&,const double&>;
+  template class backend_functor<void(*)(const int&,const double&,const double&,const double&,const double&),void,const int&,const double&,const double&,const double&,const double&>;
+
+  template class backend_functor_common<double(*)(std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double,double,double),double,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double,double,double>;
+  template class backend_functor<double(*)(std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double,double,double),double,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double,double,double>;
+
+  template class backend_functor_common<wisfer_hdec_type*(*)(),wisfer_hdec_type*>;
+  template class backend_functor<wisfer_hdec_type*(*)(),wisfer_hdec_type*>;
+
+  template class backend_functor_common<double(*)(const double&,const double&,const double&,const double&),double,const double&,const double&,const double&,const double&>;
+  template class backend_functor<double(*)(const double&,const double&,const double&,const double&),double,const double&,const double&,const double&,const double&>;
+
+  template class backend_functor_common<void(*)(const int&,const int&,double&,double&),void,const int&,const int&,double&,double&>;
+  template class backend_functor<void(*)(const int&,const int&,double&,double&),void,const int&,const int&,double&,double&>;
+
+  template class backend_functor_common<DS5_SMCUSEFUL*(*)(),DS5_SMCUSEFUL*>;
+  template class backend_functor<DS5_SMCUSEFUL*(*)(),DS5_SMCUSEFUL*>;
+
+  template class backend_functor_common<void(*)(std::complex<double>*,std::complex<double>*,std::complex<double>*,double,std::complex<double>*,std::complex<double>*,std::complex<double>*,double,const parameters*),void,std::complex<double>*,std::complex<double>*,std::complex<double>*,double,std::complex<double>*,std::complex<double>*,std::complex<double>*,double,const parameters*>;
+  template class backend_functor<void(*)(std::complex<double>*,std::complex<double>*,std::complex<double>*,double,std::complex<double>*,std::complex<double>*,std::complex<double>*,double,const parameters*),void,std::complex<double>*,std::complex<double>*,std::complex<double>*,double,std::complex<double>*,std::complex<double>*,std::complex<double>*,double,const parameters*>;
+
+  template class backend_functor_common<MicrOmegas::aChannel**(*)(),MicrOmegas::aChannel**>;
+  template class backend_functor<MicrOmegas::aChannel**(*)(),MicrOmegas::aChannel**>;
+
+  template class backend_functor_common<void(*)(Farray<Fcomplex16,1,27,1,2>&,int&),void,Farray<Fcomplex16,1,27,1,2>&,int&>;
+  template class backend_functor<void(*)(Farray<Fcomplex16,1,27,1,2>&,int&),void,Farray<Fcomplex16,1,27,1,2>&,int&>;
+
+  template class backend_functor_common<DS_SCKM*(*)(),DS_SCKM*>;
+  template class backend_functor<DS_SCKM*(*)(),DS_SCKM*>;
+
+  template class backend_functor_common<void(*)(const char*,int&,int),void,const char*,int&,int>;
+  template class backend_functor<void(*)(const char*,int&,int),void,const char*,int&,int>;
+
+  template class backend_functor_common<void(*)(const double&,const int&,const int&),void,const double&,const int&,const int&>;
+  template class backend_functor<void(*)(const double&,const int&,const int&),void,const double&,const int&,const int&>;
+
+  template class backend_functor_common<void(*)(std::complex<double>*,std::complex<double>*,double,std::complex<double>*,std::complex<double>*,double,const parameters*),void,std::complex<double>*,std::complex<double>*,double,std::complex<double>*,std::complex<double>*,double,const parameters*>;
+  template class backend_functor<void(*)(std::complex<double>*,std::complex<double>*,double,std::complex<double>*,std::complex<double>*,double,const parameters*),void,std::complex<double>*,std::complex<double>*,double,std::complex<double>*,std::complex<double>*,double,const parameters*>;
+
+  template class backend_functor_common<Farray_Fcomplex16_1_3*(*)(),Farray_Fcomplex16_1_3*>;
+  template class backend_functor<Farray_Fcomplex16_1_3*(*)(),Farray_Fcomplex16_1_3*>;
+
+  template class backend_functor_common<double(*)(const int&,const double&),double,const int&,const double&>;
+  template class backend_functor<double(*)(const int&,const double&),double,const int&,const double&>;
+
+  template class backend_functor_common<void(*)(Farray<Fcomplex8,1,27,1,2>&,int&),void,Farray<Fcomplex8,1,27,1,2>&,int&>;
+  template class backend_functor<void(*)(Farray<Fcomplex8,1,27,1,2>&,int&),void,Farray<Fcomplex8,1,27,1,2>&,int&>;
+
+  template class backend_functor_common<python_variable<int>*(*)(),python_variable<int>*>;
+  template class backend_functor<python_variable<int>*(*)(),python_variable<int>*>;
+
+  template class backend_functor_common<double(*)(const int&),double,const int&>;
+  template class backend_functor<double(*)(const int&),double,const int&>;
+
+  template class backend_functor_common<Farray_particle23_1_2*(*)(),Farray_particle23_1_2*>;
+  template class backend_functor<Farray_particle23_1_2*(*)(),Farray_particle23_1_2*>;
+
+  template class backend_functor_common<double(*)(const MList<MReal>&),double,const MList<MReal>&>;
+  template class backend_functor<double(*)(const MList<MReal>&),double,const MList<MReal>&>;
+
+  template class backend_functor_common<void(*)(const DecayTable&),void,const DecayTable&>;
+  template class backend_functor<void(*)(const DecayTable&),void,const DecayTable&>;
+
+  template class backend_functor_common<void(*)(int&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&),void,int&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&>;
+  template class backend_functor<void(*)(int&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&),void,int&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&,fh_creal&>;
+
+  template class backend_functor_common<sd_leshouches1_type*(*)(),sd_leshouches1_type*>;
+  template class backend_functor<sd_leshouches1_type*(*)(),sd_leshouches1_type*>;
+
+  template class backend_functor_common<sd_stop4body_type*(*)(),sd_stop4body_type*>;
+  template class backend_functor<sd_stop4body_type*(*)(),sd_stop4body_type*>;
+
+  template class backend_functor_common<susyhitin_type*(*)(),susyhitin_type*>;
+  template class backend_functor<susyhitin_type*(*)(),susyhitin_type*>;
+
+  template class backend_functor_common<sd_neut2body_type*(*)(),sd_neut2body_type*>;
+  template class backend_functor<sd_neut2body_type*(*)(),sd_neut2body_type*>;
+
+  template class backend_functor_common<void(*)(char*,int&,char*,int&),void,char*,int&,char*,int&>;
+  template class backend_functor<void(*)(char*,int&,char*,int&),void,char*,int&,char*,int&>;
+
+  template class backend_functor_common<void(*)(Farray<Fdouble,1,3>&,int&,Fdouble(*)(Farray<Fdouble,1,3>&)),void,Farray<Fdouble,1,3>&,int&,Fdouble(*)(Farray<Fdouble,1,3>&)>;
+  template class backend_functor<void(*)(Farray<Fdouble,1,3>&,int&,Fdouble(*)(Farray<Fdouble,1,3>&)),void,Farray<Fdouble,1,3>&,int&,Fdouble(*)(Farray<Fdouble,1,3>&)>;
+
+  template class backend_functor_common<double(*)(double&,std::vector<std::string>,double&),double,double&,std::vector<std::string>,double&>;
+  template class backend_functor<double(*)(double&,std::vector<std::string>,double&),double,double&,std::vector<std::string>,double&>;
+
+  template class backend_functor_common<std::vector<double>(*)(std::string),std::vector<double>,std::string>;
+  template class backend_functor<std::vector<double>(*)(std::string),std::vector<double>,std::string>;
+
+  template class backend_functor_common<double(*)(const parameters*,double,double),double,const parameters*,double,double>;
+  template class backend_functor<double(*)(const parameters*,double,double),double,const parameters*,double,double>;
+
+  template class backend_functor_common<double(*)(int,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double),double,int,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double>;
+  template class backend_functor<double(*)(int,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double),double,int,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double>;
+
+  template class backend_functor_common<sd_neut3body_type*(*)(),sd_neut3body_type*>;
+  template class backend_functor<sd_neut3body_type*(*)(),sd_neut3body_type*>;
+
+  template class backend_functor_common<DS_DSANCOANN*(*)(),DS_DSANCOANN*>;
+  template class backend_functor<DS_DSANCOANN*(*)(),DS_DSANCOANN*>;
+
+  template class backend_functor_common<std::vector<str>(*)(),std::vector<str>>;
+  template class backend_functor<std::vector<str>(*)(),std::vector<str>>;
+
+  template class backend_functor_common<DS_RDPADD*(*)(),DS_RDPADD*>;
+  template class backend_functor<DS_RDPADD*(*)(),DS_RDPADD*>;
+
+  template class backend_functor_common<Farray_Freal8_1_2_1_2*(*)(),Farray_Freal8_1_2_1_2*>;
+  template class backend_functor<Farray_Freal8_1_2_1_2*(*)(),Farray_Freal8_1_2_1_2*>;
+
+  template class backend_functor_common<sd_topwidth_type*(*)(),sd_topwidth_type*>;
+  template class backend_functor<sd_topwidth_type*(*)(),sd_topwidth_type*>;
+
+  template class backend_functor_common<void(*)(AlterBBN_2_2::relicparam*,map_str_dbl&),void,AlterBBN_2_2::relicparam*,map_str_dbl&>;
+  template class backend_functor<void(*)(AlterBBN_2_2::relicparam*,map_str_dbl&),void,AlterBBN_2_2::relicparam*,map_str_dbl&>;
+
+  template class backend_functor_common<sd_char3body_type*(*)(),sd_char3body_type*>;
+  template class backend_functor<sd_char3body_type*(*)(),sd_char3body_type*>;
+
+  template class backend_functor_common<DS_RDPARS*(*)(),DS_RDPARS*>;
+  template class backend_functor<DS_RDPARS*(*)(),DS_RDPARS*>;
+
+  template class backend_functor_common<sd_sup2body_type*(*)(),sd_sup2body_type*>;
+  template class backend_functor<sd_sup2body_type*(*)(),sd_sup2body_type*>;
+
+  template class backend_functor_common<double(*)(double&,double&,int&,char*,int&,int&,int&),double,double&,double&,int&,char*,int&,int&,int&>;
+  template class backend_functor<double(*)(double&,double&,int&,char*,int&,int&,int&),double,double&,double&,int&,char*,int&,int&,int&>;
+
+  template class backend_functor_common<void(*)(const char&),void,const char&>;
+  template class backend_functor<void(*)(const char&),void,const char&>;
+
+  template class backend_functor_common<gambit_inflation_observables(*)(int&,int&,int&,int&,double*,double*,double*,double&,double&,double&,int&,int&,int&,int&),gambit_inflation_observables,int&,int&,int&,int&,double*,double*,double*,double&,double&,double&,int&,int&,int&,int&>;
+  template class backend_functor<gambit_inflation_observables(*)(int&,int&,int&,int&,double*,double*,double*,double&,double&,double&,int&,int&,int&,int&),gambit_inflation_observables,int&,int&,int&,int&,double*,double*,double*,double&,double&,double&,int&,int&,int&,int&>;
+
+  template class backend_functor_common<void(*)(int&,int&,const char*),void,int&,int&,const char*>;
+  template class backend_functor<void(*)(int&,int&,const char*),void,int&,int&,const char*>;
+
+  template class backend_functor_common<sd_selectron_type*(*)(),sd_selectron_type*>;
+  template class backend_functor<sd_selectron_type*(*)(),sd_selectron_type*>;
+
+  template class backend_functor_common<fptr_void*(*)(),fptr_void*>;
+  template class backend_functor<fptr_void*(*)(),fptr_void*>;
+
+  template class backend_functor_common<obscura_1_1_0::obscura::DM_Detector_Ionization_ER(*)(),obscura_1_1_0::obscura::DM_Detector_Ionization_ER>;
+  template class backend_functor<obscura_1_1_0::obscura::DM_Detector_Ionization_ER(*)(),obscura_1_1_0::obscura::DM_Detector_Ionization_ER>;
+
+  template class backend_functor_common<map_str_pyobj(*)(pybind11::object&,map_str_str&),map_str_pyobj,pybind11::object&,map_str_str&>;
+  template class backend_functor<map_str_pyobj(*)(pybind11::object&,map_str_str&),map_str_pyobj,pybind11::object&,map_str_str&>;
+
+  template class backend_functor_common<void(*)(const double&,const double&),void,const double&,const double&>;
+  template class backend_functor<void(*)(const double&,const double&),void,const double&,const double&>;
+
+  template class backend_functor_common<DS_MSSMTYPE*(*)(),DS_MSSMTYPE*>;
+  template class backend_functor<DS_MSSMTYPE*(*)(),DS_MSSMTYPE*>;
+
+  template class backend_functor_common<DS5_WIDTHS*(*)(),DS5_WIDTHS*>;
+  template class backend_functor<DS5_WIDTHS*(*)(),DS5_WIDTHS*>;
+
+  template class backend_functor_common<void(*)(Fstring<20>&,Fstring<20>&),void,Fstring<20>&,Fstring<20>&>;
+  template class backend_functor<void(*)(Fstring<20>&,Fstring<20>&),void,Fstring<20>&,Fstring<20>&>;
+
+  template class backend_functor_common<DS_COUPLINGCONSTANTS61*(*)(),DS_COUPLINGCONSTANTS61*>;
+  template class backend_functor<DS_COUPLINGCONSTANTS61*(*)(),DS_COUPLINGCONSTANTS61*>;
+
+  template class backend_functor_common<sd_gluiwidth_type*(*)(),sd_gluiwidth_type*>;
+  template class backend_functor<sd_gluiwidth_type*(*)(),sd_gluiwidth_type*>;
+
+  template class backend_functor_common<sd_stop2body_type*(*)(),sd_stop2body_type*>;
+  template class backend_functor<sd_stop2body_type*(*)(),sd_stop2body_type*>;
+
+  template class backend_functor_common<int(*)(),int>;
+  template class backend_functor<int(*)(),int>;
+
+  template class backend_functor_common<sd_sbot3body_type*(*)(),sd_sbot3body_type*>;
+  template class backend_functor<sd_sbot3body_type*(*)(),sd_sbot3body_type*>;
+
+  template class backend_functor_common<void(*)(int,std::complex<double>*,std::complex<double>*,double,double,const parameters*),void,int,std::complex<double>*,std::complex<double>*,double,double,const parameters*>;
+  template class backend_functor<void(*)(int,std::complex<double>*,std::complex<double>*,double,double,const parameters*),void,int,std::complex<double>*,std::complex<double>*,double,double,const parameters*>;
+
+  template class backend_functor_common<Farray_Fcomplex16_1_2_1_2*(*)(),Farray_Fcomplex16_1_2_1_2*>;
+  template class backend_functor<Farray_Fcomplex16_1_2_1_2*(*)(),Farray_Fcomplex16_1_2_1_2*>;
+
+  template class backend_functor_common<double(*)(double,double*),double,double,double*>;
+  template class backend_functor<double(*)(double,double*),double,double,double*>;
+
+  template class backend_functor_common<void(*)(PyDict&),void,PyDict&>;
+  template class backend_functor<void(*)(PyDict&),void,PyDict&>;
+
+  template class backend_functor_common<std::vector<std::vector<str>>(*)(),std::vector<std::vector<str>>>;
+  template class backend_functor<std::vector<std::vector<str>>(*)(),std::vector<std::vector<str>>>;
+
+  template class backend_functor_common<sd_sel2body_type*(*)(),sd_sel2body_type*>;
+  template class backend_functor<sd_sel2body_type*(*)(),sd_sel2body_type*>;
+
+  template class backend_functor_common<void(*)(int&,fh_real&,Farray<fh_real,1,52>&),void,int&,fh_real&,Farray<fh_real,1,52>&>;
+  template class backend_functor<void(*)(int&,fh_real&,Farray<fh_real,1,52>&),void,int&,fh_real&,Farray<fh_real,1,52>&>;
+
+  template class backend_functor_common<void(*)(bool,int,int,double),void,bool,int,int,double>;
+  template class backend_functor<void(*)(bool,int,int,double),void,bool,int,int,double>;
+
+  template class backend_functor_common<double(*)(int,int,double,double,double*,const parameters*),double,int,int,double,double,double*,const parameters*>;
+  template class backend_functor<double(*)(int,int,double,double,double*,const parameters*),double,int,int,double,double,double*,const parameters*>;
+
+  template class backend_functor_common<void(*)(Farray<Fdouble,0,6>&,int&,int&,int&,double&,int&,Fstring<2>&,int&,int&,int&,int&,Farray<Fdouble,1,20>&,Farray<Fdouble,0,99>&,Farray<Fdouble,1,2,1,2>&,Farray<Fdouble,1,2,1,2>&,Farray<Fdouble,1,4,1,4>&,Farray<Fdouble,1,2,1,2>&,Farray<Fdouble,1,2,1,2>&,Farray<Fdouble,1,2,1,2>&),void,Farray<Fdouble,0,6>&,int&,int&,int&,double&,int&,Fstring<2>&,int&,int&,int&,int&,Farray<Fdouble,1,20>&,Farray<Fdouble,0,99>&,Farray<Fdouble,1,2,1,2>&,Farray<Fdouble,1,2,1,2>&,Farray<Fdouble,1,4,1,4>&,Farray<Fdouble,1,2,1,2>&,Farray<Fdouble,1,2,1,2>&,Farray<Fdouble,1,2,1,2>&>;
+  template class backend_functor<void(*)(Farray<Fdouble,0,6>&,int&,int&,int&,double&,int&,Fstring<2>&,int&,int&,int&,int&,Farray<Fdouble,1,20>&,Farray<Fdouble,0,99>&,Farray<Fdouble,1,2,1,2>&,Farray<Fdouble,1,2,1,2>&,Farray<Fdouble,1,4,1,4>&,Farray<Fdouble,1,2,1,2>&,Farray<Fdouble,1,2,1,2>&,Farray<Fdouble,1,2,1,2>&),void,Farray<Fdouble,0,6>&,int&,int&,int&,double&,int&,Fstring<2>&,int&,int&,int&,int&,Farray<Fdouble,1,20>&,Farray<Fdouble,0,99>&,Farray<Fdouble,1,2,1,2>&,Farray<Fdouble,1,2,1,2>&,Farray<Fdouble,1,4,1,4>&,Farray<Fdouble,1,2,1,2>&,Farray<Fdouble,1,2,1,2>&,Farray<Fdouble,1,2,1,2>&>;
+
+  template class backend_functor_common<void(*)(clik_object**),void,clik_object**>;
+  template class backend_functor<void(*)(clik_object**),void,clik_object**>;
+
+  template class backend_functor_common<Farray_particle2_1_6*(*)(),Farray_particle2_1_6*>;
+  template class backend_functor<Farray_particle2_1_6*(*)(),Farray_particle2_1_6*>;
+
+  template class backend_functor_common<double(*)(std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double),double,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double>;
+  template class backend_functor<double(*)(std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double),double,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double>;
+
+  template class backend_functor_common<pybind11::list(*)(const bool&,const std::string&,const mat_dbl&),pybind11::list,const bool&,const std::string&,const mat_dbl&>;
+  template class backend_functor<pybind11::list(*)(const bool&,const std::string&,const mat_dbl&),pybind11::list,const bool&,const std::string&,const mat_dbl&>;
+
+  template class backend_functor_common<sd_char2body_type*(*)(),sd_char2body_type*>;
+  template class backend_functor<sd_char2body_type*(*)(),sd_char2body_type*>;
+
+  template class backend_functor_common<void(*)(const SLHAstruct &),void,const SLHAstruct &>;
+  template class backend_functor<void(*)(const SLHAstruct &),void,const SLHAstruct &>;
+
+  template class backend_functor_common<void(*)(std::string&,std::string&),void,std::string&,std::string&>;
+  template class backend_functor<void(*)(std::string&,std::string&),void,std::string&,std::string&>;
+
+  template class backend_functor_common<Farray_Fstring60_1_31*(*)(),Farray_Fstring60_1_31*>;
+  template class backend_functor<Farray_Fstring60_1_31*(*)(),Farray_Fstring60_1_31*>;
+
+  template class backend_functor_common<double(*)(int),double,int>;
+  template class backend_functor<double(*)(int),double,int>;
+
+  template class backend_functor_common<double(*)(double(*)(double&),int&),double,double(*)(double&),int&>;
+  template class backend_functor<double(*)(double(*)(double&),int&),double,double(*)(double&),int&>;
+
+  template class backend_functor_common<DS_RDSWITCH*(*)(),DS_RDSWITCH*>;
+  template class backend_functor<DS_RDSWITCH*(*)(),DS_RDSWITCH*>;
+
+  template class backend_functor_common<double(*)(),double>;
+  template class backend_functor<double(*)(),double>;
+
+  template class backend_functor_common<void(*)(char*,double),void,char*,double>;
+  template class backend_functor<void(*)(char*,double),void,char*,double>;
+
+  template class backend_functor_common<DS5_SCKM*(*)(),DS5_SCKM*>;
+  template class backend_functor<DS5_SCKM*(*)(),DS5_SCKM*>;
+
+  template class backend_functor_common<Farray_Fcomplex16_1_2*(*)(),Farray_Fcomplex16_1_2*>;
+  template class backend_functor<Farray_Fcomplex16_1_2*(*)(),Farray_Fcomplex16_1_2*>;
+
+  template class backend_functor_common<double(*)(int&,double&,double&),double,int&,double&,double&>;
+  template class backend_functor<double(*)(int&,double&,double&),double,int&,double&,double&>;
+
+  template class backend_functor_common<double(*)(double&),double,double&>;
+  template class backend_functor<double(*)(double&),double,double&>;
+
+  template class backend_functor_common<PyDict(*)(PyDict&,PyDict&),PyDict,PyDict&,PyDict&>;
+  template class backend_functor<PyDict(*)(PyDict&,PyDict&),PyDict,PyDict&,PyDict&>;
+
+  template class backend_functor_common<size_t(*)(),size_t>;
+  template class backend_functor<size_t(*)(),size_t>;
+
+  template class backend_functor_common<double(*)(double&,std::string,double&),double,double&,std::string,double&>;
+  template class backend_functor<double(*)(double&,std::string,double&),double,double&,std::string,double&>;
+
+  template class backend_functor_common<DS_PACODES_MSSM*(*)(),DS_PACODES_MSSM*>;
+  template class backend_functor<DS_PACODES_MSSM*(*)(),DS_PACODES_MSSM*>;
+
+  template class backend_functor_common<double(*)(const parameters*),double,const parameters*>;
+  template class backend_functor<double(*)(const parameters*),double,const parameters*>;
+
+  template class backend_functor_common<std::string(*)(const std::string&),std::string,const std::string&>;
+  template class backend_functor<std::string(*)(const std::string&),std::string,const std::string&>;
+
+  template class backend_functor_common<Contur_output(*)(std::shared_ptr<std::ostringstream>,std::vector<std::string>&),Contur_output,std::shared_ptr<std::ostringstream>,std::vector<std::string>&>;
+  template class backend_functor<Contur_output(*)(std::shared_ptr<std::ostringstream>,std::vector<std::string>&),Contur_output,std::shared_ptr<std::ostringstream>,std::vector<std::string>&>;
+
+  template class backend_functor_common<int(*)(char*,double),int,char*,double>;
+  template class backend_functor<int(*)(char*,double),int,char*,double>;
+
+  template class backend_functor_common<sd_stopwidth_type*(*)(),sd_stopwidth_type*>;
+  template class backend_functor<sd_stopwidth_type*(*)(),sd_stopwidth_type*>;
+
+  template class backend_functor_common<void(*)(int&,int&),void,int&,int&>;
+  template class backend_functor<void(*)(int&,int&),void,int&,int&>;
+
+  template class backend_functor_common<numout*(*)(int,int,char*,char*,char*,char*),numout*,int,int,char*,char*,char*,char*>;
+  template class backend_functor<numout*(*)(int,int,char*,char*,char*,char*),numout*,int,int,char*,char*,char*,char*>;
+
+  template class backend_functor_common<double(*)(std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,double,double,const parameters*),double,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,double,double,const parameters*>;
+  template class backend_functor<double(*)(std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,double,double,const parameters*),double,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,double,double,const parameters*>;
+
+  template class backend_functor_common<void(*)(double&,double&,double&,double&,double&),void,double&,double&,double&,double&,double&>;
+  template class backend_functor<void(*)(double&,double&,double&,double&,double&),void,double&,double&,double&,double&,double&>;
+
+  template class backend_functor_common<void(*)(const SMInputs&),void,const SMInputs&>;
+  template class backend_functor<void(*)(const SMInputs&),void,const SMInputs&>;
+
+  template class backend_functor_common<DS_HMNOCLUE*(*)(),DS_HMNOCLUE*>;
+  template class backend_functor<DS_HMNOCLUE*(*)(),DS_HMNOCLUE*>;
+
+  template class backend_functor_common<sd_stau2body_type*(*)(),sd_stau2body_type*>;
+  template class backend_functor<sd_stau2body_type*(*)(),sd_stau2body_type*>;
+
+  template class backend_functor_common<void(*)(int&,int&,int&,int&,int&,int&,int&,int&,int&,int&,int&),void,int&,int&,int&,int&,int&,int&,int&,int&,int&,int&,int&>;
+  template class backend_functor<void(*)(int&,int&,int&,int&,int&,int&,int&,int&,int&,int&,int&),void,int&,int&,int&,int&,int&,int&,int&,int&,int&,int&,int&>;
+
+  template class backend_functor_common<DS_RDERRORS*(*)(),DS_RDERRORS*>;
+  template class backend_functor<DS_RDERRORS*(*)(),DS_RDERRORS*>;
+
+  template class backend_functor_common<void(*)(int&,int&,double&,int&),void,int&,int&,double&,int&>;
+  template class backend_functor<void(*)(int&,int&,double&,int&),void,int&,int&,double&,int&>;
+
+  template class backend_functor_common<int(*)(Spectrum&,const Finputs&),int,Spectrum&,const Finputs&>;
+  template class backend_functor<int(*)(Spectrum&,const Finputs&),int,Spectrum&,const Finputs&>;
+
+  template class backend_functor_common<sd_snel2body_type*(*)(),sd_snel2body_type*>;
+  template class backend_functor<sd_snel2body_type*(*)(),sd_snel2body_type*>;
+
+  template class backend_functor_common<void(*)(int&,bool&,bool&),void,int&,bool&,bool&>;
+  template class backend_functor<void(*)(int&,bool&,bool&),void,int&,bool&,bool&>;
+
+  template class backend_functor_common<double(*)(double&,double&,int&,int&,int&),double,double&,double&,int&,int&,int&>;
+  template class backend_functor<double(*)(double&,double&,int&,int&,int&),double,double&,double&,int&,int&,int&>;
+
+  template class backend_functor_common<void(*)(std::string&),void,std::string&>;
+  template class backend_functor<void(*)(std::string&),void,std::string&>;
+
+  template class backend_functor_common<DS_PACODES_MSSM61*(*)(),DS_PACODES_MSSM61*>;
+  template class backend_functor<DS_PACODES_MSSM61*(*)(),DS_PACODES_MSSM61*>;
+
+  template class backend_functor_common<double(*)(double(*)[10]),double,double(*)[10]>;
+  template class backend_functor<double(*)(double(*)[10]),double,double(*)[10]>;
+
+  template class backend_functor_common<DS_DDMSSMCOM*(*)(),DS_DDMSSMCOM*>;
+  template class backend_functor<DS_DDMSSMCOM*(*)(),DS_DDMSSMCOM*>;
+
+  template class backend_functor_common<void(*)(const int&,const int&,const int&,const double&),void,const int&,const int&,const int&,const double&>;
+  template class backend_functor<void(*)(const int&,const int&,const int&,const double&),void,const int&,const int&,const int&,const double&>;
+
+  template class backend_functor_common<void(*)(clik_object*,int*,clik_error**),void,clik_object*,int*,clik_error**>;
+  template class backend_functor<void(*)(clik_object*,int*,clik_error**),void,clik_object*,int*,clik_error**>;
+
+  template class backend_functor_common<double(*)(const bool&),double,const bool&>;
+  template class backend_functor<double(*)(const bool&),double,const bool&>;
+
+  template class backend_functor_common<gambit_inflation_observables(*)(int&,int&,int&,int&,double*,double*,double*,double&,double&,double&,int&,double&,double&,int&,int&,int&,int&,int&),gambit_inflation_observables,int&,int&,int&,int&,double*,double*,double*,double&,double&,double&,int&,double&,double&,int&,int&,int&,int&,int&>;
+  template class backend_functor<gambit_inflation_observables(*)(int&,int&,int&,int&,double*,double*,double*,double&,double&,double&,int&,double&,double&,int&,int&,int&,int&,int&),gambit_inflation_observables,int&,int&,int&,int&,double*,double*,double*,double&,double&,double&,int&,double&,double&,int&,int&,int&,int&,int&>;
+
+  template class backend_functor_common<DS_IBINTVARS*(*)(),DS_IBINTVARS*>;
+  template class backend_functor<DS_IBINTVARS*(*)(),DS_IBINTVARS*>;
+
+  template class backend_functor_common<map_str_dbl(*)(double&,map_str_dbl&,double&),map_str_dbl,double&,map_str_dbl&,double&>;
+  template class backend_functor<map_str_dbl(*)(double&,map_str_dbl&,double&),map_str_dbl,double&,map_str_dbl&,double&>;
+
+  template class backend_functor_common<double(*)(const double&,const double&,const double&,const int&,const int&,const int&,const int&,const int&,const int&,const char*,const int&,const int&,const int&),double,const double&,const double&,const double&,const int&,const int&,const int&,const int&,const int&,const int&,const char*,const int&,const int&,const int&>;
+  template class backend_functor<double(*)(const double&,const double&,const double&,const int&,const int&,const int&,const int&,const int&,const int&,const char*,const int&,const int&,const int&),double,const double&,const double&,const double&,const int&,const int&,const int&,const int&,const int&,const int&,const char*,const int&,const int&,const int&>;
+
+  template class backend_functor_common<DS_SMQUARKMASSES*(*)(),DS_SMQUARKMASSES*>;
+  template class backend_functor<DS_SMQUARKMASSES*(*)(),DS_SMQUARKMASSES*>;
+
+  template class backend_functor_common<sd_gluiloop_type*(*)(),sd_gluiloop_type*>;
+  template class backend_functor<sd_gluiloop_type*(*)(),sd_gluiloop_type*>;
+
+  template class backend_functor_common<double(*)(std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double),double,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double>;
+  template class backend_functor<double(*)(std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double),double,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double>;
+
+  template class backend_functor_common<int(*)(const int&),int,const int&>;
+  template class backend_functor<int(*)(const int&),int,const int&>;
+
+  template class backend_functor_common<void(*)(double(*)(double&),double&,int&),void,double(*)(double&),double&,int&>;
+  template class backend_functor<void(*)(double(*)(double&),double&,int&),void,double(*)(double&),double&,int&>;
+
+  template class backend_functor_common<clik_object*(*)(char*,clik_error**),clik_object*,char*,clik_error**>;
+  template class backend_functor<clik_object*(*)(char*,clik_error**),clik_object*,char*,clik_error**>;
+
+  template class backend_functor_common<sd_mbmb_type*(*)(),sd_mbmb_type*>;
+  template class backend_functor<sd_mbmb_type*(*)(),sd_mbmb_type*>;
+
+  template class backend_functor_common<sd_selwidth_type*(*)(),sd_selwidth_type*>;
+  template class backend_functor<sd_selwidth_type*(*)(),sd_selwidth_type*>;
+
+  template class backend_functor_common<void(*)(double*,double*),void,double*,double*>;
+  template class backend_functor<void(*)(double*,double*),void,double*,double*>;
+
+  template class backend_functor_common<void(*)(double*),void,double*>;
+  template class backend_functor<void(*)(double*),void,double*>;
+
+  template class backend_functor_common<double(*)(int&,int&,double&,int&,int&,int&),double,int&,int&,double&,int&,int&,int&>;
+  template class backend_functor<double(*)(int&,int&,double&,int&,int&,int&),double,int&,int&,double&,int&,int&,int&>;
+
+  template class backend_functor_common<int(*)(map_str_dbl&,double*),int,map_str_dbl&,double*>;
+  template class backend_functor<int(*)(map_str_dbl&,double*),int,map_str_dbl&,double*>;
+
+  template class backend_functor_common<double(*)(const double&,const double&),double,const double&,const double&>;
+  template class backend_functor<double(*)(const double&,const double&),double,const double&,const double&>;
+
+  template class backend_functor_common<void(*)(nuiscorr*,int,double**,char**,int),void,nuiscorr*,int,double**,char**,int>;
+  template class backend_functor<void(*)(nuiscorr*,int,double**,char**,int),void,nuiscorr*,int,double**,char**,int>;
+
+  template class backend_functor_common<void(*)(char*,clik_error*),void,char*,clik_error*>;
+  template class backend_functor<void(*)(char*,clik_error*),void,char*,clik_error*>;
+
+  template class backend_functor_common<wisusy_hdec_type*(*)(),wisusy_hdec_type*>;
+  template class backend_functor<wisusy_hdec_type*(*)(),wisusy_hdec_type*>;
+
+  template class backend_functor_common<sd_sntau2body_type*(*)(),sd_sntau2body_type*>;
+  template class backend_functor<sd_sntau2body_type*(*)(),sd_sntau2body_type*>;
+
+  template class backend_functor_common<int(*)(const std::string&),int,const std::string&>;
+  template class backend_functor<int(*)(const std::string&),int,const std::string&>;
+
+  template class backend_functor_common<double(*)(int,const std::vector<double>&,const std::vector<double>&),double,int,const std::vector<double>&,const std::vector<double>&>;
+  template class backend_functor<double(*)(int,const std::vector<double>&,const std::vector<double>&),double,int,const std::vector<double>&,const std::vector<double>&>;
+
+  template class backend_functor_common<double(*)(std::string&,std::string&,std::vector<str>&),double,std::string&,std::string&,std::vector<str>&>;
+  template class backend_functor<double(*)(std::string&,std::string&,std::vector<str>&),double,std::string&,std::string&,std::vector<str>&>;
+
+  template class backend_functor_common<DS_SMCOUPLING*(*)(),DS_SMCOUPLING*>;
+  template class backend_functor<DS_SMCOUPLING*(*)(),DS_SMCOUPLING*>;
+
+  template class backend_functor_common<Farray_Fcomplex16_1_4_1_4*(*)(),Farray_Fcomplex16_1_4_1_4*>;
+  template class backend_functor<Farray_Fcomplex16_1_4_1_4*(*)(),Farray_Fcomplex16_1_4_1_4*>;
+
+  template class backend_functor_common<std::vector<double>*(*)(),std::vector<double>*>;
+  template class backend_functor<std::vector<double>*(*)(),std::vector<double>*>;
+
+  template class backend_functor_common<DS5_PACODES*(*)(),DS5_PACODES*>;
+  template class backend_functor<DS5_PACODES*(*)(),DS5_PACODES*>;
+
+  template class backend_functor_common<void(*)(const int&,const int&,const int&),void,const int&,const int&,const int&>;
+  template class backend_functor<void(*)(const int&,const int&,const int&),void,const int&,const int&,const int&>;
+
+  template class backend_functor_common<DS_RDLIMS*(*)(),DS_RDLIMS*>;
+  template class backend_functor<DS_RDLIMS*(*)(),DS_RDLIMS*>;
+
+  template class backend_functor_common<DS5_SMRUSEFUL*(*)(),DS5_SMRUSEFUL*>;
+  template class backend_functor<DS5_SMRUSEFUL*(*)(),DS5_SMRUSEFUL*>;
+
+  template class backend_functor_common<void(*)(const int&,const double&,const double&),void,const int&,const double&,const double&>;
+  template class backend_functor<void(*)(const int&,const double&,const double&),void,const int&,const double&,const double&>;
+
+  template class backend_functor_common<double(*)(int,double*,double*,double*,double*,double*,double*,int*),double,int,double*,double*,double*,double*,double*,double*,int*>;
+  template class backend_functor<double(*)(int,double*,double*,double*,double*,double*,double*,int*),double,int,double*,double*,double*,double*,double*,double*,int*>;
+
+  template class backend_functor_common<DS_MSSMPAR*(*)(),DS_MSSMPAR*>;
+  template class backend_functor<DS_MSSMPAR*(*)(),DS_MSSMPAR*>;
+
+  template class backend_functor_common<int(*)(char*,int),int,char*,int>;
+  template class backend_functor<int(*)(char*,int),int,char*,int>;
+
+  template class backend_functor_common<void(*)(double*,double*,double*,double*,double*,double*,double*,double*),void,double*,double*,double*,double*,double*,double*,double*,double*>;
+  template class backend_functor<void(*)(double*,double*,double*,double*,double*,double*,double*,double*),void,double*,double*,double*,double*,double*,double*,double*,double*>;
+
+  template class backend_functor_common<double(*)(double,double,char*,char*,char*,char*),double,double,double,char*,char*,char*,char*>;
+  template class backend_functor<double(*)(double,double,char*,char*,char*,char*),double,double,double,char*,char*,char*,char*>;
+
+  template class backend_functor_common<int(*)(const std::string&,const std::string&),int,const std::string&,const std::string&>;
+  template class backend_functor<int(*)(const std::string&,const std::string&),int,const std::string&,const std::string&>;
+
+  template class backend_functor_common<Farray_Fstring60_1_10*(*)(),Farray_Fstring60_1_10*>;
+  template class backend_functor<Farray_Fstring60_1_10*(*)(),Farray_Fstring60_1_10*>;
+
+  template class backend_functor_common<void(*)(int&,Farray<Fdouble,1,35>&,Farray<Fdouble,1,35>&),void,int&,Farray<Fdouble,1,35>&,Farray<Fdouble,1,35>&>;
+  template class backend_functor<void(*)(int&,Farray<Fdouble,1,35>&,Farray<Fdouble,1,35>&),void,int&,Farray<Fdouble,1,35>&,Farray<Fdouble,1,35>&>;
+
+  template class backend_functor_common<int(*)(map_str_dbl&,double*,double*),int,map_str_dbl&,double*,double*>;
+  template class backend_functor<int(*)(map_str_dbl&,double*,double*),int,map_str_dbl&,double*,double*>;
+
+  template class backend_functor_common<void(*)(int,obsname*,int,double*,double*,const nuisance*,char**,const parameters*),void,int,obsname*,int,double*,double*,const nuisance*,char**,const parameters*>;
+  template class backend_functor<void(*)(int,obsname*,int,double*,double*,const nuisance*,char**,const parameters*),void,int,obsname*,int,double*,double*,const nuisance*,char**,const parameters*>;
+
+  template class backend_functor_common<double(*)(std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double),double,std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double>;
+  template class backend_functor<double(*)(std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double),double,std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double>;
+
+  template class backend_functor_common<sd_stauwidth_type*(*)(),sd_stauwidth_type*>;
+  template class backend_functor<sd_stauwidth_type*(*)(),sd_stauwidth_type*>;
+
+  template class backend_functor_common<Farray_Fstring60_1_25*(*)(),Farray_Fstring60_1_25*>;
+  template class backend_functor<Farray_Fstring60_1_25*(*)(),Farray_Fstring60_1_25*>;
+
+  template class backend_functor_common<double(*)(const double&,const int&,void*&),double,const double&,const int&,void*&>;
+  template class backend_functor<double(*)(const double&,const int&,void*&),double,const double&,const int&,void*&>;
+
+  template class backend_functor_common<flavviolation_type*(*)(),flavviolation_type*>;
+  template class backend_functor<flavviolation_type*(*)(),flavviolation_type*>;
+
+  template class backend_functor_common<DS_RDDOF*(*)(),DS_RDDOF*>;
+  template class backend_functor<DS_RDDOF*(*)(),DS_RDDOF*>;
+
+  template class backend_functor_common<int(*)(const bool&),int,const bool&>;
+  template class backend_functor<int(*)(const bool&),int,const bool&>;
+
+  template class backend_functor_common<pybind11::object(*)(),pybind11::object>;
+  template class backend_functor<pybind11::object(*)(),pybind11::object>;
+
+  template class backend_functor_common<DS_COUPLINGCONSTANTS*(*)(),DS_COUPLINGCONSTANTS*>;
+  template class backend_functor<DS_COUPLINGCONSTANTS*(*)(),DS_COUPLINGCONSTANTS*>;
+
+  template class backend_functor_common<sd_snelwidth_type*(*)(),sd_snelwidth_type*>;
+  template class backend_functor<sd_snelwidth_type*(*)(),sd_snelwidth_type*>;
+
+  template class backend_functor_common<void(*)(int&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&,int&),void,int&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&,int&>;
+  template class backend_functor<void(*)(int&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&,int&),void,int&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&,int&>;
+
+  template class backend_functor_common<DS5_MSPCTM*(*)(),DS5_MSPCTM*>;
+  template class backend_functor<DS5_MSPCTM*(*)(),DS5_MSPCTM*>;
+
+  template class backend_functor_common<double(*)(double,double,std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double),double,double,double,std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double>;
+  template class backend_functor<double(*)(double,double,std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double),double,double,double,std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double>;
+
+  template class backend_functor_common<double(*)(double&,int&,int&,int&),double,double&,int&,int&,int&>;
+  template class backend_functor<double(*)(double&,int&,int&,int&),double,double&,int&,int&,int&>;
+
+  template class backend_functor_common<void(*)(int,std::complex<double>*,std::complex<double>*,std::complex<double>*,double,const parameters*),void,int,std::complex<double>*,std::complex<double>*,std::complex<double>*,double,const parameters*>;
+  template class backend_functor<void(*)(int,std::complex<double>*,std::complex<double>*,std::complex<double>*,double,const parameters*),void,int,std::complex<double>*,std::complex<double>*,std::complex<double>*,double,const parameters*>;
+
+  template class backend_functor_common<sd_stop3body_type*(*)(),sd_stop3body_type*>;
+  template class backend_functor<sd_stop3body_type*(*)(),sd_stop3body_type*>;
+
+  template class backend_functor_common<void(*)(const char*,int),void,const char*,int>;
+  template class backend_functor<void(*)(const char*,int),void,const char*,int>;
+
+  template class backend_functor_common<Fstring<15>*(*)(),Fstring<15>*>;
+  template class backend_functor<Fstring<15>*(*)(),Fstring<15>*>;
+
+  template class backend_functor_common<DS_MSSMIUSEFUL*(*)(),DS_MSSMIUSEFUL*>;
+  template class backend_functor<DS_MSSMIUSEFUL*(*)(),DS_MSSMIUSEFUL*>;
+
+  template class backend_functor_common<DS5_COUPLINGCONSTANTS*(*)(),DS5_COUPLINGCONSTANTS*>;
+  template class backend_functor<DS5_COUPLINGCONSTANTS*(*)(),DS5_COUPLINGCONSTANTS*>;
+
+  template class backend_functor_common<Fdouble_complex*(*)(),Fdouble_complex*>;
+  template class backend_functor<Fdouble_complex*(*)(),Fdouble_complex*>;
+
+  template class backend_functor_common<sd_char2bodygrav_type*(*)(),sd_char2bodygrav_type*>;
+  template class backend_functor<sd_char2bodygrav_type*(*)(),sd_char2bodygrav_type*>;
+
+  template class backend_functor_common<map_str_dbl(*)(const PID_pair&,const Options&),map_str_dbl,const PID_pair&,const Options&>;
+  template class backend_functor<map_str_dbl(*)(const PID_pair&,const Options&),map_str_dbl,const PID_pair&,const Options&>;
+
+  template class backend_functor_common<Farray_particle2_1_2*(*)(),Farray_particle2_1_2*>;
+  template class backend_functor<Farray_particle2_1_2*(*)(),Farray_particle2_1_2*>;
+
+  template class backend_functor_common<DS_PMASSES*(*)(),DS_PMASSES*>;
+  template class backend_functor<DS_PMASSES*(*)(),DS_PMASSES*>;
+
+  template class backend_functor_common<sd_sdownwidth_type*(*)(),sd_sdownwidth_type*>;
+  template class backend_functor<sd_sdownwidth_type*(*)(),sd_sdownwidth_type*>;
+
+  template class backend_functor_common<sd_stoploop_type*(*)(),sd_stoploop_type*>;
+  template class backend_functor<sd_stoploop_type*(*)(),sd_stoploop_type*>;
+
+  template class backend_functor_common<double(*)(std::string,double&),double,std::string,double&>;
+  template class backend_functor<double(*)(std::string,double&),double,std::string,double&>;
+
+  template class backend_functor_common<double(*)(std::vector<std::string>,double&),double,std::vector<std::string>,double&>;
+  template class backend_functor<double(*)(std::vector<std::string>,double&),double,std::vector<std::string>,double&>;
+
+  template class backend_functor_common<double(*)(const double&),double,const double&>;
+  template class backend_functor<double(*)(const double&),double,const double&>;
+
+  template class backend_functor_common<void(*)(int&,Farray<fh_real,1,4>&,fh_complex&,Farray<fh_complex,1,3,1,3>&,Farray<fh_complex,1,3,1,3>&),void,int&,Farray<fh_real,1,4>&,fh_complex&,Farray<fh_complex,1,3,1,3>&,Farray<fh_complex,1,3,1,3>&>;
+  template class backend_functor<void(*)(int&,Farray<fh_real,1,4>&,fh_complex&,Farray<fh_complex,1,3,1,3>&,Farray<fh_complex,1,3,1,3>&),void,int&,Farray<fh_real,1,4>&,fh_complex&,Farray<fh_complex,1,3,1,3>&,Farray<fh_complex,1,3,1,3>&>;
+
+  template class backend_functor_common<void(*)(int),void,int>;
+  template class backend_functor<void(*)(int),void,int>;
+
+  template class backend_functor_common<void(*)(int&),void,int&>;
+  template class backend_functor<void(*)(int&),void,int&>;
+
+  template class backend_functor_common<DS_HMFRAMEVELCOM*(*)(),DS_HMFRAMEVELCOM*>;
+  template class backend_functor<DS_HMFRAMEVELCOM*(*)(),DS_HMFRAMEVELCOM*>;
+
+  template class backend_functor_common<double(*)(const double&,const double&,const double&,const int&,const int&,const char*,const int&,const int&,const int&),double,const double&,const double&,const double&,const int&,const int&,const char*,const int&,const int&,const int&>;
+  template class backend_functor<double(*)(const double&,const double&,const double&,const int&,const int&,const char*,const int&,const int&,const int&),double,const double&,const double&,const double&,const int&,const int&,const char*,const int&,const int&,const int&>;
+
+  template class backend_functor_common<void(*)(int,const std::vector<double>&,const std::vector<double>&,double),void,int,const std::vector<double>&,const std::vector<double>&,double>;
+  template class backend_functor<void(*)(int,const std::vector<double>&,const std::vector<double>&,double),void,int,const std::vector<double>&,const std::vector<double>&,double>;
+
+  template class backend_functor_common<void(*)(const double&,const double&,const int&,double&),void,const double&,const double&,const int&,double&>;
+  template class backend_functor<void(*)(const double&,const double&,const int&,double&),void,const double&,const double&,const int&,double&>;
+
+  template class backend_functor_common<int(*)(clik_error*),int,clik_error*>;
+  template class backend_functor<int(*)(clik_error*),int,clik_error*>;
+
+  template class backend_functor_common<void(*)(double(*)(double&),double&,double&,double&,double&,int&),void,double(*)(double&),double&,double&,double&,double&,int&>;
+  template class backend_functor<void(*)(double(*)(double&),double&,double&,double&,double&,int&),void,double(*)(double&),double&,double&,double&,double&,int&>;
+
+  template class backend_functor_common<double(*)(clik_lensing_object*,double*,clik_error**),double,clik_lensing_object*,double*,clik_error**>;
+  template class backend_functor<double(*)(clik_lensing_object*,double*,clik_error**),double,clik_lensing_object*,double*,clik_error**>;
+
+  template class backend_functor_common<Farray_Freal8_1_3*(*)(),Farray_Freal8_1_3*>;
+  template class backend_functor<Farray_Freal8_1_3*(*)(),Farray_Freal8_1_3*>;
+
+  template class backend_functor_common<int(*)(const MList<MInteger>&,const int&),int,const MList<MInteger>&,const int&>;
+  template class backend_functor<int(*)(const MList<MInteger>&,const int&),int,const MList<MInteger>&,const int&>;
+
+  template class backend_functor_common<sd_sbotwidth_type*(*)(),sd_sbotwidth_type*>;
+  template class backend_functor<sd_sbotwidth_type*(*)(),sd_sbotwidth_type*>;
+
+  template class backend_functor_common<sd_glui2body_type*(*)(),sd_glui2body_type*>;
+  template class backend_functor<sd_glui2body_type*(*)(),sd_glui2body_type*>;
+
+  template class backend_functor_common<double(*)(double,double,double,double),double,double,double,double,double>;
+  template class backend_functor<double(*)(double,double,double,double),double,double,double,double,double>;
+
+  template class backend_functor_common<double(*)(Farray<Fdouble,1,2,2,3>&),double,Farray<Fdouble,1,2,2,3>&>;
+  template class backend_functor<double(*)(Farray<Fdouble,1,2,2,3>&),double,Farray<Fdouble,1,2,2,3>&>;
+
+  template class backend_functor_common<numout*(*)(std::string,std::vector<str>,std::vector<str>),numout*,std::string,std::vector<str>,std::vector<str>>;
+  template class backend_functor<numout*(*)(std::string,std::vector<str>,std::vector<str>),numout*,std::string,std::vector<str>,std::vector<str>>;
+
+  template class backend_functor_common<void(*)(clik_error**),void,clik_error**>;
+  template class backend_functor<void(*)(clik_error**),void,clik_error**>;
+
+  template class backend_functor_common<Farray_Fstring60_1_15*(*)(),Farray_Fstring60_1_15*>;
+  template class backend_functor<Farray_Fstring60_1_15*(*)(),Farray_Fstring60_1_15*>;
+
+  template class backend_functor_common<DarkAges::Energy_injection_efficiency_table(*)(),DarkAges::Energy_injection_efficiency_table>;
+  template class backend_functor<DarkAges::Energy_injection_efficiency_table(*)(),DarkAges::Energy_injection_efficiency_table>;
+
+  template class backend_functor_common<DS_SFERMIONMASS*(*)(),DS_SFERMIONMASS*>;
+  template class backend_functor<DS_SFERMIONMASS*(*)(),DS_SFERMIONMASS*>;
+
+  template class backend_functor_common<numout*(*)(std::string,std::string,std::vector<str>),numout*,std::string,std::string,std::vector<str>>;
+  template class backend_functor<numout*(*)(std::string,std::string,std::vector<str>),numout*,std::string,std::string,std::vector<str>>;
+
+  template class backend_functor_common<int(*)(double,double,double,double,double,double,double,double,double,double,double,double,double,double,double,double,double,double,double,double),int,double,double,double,double,double,double,double,double,double,double,double,double,double,double,double,double,double,double,double,double>;
+  template class backend_functor<int(*)(double,double,double,double,double,double,double,double,double,double,double,double,double,double,double,double,double,double,double,double),int,double,double,double,double,double,double,double,double,double,double,double,double,double,double,double,double,double,double,double,double>;
+
+  template class backend_functor_common<DS_MIXING*(*)(),DS_MIXING*>;
+  template class backend_functor<DS_MIXING*(*)(),DS_MIXING*>;
+
+  template class backend_functor_common<DS_HMCOM*(*)(),DS_HMCOM*>;
+  template class backend_functor<DS_HMCOM*(*)(),DS_HMCOM*>;
+
+  template class backend_functor_common<double(*)(double*,int,double),double,double*,int,double>;
+  template class backend_functor<double(*)(double*,int,double),double,double*,int,double>;
+
+  template class backend_functor_common<void(*)(const char&,const double&,const double&,nuyield_function_pointer,double&,double&,int&,double&,double&,const int&,const double&,const int&,const bool&,const double&,const double&,void*&,const bool&),void,const char&,const double&,const double&,nuyield_function_pointer,double&,double&,int&,double&,double&,const int&,const double&,const int&,const bool&,const double&,const double&,void*&,const bool&>;
+  template class backend_functor<void(*)(const char&,const double&,const double&,nuyield_function_pointer,double&,double&,int&,double&,double&,const int&,const double&,const int&,const bool&,const double&,const double&,void*&,const bool&),void,const char&,const double&,const double&,nuyield_function_pointer,double&,double&,int&,double&,double&,const int&,const double&,const int&,const bool&,const double&,const double&,void*&,const bool&>;
+
+  template class backend_functor_common<pybind11::object(*)(map_str_str&),pybind11::object,map_str_str&>;
+  template class backend_functor<pybind11::object(*)(map_str_str&),pybind11::object,map_str_str&>;
+
+  template class backend_functor_common<gambit_inflation_observables(*)(int&,int&,int&,int&,double*,double*,double*,double&,double&,double&,int&,int&,int&,int&,int&),gambit_inflation_observables,int&,int&,int&,int&,double*,double*,double*,double&,double&,double&,int&,int&,int&,int&,int&>;
+  template class backend_functor<gambit_inflation_observables(*)(int&,int&,int&,int&,double*,double*,double*,double&,double&,double&,int&,int&,int&,int&,int&),gambit_inflation_observables,int&,int&,int&,int&,double*,double*,double*,double&,double&,double&,int&,int&,int&,int&,int&>;
+
+  template class backend_functor_common<sd_sdown2body_type*(*)(),sd_sdown2body_type*>;
+  template class backend_functor<sd_sdown2body_type*(*)(),sd_sdown2body_type*>;
+
+  template class backend_functor_common<DS_ADM_COM*(*)(),DS_ADM_COM*>;
+  template class backend_functor<DS_ADM_COM*(*)(),DS_ADM_COM*>;
+
+  template class backend_functor_common<sd_stau2bodygrav_type*(*)(),sd_stau2bodygrav_type*>;
+  template class backend_functor<sd_stau2bodygrav_type*(*)(),sd_stau2bodygrav_type*>;
+
+  template class backend_functor_common<DS_MSSMSWITCH*(*)(),DS_MSSMSWITCH*>;
+  template class backend_functor<DS_MSSMSWITCH*(*)(),DS_MSSMSWITCH*>;
+
+  template class backend_functor_common<clik_error*(*)(),clik_error*>;
+  template class backend_functor<clik_error*(*)(),clik_error*>;
+
+  template class backend_functor_common<double(*)(int,int,double,double,double*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double),double,int,int,double,double,double*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double>;
+  template class backend_functor<double(*)(int,int,double,double,double*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double),double,int,int,double,double,double*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,const parameters*,double>;
+
+  template class backend_functor_common<DS_INTDOF*(*)(),DS_INTDOF*>;
+  template class backend_functor<DS_INTDOF*(*)(),DS_INTDOF*>;
+
+  template class backend_functor_common<void(*)(int&,int&,int&),void,int&,int&,int&>;
+  template class backend_functor<void(*)(int&,int&,int&),void,int&,int&,int&>;
+
+  template class backend_functor_common<sd_glui3body_type*(*)(),sd_glui3body_type*>;
+  template class backend_functor<sd_glui3body_type*(*)(),sd_glui3body_type*>;
+
+  template class backend_functor_common<int*(*)(),int*>;
+  template class backend_functor<int*(*)(),int*>;
+
+  template class backend_functor_common<DS_PWIDTHS*(*)(),DS_PWIDTHS*>;
+  template class backend_functor<DS_PWIDTHS*(*)(),DS_PWIDTHS*>;
+
+  template class backend_functor_common<void(*)(parameters*),void,parameters*>;
+  template class backend_functor<void(*)(parameters*),void,parameters*>;
+
+  template class backend_functor_common<double(*)(map_str_dbl&,const std::string&),double,map_str_dbl&,const std::string&>;
+  template class backend_functor<double(*)(map_str_dbl&,const std::string&),double,map_str_dbl&,const std::string&>;
+
+  template class backend_functor_common<std::string(*)(),std::string>;
+  template class backend_functor<std::string(*)(),std::string>;
+
+  template class backend_functor_common<double(*)(double,double,double,const parameters*),double,double,double,double,const parameters*>;
+  template class backend_functor<double(*)(double,double,double,const parameters*),double,double,double,double,const parameters*>;
+
+  template class backend_functor_common<void(*)(const int&,double&,double&,double&,double&,double&),void,const int&,double&,double&,double&,double&,double&>;
+  template class backend_functor<void(*)(const int&,double&,double&,double&,double&,double&),void,const int&,double&,double&,double&,double&,double&>;
+
+  template class backend_functor_common<void(*)(int&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&),void,int&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&>;
+  template class backend_functor<void(*)(int&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&),void,int&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&,fh_ccomplex&>;
+
+  template class backend_functor_common<void(*)(double&,double&,double&,double&),void,double&,double&,double&,double&>;
+  template class backend_functor<void(*)(double&,double&,double&,double&),void,double&,double&,double&,double&>;
+
+  template class backend_functor_common<void(*)(Fdouble_complex&,double&,double&),void,Fdouble_complex&,double&,double&>;
+  template class backend_functor<void(*)(Fdouble_complex&,double&,double&),void,Fdouble_complex&,double&,double&>;
+
+  template class backend_functor_common<sd_sbot2body_type*(*)(),sd_sbot2body_type*>;
+  template class backend_functor<sd_sbot2body_type*(*)(),sd_sbot2body_type*>;
+
+  template class backend_functor_common<double(*)(int&,double&),double,int&,double&>;
+  template class backend_functor<double(*)(int&,double&),double,int&,double&>;
+
+  template class backend_functor_common<map_str_dbl(*)(const PID_pair&,const int&,const int&,const int&,const double&,const int&,const bool&),map_str_dbl,const PID_pair&,const int&,const int&,const int&,const double&,const int&,const bool&>;
+  template class backend_functor<map_str_dbl(*)(const PID_pair&,const int&,const int&,const int&,const double&,const int&,const bool&),map_str_dbl,const PID_pair&,const int&,const int&,const int&,const double&,const int&,const bool&>;
+
+  template class backend_functor_common<DS_RD20OPT*(*)(),DS_RD20OPT*>;
+  template class backend_functor<DS_RD20OPT*(*)(),DS_RD20OPT*>;
+
+  template class backend_functor_common<libFarrayTest_CB3_type*(*)(),libFarrayTest_CB3_type*>;
+  template class backend_functor<libFarrayTest_CB3_type*(*)(),libFarrayTest_CB3_type*>;
+
+  template class backend_functor_common<DS_SMCOUPLING61*(*)(),DS_SMCOUPLING61*>;
+  template class backend_functor<DS_SMCOUPLING61*(*)(),DS_SMCOUPLING61*>;
+
+  template class backend_functor_common<double(*)(std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,double,double,double,const parameters*),double,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,double,double,double,const parameters*>;
+  template class backend_functor<double(*)(std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,double,double,double,const parameters*),double,std::complex<double>*,std::complex<double>*,std::complex<double>*,std::complex<double>*,double,double,double,const parameters*>;
+
+  template class backend_functor_common<DS_MSSMWIDTHS*(*)(),DS_MSSMWIDTHS*>;
+  template class backend_functor<DS_MSSMWIDTHS*(*)(),DS_MSSMWIDTHS*>;
+
+  template class backend_functor_common<particle23*(*)(),particle23*>;
+  template class backend_functor<particle23*(*)(),particle23*>;
+
+  template class backend_functor_common<DS_DDCOMLEGACY*(*)(),DS_DDCOMLEGACY*>;
+  template class backend_functor<DS_DDCOMLEGACY*(*)(),DS_DDCOMLEGACY*>;
+
+  template class backend_functor_common<DS5_DDCOM*(*)(),DS5_DDCOM*>;
+  template class backend_functor<DS5_DDCOM*(*)(),DS5_DDCOM*>;
+
+  template class backend_functor_common<Farray_Fcomplex16_1_6_1_6*(*)(),Farray_Fcomplex16_1_6_1_6*>;
+  template class backend_functor<Farray_Fcomplex16_1_6_1_6*(*)(),Farray_Fcomplex16_1_6_1_6*>;
+
+  template class backend_functor_common<void(*)(),void>;
+  template class backend_functor<void(*)(),void>;
+
+  template class backend_functor_common<void(*)(const int&),void,const int&>;
+  template class backend_functor<void(*)(const int&),void,const int&>;
+
+  template class backend_functor_common<checkfavvio_type*(*)(),checkfavvio_type*>;
+  template class backend_functor<checkfavvio_type*(*)(),checkfavvio_type*>;
+
+  template class backend_functor_common<void(*)(double&,double&,double&,int&),void,double&,double&,double&,int&>;
+  template class backend_functor<void(*)(double&,double&,double&,int&),void,double&,double&,double&,int&>;
+
+  template class backend_functor_common<void(*)(int&,int&,int&,int&,int&,int&,int&,int&,int&,int&),void,int&,int&,int&,int&,int&,int&,int&,int&,int&,int&>;
+  template class backend_functor<void(*)(int&,int&,int&,int&,int&,int&,int&,int&,int&,int&),void,int&,int&,int&,int&,int&,int&,int&,int&,int&,int&>;
+
+  template class backend_functor_common<void(*)(nuisance*),void,nuisance*>;
+  template class backend_functor<void(*)(nuisance*),void,nuisance*>;
+
+  template class backend_functor_common<void(*)(clik_lensing_object**),void,clik_lensing_object**>;
+  template class backend_functor<void(*)(clik_lensing_object**),void,clik_lensing_object**>;
+
+  template class backend_functor_common<void(*)(char**,obsname*,int*),void,char**,obsname*,int*>;
+  template class backend_functor<void(*)(char**,obsname*,int*),void,char**,obsname*,int*>;
+
+  template class backend_functor_common<void(*)(AlterBBN_2_2::relicparam*),void,AlterBBN_2_2::relicparam*>;
+  template class backend_functor<void(*)(AlterBBN_2_2::relicparam*),void,AlterBBN_2_2::relicparam*>;
+
+  template class backend_functor_common<hd_golddec_type*(*)(),hd_golddec_type*>;
+  template class backend_functor<hd_golddec_type*(*)(),hd_golddec_type*>;
+
+  template class backend_functor_common<std::vector<double>(*)(),std::vector<double>>;
+  template class backend_functor<std::vector<double>(*)(),std::vector<double>>;
+
+  template class backend_functor_common<double(*)(int&,int&),double,int&,int&>;
+  template class backend_functor<double(*)(int&,int&),double,int&,int&>;
+
+  template class backend_functor_common<void(*)(const char&,const double&,const double&,const double&,const double&),void,const char&,const double&,const double&,const double&,const double&>;
+  template class backend_functor<void(*)(const char&,const double&,const double&,const double&,const double&),void,const char&,const double&,const double&,const double&,const double&>;
+
+  template class backend_functor_common<DS_MSSMMIXING*(*)(),DS_MSSMMIXING*>;
+  template class backend_functor<DS_MSSMMIXING*(*)(),DS_MSSMMIXING*>;
+
+  template class backend_functor_common<void(*)(const double(&)[29],const double(&)[29][3],const double(&)[15],const double(&)[3],const double&,const double&),void,const double(&)[29],const double(&)[29][3],const double(&)[15],const double(&)[3],const double&,const double&>;
+  template class backend_functor<void(*)(const double(&)[29],const double(&)[29][3],const double(&)[15],const double(&)[3],const double&,const double&),void,const double(&)[29],const double(&)[29][3],const double(&)[15],const double(&)[3],const double&,const double&>;
+
+  template class backend_functor_common<sd_top2body_type*(*)(),sd_top2body_type*>;
+  template class backend_functor<sd_top2body_type*(*)(),sd_top2body_type*>;
+
+  template class backend_functor_common<int(*)(const SLHAstruct &,const DecayTable&),int,const SLHAstruct &,const DecayTable&>;
+  template class backend_functor<int(*)(const SLHAstruct &,const DecayTable&),int,const SLHAstruct &,const DecayTable&>;
+
+  template class backend_functor_common<slha_leshouches2_hdec_type*(*)(),slha_leshouches2_hdec_type*>;
+  template class backend_functor<slha_leshouches2_hdec_type*(*)(),slha_leshouches2_hdec_type*>;
+
+  template class backend_functor_common<double(*)(std::string&,std::vector<str>&,std::vector<str>&,double&,const DecayTable&),double,std::string&,std::vector<str>&,std::vector<str>&,double&,const DecayTable&>;
+  template class backend_functor<double(*)(std::string&,std::vector<str>&,std::vector<str>&,double&,const DecayTable&),double,std::string&,std::vector<str>&,std::vector<str>&,double&,const DecayTable&>;
+
+  template class backend_functor_common<void(*)(int&,double&,double&,double&,int&,double&),void,int&,double&,double&,double&,int&,double&>;
+  template class backend_functor<void(*)(int&,double&,double&,double&,int&,double&),void,int&,double&,double&,double&,int&,double&>;
+
+  template class backend_functor_common<MList<MInteger>(*)(const MList<MInteger>&),MList<MInteger>,const MList<MInteger>&>;
+  template class backend_functor<MList<MInteger>(*)(const MList<MInteger>&),MList<MInteger>,const MList<MInteger>&>;
+
+  template class backend_functor_common<int(*)(AlterBBN_2_2::relicparam*,double*,double*),int,AlterBBN_2_2::relicparam*,double*,double*>;
+  template class backend_functor<int(*)(AlterBBN_2_2::relicparam*,double*,double*),int,AlterBBN_2_2::relicparam*,double*,double*>;
+
+  template class backend_functor_common<DS5_HMCOM*(*)(),DS5_HMCOM*>;
+  template class backend_functor<DS5_HMCOM*(*)(),DS5_HMCOM*>;
+
+  template class backend_functor_common<Farray_Fstring60_1_2*(*)(),Farray_Fstring60_1_2*>;
+  template class backend_functor<Farray_Fstring60_1_2*(*)(),Farray_Fstring60_1_2*>;
+
+  template class backend_functor_common<double(*)(int,const parameters*),double,int,const parameters*>;
+  template class backend_functor<double(*)(int,const parameters*),double,int,const parameters*>;
+
+  template class backend_functor_common<void(*)(int&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&),void,int&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&>;
+  template class backend_functor<void(*)(int&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&),void,int&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&,fh_real&>;
+
+  template class backend_functor_common<double(*)(const double&,const double&,const char&,const int&,const int&,const int&,const int&),double,const double&,const double&,const char&,const int&,const int&,const int&,const int&>;
+  template class backend_functor<double(*)(const double&,const double&,const char&,const int&,const int&,const int&,const int&),double,const double&,const double&,const char&,const int&,const int&,const int&,const int&>;
+
+  template class backend_functor_common<sd_neutloop_type*(*)(),sd_neutloop_type*>;
+  template class backend_functor<sd_neutloop_type*(*)(),sd_neutloop_type*>;
+
+  template class backend_functor_common<void(*)(const char&,const char&,const char&,const char&,const char&,double&,bool&,bool&),void,const char&,const char&,const char&,const char&,const char&,double&,bool&,bool&>;
+  template class backend_functor<void(*)(const char&,const char&,const char&,const char&,const char&,double&,bool&,bool&),void,const char&,const char&,const char&,const char&,const char&,double&,bool&,bool&>;
+
+  template class backend_functor_common<Farray_Fstring60_1_33*(*)(),Farray_Fstring60_1_33*>;
+  template class backend_functor<Farray_Fstring60_1_33*(*)(),Farray_Fstring60_1_33*>;
+
+  template class backend_functor_common<PyDict(*)(iipair&),PyDict,iipair&>;
+  template class backend_functor<PyDict(*)(iipair&),PyDict,iipair&>;
+
+  template class backend_functor_common<DS_RDPTH*(*)(),DS_RDPTH*>;
+  template class backend_functor<DS_RDPTH*(*)(),DS_RDPTH*>;
+
+  template class backend_functor_common<double(*)(double(*)[10][10]),double,double(*)[10][10]>;
+  template class backend_functor<double(*)(double(*)[10][10]),double,double(*)[10][10]>;
+
+  template class backend_functor_common<double(*)(double),double,double>;
+  template class backend_functor<double(*)(double),double,double>;
+
+  template class backend_functor_common<int(*)(double,int,int,double*),int,double,int,int,double*>;
+  template class backend_functor<int(*)(double,int,int,double*),int,double,int,int,double*>;
+
+  template class backend_functor_common<DS_RDPARS_OLD*(*)(),DS_RDPARS_OLD*>;
+  template class backend_functor<DS_RDPARS_OLD*(*)(),DS_RDPARS_OLD*>;
+
+  template class backend_functor_common<Farray_Fcomplex16_1_3_1_3*(*)(),Farray_Fcomplex16_1_3_1_3*>;
+  template class backend_functor<Farray_Fcomplex16_1_3_1_3*(*)(),Farray_Fcomplex16_1_3_1_3*>;
+
+  template class backend_functor_common<int(*)(numout*),int,numout*>;
+  template class backend_functor<int(*)(numout*),int,numout*>;
+
+  template class backend_functor_common<widthhh_hdec_type*(*)(),widthhh_hdec_type*>;
+  template class backend_functor<widthhh_hdec_type*(*)(),widthhh_hdec_type*>;
+
+  template class backend_functor_common<void(*)(double***,char**,int*,const parameters*,const nuisance*,double**),void,double***,char**,int*,const parameters*,const nuisance*,double**>;
+  template class backend_functor<void(*)(double***,char**,int*,const parameters*,const nuisance*,double**),void,double***,char**,int*,const parameters*,const nuisance*,double**>;
+
+  template class backend_functor_common<int(*)(char*),int,char*>;
+  template class backend_functor<int(*)(char*),int,char*>;
+
+  template class backend_functor_common<double(*)(double,double,double,int,FILE*),double,double,double,double,int,FILE*>;
+  template class backend_functor<double(*)(double,double,double,int,FILE*),double,double,double,double,int,FILE*>;
+
+  template class backend_functor_common<void(*)(double*,double*,int*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*),void,double*,double*,int*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*>;
+  template class backend_functor<void(*)(double*,double*,int*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*),void,double*,double*,int*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*,double*>;
+
+  template class backend_functor_common<void(*)(double,double,double,double),void,double,double,double,double>;
+  template class backend_functor<void(*)(double,double,double,double),void,double,double,double,double>;
+
+  template class backend_functor_common<double(*)(int&),double,int&>;
+  template class backend_functor<double(*)(int&),double,int&>;
+
+  template class backend_functor_common<sd_neutwidth_type*(*)(),sd_neutwidth_type*>;
+  template class backend_functor<sd_neutwidth_type*(*)(),sd_neutwidth_type*>;
+
+  template class backend_functor_common<double(*)(char*),double,char*>;
+  template class backend_functor<double(*)(char*),double,char*>;
+
+  template class backend_functor_common<double*(*)(),double*>;
+  template class backend_functor<double*(*)(),double*>;
+
+  template class backend_functor_common<Farray_Freal8_1_5*(*)(),Farray_Freal8_1_5*>;
+  template class backend_functor<Farray_Freal8_1_5*(*)(),Farray_Freal8_1_5*>;
+
+  template class backend_functor_common<clik_lensing_object*(*)(char*,clik_error**),clik_lensing_object*,char*,clik_error**>;
+  template class backend_functor<clik_lensing_object*(*)(char*,clik_error**),clik_lensing_object*,char*,clik_error**>;
+
+  template class backend_functor_common<void(*)(clik_lensing_object*,int*,clik_error**),void,clik_lensing_object*,int*,clik_error**>;
+  template class backend_functor<void(*)(clik_lensing_object*,int*,clik_error**),void,clik_lensing_object*,int*,clik_error**>;
+
+  template class backend_functor_common<Farray_Freal8_1_2*(*)(),Farray_Freal8_1_2*>;
+  template class backend_functor<Farray_Freal8_1_2*(*)(),Farray_Freal8_1_2*>;
+
+  template class backend_functor_common<double(*)(const int&,const double&,const double&,const double&),double,const int&,const double&,const double&,const double&>;
+  template class backend_functor<double(*)(const int&,const double&,const double&,const double&),double,const int&,const double&,const double&,const double&>;
+
+  template class backend_functor_common<void(*)(double*,double*,double*,double*,double,double,double,double,double,int),void,double*,double*,double*,double*,double,double,double,double,double,int>;
+  template class backend_functor<void(*)(double*,double*,double*,double*,double,double,double,double,double,int),void,double*,double*,double*,double*,double,double,double,double,double,int>;
+
+  template class backend_functor_common<DS_RDTIME*(*)(),DS_RDTIME*>;
+  template class backend_functor<DS_RDTIME*(*)(),DS_RDTIME*>;
+}
+
+#endif // defined __backend_functor_types_hpp__
@@ -0,0 +1,116 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file                                       
+///                                               
+///  Compile-time registration of available back- 
+///  ends.                                        
+///                                               
+///  This file was automatically generated by     
+///  backend_harvester.py. Do not modify.         
+///                                               
+///  Do not add to this if you want to add a new  
+///  backend -- just add your frontend header to  
+///  Backends/include/gambit/Backends/frontends   
+///  and rest assured that backend_harvester.py   
+///  will make sure it ends up here.              
+///                                               
+///  *********************************************
+///                                               
+///  Authors (add name and date if you modify):   
+///                                               
+///  \author The GAMBIT Collaboration            
+///  \date 08:32PM on October 16, 2026
+///                                               
+///  *********************************************
+                                                  
+#ifndef __backend_rollcall_hpp__                  
+#define __backend_rollcall_hpp__                  
+                                                  
+// Include the backend macro definitions          
+#include "gambit/Backends/backend_macros.hpp"   
+                                                  
+// Automatically-generated list of frontends.     
+#include "gambit/Backends/frontends/Contur_2_1_1.hpp"
+#include "gambit/Backends/frontends/LibMathematicaTest_1_0.hpp"
+#include "gambit/Backends/frontends/Acropolis_1_2_1.hpp"
+#include "gambit/Backends/frontends/salami_0_1_0.hpp"
+#include "gambit/Backends/frontends/simplexs_1_0.hpp"
+#include "gambit/Backends/frontends/DarkSUSY_MSSM_6_2_5.hpp"
+#include "gambit/Backends/frontends/nulike_1_0_9.hpp"
+#include "gambit/Backends/frontends/DDCalc_2_3_0.hpp"
+#include "gambit/Backends/frontends/gm2calc_1_2_0.hpp"
+#include "gambit/Backends/frontends/obscura_1_1_0.hpp"
+#include "gambit/Backends/frontends/DDCalc_2_2_0.hpp"
+#include "gambit/Backends/frontends/SuperIso_4_1.hpp"
+#include "gambit/Backends/frontends/MicrOmegas_DiracSingletDM_Z2_3_6_9_2.hpp"
+#include "gambit/Backends/frontends/MicrOmegas_ScalarSingletDM_Z3_3_6_9_2.hpp"
+#include "gambit/Backends/frontends/plc_3_0.hpp"
+#include "gambit/Backends/frontends/DarkSUSY_generic_wimp_6_2_5.hpp"
+#include "gambit/Backends/frontends/DarkSUSY_generic_wimp_6_4_0.hpp"
+#include "gambit/Backends/frontends/classy_exo_2_7_2.hpp"
+#include "gambit/Backends/frontends/HepLike_2_0.hpp"
+#include "gambit/Backends/frontends/gm2calc_1_3_0.hpp"
+#include "gambit/Backends/frontends/DarkSUSY_MSSM_6_1_1.hpp"
+#include "gambit/Backends/frontends/LibFirst_1_1.hpp"
+#include "gambit/Backends/frontends/DDCalc_1_1_0.hpp"
+#include "gambit/Backends/frontends/pbarlike_1_0.hpp"
+#include "gambit/Backends/frontends/Pythia_8_212.hpp"
+#include "gambit/Backends/frontends/HepLikeData_1_4.hpp"
+#include "gambit/Backends/frontends/nulike_1_0_8.hpp"
+#include "gambit/Backends/frontends/DarkSUSY_MSSM_6_4_0.hpp"
+#include "gambit/Backends/frontends/CalcHEP_3_6_27.hpp"
+#include "gambit/Backends/frontends/FeynHiggs_2_12_0.hpp"
+#include "gambit/Backends/frontends/DarkSUSY_5_1_3.hpp"
+#include "gambit/Backends/frontends/classy_2_9_4.hpp"
+#include "gambit/Backends/frontends/MontePythonLike_3_3_0.hpp"
+#include "gambit/Backends/frontends/MicrOmegas_ScalarSingletDM_Z2_3_6_9_2.hpp"
+#include "gambit/Backends/frontends/gamLike_1_0_0.hpp"
+#include "gambit/Backends/frontends/nulike_1_0_7.hpp"
+#include "gambit/Backends/frontends/HiggsBounds_4_3_1.hpp"
+#include "gambit/Backends/frontends/DDCalc_1_0_0.hpp"
+#include "gambit/Backends/frontends/vevacious_1_0.hpp"
+#include "gambit/Backends/frontends/Rivet_3_1_5.hpp"
+#include "gambit/Backends/frontends/AlterBBN_2_2.hpp"
+#include "gambit/Backends/frontends/gamLike_1_0_1.hpp"
+#include "gambit/Backends/frontends/MultiModeCode_2_0_0.hpp"
+#include "gambit/Backends/frontends/SUSYHD_1_0_2.hpp"
+#include "gambit/Backends/frontends/HiggsSignals_1_4.hpp"
+#include "gambit/Backends/frontends/classy_2_9_3.hpp"
+#include "gambit/Backends/frontends/LibFarrayTest_1_0.hpp"
+#include "gambit/Backends/frontends/nulike_1_0_4.hpp"
+#include "gambit/Backends/frontends/LibFirst_1_0.hpp"
+#include "gambit/Backends/frontends/nulike_1_0_6.hpp"
+#include "gambit/Backends/frontends/LibThird_1_1.hpp"
+#include "gambit/Backends/frontends/DDCalc_1_2_0.hpp"
+#include "gambit/Backends/frontends/LibThird_1_2.hpp"
+#include "gambit/Backends/frontends/ATLAS_FullLikes_1_0.hpp"
+#include "gambit/Backends/frontends/DirectDM_2_2_0.hpp"
+#include "gambit/Backends/frontends/DarkAges_1_2_0.hpp"
+#include "gambit/Backends/frontends/LibSecond_1_1.hpp"
+#include "gambit/Backends/frontends/MicrOmegas_VectorSingletDM_Z2_3_6_9_2.hpp"
+#include "gambit/Backends/frontends/MicrOmegas_MSSM_3_6_9_2.hpp"
+#include "gambit/Backends/frontends/MicrOmegas_DMsimpVectorMedVectorDM_3_6_9_2.hpp"
+#include "gambit/Backends/frontends/SPheno_4_0_3.hpp"
+#include "gambit/Backends/frontends/SUSY_HIT_1_5.hpp"
+#include "gambit/Backends/frontends/CaptnGeneral_2_1.hpp"
+#include "gambit/Backends/frontends/SPheno_3_3_8.hpp"
+#include "gambit/Backends/frontends/Prospino_2_1.hpp"
+#include "gambit/Backends/frontends/classy_3_1_0.hpp"
+#include "gambit/Backends/frontends/DarkCast_1_1.hpp"
+#include "gambit/Backends/frontends/xsecBE_1_0_2.hpp"
+#include "gambit/Backends/frontends/classy_2_6_3.hpp"
+#include "gambit/Backends/frontends/MontePythonLike_3_5_0.hpp"
+#include "gambit/Backends/frontends/DarkSUSY_generic_wimp_6_2_2.hpp"
+#include "gambit/Backends/frontends/LibFortran_1_0.hpp"
+#include "gambit/Backends/frontends/DDCalc_2_0_0.hpp"
+#include "gambit/Backends/frontends/nulike_1_0_5.hpp"
+#include "gambit/Backends/frontends/LibSecond_1_2.hpp"
+#include "gambit/Backends/frontends/DarkSUSY_MSSM_6_2_2.hpp"
+#include "gambit/Backends/frontends/HiggsBounds_4_2_1.hpp"
+#include "gambit/Backends/frontends/MicrOmegas_MajoranaSingletDM_Z2_3_6_9_2.hpp"
+#include "gambit/Backends/frontends/FeynHiggs_2_11_2.hpp"
+#include "gambit/Backends/frontends/DDCalc_2_1_0.hpp"
+#include "gambit/Backends/frontends/FeynHiggs_2_11_3.hpp"
+#include "gambit/Backends/frontends/DarkSUSY_generic_wimp_6_1_1.hpp"
+
+#endif // defined __backend_rollcall_hpp__
@@ -0,0 +1,75 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file                                       
+///                                               
+///  Compile-time registration of backend types.  
+///                                               
+///  This file was automatically generated by     
+///  backend_harvester.py. Do not modify.         
+///                                               
+///  Do not add to this if you want to add new    
+///  types associated with a new (or old) backend.
+///  Just add your backend type headers to the    
+///  directory tree in the right place, and rest  
+///  assured that backend_harvester.py will make  
+///  sure they end up here.                       
+///                                               
+///  Where is 'the right place'?                
+///  -Regular backend types: in a new header file 
+///    Backends/include/gambit/Backends/backend_types/X_types.hpp 
+///   where X is the name of the backend.         
+///  -When the types you want to add are a result 
+///   of running BOSS: add the directory created  
+///   by BOSS as                                  
+///    Backends/include/gambit/Backends/backend_types/X/ 
+///   where X is the name of the backend.  BOSS   
+///   will actually do this itself automatically  
+///   in some circumstances.                      
+///                                               
+///  *********************************************
+///                                               
+///  Authors (add name and date if you modify):   
+///                                               
+///  \author The GAMBIT Collaboration            
+///  \date 08:32PM on October 16, 2026
+///                                               
+///  *********************************************
+                                                  
+#ifndef __backend_types_rollcall_hpp__            
+#define __backend_types_rollcall_hpp__            
+                                                  
+// Macro definitions                              
+#include "gambit/Utils/type_macros.hpp"         
+                                                  
+// Regular backend type definitions.              
+#include "gambit/Backends/backend_types/DarkSUSY.hpp"
+#include "gambit/Backends/backend_types/HiggsBounds.hpp"
+#include "gambit/Backends/backend_types/SUSY-HIT.hpp"
+#include "gambit/Backends/backend_types/DDCalc.hpp"
+#include "gambit/Backends/backend_types/MontePythonLike.hpp"
+#include "gambit/Backends/backend_types/Contur.hpp"
+#include "gambit/Backends/backend_types/SuperIso.hpp"
+#include "gambit/Backends/backend_types/SPheno.hpp"
+#include "gambit/Backends/backend_types/MicrOmegas.hpp"
+#include "gambit/Backends/backend_types/MultiModeCode.hpp"
+#include "gambit/Backends/backend_types/nulike.hpp"
+#include "gambit/Backends/backend_types/AlterBBN.hpp"
+#include "gambit/Backends/backend_types/DarkAges.hpp"
+#include "gambit/Backends/backend_types/CalcHEP.hpp"
+#include "gambit/Backends/backend_types/FeynHiggs.hpp"
+#include "gambit/Backends/backend_types/Prospino.hpp"
+#include "gambit/Backends/backend_types/classy.hpp"
+#include "gambit/Backends/backend_types/plc.hpp"
+#include "gambit/Backends/backend_types/libFarrayTest.hpp"
+#include "gambit/Backends/backend_types/libfirst.hpp"
+
+// BOSSed backend type definitions.
+#include "gambit/Backends/backend_types/vevacious_1_0/loaded_types.hpp"
+#include "gambit/Backends/backend_types/Pythia_8_212/loaded_types.hpp"
+#include "gambit/Backends/backend_types/gm2calc_1_3_0/loaded_types.hpp"
+#include "gambit/Backends/backend_types/obscura_1_1_0/loaded_types.hpp"
+#include "gambit/Backends/backend_types/gm2calc_1_2_0/loaded_types.hpp"
+#include "gambit/Backends/backend_types/Rivet_3_1_5/loaded_types.hpp"
+#include "gambit/Backends/backend_types/HepLike_2_0/loaded_types.hpp"
+
+#endif // defined __backend_types_rollcall_hpp__
@@ -647,6 +647,7 @@ namespace Gambit
       logger() << "Succeeded in loading " << path << LogTags::backends << LogTags::info << EOM;
       works[be+ver] = true;
       loaded_python_backends[be+ver] = new_module;
+      Utils::python_interpreter::get().called_in_likelihood = true;
     }
 
     pybind11::module& Backends::backend_info::getPythonBackend(const str& be, const str& ver)
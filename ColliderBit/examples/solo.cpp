@@ -208,6 +208,7 @@ int main(int argc, char* argv[])
 
     // Pass the filename and the jet pt cutoff to the HepMC reader/HEPUtils converter function
     getEvent.setOption<str>("hepmc_filename", event_filename);
+    getEvent.setOption<bool>("cache_event_index", settings.getValueOrDef<bool>(false, "cache_event_index"));
     convertEvent.setOption<double>("jet_pt_min", jet_pt_min);
 
     // Pass options to the cross-section function
@@ -242,6 +243,7 @@ int main(int argc, char* argv[])
     apply_setting_if_present<double>("nuisance_marg_convthres_rel", settings, calc_LHC_LogLikes_full);//Default 0.05
     apply_setting_if_present<long>("nuisance_marg_nsamples_start", settings, calc_LHC_LogLikes_full);//Default 1000000
     apply_setting_if_present<bool>("nuisance_marg_nulike1sr", settings, calc_LHC_LogLikes_full);//Default true
+    apply_setting_if_present<str>("nuisance_marg_sampler", settings, calc_LHC_LogLikes_full);//Default "mc"
 
     bool calc_noerr_loglikes = apply_setting_if_present<bool>("calc_noerr_loglikes", settings, calc_LHC_LogLikes_full);//Default false
     bool calc_expected_loglikes= apply_setting_if_present<bool>("calc_expected_loglikes", settings, calc_LHC_LogLikes_full);//Default false
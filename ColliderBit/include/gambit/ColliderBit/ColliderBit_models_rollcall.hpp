@@ -0,0 +1,20 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file                                       
+///                                               
+///  Rollcall header for ColliderBit models.      
+///                                               
+///  This file is automatically generated by      
+///  collider_harvester.py.  Do not modify.       
+///                                               
+///  *********************************************
+///                                               
+///  \author The GAMBIT Collaboration            
+///  \date 08:32PM on October 16, 2026
+///                                               
+///  *********************************************
+                                                  
+#pragma once                                      
+                                                  
+#include "gambit/ColliderBit/models/SUSY.hpp"
+#include "gambit/ColliderBit/models/SUSY_extras.hpp"
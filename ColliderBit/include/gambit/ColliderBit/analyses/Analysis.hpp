@@ -22,6 +22,9 @@
 ///          (p.scott@imperial.ac.uk)
 ///  \date 2019 Feb
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #pragma once
@@ -29,6 +32,7 @@
 #include <string>
 #include "HEPUtils/Event.h"
 #include "gambit/ColliderBit/analyses/AnalysisData.hpp"
+#include "gambit/ColliderBit/analyses/SelectionCache.hpp"
 
 namespace Gambit
 {
@@ -81,6 +85,10 @@ namespace Gambit
         /// Scale by xsec per event.
         void scale(double);
 
+        /// Share the baseline object selections of another cache (e.g. that of the
+        /// AnalysisContainer), or use a private one if passed nullptr.
+        void set_selection_cache(SelectionCache*);
+
         /// @name Analysis combination operations
         ///@{
         /// Add the results of another analysis to this one. Argument is not const, because the other needs to be able to gather its results if necessary.
@@ -110,6 +118,9 @@ namespace Gambit
         virtual void collect_results() = 0;
         ///@}
 
+        /// Baseline object selections of the current event, shared with other analyses
+        SelectionCache& selections() { return *_selections; }
+
       private:
 
         double _luminosity;
@@ -118,6 +129,8 @@ namespace Gambit
         bool _needs_collection;
         AnalysisData _results;
         std::string _analysis_name;
+        SelectionCache _own_selections;
+        SelectionCache* _selections;
 
     };
 
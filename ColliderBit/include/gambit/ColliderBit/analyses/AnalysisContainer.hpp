@@ -22,6 +22,9 @@
 ///          (p.scott@imperial.ac.uk)
 ///  \date 2019 Feb
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #pragma once
@@ -32,6 +35,7 @@
 #include <map>
 
 #include "HEPUtils/Event.h"
+#include "gambit/ColliderBit/analyses/SelectionCache.hpp"
 
 namespace Gambit
 {
@@ -62,6 +66,9 @@ namespace Gambit
         /// First key is the collider name, second key is the analysis name.
         std::map<str,std::map<str,Analysis*> > analyses_map;
 
+        /// Baseline object selections of the current event, shared by all analyses in this container
+        mutable SelectionCache selections;
+
         /// String identifying the currently active collider
         str current_collider;
 
@@ -0,0 +1,102 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Per-event cache of baseline object
+///  selections, shared by the analyses of an
+///  AnalysisContainer.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "HEPUtils/Event.h"
+
+namespace Gambit
+{
+  namespace ColliderBit
+  {
+
+    /// Per-event cache of baseline object selections.
+    ///
+    /// A selection is the objects of one type that pass pT > ptmin and
+    /// |eta| < absetamax, optionally filtered by an efficiency function
+    /// (e.g. ATLAS::applyElectronEff).  The first analysis asking for a given
+    /// selection in an event computes it, including the random efficiency
+    /// draws; every other analysis asking for the same cuts and the same
+    /// efficiency function gets the same objects back.  Efficiency functions
+    /// are identified by address, so they must be plain functions (or
+    /// capture-less lambdas stored in a single place), not closures.
+    class SelectionCache
+    {
+
+      public:
+
+        typedef std::vector<const HEPUtils::Particle*> ParticlePtrs;
+        typedef std::vector<const HEPUtils::Jet*> JetPtrs;
+        typedef void (*ParticleEfficiency)(ParticlePtrs&);
+        typedef void (*JetEfficiency)(JetPtrs&);
+
+        SelectionCache() : _event(nullptr), _event_number(0) { }
+
+        /// Start a new event, invalidating all cached selections
+        void new_event(const HEPUtils::Event*);
+
+        /// @name Baseline selections of the current event
+        ///@{
+        const ParticlePtrs& electrons(double ptmin, double absetamax, ParticleEfficiency eff = nullptr);
+        const ParticlePtrs& muons(double ptmin, double absetamax, ParticleEfficiency eff = nullptr);
+        const ParticlePtrs& taus(double ptmin, double absetamax, ParticleEfficiency eff = nullptr);
+        const ParticlePtrs& photons(double ptmin, double absetamax, ParticleEfficiency eff = nullptr);
+        const JetPtrs& jets(const std::string& collection, double ptmin, double absetamax, JetEfficiency eff = nullptr);
+        ///@}
+
+      private:
+
+        enum object_type { ELECTRON, MUON, TAU, PHOTON, JET };
+
+        /// Identification of a selection
+        struct key
+        {
+          object_type type;
+          std::string collection;
+          double ptmin;
+          double absetamax;
+          void (*eff)();
+
+          bool operator<(const key&) const;
+        };
+
+        /// A cached selection, valid if computed for the current event
+        template <typename T>
+        struct entry
+        {
+          std::vector<const T*> objects;
+          unsigned long event_number = 0;
+        };
+
+        const ParticlePtrs& select(object_type, const std::vector<const HEPUtils::Particle*>&, double, double, ParticleEfficiency);
+        const JetPtrs& select(object_type, const std::string&, double, double, JetEfficiency);
+
+        std::map<key, entry<HEPUtils::Particle> > _particle_selections;
+        std::map<key, entry<HEPUtils::Jet> > _jet_selections;
+
+        /// The current event and its sequence number (never 0)
+        const HEPUtils::Event* _event;
+        unsigned long _event_number;
+
+    };
+
+  }
+}
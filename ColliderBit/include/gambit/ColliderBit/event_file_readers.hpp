@@ -0,0 +1,83 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Readers that parse the events of a HepMC or
+///  LHEF file at the byte offsets given by an
+///  indexed_event_file, one reader per thread.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#pragma once
+
+#include "gambit/cmake/cmake_variables.hpp"
+
+#ifndef EXCLUDE_HEPMC
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+
+#include "gambit/Utils/util_types.hpp"
+#include "HepMC3/GenEvent.h"
+#include "HepMC3/ReaderAscii.h"
+#include "HepMC3/ReaderAsciiHepMC2.h"
+#include "gambit/Utils/begin_ignore_warnings_hepmc.hpp"
+#include "HepMC3/LHEF.h"
+#include "gambit/Utils/end_ignore_warnings.hpp"
+
+namespace Gambit
+{
+
+  namespace ColliderBit
+  {
+
+    /// HepMC reader for the events claimed by a single thread.  The reader parses the
+    /// file header (version lines and run info) once, and is then moved to each claimed event.
+    struct HepMC_thread_reader
+    {
+      std::ifstream stream;
+      std::unique_ptr<HepMC3::Reader> reader;
+      HepMC_thread_reader(const str& filename, int version) : stream(filename)
+      {
+        if (version == 2) reader.reset(new HepMC3::ReaderAsciiHepMC2(stream));
+        else reader.reset(new HepMC3::ReaderAscii(stream));
+        // The readers only parse the header along with the first event
+        HepMC3::GenEvent first_event;
+        reader->read_event(first_event);
+      }
+      bool read(uint64_t offset, HepMC3::GenEvent& event)
+      {
+        stream.clear();
+        stream.seekg(offset);
+        return reader->read_event(event);
+      }
+    };
+
+    /// LHEF reader for the events claimed by a single thread.  The reader parses the
+    /// header and init block once, and is then moved to each claimed event.
+    struct LHEF_thread_reader
+    {
+      std::ifstream stream;
+      LHEF::Reader reader;
+      LHEF_thread_reader(const str& filename) : stream(filename), reader(stream) {}
+      bool read(uint64_t offset)
+      {
+        stream.clear();
+        stream.seekg(offset);
+        return reader.readEvent();
+      }
+    };
+
+  }
+
+}
+
+#endif
@@ -0,0 +1,94 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Byte-offset index of the events in a text
+///  event file (HepMC2, HepMC3 or LHEF), allowing
+///  threads to claim events and seek their own
+///  readers to them independently of each other.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "gambit/Utils/util_types.hpp"
+
+namespace Gambit
+{
+
+  namespace ColliderBit
+  {
+
+    /// Text event file with an index of the byte ranges of its events.
+    ///
+    /// The index is built with a single pass over the file, or, if caching is
+    /// requested, taken from the index file in the GAMBIT scratch directory if
+    /// that was written for the same version of the event file.  Events are
+    /// claimed with next(), which may be called from several threads at once;
+    /// each thread then seeks its own reader to offset(event).
+    class indexed_event_file
+    {
+
+      public:
+
+        enum file_format { HepMC2, HepMC3, LHEF };
+
+        /// Open and index an event file, optionally caching the index in the scratch directory
+        indexed_event_file(const str& filename, file_format format, bool cache_index = false);
+
+        indexed_event_file(const indexed_event_file&) = delete;
+        indexed_event_file& operator=(const indexed_event_file&) = delete;
+
+        /// Claim the next event not yet claimed by any thread; false if there are no more
+        bool next(size_t& event);
+
+        /// Hand out the events again from the first one (not thread safe)
+        void rewind() { cursor = 0; }
+
+        /// Byte offset of the start of an event
+        uint64_t offset(size_t event) const { return begin.at(event); }
+
+        /// Byte offset of the end of an event
+        uint64_t end_offset(size_t event) const { return end.at(event); }
+
+        /// Number of events in the file
+        size_t size() const { return begin.size(); }
+
+        /// Name of the cached index file for an event file
+        static str index_name(const str& filename);
+
+      private:
+
+        /// Scan the event file for event boundaries
+        void build_index(int fd, uint64_t file_size);
+
+        /// Read/write the cached index file, returning false if it is missing or stale
+        bool read_index(const str& index_file, uint64_t file_size, int64_t mtime);
+        void write_index(const str& index_file, uint64_t file_size, int64_t mtime) const;
+
+        str filename;
+        file_format format;
+
+        /// Byte ranges [begin, end) of the events
+        std::vector<uint64_t> begin, end;
+
+        /// Next event to hand out
+        std::atomic<size_t> cursor;
+
+    };
+
+  }
+
+}
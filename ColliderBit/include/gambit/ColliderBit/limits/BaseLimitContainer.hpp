@@ -16,6 +16,9 @@
 ///          (p.scott@imperial.ac.uk)
 ///  \date 2016 Jan
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *************************************
 
 #pragma once
@@ -27,6 +30,7 @@
 #include <iostream>
 #include <limits>
 #include <map>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -42,6 +46,39 @@ namespace Gambit
     /// @brief Factory function for lines
     inline LineSegment makeLine(const P2& pt1, const P2& pt2) { return LineSegment(pt1, pt2); }
 
+    /// @brief Uniform grid of cells over the bounding box of a set of line segments,
+    /// listing for each cell the segments that may pass through it.
+    class SegmentGrid
+    {
+      public:
+
+        SegmentGrid() : _x0(0.), _y0(0.), _w(1.), _h(1.), _eps(0.), _nx(1), _ny(1) {}
+
+        /// @brief Index the given segments (which must outlive the grid)
+        explicit SegmentGrid(const std::vector<LineSegment>& segments);
+
+        /// @brief Number of segments that line intersects (each counted once)
+        unsigned countIntersections(const LineSegment& line) const;
+
+        /// @brief Distance from point to the closest intersection of the segments with ray, which
+        /// must start at point; infinity if there is none.
+        double closestIntersection(const P2& point, const LineSegment& ray) const;
+
+      private:
+
+        /// @brief Visit the cells that the segment a -> b may pass through, column by column
+        /// starting from the end a.  Stops if visit(column, row) or endColumn(next column
+        /// boundary) returns true.
+        template <typename Visit, typename EndColumn>
+        void walk(const P2& a, const P2& b, Visit visit, EndColumn endColumn) const;
+
+        const std::vector<LineSegment>* _segments = nullptr;
+        double _x0, _y0, _w, _h, _eps;
+        int _nx, _ny;
+        /// Segment indices of cell (i,j) are _cellSegments[_cellStart[i*_ny+j] .. _cellStart[i*_ny+j+1]]
+        std::vector<unsigned> _cellStart, _cellSegments;
+    };
+
     /// @brief Base class for experimental limit curve interpolation
     class BaseLimitContainer
     {
@@ -66,6 +103,15 @@ namespace Gambit
         // Some point external to all limit contours
         P2 _externalPoint;
 
+        /// @brief Read the limit values and contours from a file in ColliderBit/data/LEP_limits
+        void loadContours(const std::string& filename);
+
+      private:
+        /// Spatial indices of the limit contours, built at first use
+        mutable std::map<unsigned, SegmentGrid> _contourGrids;
+        mutable std::once_flag _gridsBuilt;
+        const SegmentGrid& contourGrid(unsigned index) const;
+
       //@}
 
       /// @name Construction and Destruction
@@ -75,6 +121,9 @@ namespace Gambit
 
         BaseLimitContainer() {}
 
+        BaseLimitContainer(const BaseLimitContainer&) = delete;
+        BaseLimitContainer& operator=(const BaseLimitContainer&) = delete;
+
         virtual ~BaseLimitContainer();
 
       //@}
@@ -31,6 +31,9 @@
 ///          (tomas.gonzalo@monash.edu)
 ///  \date 2020 Mar
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #include <cmath>
@@ -126,16 +129,26 @@ namespace Gambit
       result.hGammaTot[0] = decays.width_in_GeV;
 
       // Set the branching fractions
-      result.BR_hjss[0] = decays.BF("s", "sbar");
-      result.BR_hjcc[0] = decays.BF("c", "cbar");
-      result.BR_hjbb[0] = decays.BF("b", "bbar");
-      result.BR_hjmumu[0] = decays.BF("mu+", "mu-");
-      result.BR_hjtautau[0] = decays.BF("tau+", "tau-");
-      result.BR_hjWW[0] = decays.BF("W+", "W-");
-      result.BR_hjZZ[0] = decays.BF("Z0", "Z0");
-      result.BR_hjZga[0] = decays.BF("gamma", "Z0");
-      result.BR_hjgaga[0] = decays.BF("gamma", "gamma");
-      result.BR_hjgg[0] = decays.BF("g", "g");
+      static const DecayTable::Channel ss("s", "sbar");
+      static const DecayTable::Channel cc("c", "cbar");
+      static const DecayTable::Channel bb("b", "bbar");
+      static const DecayTable::Channel mumu("mu+", "mu-");
+      static const DecayTable::Channel tautau("tau+", "tau-");
+      static const DecayTable::Channel WW("W+", "W-");
+      static const DecayTable::Channel ZZ("Z0", "Z0");
+      static const DecayTable::Channel Zga("gamma", "Z0");
+      static const DecayTable::Channel gaga("gamma", "gamma");
+      static const DecayTable::Channel gg("g", "g");
+      result.BR_hjss[0] = decays.BF(ss);
+      result.BR_hjcc[0] = decays.BF(cc);
+      result.BR_hjbb[0] = decays.BF(bb);
+      result.BR_hjmumu[0] = decays.BF(mumu);
+      result.BR_hjtautau[0] = decays.BF(tautau);
+      result.BR_hjWW[0] = decays.BF(WW);
+      result.BR_hjZZ[0] = decays.BF(ZZ);
+      result.BR_hjZga[0] = decays.BF(Zga);
+      result.BR_hjgaga[0] = decays.BF(gaga);
+      result.BR_hjgg[0] = decays.BF(gg);
 
       // Add the invisibles
       result.BR_hjinvisible[0] = 0.;
@@ -256,20 +269,37 @@ namespace Gambit
         result.deltaMh[i] = result.Mh[i] * std::max(upper,lower);
       }
 
+      // Decay channels, interned once
+      static const DecayTable::Channel ss("s", "sbar");
+      static const DecayTable::Channel cc("c", "cbar");
+      static const DecayTable::Channel bb("b", "bbar");
+      static const DecayTable::Channel mumu("mu+", "mu-");
+      static const DecayTable::Channel tautau("tau+", "tau-");
+      static const DecayTable::Channel WW("W+", "W-");
+      static const DecayTable::Channel ZZ("Z0", "Z0");
+      static const DecayTable::Channel Zga("gamma", "Z0");
+      static const DecayTable::Channel gaga("gamma", "gamma");
+      static const DecayTable::Channel gg("g", "g");
+      static const DecayTable::Channel cs("c", "sbar");
+      static const DecayTable::Channel cb("c", "bbar");
+      static const DecayTable::Channel taunu("tau+", "nu_tau");
+      static const DecayTable::Channel Wb("W+", "b");
+      static const DecayTable::Channel Hb("H+", "b");
+
       // Loop over all neutral Higgses, setting their branching fractions and total widths.
       for(int i = 0; i < n_neutral_higgses; i++)
       {
         result.hGammaTot[i] = h0_widths[i]->width_in_GeV;
-        result.BR_hjss[i] = h0_widths[i]->BF("s", "sbar");
-        result.BR_hjcc[i] = h0_widths[i]->BF("c", "cbar");
-        result.BR_hjbb[i] = h0_widths[i]->BF("b", "bbar");
-        result.BR_hjmumu[i] = h0_widths[i]->BF("mu+", "mu-");
-        result.BR_hjtautau[i] = h0_widths[i]->BF("tau+", "tau-");
-        result.BR_hjWW[i] = h0_widths[i]->has_channel("W+", "W-") ? h0_widths[i]->BF("W+", "W-") : 0.0;
-        result.BR_hjZZ[i] = h0_widths[i]->has_channel("Z0", "Z0") ? h0_widths[i]->BF("Z0", "Z0") : 0.0;
-        result.BR_hjZga[i] = h0_widths[i]->has_channel("gamma", "Z0") ? h0_widths[i]->BF("gamma", "Z0") : 0.0;
-        result.BR_hjgaga[i] = h0_widths[i]->BF("gamma", "gamma");
-        result.BR_hjgg[i] = h0_widths[i]->BF("g", "g");
+        result.BR_hjss[i] = h0_widths[i]->BF(ss);
+        result.BR_hjcc[i] = h0_widths[i]->BF(cc);
+        result.BR_hjbb[i] = h0_widths[i]->BF(bb);
+        result.BR_hjmumu[i] = h0_widths[i]->BF(mumu);
+        result.BR_hjtautau[i] = h0_widths[i]->BF(tautau);
+        result.BR_hjWW[i] = h0_widths[i]->has_channel(WW) ? h0_widths[i]->BF(WW) : 0.0;
+        result.BR_hjZZ[i] = h0_widths[i]->has_channel(ZZ) ? h0_widths[i]->BF(ZZ) : 0.0;
+        result.BR_hjZga[i] = h0_widths[i]->has_channel(Zga) ? h0_widths[i]->BF(Zga) : 0.0;
+        result.BR_hjgaga[i] = h0_widths[i]->BF(gaga);
+        result.BR_hjgg[i] = h0_widths[i]->BF(gg);
         // Do decays to invisibles
         result.BR_hjinvisible[i] = 0.;
         for (std::vector<std::pair<str,str>>::const_iterator it = Dep::Higgs_Couplings->invisibles.begin(); it != Dep::Higgs_Couplings->invisibles.end(); ++it)
@@ -298,13 +328,13 @@ namespace Gambit
 
       // Set charged Higgs branching fractions and total width.
       result.HpGammaTot[0] = H_plus_widths.width_in_GeV;
-      result.BR_Hpjcs[0]   = H_plus_widths.BF("c", "sbar");
-      result.BR_Hpjcb[0]   = H_plus_widths.BF("c", "bbar");
-      result.BR_Hptaunu[0] = H_plus_widths.BF("tau+", "nu_tau");
+      result.BR_Hpjcs[0]   = H_plus_widths.BF(cs);
+      result.BR_Hpjcb[0]   = H_plus_widths.BF(cb);
+      result.BR_Hptaunu[0] = H_plus_widths.BF(taunu);
 
       // Set top branching fractions
-      result.BR_tWpb       = t_widths.BF("W+", "b");
-      result.BR_tHpjb[0]   = t_widths.has_channel("H+", "b") ? t_widths.BF("H+", "b") : 0.0;
+      result.BR_tWpb       = t_widths.BF(Wb);
+      result.BR_tHpjb[0]   = t_widths.has_channel(Hb) ? t_widths.BF(Hb) : 0.0;
 
       // Retrieve cross-section ratios from the HiggsCouplingsTable
       set_CS(result, *Dep::Higgs_Couplings, n_neutral_higgses);
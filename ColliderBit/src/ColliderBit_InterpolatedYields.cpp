@@ -1761,9 +1761,8 @@ namespace Gambit
     void get_DMsimpVectorMedScalarDM_signal_yields(std::vector<double>& signal_yields, const Model_analysis_info& analysis_info, double mDM, double mMed, double gq, double gVchi)
     {
 
-      // Get the interpolator collections for the given operator_key
-      Utils::interp4d_collection& xsec_interp = analysis_info.get_interp4d("MonoJet_Data");
-      Utils::interp4d_collection& eff_interp = analysis_info.get_interp4d("MonoJet_Data");
+      // Get the interpolator collection (cross-section in column 0, efficiencies from column 2)
+      Utils::interp4d_collection& monojet_interp = analysis_info.get_interp4d("MonoJet_Data");
 
       // If DM mass is far enough below the resonance, we expect the signal prediction to be roughly constant
       double mDMmV_ratio_min = 0.1;
@@ -1773,14 +1772,16 @@ namespace Gambit
         mDMmV_ratio = mDMmV_ratio_min;
       }
 
-      // Compute the cross-section
-      double xsec_pb = xsec_interp.eval(mDMmV_ratio, mMed, gVchi, gq, 0);
+      // Evaluate the cross-section and all the efficiencies at once, into storage reused by later calls on this thread
+      static thread_local std::vector<double> interp_values;
+      monojet_interp.eval(mDMmV_ratio, mMed, gVchi, gq, interp_values);
+      double xsec_pb = interp_values[0];
 
       // Compute the signal yield for each signal region
       for (size_t sr_i = 0; sr_i < analysis_info.n_signal_regions; ++sr_i)
       {
 
-        double eff = eff_interp.eval(mDMmV_ratio, mMed, gVchi, gq, sr_i+2);
+        double eff = interp_values[sr_i+2];
         double signalcounts = analysis_info.lumi_invfb * xsec_pb * 1000.0 *  eff;
         signal_yields[sr_i] = signalcounts;
 
@@ -1800,9 +1801,8 @@ namespace Gambit
     void get_DMsimpVectorMedDiracDM_signal_yields(std::vector<double>& signal_yields, const Model_analysis_info& analysis_info, double mDM, double mMed, double gq, double gVchi, double gAchi)
     {
 
-      // Get the interpolator collections for the given operator_key
-      Utils::interp5d_collection& xsec_interp = analysis_info.get_interp5d("MonoJet_Data");
-      Utils::interp5d_collection& eff_interp = analysis_info.get_interp5d("MonoJet_Data");
+      // Get the interpolator collection (cross-section in column 0, efficiencies from column 2)
+      Utils::interp5d_collection& monojet_interp = analysis_info.get_interp5d("MonoJet_Data");
 
       // If DM mass is far enough below the resonance, we expect the signal prediction to be roughly constant
       double mDMmV_ratio_min = 0.1;
@@ -1812,14 +1812,16 @@ namespace Gambit
         mDMmV_ratio = mDMmV_ratio_min;
       }
 
-      // Compute the cross-section
-      double xsec_pb = xsec_interp.eval(mDMmV_ratio, mMed, gVchi, gAchi, gq, 0);
+      // Evaluate the cross-section and all the efficiencies at once
+      static thread_local std::vector<double> interp_values;
+      monojet_interp.eval(mDMmV_ratio, mMed, gVchi, gAchi, gq, interp_values);
+      double xsec_pb = interp_values[0];
 
       // Compute the signal yield for each signal region
       for (size_t sr_i = 0; sr_i < analysis_info.n_signal_regions; ++sr_i)
       {
 
-        double eff = eff_interp.eval(mDMmV_ratio, mMed, gVchi, gAchi, gq, sr_i+2);
+        double eff = interp_values[sr_i+2];
         signal_yields[sr_i] = analysis_info.lumi_invfb * xsec_pb * 1000.0 *  eff;
 
         #ifdef COLLIDERBIT_DEBUG
@@ -1838,9 +1840,8 @@ namespace Gambit
     void get_DMsimpVectorMedMajoranaDM_signal_yields(std::vector<double>& signal_yields, const Model_analysis_info& analysis_info, double mDM, double mMed, double gq, double gAchi)
     {
 
-      // Get the interpolator collections for the given operator_key
-      Utils::interp4d_collection& xsec_interp = analysis_info.get_interp4d("MonoJet_Data");
-      Utils::interp4d_collection& eff_interp = analysis_info.get_interp4d("MonoJet_Data");
+      // Get the interpolator collection (cross-section in column 0, efficiencies from column 2)
+      Utils::interp4d_collection& monojet_interp = analysis_info.get_interp4d("MonoJet_Data");
 
       // If DM mass is far enough below the resonance, we expect the signal prediction to be roughly constant
       double mDMmV_ratio_min = 0.1;
@@ -1850,14 +1851,16 @@ namespace Gambit
         mDMmV_ratio = mDMmV_ratio_min;
       }
 
-      // Compute the cross-section
-      double xsec_pb = xsec_interp.eval(mDMmV_ratio, mMed, gAchi, gq, 0);
+      // Evaluate the cross-section and all the efficiencies at once
+      static thread_local std::vector<double> interp_values;
+      monojet_interp.eval(mDMmV_ratio, mMed, gAchi, gq, interp_values);
+      double xsec_pb = interp_values[0];
 
       // Compute the signal yield for each signal region
       for (size_t sr_i = 0; sr_i < analysis_info.n_signal_regions; ++sr_i)
       {
 
-        double eff = eff_interp.eval(mDMmV_ratio, mMed, gAchi, gq, sr_i+2);
+        double eff = interp_values[sr_i+2];
         signal_yields[sr_i] = analysis_info.lumi_invfb * xsec_pb * 1000.0 *  eff;
 
         #ifdef COLLIDERBIT_DEBUG
@@ -1876,9 +1879,8 @@ namespace Gambit
     void get_DMsimpVectorMedVectorDM_signal_yields(std::vector<double>& signal_yields, const Model_analysis_info& analysis_info, double mDM, double mMed, double gq, double gVchi)
     {
 
-      // Get the interpolator collections for the given operator_key
-      Utils::interp4d_collection& xsec_interp = analysis_info.get_interp4d("MonoJet_Data");
-      Utils::interp4d_collection& eff_interp = analysis_info.get_interp4d("MonoJet_Data");
+      // Get the interpolator collection (cross-section in column 0, efficiencies from column 2)
+      Utils::interp4d_collection& monojet_interp = analysis_info.get_interp4d("MonoJet_Data");
 
       // If DM mass is far enough below the resonance, we expect the signal prediction to be roughly constant
       double mDMmV_ratio_min = 0.01;
@@ -1888,14 +1890,16 @@ namespace Gambit
         mDMmV_ratio = mDMmV_ratio_min;
       }
 
-      // Compute the cross-section
-      double xsec_pb = xsec_interp.eval(mDMmV_ratio, mMed, gVchi, gq, 0);
+      // Evaluate the cross-section and all the efficiencies at once
+      static thread_local std::vector<double> interp_values;
+      monojet_interp.eval(mDMmV_ratio, mMed, gVchi, gq, interp_values);
+      double xsec_pb = interp_values[0];
 
       // Compute the signal yield for each signal region
       for (size_t sr_i = 0; sr_i < analysis_info.n_signal_regions; ++sr_i)
       {
 
-        double eff = eff_interp.eval(mDMmV_ratio, mMed, gVchi, gq, sr_i+2);
+        double eff = interp_values[sr_i+2];
         signal_yields[sr_i] = analysis_info.lumi_invfb * xsec_pb * 1000.0 *  eff;
 
         #ifdef COLLIDERBIT_DEBUG
@@ -21,6 +21,9 @@
 ///          (t.e.gonzalo@fys.uio.no)
 ///  \date   2018 Feb
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #include <cmath>
@@ -62,12 +65,12 @@ namespace Gambit
       // Start by assuming the neutralino_1 is LSP
       lsp.pdg = 1000022;
       lsp.name = "~chi0_1";
-      lsp.mass = std::abs(spec.get(Par::Pole_Mass, 1000022, 0));
+      lsp.mass = std::abs(pole_mass<1000022>(spec));
 
       // Check if gravitino is LSP
       if (spec.has(Par::Pole_Mass, 1000039, 0))
       {
-        double m = spec.get(Par::Pole_Mass, 1000039, 0);
+        double m = pole_mass<1000039>(spec);
         if (m < lsp.mass)
         {
           lsp.pdg = 1000039;
@@ -1254,9 +1257,9 @@ namespace Gambit
       str sel_string = slhahelp::mass_es_from_gauge_es("~e_L", max_mixing, mssm);
       str ser_string = slhahelp::mass_es_from_gauge_es("~e_R", max_mixing, mssm);
       const double mass_seL=spec.get(Par::Pole_Mass,sel_string);
-      const double mass_neut1 = spec.get(Par::Pole_Mass,1000022, 0);
+      const double mass_neut1 = pole_mass<1000022>(spec);
       const double mass_seR = spec.get(Par::Pole_Mass,ser_string);
-      const double mZ = spec.get(Par::Pole_Mass,23, 0);
+      const double mZ = pole_mass<23>(spec);
       triplet<double> xsecWithError;
       double xsecLimit;
 
@@ -1322,9 +1325,9 @@ namespace Gambit
       str smul_string = slhahelp::mass_es_from_gauge_es("~mu_L", max_mixing, mssm);
       str smur_string = slhahelp::mass_es_from_gauge_es("~mu_R", max_mixing, mssm);
       const double mass_smuL=spec.get(Par::Pole_Mass,smul_string);
-      const double mass_neut1 = spec.get(Par::Pole_Mass,1000022, 0);
+      const double mass_neut1 = pole_mass<1000022>(spec);
       const double mass_smuR = spec.get(Par::Pole_Mass,smur_string);
-      const double mZ = spec.get(Par::Pole_Mass,23, 0);
+      const double mZ = pole_mass<23>(spec);
       triplet<double> xsecWithError;
       double xsecLimit;
 
@@ -1391,9 +1394,9 @@ namespace Gambit
       str stau1_string = slhahelp::mass_es_closest_to_family("~tau_1", mssm,tol,LOCAL_INFO,pterror);
       str stau2_string = slhahelp::mass_es_closest_to_family("~tau_2", mssm,tol,LOCAL_INFO,pterror);
       const double mass_stau1=spec.get(Par::Pole_Mass,stau1_string);
-      const double mass_neut1 = spec.get(Par::Pole_Mass,1000022, 0);
+      const double mass_neut1 = pole_mass<1000022>(spec);
       const double mass_stau2 = spec.get(Par::Pole_Mass,stau2_string);
-      const double mZ = spec.get(Par::Pole_Mass,23, 0);
+      const double mZ = pole_mass<23>(spec);
       triplet<double> xsecWithError;
       double xsecLimit;
 
@@ -1460,9 +1463,9 @@ namespace Gambit
       str sel_string = slhahelp::mass_es_from_gauge_es("~e_L", max_mixing, mssm);
       str ser_string = slhahelp::mass_es_from_gauge_es("~e_R", max_mixing, mssm);
       const double mass_seL=spec.get(Par::Pole_Mass,sel_string);
-      const double mass_neut1 = spec.get(Par::Pole_Mass,1000022, 0);
+      const double mass_neut1 = pole_mass<1000022>(spec);
       const double mass_seR = spec.get(Par::Pole_Mass,ser_string);
-      const double mZ = spec.get(Par::Pole_Mass,23, 0);
+      const double mZ = pole_mass<23>(spec);
       triplet<double> xsecWithError;
       double xsecLimit;
 
@@ -1529,9 +1532,9 @@ namespace Gambit
       str smul_string = slhahelp::mass_es_from_gauge_es("~mu_L", max_mixing, mssm);
       str smur_string = slhahelp::mass_es_from_gauge_es("~mu_R", max_mixing, mssm);
       const double mass_smuL=spec.get(Par::Pole_Mass,smul_string);
-      const double mass_neut1 = spec.get(Par::Pole_Mass,1000022, 0);
+      const double mass_neut1 = pole_mass<1000022>(spec);
       const double mass_smuR = spec.get(Par::Pole_Mass,smur_string);
-      const double mZ = spec.get(Par::Pole_Mass,23, 0);
+      const double mZ = pole_mass<23>(spec);
       triplet<double> xsecWithError;
       double xsecLimit;
 
@@ -1599,9 +1602,9 @@ namespace Gambit
       str stau1_string = slhahelp::mass_es_closest_to_family("~tau_1", mssm,tol,LOCAL_INFO,pterror);
       str stau2_string = slhahelp::mass_es_closest_to_family("~tau_2", mssm,tol,LOCAL_INFO,pterror);
       const double mass_stau1=spec.get(Par::Pole_Mass,stau1_string);
-      const double mass_neut1 = spec.get(Par::Pole_Mass,1000022, 0);
+      const double mass_neut1 = pole_mass<1000022>(spec);
       const double mass_stau2 = spec.get(Par::Pole_Mass,stau2_string);
-      const double mZ = spec.get(Par::Pole_Mass,23, 0);
+      const double mZ = pole_mass<23>(spec);
       triplet<double> xsecWithError;
       double xsecLimit;
 
@@ -1667,15 +1670,31 @@ namespace Gambit
       const Spectrum& spec = *Dep::MSSM_spectrum;
 
       const DecayTable& decays = *Dep::decay_rates;
-      const double mass_neut1 = spec.get(Par::Pole_Mass,1000022, 0);
-      const double mass_neut2 = spec.get(Par::Pole_Mass,1000023, 0);
-      const double mass_neut3 = spec.get(Par::Pole_Mass,1000025, 0);
-      const double mass_neut4 = spec.get(Par::Pole_Mass,1000035, 0);
-      const double mZ = spec.get(Par::Pole_Mass,23, 0);
+      const double mass_neut1 = pole_mass<1000022>(spec);
+      const double mass_neut2 = pole_mass<1000023>(spec);
+      const double mass_neut3 = pole_mass<1000025>(spec);
+      const double mass_neut4 = pole_mass<1000035>(spec);
+      const double mZ = pole_mass<23>(spec);
       triplet<double> xsecWithError;
       double xsecLimit, totalBR;
 
       static const L3NeutralinoAllChannelsLimitAt188pt6GeV limitContainer;
+      // Neutralino decays that look like Z* decays
+      static const std::vector<DecayTable::Channel> Zstar_channels =
+      {
+        DecayTable::Channel("~chi0_1", "Z0"),
+        DecayTable::Channel("~chi0_1", "ubar", "u"),
+        DecayTable::Channel("~chi0_1", "dbar", "d"),
+        DecayTable::Channel("~chi0_1", "cbar", "c"),
+        DecayTable::Channel("~chi0_1", "sbar", "s"),
+        DecayTable::Channel("~chi0_1", "bbar", "b"),
+        DecayTable::Channel("~chi0_1", "e+", "e-"),
+        DecayTable::Channel("~chi0_1", "mu+", "mu-"),
+        DecayTable::Channel("~chi0_1", "tau+", "tau-"),
+        DecayTable::Channel("~chi0_1", "nubar_e", "nu_e"),
+        DecayTable::Channel("~chi0_1", "nubar_mu", "nu_mu"),
+        DecayTable::Channel("~chi0_1", "nubar_tau", "nu_tau")
+      };
       // #ifdef COLLIDERBIT_DEBUG
       //   static bool dumped=false;
       //   if(!dumped)
@@ -1695,18 +1714,7 @@ namespace Gambit
       xsecWithError = *Dep::LEP188_xsec_chi00_12;
       // Total up all channels which look like Z* decays
       totalBR = 0;
-      totalBR += decays.at("~chi0_2").BF("~chi0_1", "Z0");
-      totalBR += decays.at("~chi0_2").BF("~chi0_1", "ubar", "u");
-      totalBR += decays.at("~chi0_2").BF("~chi0_1", "dbar", "d");
-      totalBR += decays.at("~chi0_2").BF("~chi0_1", "cbar", "c");
-      totalBR += decays.at("~chi0_2").BF("~chi0_1", "sbar", "s");
-      totalBR += decays.at("~chi0_2").BF("~chi0_1", "bbar", "b");
-      totalBR += decays.at("~chi0_2").BF("~chi0_1", "e+", "e-");
-      totalBR += decays.at("~chi0_2").BF("~chi0_1", "mu+", "mu-");
-      totalBR += decays.at("~chi0_2").BF("~chi0_1", "tau+", "tau-");
-      totalBR += decays.at("~chi0_2").BF("~chi0_1", "nubar_e", "nu_e");
-      totalBR += decays.at("~chi0_2").BF("~chi0_1", "nubar_mu", "nu_mu");
-      totalBR += decays.at("~chi0_2").BF("~chi0_1", "nubar_tau", "nu_tau");
+      for (const DecayTable::Channel& channel : Zstar_channels) totalBR += decays.at("~chi0_2").BF(channel);
       xsecWithError.upper *= totalBR;
       xsecWithError.central *= totalBR;
       xsecWithError.lower *= totalBR;
@@ -1726,18 +1734,7 @@ namespace Gambit
       xsecWithError = *Dep::LEP188_xsec_chi00_13;
       // Total up all channels which look like Z* decays
       totalBR = 0;
-      totalBR += decays.at("~chi0_3").BF("~chi0_1", "Z0");
-      totalBR += decays.at("~chi0_3").BF("~chi0_1", "ubar", "u");
-      totalBR += decays.at("~chi0_3").BF("~chi0_1", "dbar", "d");
-      totalBR += decays.at("~chi0_3").BF("~chi0_1", "cbar", "c");
-      totalBR += decays.at("~chi0_3").BF("~chi0_1", "sbar", "s");
-      totalBR += decays.at("~chi0_3").BF("~chi0_1", "bbar", "b");
-      totalBR += decays.at("~chi0_3").BF("~chi0_1", "e+", "e-");
-      totalBR += decays.at("~chi0_3").BF("~chi0_1", "mu+", "mu-");
-      totalBR += decays.at("~chi0_3").BF("~chi0_1", "tau+", "tau-");
-      totalBR += decays.at("~chi0_3").BF("~chi0_1", "nubar_e", "nu_e");
-      totalBR += decays.at("~chi0_3").BF("~chi0_1", "nubar_mu", "nu_mu");
-      totalBR += decays.at("~chi0_3").BF("~chi0_1", "nubar_tau", "nu_tau");
+      for (const DecayTable::Channel& channel : Zstar_channels) totalBR += decays.at("~chi0_3").BF(channel);
       xsecWithError.upper *= totalBR;
       xsecWithError.central *= totalBR;
       xsecWithError.lower *= totalBR;
@@ -1757,18 +1754,7 @@ namespace Gambit
       xsecWithError = *Dep::LEP188_xsec_chi00_14;
       // Total up all channels which look like Z* decays
       totalBR = 0;
-      totalBR += decays.at("~chi0_4").BF("~chi0_1", "Z0");
-      totalBR += decays.at("~chi0_4").BF("~chi0_1", "ubar", "u");
-      totalBR += decays.at("~chi0_4").BF("~chi0_1", "dbar", "d");
-      totalBR += decays.at("~chi0_4").BF("~chi0_1", "cbar", "c");
-      totalBR += decays.at("~chi0_4").BF("~chi0_1", "sbar", "s");
-      totalBR += decays.at("~chi0_4").BF("~chi0_1", "bbar", "b");
-      totalBR += decays.at("~chi0_4").BF("~chi0_1", "e+", "e-");
-      totalBR += decays.at("~chi0_4").BF("~chi0_1", "mu+", "mu-");
-      totalBR += decays.at("~chi0_4").BF("~chi0_1", "tau+", "tau-");
-      totalBR += decays.at("~chi0_4").BF("~chi0_1", "nubar_e", "nu_e");
-      totalBR += decays.at("~chi0_4").BF("~chi0_1", "nubar_mu", "nu_mu");
-      totalBR += decays.at("~chi0_4").BF("~chi0_1", "nubar_tau", "nu_tau");
+      for (const DecayTable::Channel& channel : Zstar_channels) totalBR += decays.at("~chi0_4").BF(channel);
       xsecWithError.upper *= totalBR;
       xsecWithError.central *= totalBR;
       xsecWithError.lower *= totalBR;
@@ -1793,11 +1779,11 @@ namespace Gambit
       const Spectrum& spec = *Dep::MSSM_spectrum;
 
       const DecayTable& decays = *Dep::decay_rates;
-      const double mass_neut1 = spec.get(Par::Pole_Mass,1000022, 0);
-      const double mass_neut2 = spec.get(Par::Pole_Mass,1000023, 0);
-      const double mass_neut3 = spec.get(Par::Pole_Mass,1000025, 0);
-      const double mass_neut4 = spec.get(Par::Pole_Mass,1000035, 0);
-      const double mZ = spec.get(Par::Pole_Mass,23, 0);
+      const double mass_neut1 = pole_mass<1000022>(spec);
+      const double mass_neut2 = pole_mass<1000023>(spec);
+      const double mass_neut3 = pole_mass<1000025>(spec);
+      const double mass_neut4 = pole_mass<1000035>(spec);
+      const double mZ = pole_mass<23>(spec);
       triplet<double> xsecWithError;
       double xsecLimit, totalBR;
 
@@ -1919,13 +1905,23 @@ namespace Gambit
       const str snue = slhahelp::mass_es_from_gauge_es("~nu_e_L", mssm, tol, LOCAL_INFO, pt_error);
       const str snumu = slhahelp::mass_es_from_gauge_es("~nu_mu_L", mssm, tol, LOCAL_INFO, pt_error);
       const str snutau = slhahelp::mass_es_from_gauge_es("~nu_tau_L", mssm, tol, LOCAL_INFO, pt_error);
-      const double mass_char1 = spec.get(Par::Pole_Mass,1000024, 0);
-      const double mass_char2 = spec.get(Par::Pole_Mass,1000037, 0);
-      const double mZ = spec.get(Par::Pole_Mass,23, 0);
+      const double mass_char1 = pole_mass<1000024>(spec);
+      const double mass_char2 = pole_mass<1000037>(spec);
+      const double mZ = pole_mass<23>(spec);
       triplet<double> xsecWithError;
       double xsecLimit, totalBR;
 
       static const L3CharginoAllChannelsLimitAt188pt6GeV limitContainer;
+      // Chargino decays that look like W* decays
+      static const std::vector<DecayTable::Channel> Wstar_channels =
+      {
+        DecayTable::Channel("~chi0_1", "W+"),
+        DecayTable::Channel("~chi0_1", "u", "dbar"),
+        DecayTable::Channel("~chi0_1", "c", "sbar"),
+        DecayTable::Channel("~chi0_1", "e+", "nu_e"),
+        DecayTable::Channel("~chi0_1", "mu+", "nu_mu"),
+        DecayTable::Channel("~chi0_1", "tau+", "nu_tau")
+      };
       // #ifdef COLLIDERBIT_DEBUG
       //   static bool dumped=false;
       //   if(!dumped)
@@ -1945,12 +1941,7 @@ namespace Gambit
       xsecWithError = *Dep::LEP188_xsec_chipm_11;
       // Total up all channels which look like W* decays
       totalBR = 0;
-      totalBR += decays.at("~chi+_1").BF("~chi0_1", "W+");
-      totalBR += decays.at("~chi+_1").BF("~chi0_1", "u", "dbar");
-      totalBR += decays.at("~chi+_1").BF("~chi0_1", "c", "sbar");
-      totalBR += decays.at("~chi+_1").BF("~chi0_1", "e+", "nu_e");
-      totalBR += decays.at("~chi+_1").BF("~chi0_1", "mu+", "nu_mu");
-      totalBR += decays.at("~chi+_1").BF("~chi0_1", "tau+", "nu_tau");
+      for (const DecayTable::Channel& channel : Wstar_channels) totalBR += decays.at("~chi+_1").BF(channel);
       totalBR += decays.at("~chi+_1").BF(snue, "e+")
                * decays.at(snue).BF("~chi0_1", "nu_e");
       totalBR += decays.at("~chi+_1").BF(snumu, "mu+")
@@ -1976,12 +1967,7 @@ namespace Gambit
       xsecWithError = *Dep::LEP188_xsec_chipm_22;
       // Total up all channels which look like W* decays
       totalBR = 0;
-      totalBR += decays.at("~chi+_2").BF("~chi0_1", "W+");
-      totalBR += decays.at("~chi+_2").BF("~chi0_1", "u", "dbar");
-      totalBR += decays.at("~chi+_2").BF("~chi0_1", "c", "sbar");
-      totalBR += decays.at("~chi+_2").BF("~chi0_1", "e+", "nu_e");
-      totalBR += decays.at("~chi+_2").BF("~chi0_1", "mu+", "nu_mu");
-      totalBR += decays.at("~chi+_2").BF("~chi0_1", "tau+", "nu_tau");
+      for (const DecayTable::Channel& channel : Wstar_channels) totalBR += decays.at("~chi+_2").BF(channel);
       totalBR += decays.at("~chi+_2").BF(snue, "e+")
                * decays.at(snue).BF("~chi0_1", "nu_e");
       totalBR += decays.at("~chi+_2").BF(snumu, "mu+")
@@ -2021,9 +2007,9 @@ namespace Gambit
       const str snue = slhahelp::mass_es_from_gauge_es("~nu_e_L", mssm, tol, LOCAL_INFO, pt_error);
       const str snumu = slhahelp::mass_es_from_gauge_es("~nu_mu_L", mssm, tol, LOCAL_INFO, pt_error);
       const str snutau = slhahelp::mass_es_from_gauge_es("~nu_tau_L", mssm, tol, LOCAL_INFO, pt_error);
-      const double mass_char1 = spec.get(Par::Pole_Mass,1000024, 0);
-      const double mass_char2 = spec.get(Par::Pole_Mass,1000037, 0);
-      const double mZ = spec.get(Par::Pole_Mass,23, 0);
+      const double mass_char1 = pole_mass<1000024>(spec);
+      const double mass_char2 = pole_mass<1000037>(spec);
+      const double mZ = pole_mass<23>(spec);
       triplet<double> xsecWithError;
       double xsecLimit, totalBR;
 
@@ -2126,9 +2112,9 @@ namespace Gambit
 
       const DecayTable& decays = *Dep::decay_rates;
       const double mass_neut1 = lsp.mass;
-      const double mass_char1 = spec.get(Par::Pole_Mass,1000024, 0);
-      const double mass_char2 = spec.get(Par::Pole_Mass,1000037, 0);
-      const double mZ = spec.get(Par::Pole_Mass,23, 0);
+      const double mass_char1 = pole_mass<1000024>(spec);
+      const double mass_char2 = pole_mass<1000037>(spec);
+      const double mZ = pole_mass<23>(spec);
       triplet<double> xsecWithError;
       double xsecLimit, totalBR;
 
@@ -2213,9 +2199,9 @@ namespace Gambit
       const str snumu = slhahelp::mass_es_from_gauge_es("~nu_mu_L", mssm, tol, LOCAL_INFO, pt_error);
       const str snutau = slhahelp::mass_es_from_gauge_es("~nu_tau_L", mssm, tol, LOCAL_INFO, pt_error);
       const double mass_neut1 = lsp.mass;
-      const double mass_char1 = spec.get(Par::Pole_Mass,1000024, 0);
-      const double mass_char2 = spec.get(Par::Pole_Mass,1000037, 0);
-      const double mZ = spec.get(Par::Pole_Mass,23, 0);
+      const double mass_char1 = pole_mass<1000024>(spec);
+      const double mass_char2 = pole_mass<1000037>(spec);
+      const double mZ = pole_mass<23>(spec);
       triplet<double> xsecWithError;
       double xsecLimit, totalBR;
 
@@ -2355,9 +2341,9 @@ namespace Gambit
       const str snumu = slhahelp::mass_es_from_gauge_es("~nu_mu_L", mssm, tol, LOCAL_INFO, pt_error);
       const str snutau = slhahelp::mass_es_from_gauge_es("~nu_tau_L", mssm, tol, LOCAL_INFO, pt_error);
       const double mass_neut1 = lsp.mass;
-      const double mass_char1 = spec.get(Par::Pole_Mass,1000024, 0);
-      const double mass_char2 = spec.get(Par::Pole_Mass,1000037, 0);
-      const double mZ = spec.get(Par::Pole_Mass,23, 0);
+      const double mass_char1 = pole_mass<1000024>(spec);
+      const double mass_char2 = pole_mass<1000037>(spec);
+      const double mZ = pole_mass<23>(spec);
       triplet<double> xsecWithError;
       double xsecLimit, totalBR;
 
@@ -2465,9 +2451,9 @@ namespace Gambit
       using namespace Pipes::OPAL_Degenerate_Chargino_Conservative_LLike;
 
       const Spectrum& spec = *Dep::MSSM_spectrum;
-      const double mass_neut1 = spec.get(Par::Pole_Mass,1000022, 0);
-      const double mass_char1 = spec.get(Par::Pole_Mass,1000024, 0);
-      const double mZ = spec.get(Par::Pole_Mass,23, 0);
+      const double mass_neut1 = pole_mass<1000022>(spec);
+      const double mass_char1 = pole_mass<1000024>(spec);
+      const double mZ = pole_mass<23>(spec);
       triplet<double> xsecWithError;
       double xsecLimit;
 
@@ -2515,9 +2501,9 @@ namespace Gambit
       const str snumu = slhahelp::mass_es_from_gauge_es("~nu_mu_L", mssm, tol, LOCAL_INFO, pt_error);
       const str snutau = slhahelp::mass_es_from_gauge_es("~nu_tau_L", mssm, tol, LOCAL_INFO, pt_error);
       const double mass_neut1 = lsp.mass;
-      const double mass_char1 = spec.get(Par::Pole_Mass,1000024, 0);
-      const double mass_char2 = spec.get(Par::Pole_Mass,1000037, 0);
-      const double mZ = spec.get(Par::Pole_Mass,23, 0);
+      const double mass_char1 = pole_mass<1000024>(spec);
+      const double mass_char2 = pole_mass<1000037>(spec);
+      const double mZ = pole_mass<23>(spec);
       triplet<double> xsecWithError;
       double xsecLimit, totalBR;
 
@@ -2620,11 +2606,11 @@ namespace Gambit
       const Spectrum& spec = *Dep::MSSM_spectrum;
 
       const DecayTable& decays = *Dep::decay_rates;
-      const double mass_neut1 = spec.get(Par::Pole_Mass,1000022, 0);
-      const double mass_neut2 = spec.get(Par::Pole_Mass,1000023, 0);
-      const double mass_neut3 = spec.get(Par::Pole_Mass,1000025, 0);
-      const double mass_neut4 = spec.get(Par::Pole_Mass,1000035, 0);
-      const double mZ = spec.get(Par::Pole_Mass,23, 0);
+      const double mass_neut1 = pole_mass<1000022>(spec);
+      const double mass_neut2 = pole_mass<1000023>(spec);
+      const double mass_neut3 = pole_mass<1000025>(spec);
+      const double mass_neut4 = pole_mass<1000035>(spec);
+      const double mZ = pole_mass<23>(spec);
       triplet<double> xsecWithError;
       double xsecLimit, totalBR;
 
@@ -2737,8 +2723,8 @@ namespace Gambit
       // Unpack neutralino & gravitino mass
       using namespace Pipes::L3_Gravitino_LLike;
       const Spectrum& spectrum = *Dep::MSSM_spectrum;
-      const double m_chi = spectrum.get(Par::Pole_Mass, 1000022, 0);
-      const double m_gravitino = spectrum.get(Par::Pole_Mass, 1000039, 0);
+      const double m_chi = pole_mass<1000022>(spectrum);
+      const double m_gravitino = pole_mass<1000039>(spectrum);
 
       // Calculate relevant branching ratio
       const DecayTable& decay_rates = *Dep::decay_rates;
@@ -34,6 +34,8 @@
 ///
 ///  *********************************************
 
+#include <atomic>
+
 #include "gambit/Elements/gambit_module_headers.hpp"
 #include "gambit/ColliderBit/ColliderBit_eventloop.hpp"
 
@@ -63,6 +65,7 @@ namespace Gambit
       static std::map<str,int> min_nEvents;
       static std::map<str,int> max_nEvents;
       static std::map<str,int> stoppingres;
+      static std::map<str,int> chunk_size;
       if (first)
       {
         // Should we silence stdout during the loop?
@@ -90,6 +93,9 @@ namespace Gambit
           result.maxFailedEvents[collider]                                = colOptions.getValueOrDef<int>(1, "maxFailedEvents");
           result.invalidate_failed_points[collider]                       = colOptions.getValueOrDef<bool>(false, "invalidate_failed_points");
           stoppingres[collider]                                           = colOptions.getValueOrDef<int>(200, "events_between_convergence_checks");
+          // Number of events claimed by a thread at a time (by default ~8 chunks per thread between convergence checks)
+          chunk_size[collider]                                            = colOptions.getValueOrDef<int>(
+                                                                              std::max(1, std::min(64, stoppingres.at(collider)/(8*omp_get_max_threads()))), "events_per_chunk");
           result.analyses[collider]                                       = colOptions.getValueOrDef<std::vector<str>>(std::vector<str>(), "analyses");
           result.event_count[collider]                                    = 0;
           // Check that the nEvents options given make sense.
@@ -184,6 +190,7 @@ namespace Gambit
         piped_invalid_point.check();
 
         // Convergence loop
+        int iterations_started = 0;
         while(result.current_event_count() < max_nEvents.at(collider) and not *Loop::done)
         {
           int eventCountBetweenConvergenceChecks = 0;
@@ -191,59 +198,70 @@ namespace Gambit
             cout << DEBUG_PREFIX << "Starting main event loop.  Will do " << stoppingres.at(collider) << " events before testing convergence." << endl;
           #endif
 
-          // Main event loop
+          // Main event loop.
+          // The threads claim chunks of event iterations from a shared atomic counter, and only add
+          // their successful events to the event count at the end of each chunk. An event that fails
+          // with a std::domain_error frees up an extra iteration, so that the batch still contains
+          // the same number of successful events.
           result.event_generation_began = true;
-          #pragma omp parallel
+          const int batch_size = std::min(stoppingres.at(collider), max_nEvents.at(collider) - result.current_event_count());
+          std::atomic<int> batch_claimed(0);
+          std::atomic<int> batch_target(batch_size);
+          const int first_iteration = iterations_started;
+          #pragma omp parallel reduction(+:eventCountBetweenConvergenceChecks)
           {
-            while(eventCountBetweenConvergenceChecks < stoppingres.at(collider) and
-                  result.current_event_count() < max_nEvents.at(collider) and
-                  not *Loop::done and
-                  not result.end_of_event_file and
-                  not result.exceeded_maxFailedEvents and
-                  not piped_errors.inquire()
-                  )
+            auto keep_going = [&]()
             {
-              bool thread_do_iteration = true;
-              int thread_my_iteration;
-
-              // Increment counters before executing the corresponding event loop iteration, 
-              // to stop other threads from starting any event iterations beyond max_nEvents.
-              #pragma omp critical
+              // The flags are set with atomic writes by other threads during the loop, so read them atomically too
+              bool end_of_event_file, exceeded_maxFailedEvents;
+              #pragma omp atomic read
+              end_of_event_file = result.end_of_event_file;
+              #pragma omp atomic read
+              exceeded_maxFailedEvents = result.exceeded_maxFailedEvents;
+              return not *Loop::done and
+                     not end_of_event_file and
+                     not exceeded_maxFailedEvents and
+                     not piped_errors.inquire();
+            };
+
+            while(keep_going())
+            {
+              // Claim the next chunk of iterations, without going beyond the current target.
+              int first = batch_claimed.load();
+              int n;
+              do
               {
-                if(result.current_event_count() < max_nEvents.at(collider))
-                {
-                  result.current_event_count()++;
-                  thread_my_iteration = result.current_event_count();
-                  eventCountBetweenConvergenceChecks++;
-                }
-                else
-                {
-                  thread_do_iteration = false;
-                }
+                n = std::min(chunk_size.at(collider), batch_target.load() - first);
               }
-              
-              if(thread_do_iteration)
+              while(n > 0 and not batch_claimed.compare_exchange_weak(first, first + n));
+              if (n <= 0) break;
+
+              int thread_events = 0;
+              for (int i = first; i < first + n and keep_going(); ++i)
               {
                 try
                 {
                   // Execute event loop iteration
-                  Loop::executeIteration(thread_my_iteration);
+                  Loop::executeIteration(first_iteration + i + 1);
+                  thread_events++;
                 }
                 catch (std::domain_error& e)
                 {
                   cout << "\n   Caught std::domain_error. Continuing to the next event...\n\n";
-                  // Decrement counters since the event iteration failed
-                  #pragma omp critical
-                  {
-                    result.current_event_count()--;
-                    eventCountBetweenConvergenceChecks--;
-                  }
+                  // Make room for another event, since the event iteration failed
+                  batch_target++;
                 }
               }
 
+              // Merge the successful events of this chunk into the event count
+              #pragma omp atomic
+              result.current_event_count() += thread_events;
+              eventCountBetweenConvergenceChecks += thread_events;
+
             } // end while loop
 
           } // end omp parallel block
+          iterations_started += batch_claimed.load();
 
           // Any problems during the main event loop?
           piped_warnings.check(ColliderBit_warning());
@@ -37,10 +37,17 @@
 ///  \author Chris Chang
 ///  \date   2022 April
 ///
+///  \author The GAMBIT Collaboration
+///  \date   2026 Oct
+///
 ///  *********************************************
 
+#include <array>
+#include <cstdint>
+#include <mutex>
 #include <string>
 #include <sstream>
+#include <limits>
 
 #include "gambit/Elements/gambit_module_headers.hpp"
 #include "gambit/ColliderBit/ColliderBit_rollcall.hpp"
@@ -55,10 +62,15 @@
 #include "gambit/Utils/end_ignore_warnings.hpp"
 
 #include <gsl/gsl_sf_gamma.h>
+#include <gsl/gsl_qrng.h>
+#include <gsl/gsl_cdf.h>
 
 // #define COLLIDERBIT_DEBUG
 #define DEBUG_PREFIX "DEBUG: OMP thread " << omp_get_thread_num() << ":  "
 
+// Maximum dimension of GSL's Sobol sequence generator
+#define SOBOL_MAX_DIMENSION 40
+
 namespace Gambit
 {
 
@@ -328,6 +340,76 @@ namespace Gambit
     }
 
 
+    /// Accumulator for log(sum_i exp(x_i)), which neither over- nor underflows
+    struct logsumexp_accumulator
+    {
+      double max = -std::numeric_limits<double>::infinity();
+      double sum = 0;  //< sum_i exp(x_i - max)
+
+      /// Add log(sum_i exp(x_i)) = m + log(s)
+      void add(double m, double s)
+      {
+        if (s <= 0) return;
+        if (m > max)
+        {
+          sum = sum*exp(max - m) + s;
+          max = m;
+        }
+        else sum += s*exp(m - max);
+      }
+
+      /// Add a block of values
+      void add(const Eigen::Ref<const Eigen::ArrayXd>& x)
+      {
+        if (x.size() == 0) return;
+        const double m = x.maxCoeff();
+        if (m == -std::numeric_limits<double>::infinity()) return;
+        add(m, (x - m).exp().sum());
+      }
+
+      void add(const logsumexp_accumulator& other) { add(other.max, other.sum); }
+
+      /// log(sum_i exp(x_i))
+      double value() const { return max + log(sum); }
+    };
+
+
+    /// Direction numbers of GSL's Sobol sequence, one array per bit, for the lowest nbits bits.
+    /// GSL keeps them private, so they are read off its generator: it steps from point c to c+1 by
+    /// XORing in the direction numbers of the lowest zero bit of c, and so first uses bit k at c = 2^k-1.
+    /// The table is extended as larger samples need more bits, and copied out under a lock.
+    std::vector<std::array<uint32_t, SOBOL_MAX_DIMENSION>> sobol_directions(size_t nbits)
+    {
+      static std::mutex directions_mutex;
+      static std::vector<std::array<uint32_t, SOBOL_MAX_DIMENSION>> directions;
+      static std::array<uint32_t, SOBOL_MAX_DIMENSION> numerators{};
+      static gsl_qrng* qrng = NULL;
+      static size_t count = 0;
+
+      std::lock_guard<std::mutex> lock(directions_mutex);
+      if (qrng == NULL) qrng = gsl_qrng_alloc(gsl_qrng_sobol, SOBOL_MAX_DIMENSION);
+      double point[SOBOL_MAX_DIMENSION];
+      while (directions.size() < nbits)
+      {
+        const size_t first_use = (size_t(1) << directions.size()) - 1;
+        std::array<uint32_t, SOBOL_MAX_DIMENSION> direction{};
+        for (; count <= first_use; ++count)
+        {
+          gsl_qrng_get(qrng, point);
+          for (size_t j = 0; j < SOBOL_MAX_DIMENSION; ++j)
+          {
+            // GSL's points are 30-bit numerators over 2^30
+            const uint32_t numerator = uint32_t(std::ldexp(point[j], 30));
+            if (count == first_use) direction[j] = numerators[j] ^ numerator;
+            numerators[j] = numerator;
+          }
+        }
+        directions.push_back(direction);
+      }
+      return std::vector<std::array<uint32_t, SOBOL_MAX_DIMENSION>>(directions.begin(), directions.begin() + nbits);
+    }
+
+
     double marg_loglike_cov(const Eigen::ArrayXd& n_preds,
                             const Eigen::ArrayXd& n_obss,
                             const Eigen::ArrayXd& sqrtevals,
@@ -342,36 +424,69 @@ namespace Gambit
       static const double CONVERGENCE_TOLERANCE_REL = runOptions->getValueOrDef<double>(0.05, "nuisance_marg_convthres_rel");
       static const size_t NSAMPLE_INPUT = runOptions->getValueOrDef<size_t>(100000, "nuisance_marg_nsamples_start");
       static const bool   NULIKE1SR = runOptions->getValueOrDef<bool>(true, "nuisance_marg_nulike1sr");
+      // Sampler for the nuisances: "mc" for pseudo-random or "sobol" for randomised quasi-Monte Carlo
+      static const str    SAMPLER = runOptions->getValueOrDef<str>("mc", "nuisance_marg_sampler");
+      static const bool   SOBOL = (SAMPLER == "sobol");
+      if (not SOBOL and SAMPLER != "mc")
+      {
+        ColliderBit_error().raise(LOCAL_INFO, "Unknown nuisance_marg_sampler '" + SAMPLER + "'. Options are 'mc' and 'sobol'.");
+      }
 
       // Optionally use nulike's more careful 1D marginalisation for one-SR cases
       if (NULIKE1SR && nSR == 1) return marg_loglike_nulike1sr(n_preds, n_obss, sqrtevals);
 
+      // GSL's Sobol generator is limited to 40 dimensions; use pseudo-random samples beyond that
+      const bool use_sobol = SOBOL and nSR <= SOBOL_MAX_DIMENSION;
+      if (SOBOL and not use_sobol)
+      {
+        logger() << LogTags::warn << "Too many signal regions (" << nSR << ") for Sobol sampling of the nuisances. "
+                 << "Using pseudo-random samples instead." << EOM;
+      }
+
+      // Number of samples processed together by each thread
+      const size_t BLOCKSIZE = 256;
+
       // Dynamic convergence control & test has_and_variables
       size_t nsample = NSAMPLE_INPUT;
       bool first_iteration = true;
       double diff_abs = 9999;
       double diff_rel = 1;
 
-      // Likelihood variables (note use of long double to guard against blow-up of L as opposed to log(L1/L0))
+      // Likelihood variables. The sums of the sample likelihoods are accumulated in log space, to
+      // guard against under- and overflow of L as opposed to log(L1/L0).
       long double ana_like_prev = 1;
       long double ana_like = 1;
-      long double lsum_prev = 0;
+      double ana_loglike_prev = 0;
+      double ana_loglike = 0;
+      logsumexp_accumulator lsum_prev;
 
-      // Sampler for unit-normal nuisances
-      std::normal_distribution<double> unitnormdbn(0,1);
+      // Rotation of the unit-normal nuisances into rate deltas in the SR basis
+      const Eigen::MatrixXd rotation = evecs * sqrtevals.matrix().asDiagonal();
 
       // Log factorial of observed number of events.
       // Currently use the ln(Gamma(x)) function gsl_sf_lngamma from GSL. (Need continuous function.)
       // We may want to switch to using Stirling's approximation: ln(n!) ~ n*ln(n) - n
-      Eigen::ArrayXd logfact_n_obss(nSR);
+      double sum_logfact_n_obss = 0;
       for (size_t j = 0; j < nSR; ++j)
-        logfact_n_obss(j) = gsl_sf_lngamma(n_obss(j) + 1);
+        sum_logfact_n_obss += gsl_sf_lngamma(n_obss(j) + 1);
+
+      // For quasi-Monte Carlo, each batch uses the first nsample points of the Sobol sequence, randomly
+      // shifted modulo 1 in each dimension.  Each batch draws its own shift, so the batches are
+      // independent unbiased estimates.
+      std::vector<double> sobol_shift(use_sobol ? nSR : 0);
 
       // Check absolute difference between independent has_and_estimates
       /// @todo Should also implement a check of relative difference
       while ((diff_abs > CONVERGENCE_TOLERANCE_ABS && diff_rel > CONVERGENCE_TOLERANCE_REL) || 1.0/sqrt(nsample) > CONVERGENCE_TOLERANCE_ABS)
       {
-        long double lsum = 0;
+        logsumexp_accumulator lsum;
+        const size_t nblocks = (nsample + BLOCKSIZE - 1) / BLOCKSIZE;
+
+        // Point i of the sequence is given by the Gray code of i+1, so needs as many bits as nsample has
+        size_t sobol_bits = 0;
+        while (use_sobol and (nsample >> sobol_bits) != 0) ++sobol_bits;
+        const std::vector<std::array<uint32_t, SOBOL_MAX_DIMENSION>> directions = sobol_directions(sobol_bits);
+        for (double& shift : sobol_shift) shift = Random::draw();
 
         /// @note How to correct negative rates? Discard (scales badly), set to
         /// epsilon (= discontinuous & unphysical pdf), transform to log-space
@@ -382,33 +497,73 @@ namespace Gambit
 
         #pragma omp parallel
         {
-          // Sample correlated SR rates from a rotated Gaussian defined by the covariance matrix and offset by the mean rates
-          double lsum_private  = 0;
-          #pragma omp for nowait
-          for (size_t i = 0; i < nsample; ++i)
-          {
-            Eigen::VectorXd norm_samples(nSR);
-            for (size_t j = 0; j < nSR; ++j)
-              norm_samples(j) = sqrtevals(j) * unitnormdbn(Random::rng());
+          // Work space for a block of samples (one sample per column)
+          Eigen::MatrixXd unit_samples(nSR, BLOCKSIZE);
+          Eigen::ArrayXXd n_pred_samples(nSR, BLOCKSIZE);
+          Eigen::ArrayXd loglikes(BLOCKSIZE);
+          logsumexp_accumulator lsum_private;
+
+          // Sampler for unit-normal nuisances
+          std::normal_distribution<double> unitnormdbn(0,1);
 
-            // Rotate rate deltas into the SR basis and shift by SR mean rates
-            const Eigen::VectorXd n_pred_samples  = n_preds + (evecs*norm_samples).array();
+          // Numerators of the current Sobol point
+          std::array<uint32_t, SOBOL_MAX_DIMENSION> numerators;
 
-            // Calculate Poisson likelihood and add to composite likelihood calculation
-            double combined_loglike = 0;
-            for (size_t j = 0; j < nSR; ++j)
+          #pragma omp for schedule(static) nowait
+          for (size_t block = 0; block < nblocks; ++block)
+          {
+            const size_t first = block*BLOCKSIZE;
+            const size_t nb = std::min(BLOCKSIZE, nsample - first);
+
+            // Draw the unit-normal nuisances for the whole block
+            if (use_sobol)
+            {
+              // Jump straight to the first point of the block, then step through the sequence in Gray-code order
+              numerators.fill(0);
+              size_t k = 0;
+              for (size_t gray = (first+1) ^ ((first+1) >> 1); gray != 0; gray >>= 1, ++k)
+              {
+                if (gray & 1) for (size_t j = 0; j < nSR; ++j) numerators[j] ^= directions[k][j];
+              }
+              for (size_t i = 0; i < nb; ++i)
+              {
+                if (i > 0)
+                {
+                  // Point m differs from point m-1 in the direction numbers of the lowest zero bit of m
+                  k = 0;
+                  for (size_t m = first + i; m & 1; m >>= 1) ++k;
+                  for (size_t j = 0; j < nSR; ++j) numerators[j] ^= directions[k][j];
+                }
+                for (size_t j = 0; j < nSR; ++j)
+                {
+                  double u = std::ldexp(double(numerators[j]), -30) + sobol_shift[j];
+                  if (u >= 1) u -= 1;
+                  u = std::min(std::max(u, std::numeric_limits<double>::min()), 1 - std::numeric_limits<double>::epsilon());
+                  unit_samples(j,i) = gsl_cdf_ugaussian_Pinv(u);
+                }
+              }
+            }
+            else
             {
-              const double lambda_j = std::max(n_pred_samples(j), 1e-3); //< manually avoid <= 0 rates
-              const double loglike_j  = n_obss(j)*log(lambda_j) - lambda_j - logfact_n_obss(j);
-              combined_loglike += loglike_j;
+              for (size_t i = 0; i < nb; ++i)
+                for (size_t j = 0; j < nSR; ++j)
+                  unit_samples(j,i) = unitnormdbn(Random::rng());
             }
-            // Add combined likelihood to running sums (to later calculate averages)
-            lsum_private += exp(combined_loglike);
+
+            // Rotate rate deltas into the SR basis and shift by SR mean rates, manually avoiding <= 0 rates
+            n_pred_samples.leftCols(nb) = ((rotation * unit_samples.leftCols(nb)).array().colwise() + n_preds).max(1e-3);
+
+            // Calculate the combined Poisson log-likelihood of each sample
+            loglikes.head(nb) = (n_obss.matrix().transpose() * n_pred_samples.leftCols(nb).log().matrix()).transpose().array()
+                                - n_pred_samples.leftCols(nb).colwise().sum().transpose() - sum_logfact_n_obss;
+
+            // Add the likelihoods to the running sum (to later calculate averages)
+            lsum_private.add(loglikes.head(nb));
           }
 
           #pragma omp critical
           {
-            lsum  += lsum_private;
+            lsum.add(lsum_private);
           }
         } // End omp parallel
 
@@ -420,13 +575,15 @@ namespace Gambit
         }
         else
         {
-          ana_like_prev = lsum_prev / (double)nsample;
-          ana_like = lsum / (double)nsample;
+          ana_loglike_prev = lsum_prev.value() - log((double)nsample);
+          ana_loglike = lsum.value() - log((double)nsample);
+          ana_like_prev = expl((long double)ana_loglike_prev);
+          ana_like = expl((long double)ana_loglike);
           diff_abs = fabs(ana_like_prev - ana_like);
-          diff_rel = diff_abs/ana_like;
+          diff_rel = fabs(expm1(ana_loglike_prev - ana_loglike));
 
           // Update variables
-          lsum_prev += lsum;  // Aggregate result. This doubles the effective batch size for lsum_prev.
+          lsum_prev.add(lsum);  // Aggregate result. This doubles the effective batch size for lsum_prev.
           nsample *=2;  // This ensures that the next batch for lsum is as big as the current batch size for lsum_prev, so they can be compared directly.
         }
 
@@ -434,7 +591,7 @@ namespace Gambit
         cout << DEBUG_PREFIX
              << "diff_rel: " << diff_rel << endl
              << "   diff_abs: " << diff_abs << endl
-             << "   logl: " << log(ana_like) << endl;
+             << "   logl: " << ana_loglike << endl;
         cout << DEBUG_PREFIX << "nsample for the next iteration is: " << nsample << endl;
         cout << DEBUG_PREFIX << endl;
         #endif
@@ -443,8 +600,10 @@ namespace Gambit
 
       // Combine the independent estimates ana_like and ana_like_prev.
       // Use equal weights since the estimates are based on equal batch sizes.
-      ana_like = 0.5*(ana_like + ana_like_prev);
-      const double ana_margll = log(ana_like);
+      logsumexp_accumulator combined;
+      combined.add(ana_loglike, 1);
+      combined.add(ana_loglike_prev, 1);
+      const double ana_margll = combined.value() - log(2.0);
       #ifdef COLLIDERBIT_DEBUG
       cout << DEBUG_PREFIX << "Combined estimate: ana_loglike: " << ana_margll << "   (based on 2*nsample=" << 2*nsample << " samples)" << endl;
       #endif
@@ -28,23 +28,21 @@ namespace Gambit
     /// Set exceeded_maxFailedEvents = true and decrement event counter by 1
     void MCLoopInfo::report_exceeded_maxFailedEvents() const
     {
-      #pragma omp critical
-      {
-        exceeded_maxFailedEvents = true;
-        // Decrement event counter
-        _current_event_count_it->second--;        
-      }
+      #pragma omp atomic write
+      exceeded_maxFailedEvents = true;
+      // Decrement event counter (atomically, as the event loop adds to it without locking)
+      #pragma omp atomic
+      _current_event_count_it->second--;
     }
 
     /// Set end_of_event_file = true and decrement event counter by 1
     void MCLoopInfo::report_end_of_event_file() const
     {
-      #pragma omp critical
-      {
-        end_of_event_file = true;
-        // Decrement event counter
-        _current_event_count_it->second--;        
-      }
+      #pragma omp atomic write
+      end_of_event_file = true;
+      // Decrement event counter (atomically, as the event loop adds to it without locking)
+      #pragma omp atomic
+      _current_event_count_it->second--;
     }
 
     /// Reset flags
@@ -22,6 +22,9 @@
 ///          (p.scott@imperial.ac.uk)
 ///  \date 2019 Feb
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #include <vector>
@@ -37,6 +40,7 @@ namespace Gambit
                          , _luminosity_is_set(false)
                          , _is_scaled(false)
                          , _needs_collection(true)
+                         , _selections(&_own_selections)
                          { }
 
     /// Public method to reset this instance for reuse, avoiding the need for "new" or "delete".
@@ -48,6 +52,12 @@ namespace Gambit
       analysis_specific_reset();
     }
 
+    /// Share the baseline object selections of another cache, or use a private one if passed nullptr.
+    void Analysis::set_selection_cache(SelectionCache* cache)
+    {
+      _selections = (cache != nullptr ? cache : &_own_selections);
+    }
+
     /// Analyze the event (accessed by reference).
     void Analysis::analyze(const HEPUtils::Event& e) { analyze(&e); }
 
@@ -55,6 +65,8 @@ namespace Gambit
     void Analysis::analyze(const HEPUtils::Event* e)
     {
       _needs_collection = true;
+      // A shared cache is moved on to the new event by its owner
+      if (_selections == &_own_selections) _own_selections.new_event(e);
       run(e);
     }
 
@@ -22,6 +22,9 @@
 ///          (p.scott@imperial.ac.uk)
 ///  \date 2019 Feb
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #include <stdexcept>
@@ -328,7 +331,9 @@ namespace Gambit
       // Create analysis pointers and add to the map
       for (auto& aname : analysis_names)
       {
-        analyses_map[collider_name][aname] = mkAnalysis(aname);
+        Analysis* analysis = mkAnalysis(aname);
+        analysis->set_selection_cache(&selections);
+        analyses_map[collider_name][aname] = analysis;
       }
     }
 
@@ -397,12 +402,15 @@ namespace Gambit
     /// Pass event through specific analysis
     void AnalysisContainer::analyze(const HEPUtils::Event& event, str collider_name, str analysis_name) const
     {
+      selections.new_event(&event);
       analyses_map.at(collider_name).at(analysis_name)->analyze(event);
     }
 
     /// Pass event through all analyses for a specific collider
     void AnalysisContainer::analyze(const HEPUtils::Event& event, str collider_name) const
     {
+      // Analyses asking for the same baseline selections share them for this event
+      selections.new_event(&event);
       for (auto& analysis_pointer_pair : analyses_map.at(collider_name))
       {
         analysis_pointer_pair.second->analyze(event);
@@ -114,29 +114,13 @@ namespace Gambit {
 
         // Get baseline jets
         /// @todo Drop b-tag if pT < 50 GeV or |eta| > 2.5?
-        vector<const Jet*> baselineJets;
-        for (const Jet* jet : event->jets("antikt_R04"))
-          if (jet->pT() > 20. && jet->abseta() < 2.8) {
-            baselineJets.push_back(jet);
-          }
+        const vector<const Jet*>& baselineJets = selections().jets("antikt_R04", 20., 2.8);
 
         // Get baseline electrons
-        vector<const Particle*> baselineElectrons;
-        for (const Particle* electron : event->electrons())
-          if (electron->pT() > 7. && electron->abseta() < 2.47)
-            baselineElectrons.push_back(electron);
-
-        // Apply electron efficiency
-        ATLAS::applyElectronEff(baselineElectrons);
+        const vector<const Particle*>& baselineElectrons = selections().electrons(7., 2.47, ATLAS::applyElectronEff);
 
         // Get baseline muons
-        vector<const Particle*> baselineMuons;
-        for (const Particle* muon : event->muons())
-          if (muon->pT() > 7. && muon->abseta() < 2.7)
-            baselineMuons.push_back(muon);
-
-        // Apply muon efficiency
-        ATLAS::applyMuonEff(baselineMuons);
+        const vector<const Particle*>& baselineMuons = selections().muons(7., 2.7, ATLAS::applyMuonEff);
 
         // Full isolation details:
         //  - Remove electrons within dR = 0.2 of a b-tagged jet
@@ -381,43 +381,17 @@ namespace Gambit {
         double Met = event->met();
 
         // Construct baseline electron objects
-        vector<const HEPUtils::Particle*> baselineElectrons;
-        for (const HEPUtils::Particle* electron : event->electrons())
-        {
-          if (electron->pT() > 5. && electron->abseta() < 2.47)
-          {
-            baselineElectrons.push_back(electron);
-          }
-        }
-
-        // Apply electron efficiency
-        ATLAS::applyElectronEff(baselineElectrons);
+        const vector<const HEPUtils::Particle*>& baselineElectrons = selections().electrons(5., 2.47, ATLAS::applyElectronEff);
 
         // Construct baseline muon objects
-        vector<const HEPUtils::Particle*> baselineMuons;
-        for (const HEPUtils::Particle* muon : event->muons())
-        {
-          if (muon->pT() > 4. && muon->abseta() < 2.7)
-          {
-            baselineMuons.push_back(muon);
-          }
-        }
-
-        // Apply muon efficiency
-        ATLAS::applyMuonEff(baselineMuons);
+        const vector<const HEPUtils::Particle*>& baselineMuons = selections().muons(4., 2.7, ATLAS::applyMuonEff);
 
         // Construct set of all light baseline leptons
         vector<const HEPUtils::Particle*> baselineLeptons = baselineElectrons;
         baselineLeptons.insert(baselineLeptons.end(), baselineMuons.begin(), baselineMuons.end() );
 
         // Construct baseline tau objects
-        vector<const HEPUtils::Particle*> baselineTaus;
-        for (const HEPUtils::Particle* tau : event->taus())
-        {
-          if (tau->pT() > 20. && fabs(tau->eta()) < 2.5) baselineTaus.push_back(tau);
-        }
-        // Apply tau efficiency
-        ATLAS::applyTauEfficiencyR1(baselineTaus);
+        vector<const HEPUtils::Particle*> baselineTaus = selections().taus(20., 2.5, ATLAS::applyTauEfficiencyR1);
 
         // Photons
         vector<const HEPUtils::Particle*> signalPhotons;
@@ -176,26 +176,10 @@ namespace Gambit
         double met = event->met();
 
         // Electrons
-        vector<const HEPUtils::Particle*> electrons;
-        for (const HEPUtils::Particle* electron : event->electrons()) {
-          if (electron->pT() > 10.
-              && fabs(electron->eta()) < 2.47)
-            electrons.push_back(electron);
-        }
-
-        // Apply electron efficiency
-        ATLAS::applyElectronEff(electrons);
+        vector<const HEPUtils::Particle*> electrons = selections().electrons(10., 2.47, ATLAS::applyElectronEff);
 
         // Muons
-        vector<const HEPUtils::Particle*> muons;
-        for (const HEPUtils::Particle* muon : event->muons()) {
-          if (muon->pT() > 10.
-              && fabs(muon->eta()) < 2.5)
-            muons.push_back(muon);
-        }
-
-        // Apply muon efficiency
-        ATLAS::applyMuonEff(muons);
+        vector<const HEPUtils::Particle*> muons = selections().muons(10., 2.5, ATLAS::applyMuonEff);
 
         // Jets
         vector<const HEPUtils::Jet*> candJets;
@@ -317,27 +317,9 @@ namespace Gambit
           // Now define vectors of baseline objects, including:
           // - retrieval of electron, muon and jets from the event
           // - application of basic pT and eta cuts
-          vector<const HEPUtils::Particle*> electrons;
-          for (const HEPUtils::Particle* electron : event->electrons())
-          {
-            if (electron->pT() > 10.
-                && fabs(electron->eta()) < 2.47)
-              electrons.push_back(electron);
-          }
-
-          // Apply electron efficiency
-          ATLAS::applyElectronEff(electrons);
-
-          vector<const HEPUtils::Particle*> muons;
-          for (const HEPUtils::Particle* muon : event->muons())
-          {
-            if (muon->pT() > 10.
-                && fabs(muon->eta()) < 2.7)
-              muons.push_back(muon);
-          }
+          vector<const HEPUtils::Particle*> electrons = selections().electrons(10., 2.47, ATLAS::applyElectronEff);
 
-          // Apply muon efficiency
-          ATLAS::applyMuonEff(muons);
+          vector<const HEPUtils::Particle*> muons = selections().muons(10., 2.7, ATLAS::applyMuonEff);
 
           //vector<const HEPUtils::Jet*> candJets;
           //for (const HEPUtils::Jet* jet : event->jets()) {
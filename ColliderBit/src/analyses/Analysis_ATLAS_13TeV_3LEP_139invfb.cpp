@@ -218,12 +218,7 @@ namespace Gambit
           int nBaselineLeptons = baselineElectrons.size() + baselineMuons.size() + nHighEtaMuons;
 
           // Baseline jets
-          vector<const HEPUtils::Jet*> baselineJets;
-          for (const HEPUtils::Jet* jet : event->jets("antikt_R04"))
-          {
-            if (jet->pT() > 20. && fabs(jet->eta()) < 4.5 )
-              baselineJets.push_back(jet);
-          }
+          vector<const HEPUtils::Jet*> baselineJets = selections().jets("antikt_R04", 20., 4.5);
 
 
           //
@@ -175,32 +175,12 @@ namespace Gambit {
         // - application of basic pT and eta cuts
 
         // Electrons
-        vector<const HEPUtils::Particle*> electrons;
-        for (const HEPUtils::Particle* electron : event->electrons()) {
-          if (electron->pT() > 5.
-              && fabs(electron->eta()) < 2.47)
-            electrons.push_back(electron);
-        }
-
-        // Apply electron efficiency
-        ATLAS::applyElectronEff(electrons);
+        vector<const HEPUtils::Particle*> electrons = selections().electrons(5., 2.47, ATLAS::applyElectronEff);
 
         // Muons
-        vector<const HEPUtils::Particle*> muons;
-        for (const HEPUtils::Particle* muon : event->muons()) {
-          if (muon->pT() > 5.
-              && fabs(muon->eta()) < 2.5)
-            muons.push_back(muon);
-        }
+        vector<const HEPUtils::Particle*> muons = selections().muons(5., 2.5, ATLAS::applyMuonEff);
 
-        // Apply muon efficiency
-        ATLAS::applyMuonEff(muons);
-
-        vector<const HEPUtils::Jet*> candJets;
-        for (const HEPUtils::Jet* jet : event->jets("antikt_R04")) {
-          if (jet->pT() > 25. && fabs(jet->eta()) < 2.5)
-            candJets.push_back(jet);
-        }
+        vector<const HEPUtils::Jet*> candJets = selections().jets("antikt_R04", 25., 2.5);
 
         // Overlap removal
         JetLeptonOverlapRemoval(candJets,electrons,0.2);
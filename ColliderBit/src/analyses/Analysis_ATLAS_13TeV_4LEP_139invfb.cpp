@@ -326,10 +326,7 @@ namespace Gambit
         // Since tau efficiencies are not applied as part of the BuckFast ATLAS sim we apply it here
         ATLAS::applyTauEfficiencyR2(baselineTaus);
 
-        for (const HEPUtils::Jet* jet : event->jets("antikt_R04"))
-        {
-          if (jet->pT()>20. && jet->abseta()<2.8) baselineJets.push_back(jet);
-        }
+        baselineJets = selections().jets("antikt_R04", 20., 2.8);
         // Missing: Some additional requirements for jets with abseta < 2.5, originating from b-quarks (see paper)
         // Missing: some jets are originating from hadronically decayed taus pT > 10, abseta < 2.47 and more. (see paper)
 
@@ -217,17 +217,10 @@ namespace Gambit
 
         // Missing: Apply "medium" muon ID criteria
 
-        for (const HEPUtils::Particle* tau : event->taus())
-        {
-          if (tau->pT()>20. && tau->abseta()<2.47) baselineTaus.push_back(tau);
-        }
         // Since tau efficiencies are not applied as part of the BuckFast ATLAS sim we apply it here
-        ATLAS::applyTauEfficiencyR2(baselineTaus);
+        baselineTaus = selections().taus(20., 2.47, ATLAS::applyTauEfficiencyR2);
 
-        for (const HEPUtils::Jet* jet : event->jets("antikt_R04"))
-        {
-          if (jet->pT()>20. && jet->abseta()<2.8) baselineJets.push_back(jet);
-        }
+        baselineJets = selections().jets("antikt_R04", 20., 2.8);
         // Missing: Some additional requirements for jets with pT < 60 and abseta < 2.4 (see paper)
 
 
@@ -128,16 +128,10 @@ namespace Gambit
           }
 
           // Fill tau object
-          for (const Particle* t : event->taus())
-          {
-            if (t->pT() > 20 && t->abseta()<2.5) baselineTaus.push_back(t);
-          }
+          baselineTaus = selections().taus(20., 2.5);
 
           // Fill photon object
-          for (const Particle* p : event->photons())
-          {
-            if (p->pT() > 10 && p->abseta()<2.37) baselinePhotons.push_back(p);
-          }
+          baselinePhotons = selections().photons(10., 2.37);
 
           // Get jets (0.9 is to emulate the requirement of coming from a primary vertex)
           vector<const Jet*> baselineJets;
@@ -167,29 +167,14 @@ namespace Gambit {
         double met = event->met();
 
         // Baseline objects
-        vector<const HEPUtils::Particle*> baselineElectrons;
-        for (const HEPUtils::Particle* electron : event->electrons()) {
-          if (electron->pT()>10. && electron->abseta()<2.47)baselineElectrons.push_back(electron);
-        }
-
-        // Apply electron efficiency
-        ATLAS::applyElectronEff(baselineElectrons);
+        vector<const HEPUtils::Particle*> baselineElectrons = selections().electrons(10., 2.47, ATLAS::applyElectronEff);
 
         // Apply loose electron selection
         ATLAS::applyLooseIDElectronSelectionR2(baselineElectrons);
 
-        vector<const HEPUtils::Particle*> baselineMuons;
-        for (const HEPUtils::Particle* muon : event->muons()) {
-          if (muon->pT()>10. && muon->abseta()<2.7)baselineMuons.push_back(muon);
-        }
+        const vector<const HEPUtils::Particle*>& baselineMuons = selections().muons(10., 2.7, ATLAS::applyMuonEff);
 
-        // Apply muon efficiency
-        ATLAS::applyMuonEff(baselineMuons);
-
-        vector<const HEPUtils::Jet*> baselineJets;
-        for (const HEPUtils::Jet* jet : event->jets("antikt_R04")) {
-          if (jet->pT()>20. && jet->abseta()<4.5)baselineJets.push_back(jet);
-        }
+        vector<const HEPUtils::Jet*> baselineJets = selections().jets("antikt_R04", 20., 4.5);
 
         //Overlap Removal + Signal Objects
         vector<const HEPUtils::Particle*> signalElectrons;
@@ -179,13 +179,7 @@ namespace Gambit {
 
         // Get baseline jets
         /// @todo Drop b-tag if |eta| > 2.5?
-        for (const Jet* jet : event->jets("antikt_R04")) 
-        {
-          if (jet->pT() > 20. && jet->abseta() < 2.8) 
-          {
-            baselineJets.push_back(jet);
-          }
-        }
+        baselineJets = selections().jets("antikt_R04", 20., 2.8);
 
         // Alternative met construction 1
         // P4 pmiss_sum;
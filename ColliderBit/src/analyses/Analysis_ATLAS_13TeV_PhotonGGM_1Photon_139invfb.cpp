@@ -105,13 +105,7 @@ namespace Gambit
         // - pT > 25
         // - |eta| < 2.7
         // - loose isolation
-        vector<const HEPUtils::Particle*> signalMuons;
-        for (const HEPUtils::Particle* muon : event->muons())
-        {
-          if (muon->pT() > 25. && muon->abseta() < 2.7) signalMuons.push_back(muon);
-        }
-        // Apply muon efficiency
-        ATLAS::applyMuonEff(signalMuons);
+        vector<const HEPUtils::Particle*> signalMuons = selections().muons(25., 2.7, ATLAS::applyMuonEff);
         // Apply loose muon isolation efficiency
         ATLAS::applyMuonIsolationEfficiency2020(signalMuons, "Loose");
 
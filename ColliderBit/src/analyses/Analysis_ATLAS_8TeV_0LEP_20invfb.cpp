@@ -60,26 +60,11 @@ namespace Gambit {
         double met = event->met();
 
         // Now define vectors of baseline objects
-        vector<const HEPUtils::Particle*> baselineElectrons;
-        for (const HEPUtils::Particle* electron : event->electrons()) {
-          if (electron->pT() > 10. && fabs(electron->eta()) < 2.47) baselineElectrons.push_back(electron);
-        }
-
-        // Apply electron efficiency
-        ATLAS::applyElectronEff(baselineElectrons);
+        const vector<const HEPUtils::Particle*>& baselineElectrons = selections().electrons(10., 2.47, ATLAS::applyElectronEff);
 
-        vector<const HEPUtils::Particle*> baselineMuons;
-        for (const HEPUtils::Particle* muon : event->muons()) {
-          if (muon->pT() > 10. && fabs(muon->eta()) < 2.4) baselineMuons.push_back(muon);
-        }
+        const vector<const HEPUtils::Particle*>& baselineMuons = selections().muons(10., 2.4, ATLAS::applyMuonEff);
 
-        // Apply muon efficiency
-        ATLAS::applyMuonEff(baselineMuons);
-
-        vector<const HEPUtils::Jet*> baselineJets;
-        for (const HEPUtils::Jet* jet : event->jets("antikt_R04")) {
-          if (jet->pT() > 20. && fabs(jet->eta()) < 4.5) baselineJets.push_back(jet);
-        }
+        const vector<const HEPUtils::Jet*>& baselineJets = selections().jets("antikt_R04", 20., 4.5);
 
         // Overlap removal: only applied to jets with |eta|<2.8
         vector<const HEPUtils::Particle*> signalElectrons;
@@ -89,24 +89,12 @@ namespace Gambit {
         double met = event->met();
 
         // Baseline objects
-        vector<const HEPUtils::Particle*> baselineElectrons;
-        for (const HEPUtils::Particle* electron : event->electrons()) {
-          if (electron->pT()>10. && electron->abseta()<2.47)baselineElectrons.push_back(electron);
-        }
-
-        // Apply electron efficiency
-        ATLAS::applyElectronEff(baselineElectrons);
+        vector<const HEPUtils::Particle*> baselineElectrons = selections().electrons(10., 2.47, ATLAS::applyElectronEff);
 
         // Apply medium electron selection
         ATLAS::applyMediumIDElectronSelection(baselineElectrons);
 
-        vector<const HEPUtils::Particle*> baselineMuons;
-        for (const HEPUtils::Particle* muon : event->muons()) {
-          if (muon->pT()>10. && muon->abseta()<2.4)baselineMuons.push_back(muon);
-        }
-
-        // Apply muon efficiency
-        ATLAS::applyMuonEff(baselineMuons);
+        const vector<const HEPUtils::Particle*>& baselineMuons = selections().muons(10., 2.4, ATLAS::applyMuonEff);
 
         vector<const HEPUtils::Jet*> baselineJets;
         for (const HEPUtils::Jet* jet : event->jets("antikt_R04")) {
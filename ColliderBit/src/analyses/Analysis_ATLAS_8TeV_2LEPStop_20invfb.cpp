@@ -74,22 +74,10 @@ namespace Gambit {
         //double met = event->met();
 
         // Now define vector of baseline electrons
-        vector<const HEPUtils::Particle*> baselineElectrons;
-        for (const HEPUtils::Particle* electron : event->electrons()) {
-          if (electron->pT() > 10. && electron->abseta() < 2.47) baselineElectrons.push_back(electron);
-        }
-
-        // Apply electron efficiency
-        ATLAS::applyElectronEff(baselineElectrons);
+        const vector<const HEPUtils::Particle*>& baselineElectrons = selections().electrons(10., 2.47, ATLAS::applyElectronEff);
 
         // Now define vector of baseline muons
-        vector<const HEPUtils::Particle*> baselineMuons;
-        for (const HEPUtils::Particle* muon : event->muons()) {
-          if (muon->pT() > 10. && muon->abseta() < 2.4) baselineMuons.push_back(muon);
-        }
-
-        // Apply muon efficiency
-        ATLAS::applyMuonEff(baselineMuons);
+        const vector<const HEPUtils::Particle*>& baselineMuons = selections().muons(10., 2.4, ATLAS::applyMuonEff);
 
         vector<const HEPUtils::Particle*> baselineTaus;
         for (const HEPUtils::Particle* tau : event->taus()) {
@@ -92,24 +92,10 @@ namespace Gambit
           double met = event->met();
 
           // Now define vector of baseline electrons
-          vector<const HEPUtils::Particle*> baselineElectrons;
-          for (const HEPUtils::Particle* electron : event->electrons())
-          {
-            if (electron->pT() > 7. && fabs(electron->eta()) < 2.47) baselineElectrons.push_back(electron);
-          }
-
-          // Apply electron efficiency
-          ATLAS::applyElectronEff(baselineElectrons);
+          const vector<const HEPUtils::Particle*>& baselineElectrons = selections().electrons(7., 2.47, ATLAS::applyElectronEff);
 
           // Now define vector of baseline muons
-          vector<const HEPUtils::Particle*> baselineMuons;
-          for (const HEPUtils::Particle* muon : event->muons())
-          {
-            if (muon->pT() > 6. && fabs(muon->eta()) < 2.4) baselineMuons.push_back(muon);
-          }
-
-          // Apply muon efficiency
-          ATLAS::applyMuonEff(baselineMuons);
+          const vector<const HEPUtils::Particle*>& baselineMuons = selections().muons(6., 2.4, ATLAS::applyMuonEff);
 
           const std::vector<double> a = {0,10.};
           const std::vector<double> b = {0,10000.};
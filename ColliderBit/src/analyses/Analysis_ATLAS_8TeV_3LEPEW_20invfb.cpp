@@ -195,22 +195,10 @@ namespace Gambit {
         double met = event->met();
 
         // Now define vector of baseline electrons
-        vector<const HEPUtils::Particle*> signalElectrons;
-        for (const HEPUtils::Particle* electron : event->electrons()) {
-          if (electron->pT() > 10. && fabs(electron->eta()) < 2.47) signalElectrons.push_back(electron);
-        }
-
-        // Apply electron efficiency
-        ATLAS::applyElectronEff(signalElectrons);
+        vector<const HEPUtils::Particle*> signalElectrons = selections().electrons(10., 2.47, ATLAS::applyElectronEff);
 
         // Now define vector of baseline muons
-        vector<const HEPUtils::Particle*> signalMuons;
-        for (const HEPUtils::Particle* muon : event->muons()) {
-          if (muon->pT() > 10. && fabs(muon->eta()) < 2.4) signalMuons.push_back(muon);
-        }
-
-        // Apply muon efficiency
-        ATLAS::applyMuonEff(signalMuons);
+        vector<const HEPUtils::Particle*> signalMuons = selections().muons(10., 2.4, ATLAS::applyMuonEff);
 
         vector<const HEPUtils::Jet*> signalJets;
         vector<const HEPUtils::Jet*> bJets;
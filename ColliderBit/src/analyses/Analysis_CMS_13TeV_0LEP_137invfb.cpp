@@ -108,18 +108,10 @@ namespace Gambit
               basephotons.push_back(gamma);
 
           // Get baseline electrons and apply efficiency
-          vector<const Particle*> baseelecs;
-          for (const Particle* electron : event->electrons())
-            if (electron->pT() > 10. && electron->abseta() < 2.5)
-              baseelecs.push_back(electron);
-          CMS::applyElectronEff(baseelecs);
+          const vector<const Particle*>& baseelecs = selections().electrons(10., 2.5, CMS::applyElectronEff);
 
           // Get baseline muons and apply efficiency
-          vector<const Particle*> basemuons;
-          for (const Particle* muon : event->muons())
-            if (muon->pT() > 10. && muon->abseta() < 2.4)
-              basemuons.push_back(muon);
-          CMS::applyMuonEff(basemuons);
+          const vector<const Particle*>& basemuons = selections().muons(10., 2.4, CMS::applyMuonEff);
 
 
           // Photon isolation
@@ -81,22 +81,10 @@ namespace Gambit {
 
 
         // Get baseline electrons
-        vector<const Particle*> baseelecs;
-        for (const Particle* electron : event->electrons())
-          if (electron->pT() > 10. && electron->abseta() < 2.5)
-            baseelecs.push_back(electron);
-
-        // Apply electron efficiency
-        CMS::applyElectronEff(baseelecs);
+        const vector<const Particle*>& baseelecs = selections().electrons(10., 2.5, CMS::applyElectronEff);
 
         // Get baseline muons
-        vector<const Particle*> basemuons;
-        for (const Particle* muon : event->muons())
-          if (muon->pT() > 10. && muon->abseta() < 2.4)
-            basemuons.push_back(muon);
-
-        // Apply muon efficiency
-        CMS::applyMuonEff(basemuons);
+        const vector<const Particle*>& basemuons = selections().muons(10., 2.4, CMS::applyMuonEff);
 
         // Electron isolation
         /// @todo Sum should actually be over all non-e/mu calo particles
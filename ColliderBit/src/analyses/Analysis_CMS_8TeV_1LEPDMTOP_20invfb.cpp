@@ -78,26 +78,10 @@ namespace Gambit {
         double met = event->met();
 
         // Baseline electrons
-        vector<const HEPUtils::Particle*> baselineElectrons;
-        for (const HEPUtils::Particle* electron : event->electrons()) {
-          if (electron->pT() > 30. && fabs(electron->eta()) < 2.5) {
-            baselineElectrons.push_back(electron);
-          }
-        }
-
-        // Apply electron efficiency
-        CMS::applyElectronEff(baselineElectrons);
+        const vector<const HEPUtils::Particle*>& baselineElectrons = selections().electrons(30., 2.5, CMS::applyElectronEff);
 
         // Baseline muons
-        vector<const HEPUtils::Particle*> baselineMuons;
-        for (const HEPUtils::Particle* muon : event->muons()) {
-          if (muon->pT() > 30. && fabs(muon->eta()) < 2.1) {
-            baselineMuons.push_back(muon);
-          }
-        }
-
-        // Apply muon efficiency
-        CMS::applyMuonEff(baselineMuons);
+        const vector<const HEPUtils::Particle*>& baselineMuons = selections().muons(30., 2.1, CMS::applyMuonEff);
 
         // All baseline leptons
         vector<const HEPUtils::Particle*> baselineLeptons = baselineElectrons;
@@ -76,26 +76,10 @@ namespace Gambit {
         double met = event->met();
 
         // Baseline electrons
-        vector<const HEPUtils::Particle*> baselineElectrons;
-        for (const HEPUtils::Particle* electron : event->electrons()) {
-          if (electron->pT() > 20. && fabs(electron->eta()) < 2.5) {
-            baselineElectrons.push_back(electron);
-          }
-        }
-
-        // Apply electron efficiency
-        CMS::applyElectronEff(baselineElectrons);
+        const vector<const HEPUtils::Particle*>& baselineElectrons = selections().electrons(20., 2.5, CMS::applyElectronEff);
 
         // Baseline muons
-        vector<const HEPUtils::Particle*> baselineMuons;
-        for (const HEPUtils::Particle* muon : event->muons()) {
-          if (muon->pT() > 20. && fabs(muon->eta()) < 2.4) {
-            baselineMuons.push_back(muon);
-          }
-        }
-
-        // Apply muon efficiency
-        CMS::applyMuonEff(baselineMuons);
+        const vector<const HEPUtils::Particle*>& baselineMuons = selections().muons(20., 2.4, CMS::applyMuonEff);
 
         // All baseline leptons
         vector<const HEPUtils::Particle*> baselineLeptons = baselineElectrons;
@@ -77,26 +77,10 @@ namespace Gambit {
         // Now define vectors of baseline objects
 
         // Baseline electrons
-        vector<const HEPUtils::Particle*> baselineElectrons;
-        for (const HEPUtils::Particle* electron : event->electrons()) {
-          if (electron->pT() > 10. && fabs(electron->eta()) < 2.5) {
-            baselineElectrons.push_back(electron);
-          }
-        }
-
-        // Apply electron efficiency
-        CMS::applyElectronEff(baselineElectrons);
+        const vector<const HEPUtils::Particle*>& baselineElectrons = selections().electrons(10., 2.5, CMS::applyElectronEff);
 
         // Baseline muons
-        vector<const HEPUtils::Particle*> baselineMuons;
-        for (const HEPUtils::Particle* muon : event->muons()) {
-          if (muon->pT() > 10. && fabs(muon->eta()) < 2.5) {
-            baselineMuons.push_back(muon);
-          }
-        }
-
-        // Apply muon efficiency
-        CMS::applyMuonEff(baselineMuons);
+        const vector<const HEPUtils::Particle*>& baselineMuons = selections().muons(10., 2.5, CMS::applyMuonEff);
 
         // Baseline taus
         vector<const HEPUtils::Particle*> baselineTaus;
@@ -450,22 +450,10 @@ namespace Gambit {
 
         // Create vectors of physics objects:
         // - electrons
-        vector<const HEPUtils::Particle*> signalElectrons;
-        for (const HEPUtils::Particle* electron : event->electrons()) {
-          if (electron->pT() > 10. && fabs(electron->eta()) < 2.4) signalElectrons.push_back(electron);
-        }
-
-        // Apply electron efficiency
-        CMS::applyElectronEff(signalElectrons);
+        vector<const HEPUtils::Particle*> signalElectrons = selections().electrons(10., 2.4, CMS::applyElectronEff);
 
         // - muons
-        vector<const HEPUtils::Particle*> signalMuons;
-        for (const HEPUtils::Particle* muon : event->muons()) {
-          if (muon->pT() > 10. && fabs(muon->eta()) < 2.4) signalMuons.push_back(muon);
-        }
-
-        // Apply muon efficiency
-        CMS::applyMuonEff(signalMuons);
+        vector<const HEPUtils::Particle*> signalMuons = selections().muons(10., 2.4, CMS::applyMuonEff);
 
         // - taus
         vector<const HEPUtils::Particle*> signalTaus;
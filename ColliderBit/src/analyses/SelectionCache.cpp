@@ -0,0 +1,109 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Per-event cache of baseline object
+///  selections, shared by the analyses of an
+///  AnalysisContainer.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#include <functional>
+#include <tuple>
+
+#include "gambit/ColliderBit/analyses/SelectionCache.hpp"
+
+namespace Gambit
+{
+  namespace ColliderBit
+  {
+
+    /// Order selections by type, cuts and efficiency function
+    bool SelectionCache::key::operator<(const key& other) const
+    {
+      if (std::tie(type, collection, ptmin, absetamax) != std::tie(other.type, other.collection, other.ptmin, other.absetamax))
+      {
+        return std::tie(type, collection, ptmin, absetamax) < std::tie(other.type, other.collection, other.ptmin, other.absetamax);
+      }
+      return std::less<void(*)()>()(eff, other.eff);
+    }
+
+    /// Start a new event, invalidating all cached selections
+    void SelectionCache::new_event(const HEPUtils::Event* event)
+    {
+      _event = event;
+      // Skip 0, the sequence number of entries never computed
+      if (++_event_number == 0) ++_event_number;
+    }
+
+    const SelectionCache::ParticlePtrs& SelectionCache::electrons(double ptmin, double absetamax, ParticleEfficiency eff)
+    {
+      return select(ELECTRON, _event->electrons(), ptmin, absetamax, eff);
+    }
+
+    const SelectionCache::ParticlePtrs& SelectionCache::muons(double ptmin, double absetamax, ParticleEfficiency eff)
+    {
+      return select(MUON, _event->muons(), ptmin, absetamax, eff);
+    }
+
+    const SelectionCache::ParticlePtrs& SelectionCache::taus(double ptmin, double absetamax, ParticleEfficiency eff)
+    {
+      return select(TAU, _event->taus(), ptmin, absetamax, eff);
+    }
+
+    const SelectionCache::ParticlePtrs& SelectionCache::photons(double ptmin, double absetamax, ParticleEfficiency eff)
+    {
+      return select(PHOTON, _event->photons(), ptmin, absetamax, eff);
+    }
+
+    const SelectionCache::JetPtrs& SelectionCache::jets(const std::string& collection, double ptmin, double absetamax, JetEfficiency eff)
+    {
+      return select(JET, collection, ptmin, absetamax, eff);
+    }
+
+    /// Find or compute a particle selection
+    const SelectionCache::ParticlePtrs& SelectionCache::select(object_type type, const std::vector<const HEPUtils::Particle*>& candidates,
+                                                               double ptmin, double absetamax, ParticleEfficiency eff)
+    {
+      entry<HEPUtils::Particle>& e = _particle_selections[{type, "", ptmin, absetamax, reinterpret_cast<void(*)()>(eff)}];
+      if (e.event_number != _event_number)
+      {
+        // Reuse the storage of the previous event
+        e.objects.clear();
+        for (const HEPUtils::Particle* p : candidates)
+        {
+          if (p->pT() > ptmin && p->abseta() < absetamax) e.objects.push_back(p);
+        }
+        if (eff != nullptr) eff(e.objects);
+        e.event_number = _event_number;
+      }
+      return e.objects;
+    }
+
+    /// Find or compute a jet selection
+    const SelectionCache::JetPtrs& SelectionCache::select(object_type type, const std::string& collection,
+                                                          double ptmin, double absetamax, JetEfficiency eff)
+    {
+      entry<HEPUtils::Jet>& e = _jet_selections[{type, collection, ptmin, absetamax, reinterpret_cast<void(*)()>(eff)}];
+      if (e.event_number != _event_number)
+      {
+        e.objects.clear();
+        for (const HEPUtils::Jet* j : _event->jets(collection))
+        {
+          if (j->pT() > ptmin && j->abseta() < absetamax) e.objects.push_back(j);
+        }
+        if (eff != nullptr) eff(e.objects);
+        e.event_number = _event_number;
+      }
+      return e.objects;
+    }
+
+  }
+}
@@ -41,16 +41,16 @@ namespace Gambit
       // Smear jet momenta
       if (smearJets != NULL)
       {
-        for (std::string jetcollection : event.jet_collections())
+        for (const auto& jetcollection : event.jet_collection_map())
         {
-          smearJets(event.jets(jetcollection));
+          smearJets(event.jets(jetcollection.first));
         }
       }
 
       // Unset b-tags outside |eta|=2.5
-      for (std::string jetcollection : event.jet_collections())
+      for (const auto& jetcollection : event.jet_collection_map())
       {
-        for (HEPUtils::Jet* j : event.jets(jetcollection))
+        for (HEPUtils::Jet* j : event.jets(jetcollection.first))
         {
           if (j->abseta() > 2.5) j->set_btag(false);
         }
@@ -34,13 +34,22 @@
 ///           (tsp116@ic.ac.uk)
 ///  \date 2020 June
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #include "gambit/cmake/cmake_variables.hpp"
 
+#include <fstream>
+#include <map>
+#include <memory>
+
 #ifndef EXCLUDE_HEPMC
 
 #include "gambit/ColliderBit/ColliderBit_eventloop.hpp"
+#include "gambit/ColliderBit/indexed_event_file.hpp"
+#include "gambit/ColliderBit/event_file_readers.hpp"
 #include "gambit/Utils/util_functions.hpp"
 #include "HepMC3/ReaderAsciiHepMC2.h"
 #include "gambit/ColliderBit/colliders/Pythia8/Py8EventConversions.hpp"
@@ -57,10 +66,17 @@ namespace Gambit
   namespace ColliderBit
   {
 
+    /// Index of a HepMC file and the readers of each thread, kept for the whole run
+    struct HepMC_event_source
+    {
+      std::unique_ptr<indexed_event_file> events;
+      std::vector<std::unique_ptr<HepMC_thread_reader>> readers;
+    };
+
     /// A nested function that reads in HepMC event files
     void readHepMCEvent(HepMC3::GenEvent& result, const str HepMC_filename,
                         const MCLoopInfo& RunMC, const int iteration,
-                        void(*halt)())
+                        void(*halt)(), bool cache_index)
     {
       result.clear();
 
@@ -131,25 +147,23 @@ namespace Gambit
         ColliderBit_error().raise(LOCAL_INFO, msg.str());
       }
 
-      static HepMC3::Reader *HepMCio;
-
-      // Initialize the reader on the first iteration
+      // Index the events the first time a file is used.  Every point then reads the file from
+      // its first event again: each thread claims the next unread event and parses it with its
+      // own reader, without locking.  The index and the readers are kept for the whole run.
+      static std::map<str, HepMC_event_source> sources;
+      static HepMC_event_source* source = nullptr;
       if (iteration == BASE_INIT)
       {
-        if (HepMC_file_version == 2)
-        {
-          HepMCio = new HepMC3::ReaderAsciiHepMC2(HepMC_filename);
-        }
-        else
+        source = &sources[HepMC_filename];
+        if (not source->events)
         {
-          HepMCio = new HepMC3::ReaderAscii(HepMC_filename);
+          source->events.reset(new indexed_event_file(HepMC_filename, (HepMC_file_version == 2 ?
+           indexed_event_file::HepMC2 : indexed_event_file::HepMC3), cache_index));
         }
+        else source->events->rewind();
+        if (source->readers.size() < size_t(omp_get_max_threads())) source->readers.resize(omp_get_max_threads());
       }
 
-      // Delete the reader in the last iteration
-      if (iteration == BASE_FINALIZE)
-        delete HepMCio;
-
       // Don't do anything else during special iterations
       if (iteration < 0) return;
 
@@ -158,10 +172,15 @@ namespace Gambit
       #endif
 
       // Attempt to read the next HepMC event. If there are no more events, wrap up the loop and skip the rest of this iteration.
-      bool event_retrieved = true;
-      #pragma omp critical (reading_HepMCEvent)
+      size_t event;
+      bool event_retrieved = source->events->next(event);
+      if (event_retrieved)
       {
-        event_retrieved = HepMCio->read_event(result);
+        const size_t thread = omp_get_thread_num();
+        if (thread >= source->readers.size()) ColliderBit_error().raise(LOCAL_INFO, "More OpenMP threads than HepMC readers.");
+        std::unique_ptr<HepMC_thread_reader>& reader = source->readers[thread];
+        if (not reader) reader.reset(new HepMC_thread_reader(HepMC_filename, HepMC_file_version));
+        event_retrieved = reader->read(source->events->offset(event), result);
 
         // FIXME This is a temp solution to ensure that the event reading
         //       stops when there are no more events in the HepMC file.
@@ -184,9 +203,10 @@ namespace Gambit
 
       // Get yaml options
       const static str HepMC_filename = runOptions->getValueOrDef<str>("", "hepmc_filename");
+      const static bool cache_index = runOptions->getValueOrDef<bool>(false, "cache_event_index");
 
       // Get the HepMC event
-      readHepMCEvent(result, HepMC_filename, *Dep::RunMC, *Loop::iteration, Loop::halt);
+      readHepMCEvent(result, HepMC_filename, *Dep::RunMC, *Loop::iteration, Loop::halt, cache_index);
 
     }
 
@@ -236,6 +256,7 @@ namespace Gambit
       // Get yaml options
       const static str HepMC_filename = runOptions->getValueOrDef<str>("", "hepmc_filename");
       const static double jet_pt_min = runOptions->getValueOrDef<double>(10.0, "jet_pt_min");
+      const static bool cache_index = runOptions->getValueOrDef<bool>(false, "cache_event_index");
       std::vector<jet_collection_settings> all_jet_collection_settings = {};
       str jetcollection_taus;
       read_jet_collections_settings(*runOptions, all_jet_collection_settings, jetcollection_taus);
@@ -243,7 +264,7 @@ namespace Gambit
       // Get the HepMC event
       //HepMC3::GenEvent ge = *Dep::HardScatteringEvent;
       HepMC3::GenEvent ge;
-      readHepMCEvent(ge, HepMC_filename, *Dep::RunMC, *Loop::iteration, Loop::halt);
+      readHepMCEvent(ge, HepMC_filename, *Dep::RunMC, *Loop::iteration, Loop::halt, cache_index);
 
       //We need to not do anything else on special iterations, where an event has not actually been extracted:
       if (*Loop::iteration < 0) return;
@@ -12,24 +12,27 @@
 ///          (p.scott@imperial.ac.uk)
 ///  \date 2019 May
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #include "gambit/cmake/cmake_variables.hpp"
 
+#include <fstream>
 #include <iostream>
+#include <memory>
 
 using namespace std;
 
 #ifndef EXCLUDE_HEPMC
 
 #include "gambit/ColliderBit/ColliderBit_eventloop.hpp"
+#include "gambit/ColliderBit/indexed_event_file.hpp"
+#include "gambit/ColliderBit/event_file_readers.hpp"
 #include "gambit/ColliderBit/lhef2heputils.hpp"
 #include "gambit/Utils/util_functions.hpp"
 
-#include "gambit/Utils/begin_ignore_warnings_hepmc.hpp"
-#include "HepMC3/LHEF.h"
-#include "gambit/Utils/end_ignore_warnings.hpp"
-
 
 namespace Gambit
 {
@@ -47,13 +50,16 @@ namespace Gambit
       // Get yaml options and initialise the LHEF reader
       const static double jet_pt_min = runOptions->getValueOrDef<double>(10.0, "jet_pt_min");
       const static str lhef_filename = runOptions->getValue<str>("lhef_filename");
+      const static bool cache_index = runOptions->getValueOrDef<bool>(false, "cache_event_index");
       static bool first = true;
       if (first)
       {
         if (not Utils::file_exists(lhef_filename)) throw std::runtime_error("LHE file "+lhef_filename+" not found.  Quitting...");
         first = false;
       }
-      static LHEF::Reader lhe(lhef_filename);
+      // Index the events once; each thread then claims the next unread event and parses it with its own reader.
+      static indexed_event_file lhe_events(lhef_filename, indexed_event_file::LHEF, cache_index);
+      static std::vector<std::unique_ptr<LHEF_thread_reader>> readers(omp_get_max_threads());
 
       // Get all jet collection settings
       str jetcollection_taus;
@@ -107,10 +113,14 @@ namespace Gambit
       if (*Loop::iteration < 0) return;
 
       // Attempt to read the next LHE event as a HEPUtils event. If there are no more events, wrap up the loop and skip the rest of this iteration.
-      bool event_retrieved = true;
-      #pragma omp critical (reading_LHEvent)
+      size_t event;
+      bool event_retrieved = lhe_events.next(event);
+      if (event_retrieved)
       {
-        if (lhe.readEvent()) get_HEPUtils_event(lhe, result, jet_pt_min, all_jet_collection_settings);
+        const size_t thread = omp_get_thread_num();
+        if (thread >= readers.size()) ColliderBit_error().raise(LOCAL_INFO, "More OpenMP threads than LHEF readers.");
+        if (not readers[thread]) readers[thread].reset(new LHEF_thread_reader(lhef_filename));
+        if (readers[thread]->read(lhe_events.offset(event))) get_HEPUtils_event(readers[thread]->reader, result, jet_pt_min, all_jet_collection_settings);
         else event_retrieved = false;
       }
       if (not event_retrieved)
@@ -0,0 +1,251 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Byte-offset index of the events in a text
+///  event file (HepMC2, HepMC3 or LHEF).
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "gambit/ColliderBit/indexed_event_file.hpp"
+#include "gambit/Utils/standalone_error_handlers.hpp"
+#include "gambit/Utils/util_functions.hpp"
+#include "gambit/Logs/logger.hpp"
+
+namespace Gambit
+{
+
+  namespace ColliderBit
+  {
+
+    namespace
+    {
+      const char index_magic[8] = {'G','B','E','V','I','D','X','\0'};
+      const uint64_t index_version = 1;
+
+      /// Read exactly n bytes at offset from fd
+      bool pread_all(int fd, char* buffer, size_t n, uint64_t offset)
+      {
+        while (n > 0)
+        {
+          ssize_t got = ::pread(fd, buffer, n, offset);
+          if (got < 0 and errno == EINTR) continue;
+          if (got <= 0) return false;
+          buffer += got;
+          n -= got;
+          offset += got;
+        }
+        return true;
+      }
+    }
+
+    indexed_event_file::indexed_event_file(const str& filename, file_format format, bool cache_index)
+     : filename(filename), format(format), cursor(0)
+    {
+      int fd = ::open(filename.c_str(), O_RDONLY);
+      struct stat st;
+      if (fd < 0 or ::fstat(fd, &st) != 0)
+      {
+        const str reason = std::strerror(errno);
+        if (fd >= 0) ::close(fd);
+        utils_error().raise(LOCAL_INFO, "Could not open event file " + filename + ": " + reason);
+      }
+      const uint64_t file_size = st.st_size;
+      const int64_t mtime = st.st_mtime;
+
+      const str index_file = (cache_index ? index_name(filename) : "");
+      if (cache_index and read_index(index_file, file_size, mtime))
+      {
+        ::close(fd);
+        logger() << LogTags::debug << "Using the event index " << index_file << " for " << filename << "." << EOM;
+        return;
+      }
+      try
+      {
+        build_index(fd, file_size);
+      }
+      catch (...)
+      {
+        ::close(fd);
+        throw;
+      }
+      ::close(fd);
+      if (cache_index) write_index(index_file, file_size, mtime);
+    }
+
+    str indexed_event_file::index_name(const str& filename)
+    {
+      // Name the index after the absolute path of the event file, so that event files
+      // with the same name in different directories get different indices.
+      char* path = ::realpath(filename.c_str(), NULL);
+      const str full_path = (path != NULL ? str(path) : filename);
+      std::free(path);
+      std::ostringstream name;
+      name << Utils::ensure_path_exists(GAMBIT_DIR "/scratch/event_indices/") << full_path.substr(full_path.find_last_of('/') + 1)
+           << "." << std::hex << std::hash<str>()(full_path) << ".gbidx";
+      return name.str();
+    }
+
+    bool indexed_event_file::next(size_t& event)
+    {
+      event = cursor.fetch_add(1, std::memory_order_relaxed);
+      return event < size();
+    }
+
+    void indexed_event_file::build_index(int fd, uint64_t file_size)
+    {
+      begin.clear();
+      end.clear();
+      // Offset of the end of the event list (a HepMC footer, or the end of the file)
+      uint64_t end_of_events = file_size;
+
+      // Only the start of each line is needed to find the event boundaries
+      const size_t prefix_length = 40;
+      str prefix;
+      uint64_t line_start = 0;
+
+      auto process_line = [&](uint64_t line_end)
+      {
+        if (format == LHEF)
+        {
+          size_t first = prefix.find_first_not_of(" \t\r");
+          if (first == str::npos) return;
+          if (prefix.compare(first, 6, "<event") == 0 and
+              (prefix.size() == first + 6 or std::strchr("> \t\r", prefix[first + 6]) != NULL))
+          {
+            // Drop an earlier event that was not closed
+            if (end.size() < begin.size()) begin.pop_back();
+            begin.push_back(line_start);
+          }
+          else if (prefix.compare(first, 8, "</event>") == 0 and end.size() < begin.size())
+          {
+            end.push_back(line_end);
+          }
+        }
+        else
+        {
+          if (prefix.compare(0, 2, "E ") == 0)
+          {
+            if (not begin.empty()) end.push_back(line_start);
+            begin.push_back(line_start);
+          }
+          else if (not begin.empty() and end_of_events == file_size and prefix.compare(0, 7, "HepMC::") == 0)
+          {
+            end_of_events = line_start;
+          }
+        }
+      };
+
+      std::vector<char> buffer(1 << 22);
+      for (uint64_t offset = 0; offset < file_size and end_of_events == file_size; )
+      {
+        const size_t n = std::min<uint64_t>(buffer.size(), file_size - offset);
+        if (not pread_all(fd, &buffer[0], n, offset))
+        {
+          utils_error().raise(LOCAL_INFO, "Could not read event file " + filename + ".");
+        }
+        for (size_t i = 0; i < n; ++i)
+        {
+          if (buffer[i] == '\n')
+          {
+            process_line(offset + i + 1);
+            prefix.clear();
+            line_start = offset + i + 1;
+            if (end_of_events != file_size) break;
+          }
+          else if (prefix.size() < prefix_length)
+          {
+            prefix += buffer[i];
+          }
+        }
+        offset += n;
+      }
+      if (line_start < file_size and end_of_events == file_size) process_line(file_size);
+
+      if (format == LHEF)
+      {
+        if (end.size() < begin.size()) begin.pop_back();
+      }
+      else if (not begin.empty())
+      {
+        end.push_back(end_of_events);
+      }
+
+      logger() << LogTags::debug << "Indexed " << begin.size() << " events in " << filename << "." << EOM;
+    }
+
+    bool indexed_event_file::read_index(const str& index_file, uint64_t file_size, int64_t mtime)
+    {
+      std::ifstream in(index_file, std::ios::binary);
+      if (not in) return false;
+      char magic[8];
+      uint64_t version, size, fmt, n;
+      int64_t time;
+      in.read(magic, 8);
+      in.read(reinterpret_cast<char*>(&version), sizeof(version));
+      in.read(reinterpret_cast<char*>(&size), sizeof(size));
+      in.read(reinterpret_cast<char*>(&time), sizeof(time));
+      in.read(reinterpret_cast<char*>(&fmt), sizeof(fmt));
+      in.read(reinterpret_cast<char*>(&n), sizeof(n));
+      if (not in or std::memcmp(magic, index_magic, 8) != 0 or version != index_version or size != file_size
+          or time != mtime or fmt != uint64_t(format) or n > file_size) return false;
+      begin.resize(n);
+      end.resize(n);
+      in.read(reinterpret_cast<char*>(begin.data()), n*sizeof(uint64_t));
+      in.read(reinterpret_cast<char*>(end.data()), n*sizeof(uint64_t));
+      if (not in)
+      {
+        begin.clear();
+        end.clear();
+        return false;
+      }
+      return true;
+    }
+
+    void indexed_event_file::write_index(const str& index_file, uint64_t file_size, int64_t mtime) const
+    {
+      // Write to a temporary file and rename it, so that other processes never see a partial index.
+      const str tmp_file = index_file + ".tmp" + std::to_string(::getpid());
+      {
+        std::ofstream out(tmp_file, std::ios::binary);
+        const uint64_t fmt = format, n = begin.size();
+        out.write(index_magic, 8);
+        out.write(reinterpret_cast<const char*>(&index_version), sizeof(index_version));
+        out.write(reinterpret_cast<const char*>(&file_size), sizeof(file_size));
+        out.write(reinterpret_cast<const char*>(&mtime), sizeof(mtime));
+        out.write(reinterpret_cast<const char*>(&fmt), sizeof(fmt));
+        out.write(reinterpret_cast<const char*>(&n), sizeof(n));
+        out.write(reinterpret_cast<const char*>(begin.data()), n*sizeof(uint64_t));
+        out.write(reinterpret_cast<const char*>(end.data()), n*sizeof(uint64_t));
+        if (out.good()) out.close();
+        if (not out.good())
+        {
+          std::remove(tmp_file.c_str());
+          logger() << LogTags::debug << "Could not write the event index " << index_file << "." << EOM;
+          return;
+        }
+      }
+      if (std::rename(tmp_file.c_str(), index_file.c_str()) != 0) std::remove(tmp_file.c_str());
+    }
+
+  }
+
+}
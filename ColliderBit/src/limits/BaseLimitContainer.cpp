@@ -16,15 +16,142 @@
 ///          (p.scott@imperial.ac.uk)
 ///  \date 2016 Jan
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *************************************
 
+#include <sstream>
+
 #include "gambit/ColliderBit/limits/BaseLimitContainer.hpp"
+#include "gambit/Utils/standalone_error_handlers.hpp"
+#include "gambit/cmake/cmake_variables.hpp"
 
 namespace Gambit
 {
   namespace ColliderBit
   {
 
+    SegmentGrid::SegmentGrid(const std::vector<LineSegment>& segments) : SegmentGrid()
+    {
+      _segments = &segments;
+      _cellStart.assign(2, 0);
+      if (segments.empty()) return;
+
+      double xmin = std::numeric_limits<double>::infinity(), ymin = xmin;
+      double xmax = -xmin, ymax = -xmin;
+      for (const LineSegment& s : segments) {
+        for (const P2& p : {s.getp1(), s.getp2()}) {
+          xmin = std::min(xmin, p.getx()); xmax = std::max(xmax, p.getx());
+          ymin = std::min(ymin, p.gety()); ymax = std::max(ymax, p.gety());
+        }
+      }
+
+      // Roughly one segment per cell along each row and column.  Segments are entered into all
+      // cells overlapped by their bounding boxes, widened by _eps to absorb rounding errors in
+      // the intersection points.
+      _eps = 1e-9 * std::max(1., std::max(xmax - xmin, ymax - ymin));
+      _nx = _ny = std::min(256, std::max(1, int(std::ceil(std::sqrt(double(segments.size()))))));
+      _x0 = xmin - 2.*_eps;
+      _y0 = ymin - 2.*_eps;
+      _w = (xmax - xmin + 4.*_eps) / _nx;
+      _h = (ymax - ymin + 4.*_eps) / _ny;
+
+      auto column = [&](double x) { return std::min(_nx - 1, std::max(0, int(std::floor((x - _x0) / _w)))); };
+      auto row = [&](double y) { return std::min(_ny - 1, std::max(0, int(std::floor((y - _y0) / _h)))); };
+      std::vector<unsigned> counts(_nx * _ny + 1, 0);
+      for (int pass = 0; pass < 2; ++pass) {
+        for (unsigned k = 0; k < segments.size(); ++k) {
+          const LineSegment& s = segments[k];
+          int i0 = column(std::min(s.getp1().getx(), s.getp2().getx()) - _eps);
+          int i1 = column(std::max(s.getp1().getx(), s.getp2().getx()) + _eps);
+          int j0 = row(std::min(s.getp1().gety(), s.getp2().gety()) - _eps);
+          int j1 = row(std::max(s.getp1().gety(), s.getp2().gety()) + _eps);
+          for (int i = i0; i <= i1; ++i)
+            for (int j = j0; j <= j1; ++j) {
+              if (pass == 0) counts[i * _ny + j + 1]++;
+              else _cellSegments[counts[i * _ny + j]++] = k;
+            }
+        }
+        if (pass == 0) {
+          for (size_t c = 1; c < counts.size(); ++c) counts[c] += counts[c-1];
+          _cellStart = counts;
+          _cellSegments.resize(counts.back());
+        }
+      }
+    }
+
+    template <typename Visit, typename EndColumn>
+    void SegmentGrid::walk(const P2& a, const P2& b, Visit visit, EndColumn endColumn) const
+    {
+      const double xlo = std::min(a.getx(), b.getx()) - _eps, xhi = std::max(a.getx(), b.getx()) + _eps;
+      const double ylo = std::min(a.gety(), b.gety()) - _eps, yhi = std::max(a.gety(), b.gety()) + _eps;
+      if (xhi < _x0 or xlo > _x0 + _nx * _w or yhi < _y0 or ylo > _y0 + _ny * _h) return;
+
+      auto column = [&](double x) { return std::min(_nx - 1, std::max(0, int(std::floor((x - _x0) / _w)))); };
+      auto row = [&](double y) { return std::min(_ny - 1, std::max(0, int(std::floor((y - _y0) / _h)))); };
+      const int i0 = column(a.getx()), i1 = column(b.getx());
+      const int step = (i1 >= i0 ? 1 : -1);
+      const double dx = b.getx() - a.getx();
+      const double slope = (dx != 0. ? (b.gety() - a.gety()) / dx : 0.);
+
+      for (int i = i0; ; i += step) {
+        // The range of y covered by the segment within this column
+        double y1 = ylo, y2 = yhi;
+        if (dx != 0.) {
+          const double left = std::max(_x0 + i * _w, xlo), right = std::min(_x0 + (i + 1) * _w, xhi);
+          const double yl = a.gety() + (left - a.getx()) * slope, yr = a.gety() + (right - a.getx()) * slope;
+          y1 = std::max(ylo, std::min(yl, yr) - _eps);
+          y2 = std::min(yhi, std::max(yl, yr) + _eps);
+        }
+        if (y2 >= _y0 and y1 <= _y0 + _ny * _h) {
+          for (int j = row(y1), j1 = row(y2); j <= j1; ++j)
+            if (visit(i * _ny + j)) return;
+        }
+        if (i == i1 or endColumn(step > 0 ? _x0 + (i + 1) * _w : _x0 + i * _w)) return;
+      }
+    }
+
+    unsigned SegmentGrid::countIntersections(const LineSegment& line) const
+    {
+      std::vector<unsigned> candidates;
+      walk(line.getp1(), line.getp2(), [&](int cell) {
+        candidates.insert(candidates.end(), _cellSegments.begin() + _cellStart[cell],
+                          _cellSegments.begin() + _cellStart[cell+1]);
+        return false;
+      }, [](double) { return false; });
+      std::sort(candidates.begin(), candidates.end());
+      candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+      unsigned intersectCounter = 0;
+      for (unsigned k : candidates)
+        if (line.intersectsAt((*_segments)[k]).r() < std::numeric_limits<double>::infinity())
+          intersectCounter++;
+      return intersectCounter;
+    }
+
+    double SegmentGrid::closestIntersection(const P2& point, const LineSegment& ray) const
+    {
+      const bool startsAtP1 = (ray.getp1().getx() == point.getx() and ray.getp1().gety() == point.gety());
+      const P2 end = (startsAtP1 ? ray.getp2() : ray.getp1());
+      // Ratio of distance along the ray to distance along x
+      const double stretch = ray.r() / std::fabs(end.getx() - point.getx());
+      LineSegment intersectLine;
+      double r, rmin = std::numeric_limits<double>::infinity();
+      walk(point, end, [&](int cell) {
+        for (unsigned c = _cellStart[cell]; c < _cellStart[cell+1]; ++c) {
+          intersectLine.init(point, ray.intersectsAt((*_segments)[_cellSegments[c]]));
+          r = intersectLine.r();
+          if (r <= rmin) rmin = r;
+        }
+        return false;
+      }, [&](double boundary) {
+        // Intersections in the remaining columns are at least this far away
+        return rmin < (std::fabs(boundary - point.getx()) - _eps) * stretch;
+      });
+      return rmin;
+    }
+
     BaseLimitContainer::~BaseLimitContainer()
     {
       // Clean up all the contours created when this object was constructed.
@@ -38,6 +165,58 @@ namespace Gambit
     {
       return std::numeric_limits<double>::infinity();
     }
+
+    void BaseLimitContainer::loadContours(const std::string& filename)
+    {
+      const std::string path = GAMBIT_DIR "/ColliderBit/data/LEP_limits/" + filename;
+      std::ifstream file(path);
+      if (not file) utils_error().raise(LOCAL_INFO, "Could not open LEP limit contour file " + path + ".");
+
+      Corners corners;
+      ContoursPointer contoursPointer = nullptr;
+      // Join the corners read so far into line segments of the current contour.
+      auto endPolyline = [&]() {
+        if (corners.size() > 1) {
+          size_t oldSize = contoursPointer->size();
+          contoursPointer->resize(oldSize + corners.size() - 1);
+          std::transform(corners.begin(), --corners.end(), ++corners.begin(),
+                         contoursPointer->begin() + oldSize, makeLine);
+        }
+        corners.clear();
+      };
+
+      std::string line, word;
+      while (std::getline(file, line)) {
+        std::istringstream iss(line);
+        if (not (iss >> word)) { endPolyline(); continue; }
+        if (word[0] == '#') continue;
+        if (word == "limit") {
+          endPolyline();
+          double value;
+          iss >> value;
+          contoursPointer = new Contours();
+          _limitContours.insert(LimitContourEntry(_limitValuesSorted.size(), contoursPointer));
+          _limitValuesSorted.push_back(value);
+        } else {
+          std::istringstream point(line);
+          double x, y;
+          point >> x >> y;
+          if (point.fail() or contoursPointer == nullptr)
+            utils_error().raise(LOCAL_INFO, "Malformed line in LEP limit contour file " + path + ": " + line);
+          corners.push_back(convertPt(x, y));
+        }
+      }
+      endPolyline();
+    }
+
+    const SegmentGrid& BaseLimitContainer::contourGrid(unsigned index) const
+    {
+      std::call_once(_gridsBuilt, [this]() {
+        for (auto it = _limitContours.begin(); it != _limitContours.end(); ++it)
+          _contourGrids.emplace(it->first, SegmentGrid(*it->second));
+      });
+      return _contourGrids.at(index);
+    }
   
     double BaseLimitContainer::limitAverage(double x, double y, double mZ) const
     {
@@ -45,20 +224,15 @@ namespace Gambit
       const P2& point = P2(x, y);
       const LineSegment& externalLine = LineSegment(point, _externalPoint);
       P2 rayMaker;
-      LineSegment ray, intersectLine;
-      double r, rmin;
-      double average, totalWeight, thisLimit, nextBestLimit;
-      unsigned intersectCounter, index;
+      LineSegment ray;
+      double rmin;
+      double average, totalWeight, thisLimit = -1., nextBestLimit;
+      unsigned index;
   
       // First, find the inner-most contour in which lies point.
       for (index=0; index<_limitValuesSorted.size(); index++) {
-        intersectCounter = 0; 
         thisLimit = _limitValuesSorted[index];
-        for (auto segmentIter = _limitContours.at(index)->begin();
-                  segmentIter != _limitContours.at(index)->end(); ++segmentIter)
-          if (externalLine.intersectsAt(*segmentIter).r() < std::numeric_limits<double>::infinity())
-            intersectCounter++;
-        if (intersectCounter % 2) break;
+        if (contourGrid(index).countIntersections(externalLine) % 2) break;
         thisLimit = -1.;
       }
   
@@ -73,6 +247,9 @@ namespace Gambit
         nextBestLimit = _limitValuesSorted[index-1];
   
       // Scan over all the angles around the current point to perform the average.
+      // The contour grids only return intersections near each ray, closest first.
+      const SegmentGrid& nextBestGrid = contourGrid(index-1);
+      const SegmentGrid& thisGrid = contourGrid(index);
       average = 0.;
       totalWeight = 0.;
       for (double angle = 0.; angle < 2.*acos(-1); angle += acos(-1)/41.) {
@@ -81,13 +258,7 @@ namespace Gambit
         ray.init(point, point + rayMaker);
   
         // For each ray, look for intersections with the next best limit.
-        rmin = std::numeric_limits<double>::infinity();
-        for (auto segmentIter = _limitContours.at(index-1)->begin();
-                  segmentIter != _limitContours.at(index-1)->end(); ++segmentIter) {
-          intersectLine.init(point, ray.intersectsAt(*segmentIter));
-          r = intersectLine.r();
-          if (r <= rmin) rmin = r;
-        }
+        rmin = nextBestGrid.closestIntersection(point, ray);
         if (rmin == 0.) {
           totalWeight = -1.;
           average = nextBestLimit;
@@ -98,13 +269,7 @@ namespace Gambit
         }
   
         // For each ray, also look for intersections with the current limit.
-        rmin = std::numeric_limits<double>::infinity();
-        for (auto segmentIter = _limitContours.at(index)->begin();
-                  segmentIter != _limitContours.at(index)->end(); ++segmentIter) {
-          intersectLine.init(point, ray.intersectsAt(*segmentIter));
-          r = intersectLine.r();
-          if (r <= rmin) rmin = r;
-        }
+        rmin = thisGrid.closestIntersection(point, ray);
         if (rmin == 0.) {
           totalWeight = -1.;
           average = thisLimit;
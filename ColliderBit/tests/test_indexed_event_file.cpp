@@ -0,0 +1,301 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Unit tests for the byte-offset index of the
+///  events in HepMC2, HepMC3 and LHEF files, and
+///  for the per-thread readers seeked to it.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include "gambit/ColliderBit/indexed_event_file.hpp"
+#include "gambit/ColliderBit/event_file_readers.hpp"
+#include "gambit/Utils/static_members.hpp"
+#include "unit_test.hpp"
+
+using namespace Gambit;
+using ColliderBit::indexed_event_file;
+#ifndef EXCLUDE_HEPMC
+  using ColliderBit::HepMC_thread_reader;
+  using ColliderBit::LHEF_thread_reader;
+#endif
+
+/// Write a file and return its name
+str write_file(const str& name, const str& contents)
+{
+  const str filename = "test_indexed_event_file_" + std::to_string(getpid()) + "_" + name;
+  std::ofstream out(filename, std::ios::binary);
+  out << contents;
+  return filename;
+}
+
+/// Read the byte range [begin, end) of a file
+str read_range(const str& filename, uint64_t begin, uint64_t end)
+{
+  std::ifstream in(filename, std::ios::binary);
+  in.seekg(begin);
+  str text(end - begin, '\0');
+  in.read(&text[0], text.size());
+  return text;
+}
+
+/// Check that the indexed events of a file are exactly the given event texts
+void check_events(const str& filename, const indexed_event_file& index, const std::vector<str>& events)
+{
+  EXPECT(index.size() == events.size());
+  if (index.size() != events.size()) return;
+  for (size_t i = 0; i < events.size(); ++i)
+  {
+    EXPECT(read_range(filename, index.offset(i), index.end_offset(i)) == events[i]);
+  }
+}
+
+#ifndef EXCLUDE_HEPMC
+
+/// Summary of an event that differs between all the events of the test files
+str summary(const HepMC3::GenEvent& event)
+{
+  std::ostringstream out;
+  out << event.event_number();
+  for (const auto& p : event.particles()) out << " " << p->pid() << ":" << p->momentum().px() << "," << p->momentum().pz();
+  return out.str();
+}
+str summary(const LHEF::HEPEUP& event)
+{
+  std::ostringstream out;
+  out << event.NUP << " " << event.XWGTUP;
+  for (int i = 0; i < event.NUP; ++i) out << " " << event.IDUP[i] << ":" << event.PUP[i][0] << "," << event.PUP[i][2];
+  return out.str();
+}
+
+/// Read all events of a file in several threads, each with its own reader seeked to the events it claims
+template <typename Reader, typename Read>
+std::vector<str> read_in_threads(indexed_event_file& index, size_t nthreads, Reader make_reader, Read read)
+{
+  std::vector<str> events(index.size());
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < nthreads; ++t)
+  {
+    threads.emplace_back([&]()
+    {
+      auto reader = make_reader();
+      size_t event;
+      while (index.next(event)) events[event] = read(*reader, index.offset(event));
+    });
+  }
+  for (auto& t : threads) t.join();
+  return events;
+}
+
+#endif
+
+int main()
+{
+  // HepMC3: run info before the first event, and a footer after the last
+  const str hepmc3_header = "HepMC::Version 3.02.02\nHepMC::Asciiv3-START_EVENT_LISTING\nW weight\n";
+  const std::vector<str> hepmc3_events =
+  {
+    "E 0 1 2\nU GEV MM\nP 1 0 2212 0 0 7000 7000 0.938 4\nP 2 0 2212 0 0 -7000 7000 0.938 4\n",
+    "E 1 1 2\nU GEV MM\nP 1 0 2212 0 0 7000 7000 0.938 4\nP 2 0 2212 0 0 -7000 7000 0.938 4\n",
+    "E 2 1 2\nU GEV MM\nP 1 0 2212 0 0 7000 7000 0.938 4\nP 2 0 2212 0 0 -7000 7000 0.938 4\n",
+  };
+  str hepmc3 = hepmc3_header;
+  for (const str& event : hepmc3_events) hepmc3 += event;
+  const str hepmc3_file = write_file("events.hepmc3", hepmc3 + "HepMC::Asciiv3-END_EVENT_LISTING\n\n");
+  {
+    indexed_event_file index(hepmc3_file, indexed_event_file::HepMC3);
+    check_events(hepmc3_file, index, hepmc3_events);
+    EXPECT(index.offset(0) == hepmc3_header.size());
+  }
+
+  // HepMC2: the last event runs up to the end of the file if there is no footer
+  const std::vector<str> hepmc2_events =
+  {
+    "E 0 -1 -1 -1 -1 0 1 2 0 0 0 1 1.0\nN 1 \"0\"\nU GEV MM\n",
+    "E 1 -1 -1 -1 -1 0 1 2 0 0 0 1 1.0\nN 1 \"0\"\nU GEV MM\n",
+  };
+  const str hepmc2_file = write_file("events.hepmc2", "HepMC::Version 2.06.09\nHepMC::IO_GenEvent-START_EVENT_LISTING\n"
+                                                      + hepmc2_events[0] + hepmc2_events[1]);
+  {
+    indexed_event_file index(hepmc2_file, indexed_event_file::HepMC2);
+    check_events(hepmc2_file, index, hepmc2_events);
+  }
+
+  // LHEF: events are the <event> blocks only, and an unterminated last event is dropped
+  const std::vector<str> lhef_events =
+  {
+    "<event>\n 2 1 1.0 91.2 0.0078 0.118\n 2 -1 0 0 501 0 0 0 45 45 0 0 9\n</event>\n",
+    "<event id=\"2\">\n 2 1 1.0 91.2 0.0078 0.118\n 2 -1 0 0 501 0 0 0 45 45 0 0 9\n</event>\n",
+  };
+  const str lhef_file = write_file("events.lhe", "<LesHouchesEvents version=\"3.0\">\n<header>\n<eventsummary/>\n</header>\n"
+                                                 "<init>\n 2212 2212 6500 6500 0 0 0 0 3 1\n 1.0 0.1 1.0 1\n</init>\n"
+                                                 + lhef_events[0] + "<!-- between events -->\n" + lhef_events[1]
+                                                 + "<event>\n 2 1 1.0 91.2 0.0078 0.118\n");
+  {
+    indexed_event_file index(lhef_file, indexed_event_file::LHEF);
+    check_events(lhef_file, index, lhef_events);
+  }
+
+  // An empty event file has no events
+  const str empty_file = write_file("empty.hepmc3", "HepMC::Version 3.02.02\nHepMC::Asciiv3-START_EVENT_LISTING\n");
+  {
+    indexed_event_file index(empty_file, indexed_event_file::HepMC3);
+    size_t event;
+    EXPECT(index.size() == 0);
+    EXPECT(not index.next(event));
+  }
+
+  // Every event is claimed exactly once when several threads claim events at once
+  std::ostringstream many;
+  many << hepmc3_header;
+  const size_t n_many = 1000;
+  for (size_t i = 0; i < n_many; ++i) many << "E " << i << " 0 0\nU GEV MM\n";
+  const str many_file = write_file("many.hepmc3", many.str());
+  {
+    indexed_event_file index(many_file, indexed_event_file::HepMC3);
+    EXPECT(index.size() == n_many);
+    std::vector<std::vector<size_t>> claimed(4);
+    std::vector<std::thread> threads;
+    for (auto& mine : claimed) threads.emplace_back([&index, &mine]() { size_t event; while (index.next(event)) mine.push_back(event); });
+    for (auto& t : threads) t.join();
+    std::vector<int> times_claimed(n_many, 0);
+    for (const auto& mine : claimed) for (size_t event : mine) ++times_claimed[event];
+    bool all_once = true;
+    for (int n : times_claimed) all_once = all_once and (n == 1);
+    EXPECT(all_once);
+  }
+
+  // The index is only cached on request, in the scratch directory, and it is rebuilt once the event file changes
+  const str index_file = indexed_event_file::index_name(hepmc3_file);
+  EXPECT(index_file.find(hepmc3_file + ".gbidx") == str::npos);
+  std::remove(index_file.c_str());
+  {
+    indexed_event_file index(hepmc3_file, indexed_event_file::HepMC3);
+    EXPECT(not std::ifstream(index_file).good());
+  }
+  {
+    indexed_event_file index(hepmc3_file, indexed_event_file::HepMC3, true);
+    EXPECT(std::ifstream(index_file).good());
+    check_events(hepmc3_file, index, hepmc3_events);
+  }
+  {
+    indexed_event_file index(hepmc3_file, indexed_event_file::HepMC3, true);
+    check_events(hepmc3_file, index, hepmc3_events);
+  }
+  write_file("events.hepmc3", hepmc3_header + hepmc3_events[0] + hepmc3_events[1]);
+  {
+    indexed_event_file index(hepmc3_file, indexed_event_file::HepMC3, true);
+    check_events(hepmc3_file, index, {hepmc3_events[0], hepmc3_events[1]});
+  }
+  std::remove(index_file.c_str());
+
+  #ifndef EXCLUDE_HEPMC
+    // Readers seeked to the indexed events, from several threads and in any order, give the same events as a sequential read
+    const size_t n_read = 50;
+    std::ostringstream hepmc3_read, hepmc2_read, lhef_read;
+    hepmc3_read << hepmc3_header;
+    hepmc2_read << "HepMC::Version 2.06.09\nHepMC::IO_GenEvent-START_EVENT_LISTING\n";
+    lhef_read << "<LesHouchesEvents version=\"3.0\">\n<header>\n</header>\n<init>\n 2212 2212 6500 6500 0 0 0 0 3 1\n 1.0 0.1 1.0 1\n</init>\n";
+    for (size_t i = 0; i < n_read; ++i)
+    {
+      const double pz = 100.0 + i;
+      hepmc3_read << "E " << i << " 1 3\nU GEV MM\n"
+                  << "P 1 0 2212 0 0 7000 7000 0.938 4\n"
+                  << "P 2 0 2212 0 0 -7000 7000 0.938 4\n"
+                  << "V -1 0 [1,2]\n"
+                  << "P 3 -1 " << 11 + (i % 3) << " " << 0.5*i << " 0 " << pz << " " << pz << " 0 1\n";
+      hepmc2_read << "E " << i << " -1 -1 -1 -1 0 -1 1 10001 10002 0 1 1.0\nN 1 \"0\"\nU GEV MM\n"
+                  << "V -1 0 0 0 0 0 0 1 0\n"
+                  << "P 10001 2212 0 0 7000 7000 0.938 4 0 0 -1 0\n"
+                  << "P 10002 2212 0 0 -7000 7000 0.938 4 0 0 -1 0\n"
+                  << "P 10003 " << 11 + (i % 3) << " " << 0.5*i << " 0 " << pz << " " << pz << " 0 1 0 0 0 0\n";
+      lhef_read << "<event>\n 2 1 " << 1.0 + i << " 91.2 0.0078 0.118\n"
+                << " " << 11 + (i % 3) << " 1 0 0 0 0 " << 0.5*i << " 0 " << pz << " " << pz << " 0 0 9\n"
+                << " -11 1 0 0 0 0 0 0 -" << pz << " " << pz << " 0 0 9\n</event>\n";
+    }
+    hepmc3_read << "HepMC::Asciiv3-END_EVENT_LISTING\n";
+    hepmc2_read << "HepMC::IO_GenEvent-END_EVENT_LISTING\n";
+    lhef_read << "</LesHouchesEvents>\n";
+
+    const std::vector<std::pair<str, int>> hepmc_files =
+    {
+      {write_file("read.hepmc3", hepmc3_read.str()), 3},
+      {write_file("read.hepmc2", hepmc2_read.str()), 2},
+    };
+    for (const auto& file : hepmc_files)
+    {
+      std::vector<str> sequential;
+      {
+        std::unique_ptr<HepMC3::Reader> reader;
+        if (file.second == 2) reader.reset(new HepMC3::ReaderAsciiHepMC2(file.first));
+        else reader.reset(new HepMC3::ReaderAscii(file.first));
+        HepMC3::GenEvent event;
+        while (reader->read_event(event) and not reader->failed() and not event.particles().empty()) sequential.push_back(summary(event));
+      }
+      EXPECT(sequential.size() == n_read);
+
+      indexed_event_file index(file.first, file.second == 2 ? indexed_event_file::HepMC2 : indexed_event_file::HepMC3);
+      EXPECT(index.size() == n_read);
+      auto make_reader = [&]() { return std::unique_ptr<HepMC_thread_reader>(new HepMC_thread_reader(file.first, file.second)); };
+      auto read = [](HepMC_thread_reader& reader, uint64_t offset)
+      {
+        HepMC3::GenEvent event;
+        return reader.read(offset, event) ? summary(event) : str("(failed)");
+      };
+      EXPECT(read_in_threads(index, 4, make_reader, read) == sequential);
+
+      // A single reader moved backwards through the file
+      auto reader = make_reader();
+      bool all_same = true;
+      for (size_t i = index.size(); i-- > 0; ) all_same = all_same and (read(*reader, index.offset(i)) == sequential.at(i));
+      EXPECT(all_same);
+    }
+
+    const str lhef_read_file = write_file("read.lhe", lhef_read.str());
+    {
+      std::vector<str> sequential;
+      {
+        LHEF::Reader reader(lhef_read_file);
+        while (reader.readEvent()) sequential.push_back(summary(reader.hepeup));
+      }
+      EXPECT(sequential.size() == n_read);
+
+      indexed_event_file index(lhef_read_file, indexed_event_file::LHEF);
+      EXPECT(index.size() == n_read);
+      auto make_reader = [&]() { return std::unique_ptr<LHEF_thread_reader>(new LHEF_thread_reader(lhef_read_file)); };
+      auto read = [](LHEF_thread_reader& reader, uint64_t offset) { return reader.read(offset) ? summary(reader.reader.hepeup) : str("(failed)"); };
+      EXPECT(read_in_threads(index, 4, make_reader, read) == sequential);
+
+      // The index can be handed out again from the start, as it is at every new parameter point
+      index.rewind();
+      EXPECT(read_in_threads(index, 2, make_reader, read) == sequential);
+
+      auto reader = make_reader();
+      bool all_same = true;
+      for (size_t i = index.size(); i-- > 0; ) all_same = all_same and (read(*reader, index.offset(i)) == sequential.at(i));
+      EXPECT(all_same);
+    }
+
+    for (const auto& file : hepmc_files) std::remove(file.first.c_str());
+    std::remove(lhef_read_file.c_str());
+  #endif
+
+  for (const str& file : {hepmc3_file, hepmc2_file, lhef_file, empty_file, many_file}) std::remove(file.c_str());
+
+  return UnitTest::result();
+}
@@ -91,6 +91,32 @@ namespace Gambit
       const Observable* obslike;
     };
 
+    /// Dependency structure of the functors needed for a single ObsLike, used for concurrent evaluation
+    struct ConcurrentPlan
+    {
+      /// Topologically sorted vertices required by the ObsLike (including the ObsLike itself)
+      std::vector<VertexID> vertices;
+      /// Number of parents of each vertex within this plan
+      std::vector<int> nparents;
+      /// Children of each vertex within this plan (as indices into vertices)
+      std::vector<std::vector<int>> children;
+      /// Flags indicating which vertices may be calculated concurrently with others
+      std::vector<bool> concurrent;
+    };
+
+    /// Everything needed to calculate and print a single ObsLike at each point, resolved once after dependency resolution
+    struct RuntimePlan
+    {
+      /// Functors required by the ObsLike (including the ObsLike itself), in calling order
+      std::vector<functor*> functors;
+      /// Flags indicating which of the functors have printable (i.e. non-void) results
+      std::vector<bool> printable;
+      /// Labels of the functors ("function from module"), for debug logging
+      std::vector<str> labels;
+      /// Purpose assigned to the ObsLike in the yaml file
+      str purpose;
+    };
+
     /// Main dependency resolver
     class DependencyResolver
     {
@@ -122,6 +148,9 @@ namespace Gambit
         /// Retrieve the order in which target vertices are to be evaluated.
         std::vector<VertexID> getObsLikeOrder();
 
+        /// Sort a subset of target vertices into the order in which they are to be evaluated, using current runtime and invalidation statistics.
+        std::vector<VertexID> getObsLikeOrder(const std::vector<VertexID>&);
+
         /// Calculate a single target vertex.
         void calcObsLike(VertexID);
 
@@ -214,6 +243,15 @@ namespace Gambit
         /// Topological sort
         std::list<VertexID> run_topological_sort();
 
+        /// Resolve the functors, flags and purposes needed at each point into runtime plans for the ObsLikes
+        void setupRuntimePlans();
+
+        /// Work out which functors are threadsafe and build the concurrent evaluation plans
+        void setupConcurrentEvaluation();
+
+        /// Calculate a single target vertex, running independent threadsafe functors concurrently.
+        void calcObsLikeConcurrently(VertexID);
+
         /// Main function for resolution of backend requirements
         void resolveVertexBackend(VertexID, const std::vector<functor*>&);
 
@@ -271,6 +309,18 @@ namespace Gambit
         /// Saved calling order for functions required to compute single ObsLike entries
         std::map<VertexID, std::vector<VertexID>> SortedParentVertices;
 
+        /// Saved dependency structure of functions required to compute single ObsLike entries
+        std::map<VertexID, ConcurrentPlan> ConcurrentPlans;
+
+        /// Saved runtime plans for computing and printing single ObsLike entries
+        std::map<VertexID, RuntimePlan> RuntimePlans;
+
+        /// Saved list of all active functors (to be reset after each point)
+        std::vector<functor*> activeFunctors;
+
+        /// Backends used to fulfil the backend requirements of each vertex
+        std::map<VertexID, std::set<str>> vertexBackends;
+
         /// Temporary map for loop manager -> list of nested functions
         std::map<VertexID, std::set<VertexID>> loopManagerMap;
 
@@ -296,6 +346,12 @@ namespace Gambit
         /// Global flag for triggering printing of unitCubeParameters
         bool print_unitcube = false;
 
+        /// Number of threads used to calculate independent functors concurrently (1 = serial evaluation)
+        int functor_threads = 1;
+
+        /// Global flag for logging the average runtime of each functor after it is calculated
+        bool log_runtime = false;
+
   };
   }
 }
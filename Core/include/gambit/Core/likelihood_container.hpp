@@ -34,6 +34,9 @@
 ///          (christopher.chang@uqconnect.edu.au)
 ///  \date 2022 Aug
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #ifndef __likelihood_container_hpp__
@@ -119,6 +122,46 @@ namespace Gambit
       /// Run in likelihood debug mode?
       bool debug;
 
+      /// Number of likelihood evaluations between re-sorting of the target vertices (0 = never re-sort)
+      long long reorder_interval;
+
+      /// Number of likelihood evaluations since the target vertices were last re-sorted
+      long long evaluations_since_reorder;
+
+      /// File in which the current order of the target vertices is saved for resuming
+      str target_order_file;
+
+      /// Re-sort the target vertices according to the latest runtime and invalidation statistics of their functors
+      void reorderTargetVertices();
+
+      /// Save the current order of the target vertices to disk
+      void saveTargetOrder() const;
+
+      /// Restore the order of the target vertices saved by a previous run
+      void loadTargetOrder();
+
+      /// Binding of a single model parameter to its value in the primary_model_parameters functor
+      struct parameter_binding
+      {
+        str key;                // Full name of the parameter (model::parameter)
+        double* target;         // Value of the parameter in its primary_model_parameters functor
+      };
+
+      /// Bindings of all scanned parameters, compiled once at construction
+      std::vector<parameter_binding> parameter_bindings;
+
+      /// Entries of this container's own parameter map holding the value of each binding (same order as parameter_bindings)
+      std::vector<const double*> parameter_sources;
+
+      /// Look up the entries of this container's own parameter map that hold the values of the parameter bindings
+      void resolveParameterSources(const std::unordered_map<std::string, double> &);
+
+      /// Raise an error for a parameter missing from the map returned by the prior
+      void missingParameter(const str &, const std::unordered_map<std::string, double> &) const;
+
+      /// Get the YAML-ready values of the parameters at the current point, for diagnostic output
+      str parameterString() const;
+
     public:
 
       /// Constructor
@@ -126,6 +169,9 @@ namespace Gambit
        DRes::DependencyResolver &dependencyResolver, IniParser::IniFile &iniFile,
        const str &purpose, Printers::BaseBasePrinter& printer);
 
+      /// Destructor
+      ~Likelihood_Container();
+
       /// Do the prior transformation and populate the parameter map
       void setParameters (const std::unordered_map<std::string, double> &);
 
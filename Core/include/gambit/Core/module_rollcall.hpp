@@ -0,0 +1,45 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file                                       
+///                                               
+///  Compile-time registration of GAMBIT modules. 
+///                                               
+///  This file was automatically generated by     
+///  module_harvester.py. Do not modify.          
+///  The content is harvested from your local     
+///  installation.  If you want to add a new      
+///  module, just create it and make sure it      
+///  contains a rollcall header, and the          
+///  module_harvester.py script will make         
+///  sure it turns up here.                       
+///                                               
+///  By 'rollcall header', we mean a file         
+///  myBit/include/gambit/myBit/myBit_rollcall.hpp,
+///  where myBit is the name of your module.      
+///                                               
+///  *********************************************
+///                                               
+///  Authors:                                     
+///                                               
+///  \author The GAMBIT Collaboration            
+///  \date 06:54PM on October 16, 2026
+///                                               
+///  *********************************************
+                                                  
+#ifndef __module_rollcall_hpp__                   
+#define __module_rollcall_hpp__                   
+                                                  
+#include "gambit/Elements/module_macros_incore.hpp"
+
+#include "gambit/ExampleBit_B/ExampleBit_B_rollcall.hpp"
+#include "gambit/FlavBit/FlavBit_rollcall.hpp"
+#include "gambit/ExampleBit_A/ExampleBit_A_rollcall.hpp"
+#include "gambit/DecayBit/DecayBit_rollcall.hpp"
+#include "gambit/NeutrinoBit/NeutrinoBit_rollcall.hpp"
+#include "gambit/ObjectivesBit/ObjectivesBit_rollcall.hpp"
+#include "gambit/ColliderBit/ColliderBit_rollcall.hpp"
+#include "gambit/PrecisionBit/PrecisionBit_rollcall.hpp"
+#include "gambit/CosmoBit/CosmoBit_rollcall.hpp"
+#include "gambit/DarkBit/DarkBit_rollcall.hpp"
+
+#endif // defined __module_rollcall_hpp__
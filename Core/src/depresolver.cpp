@@ -58,6 +58,10 @@
 #include <iomanip>
 #include <regex>
 #include <utility>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
 
 #include <boost/format.hpp>
 #include <boost/algorithm/string/replace.hpp>
@@ -311,6 +315,12 @@ namespace Gambit
         SortedParentVertices[v] = getSortedParentVertices(v, masterGraph, function_order);
       }
 
+      // Resolve everything needed to evaluate the ObsLikes at each point, so that no graph searches or yaml lookups are needed then.
+      setupRuntimePlans();
+
+      // Work out which functors can be calculated concurrently (if requested)
+      setupConcurrentEvaluation();
+
       // Print list of backends required
       if (boundCore->show_backends)
       {
@@ -565,13 +575,21 @@ namespace Gambit
     std::vector<VertexID> DependencyResolver::getObsLikeOrder()
     {
       std::vector<VertexID> unsorted;
-      std::vector<VertexID> sorted;
-      std::set<VertexID> parents, colleagues, colleagues_min;
       // Copy unsorted vertexIDs --> unsorted
       for (const OutputVertex& ov : outputVertices)
       {
         unsorted.push_back(ov.vertex);
       }
+      return getObsLikeOrder(unsorted);
+    }
+
+    /// Returns a given list of ObsLike vertices in order of expected runtime per invalidation.
+    /// Parents shared with vertices earlier in the list are counted as free, as they will already have been calculated.
+    std::vector<VertexID> DependencyResolver::getObsLikeOrder(const std::vector<VertexID>& targets)
+    {
+      std::vector<VertexID> unsorted(targets);
+      std::vector<VertexID> sorted;
+      std::set<VertexID> parents, colleagues, colleagues_min;
       // Sort iteratively (unsorted --> sorted)
       while (unsorted.size() > 0)
       {
@@ -598,8 +616,9 @@ namespace Gambit
         // Extent list of calculated vertices
         colleagues.insert(colleagues_min.begin(), colleagues_min.end());
         double prop = masterGraph[*it_min]->getInvalidationRate();
-        logger() << LogTags::dependency_resolver << "Estimated T [s]: " << t2p_min*prop << EOM;
-        logger() << LogTags::dependency_resolver << "Estimated p: " << prop << EOM;
+        // Debug level only, as this runs for every target each time the likelihood components are re-sorted during a scan
+        logger() << LogTags::dependency_resolver << LogTags::debug << "Estimated T [s]: " << t2p_min*prop << endl
+                 << "Estimated p: " << prop << EOM;
         sorted.push_back(*it_min);
         unsorted.erase(it_min);
       }
@@ -609,47 +628,162 @@ namespace Gambit
     /// Evaluates ObsLike vertex, and everything it depends on, and prints results
     void DependencyResolver::calcObsLike(VertexID vertex)
     {
-      if (SortedParentVertices.find(vertex) == SortedParentVertices.end())
+      auto plan_it = RuntimePlans.find(vertex);
+      if (plan_it == RuntimePlans.end())
         core_error().raise(LOCAL_INFO, "Tried to calculate a function not in or not at top of dependency graph.");
-      std::vector<VertexID> order = SortedParentVertices.at(vertex);
 
-      for (const VertexID& v : order)
+      // Hand over to the concurrent evaluator if requested
+      if (functor_threads > 1)
       {
-        std::ostringstream ss;
-        ss << "Calling " << masterGraph[v]->name() << " from " << masterGraph[v]->origin() << "...";
-        logger() << LogTags::dependency_resolver << LogTags::info << LogTags::debug << ss.str() << EOM;
-        masterGraph[v]->calculate();
-        if (boundIniFile->getValueOrDef<bool>(
-              false, "dependency_resolution", "log_runtime") )
+        calcObsLikeConcurrently(vertex);
+        cout << std::setprecision(boundCore->get_outprec());
+        return;
+      }
+
+      const RuntimePlan& plan = plan_it->second;
+      for (size_t i = 0; i < plan.functors.size(); ++i)
+      {
+        functor* f = plan.functors[i];
+        logger() << LogTags::dependency_resolver << LogTags::info << LogTags::debug << "Calling " << plan.labels[i] << "..." << EOM;
+        f->calculate();
+        if (log_runtime)
         {
-          double T = masterGraph[v]->getRuntimeAverage();
+          double T = f->getRuntimeAverage();
           logger() << LogTags::dependency_resolver << LogTags::info <<
             "Runtime, averaged over multiple calls [s]: " << T << EOM;
         }
-        invalid_point_exception* e = masterGraph[v]->retrieve_invalid_point_exception();
+        invalid_point_exception* e = f->retrieve_invalid_point_exception();
         if (e != NULL) throw(*e);
       }
       // Reset the cout output precision, in case any backends have messed with it during the ObsLike evaluation.
       cout << std::setprecision(boundCore->get_outprec());
     }
 
+    /// Evaluates ObsLike vertex and everything it depends on, running independent threadsafe functors concurrently.
+    /// Functors that are not threadsafe are run one at a time by the master thread, outside of any parallel region,
+    /// so that they see exactly the same environment as in serial evaluation (including any loops they manage).
+    void DependencyResolver::calcObsLikeConcurrently(VertexID vertex)
+    {
+      const ConcurrentPlan& plan = ConcurrentPlans.at(vertex);
+      const int n = plan.vertices.size();
+
+      // Count down the parents of each vertex as they are calculated, and queue up vertices with none left
+      std::vector<int> nparents(plan.nparents);
+      std::deque<int> ready_concurrent, ready_serial;
+      auto enqueue = [&](int i) { (plan.concurrent[i] ? ready_concurrent : ready_serial).push_back(i); };
+      auto release = [&](int i) { for (int child : plan.children[i]) if (--nparents[child] == 0) enqueue(child); };
+      for (int i = 0; i < n; ++i) if (nparents[i] == 0) enqueue(i);
+
+      // Calculate a single vertex
+      const RuntimePlan& runtime_plan = RuntimePlans.at(vertex);
+      auto calculate = [&](int i)
+      {
+        functor* f = runtime_plan.functors[i];
+        logger() << LogTags::dependency_resolver << LogTags::info << LogTags::debug << "Calling " << runtime_plan.labels[i] << "..." << EOM;
+        f->calculate();
+        if (log_runtime)
+        {
+          logger() << LogTags::dependency_resolver << LogTags::info <<
+            "Runtime, averaged over multiple calls [s]: " << f->getRuntimeAverage() << EOM;
+        }
+      };
+
+      int n_done = 0;
+      while (true)
+      {
+        // Run all functors that are ready but must be run serially.
+        while (not ready_serial.empty())
+        {
+          int i = ready_serial.front();
+          ready_serial.pop_front();
+          calculate(i);
+          invalid_point_exception* e = runtime_plan.functors[i]->retrieve_invalid_point_exception();
+          if (e != NULL) throw(*e);
+          release(i);
+          n_done++;
+        }
+        if (n_done == n) break;
+        if (ready_concurrent.empty())
+        {
+          core_error().raise(LOCAL_INFO, "Concurrent evaluation of " + masterGraph[vertex]->origin() + "::"
+           + masterGraph[vertex]->name() + " stalled with functors still to be calculated.");
+          break;
+        }
+
+        // Run threadsafe functors concurrently until only serial ones are ready (or the point is invalidated).
+        // Each thread catches whatever its functors raise (invalid points are also recorded by the functors
+        // themselves), stops the others and leaves the first error or invalidation to be rethrown after the region.
+        // Threads with nothing to do sleep until a running functor finishes and releases its children.
+        int n_running = 0;
+        bool abort = false;
+        invalid_point_exception* invalidation = NULL;
+        std::exception_ptr error = nullptr;
+        std::mutex queue_mutex;
+        std::condition_variable queue_changed;
+        #pragma omp parallel num_threads(functor_threads)
+        {
+          // Let GAMBIT exceptions raised by this thread be thrown and caught below, rather than aborting the run.
+          parallel_exception_scope catching;
+          while (true)
+          {
+            int i = -1;
+            {
+              std::unique_lock<std::mutex> lock(queue_mutex);
+              queue_changed.wait(lock, [&]{ return abort or not ready_concurrent.empty() or n_running == 0; });
+              if (abort or ready_concurrent.empty()) break;
+              i = ready_concurrent.front();
+              ready_concurrent.pop_front();
+              n_running++;
+            }
+
+            invalid_point_exception* e = NULL;
+            std::exception_ptr caught = nullptr;
+            try
+            {
+              calculate(i);
+              e = runtime_plan.functors[i]->retrieve_invalid_point_exception();
+            }
+            catch (...)
+            {
+              caught = std::current_exception();
+            }
+
+            {
+              std::lock_guard<std::mutex> lock(queue_mutex);
+              n_running--;
+              n_done++;
+              if (caught != nullptr or e != NULL)
+              {
+                abort = true;
+                if (error == nullptr) error = caught;
+                if (invalidation == NULL) invalidation = e;
+              }
+              else release(i);
+            }
+            queue_changed.notify_all();
+          }
+        }
+        if (error != nullptr) std::rethrow_exception(error);
+        if (invalidation != NULL) throw(*invalidation);
+      }
+    }
+
     /// Prints the results of an ObsLike vertex
     void DependencyResolver::printObsLike(VertexID vertex, const int pointID)
     {
       // pointID is supplied by the scanner, and is used to tell the printer which model
       // point the results should be associated with.
 
-      if (SortedParentVertices.find(vertex) == SortedParentVertices.end())
+      auto plan_it = RuntimePlans.find(vertex);
+      if (plan_it == RuntimePlans.end())
         core_error().raise(LOCAL_INFO, "Tried to calculate a function not in or not at top of dependency graph.");
-      std::vector<VertexID> order = SortedParentVertices.at(vertex);
+      const RuntimePlan& plan = plan_it->second;
 
-      for (const VertexID& v : order)
+      for (size_t i = 0; i < plan.functors.size(); ++i)
       {
-        std::ostringstream ss;
-        ss << "Printing " << masterGraph[v]->name() << " from " << masterGraph[v]->origin() << "...";
-        logger() << LogTags::dependency_resolver << LogTags::info << LogTags::debug << ss.str() << EOM;
+        logger() << LogTags::dependency_resolver << LogTags::info << LogTags::debug << "Printing " << plan.labels[i] << "..." << EOM;
 
-        if (not typeComp(masterGraph[v]->type(),  "void", *boundTEs))
+        if (plan.printable[i])
         {
           // Note that this prints from thread index 0 only, i.e. results created by
           // threads other than the main one need to be accessed with
@@ -658,7 +792,7 @@ namespace Gambit
           // At the moment GAMBIT only prints results of thread 0, under the expectation
           // that nested module functions are all designed to gather their results into
           // thread 0.
-          masterGraph[v]->print(boundPrinter,pointID);
+          plan.functors[i]->print(boundPrinter,pointID);
         }
       }
     }
@@ -669,11 +803,8 @@ namespace Gambit
     /// Get the functor corresponding to a single VertexID
     functor* DependencyResolver::get_functor(VertexID id)
     {
-      graph_traits<MasterGraphType>::vertex_iterator vi, vi_end;
-      for (std::tie(vi, vi_end) = vertices(masterGraph); vi != vi_end; ++vi)
-      {
-        if (*vi == id) return masterGraph[id];
-      }
+      // Vertices are stored contiguously, so any ID below the number of vertices is valid.
+      if (id < num_vertices(masterGraph)) return masterGraph[id];
       return NULL;
     }
 
@@ -698,10 +829,8 @@ namespace Gambit
     /// Return the purpose associated with a given functor.
     const str& DependencyResolver::getPurpose(VertexID v)
     {
-      for (const OutputVertex& ov : outputVertices)
-      {
-        if (ov.vertex == v) return ov.purpose;
-      }
+      auto plan_it = RuntimePlans.find(v);
+      if (plan_it != RuntimePlans.end()) return plan_it->second.purpose;
       /// '__no_purpose' if the functor does not correspond to an ObsLike entry in the ini file.
       static const str none("__no_purpose");
       return none;
@@ -723,11 +852,7 @@ namespace Gambit
     /// Reset all active functors and delete existing results.
     void DependencyResolver::resetAll()
     {
-      graph_traits<MasterGraphType>::vertex_iterator vi, vi_end;
-      for (std::tie(vi, vi_end) = vertices(masterGraph); vi != vi_end; ++vi)
-      {
-        if (masterGraph[*vi]->isActive()) masterGraph[*vi]->reset();
-      }
+      for (functor* f : activeFunctors) f->reset();
     }
 
 
@@ -1358,6 +1483,7 @@ namespace Gambit
       // Read ini entries
       print_timing   = boundIniFile->getValueOrDef<bool>(false, "print_timing_data");
       print_unitcube = boundIniFile->getValueOrDef<bool>(false, "print_unitcube");
+      log_runtime    = boundIniFile->getValueOrDef<bool>(false, "dependency_resolution", "log_runtime");
 
       if ( print_timing   ) logger() << "Will output timing information for all functors (via printer system)" << EOM;
       if ( print_unitcube ) logger() << "Printing of unitCubeParameters will be enabled." << EOM;
@@ -2070,6 +2196,7 @@ namespace Gambit
     void DependencyResolver::resolveRequirement(functor* func, VertexID vertex)
     {
       masterGraph[vertex]->resolveBackendReq(func);
+      vertexBackends[vertex].insert(func->origin());
       logger() << LogTags::dependency_resolver;
       logger() << "Resolved by: [" << func->name() << ", ";
       logger() << func->origin() << " (" << func->version() << ")]";
@@ -2120,6 +2247,94 @@ namespace Gambit
 
 
 
+    /// Resolve the functors, flags and purposes needed at each point into runtime plans for the ObsLikes
+    void DependencyResolver::setupRuntimePlans()
+    {
+      for (const auto& entry : SortedParentVertices)
+      {
+        RuntimePlan& plan = RuntimePlans[entry.first];
+        for (const VertexID& v : entry.second)
+        {
+          functor* f = masterGraph[v];
+          plan.functors.push_back(f);
+          plan.printable.push_back(not typeComp(f->type(), "void", *boundTEs));
+          plan.labels.push_back(f->name() + " from " + f->origin());
+        }
+        plan.purpose = "__no_purpose";
+      }
+      // Where an ObsLike has been requested more than once, the purpose of the first request applies.
+      for (auto ov = outputVertices.rbegin(); ov != outputVertices.rend(); ++ov)
+      {
+        RuntimePlans.at(ov->vertex).purpose = ov->purpose;
+      }
+
+      graph_traits<MasterGraphType>::vertex_iterator vi, vi_end;
+      for (std::tie(vi, vi_end) = vertices(masterGraph); vi != vi_end; ++vi)
+      {
+        if (masterGraph[*vi]->isActive()) activeFunctors.push_back(masterGraph[*vi]);
+      }
+    }
+
+    /// Work out which functors are threadsafe and build the concurrent evaluation plans
+    void DependencyResolver::setupConcurrentEvaluation()
+    {
+      // The logger and functors only have storage for as many threads as OpenMP allows.
+      functor_threads = std::min(boundIniFile->getValueOrDef<int>(1, "dependency_resolution", "functor_threads"), omp_get_max_threads());
+      if (functor_threads <= 1) return;
+
+      // Backends that can safely be called from several threads at once, and functions/modules that the user has declared
+      // free of static state and OpenMP regions of their own.  All other functions are calculated serially.
+      const std::vector<str> threadsafe_backends = boundIniFile->getValueOrDef<std::vector<str>>(std::vector<str>(), "dependency_resolution", "threadsafe_backends");
+      const std::vector<str> concurrent_functions = boundIniFile->getValueOrDef<std::vector<str>>(std::vector<str>(), "dependency_resolution", "concurrent_functions");
+      auto listed = [](const std::vector<str>& list, const str& entry) { return std::find(list.begin(), list.end(), entry) != list.end(); };
+
+      std::ostringstream ss;
+      ss << "Independent functors will be calculated concurrently on up to " << functor_threads << " threads." << endl
+         << "The following functors will be calculated serially:";
+      graph_traits<MasterGraphType>::vertex_iterator vi, vi_end;
+      for (std::tie(vi, vi_end) = vertices(masterGraph); vi != vi_end; ++vi)
+      {
+        functor* f = masterGraph[*vi];
+        if (not f->isActive()) continue;
+        // Only functions listed in concurrent_functions are candidates.  Loop managers and backend initialisation
+        // functions need the master thread (and all of the OpenMP threads), so they are never run concurrently.
+        bool threadsafe = (listed(concurrent_functions, f->origin()) or listed(concurrent_functions, f->origin() + "::" + f->name()))
+                          and not f->canBeLoopManager() and not f->needsLoopManager()
+                          and not typeComp(f->type(), "void", *boundTEs);
+        // Backends hold global state, so functors using them run serially unless the backend is declared threadsafe.
+        if (vertexBackends.find(*vi) != vertexBackends.end())
+        {
+          for (const str& be : vertexBackends.at(*vi)) threadsafe = threadsafe and listed(threadsafe_backends, be);
+        }
+        f->setThreadsafe(threadsafe);
+        if (not threadsafe) ss << endl << "  " << f->origin() << "::" << f->name();
+      }
+      logger() << LogTags::dependency_resolver << ss.str() << EOM;
+
+      // Translate the sorted vertex lists into dependency counts and child lists.
+      for (const auto& entry : SortedParentVertices)
+      {
+        ConcurrentPlan& plan = ConcurrentPlans[entry.first];
+        plan.vertices = entry.second;
+        const int n = plan.vertices.size();
+        plan.nparents.assign(n, 0);
+        plan.children.assign(n, std::vector<int>());
+        plan.concurrent.assign(n, false);
+        std::map<VertexID, int> position;
+        for (int i = 0; i < n; ++i) position[plan.vertices[i]] = i;
+        for (int i = 0; i < n; ++i)
+        {
+          graph_traits<MasterGraphType>::in_edge_iterator it, iend;
+          for (std::tie(it, iend) = in_edges(plan.vertices[i], masterGraph); it != iend; ++it)
+          {
+            plan.children[position.at(source(*it, masterGraph))].push_back(i);
+            plan.nparents[i]++;
+          }
+          plan.concurrent[i] = masterGraph[plan.vertices[i]]->isThreadsafe();
+        }
+      }
+    }
+
     /// Check for unused rules and options
     void DependencyResolver::checkForUnusedRules()
     {
@@ -31,6 +31,7 @@ using namespace LogTags;
 void do_cleanup()
 {
   Gambit::Scanner::Plugins::plugin_info.dump(); // Also calls printer finalise() routine
+  profiler().write(); // Write out the functor profile so far (if profiling)
 }
 
 
@@ -220,6 +221,14 @@ int main(int argc, char* argv[])
         // Set cleanup function to call during premature shutdown
         signaldata().set_cleanup(&do_cleanup);
 
+        // Switch on profiling of module and backend functors if requested
+        Options profiling(iniFile.getValueOrDef<YAML::Node>(YAML::Node(), "profiling"));
+        if (profiling.getValueOrDef<bool>(false, "enabled"))
+        {
+          str prefix = profiling.getValueOrDef<str>(iniFile.getLoggerNode()["default_output_path"].as<str>(), "output_prefix");
+          profiler().enable(prefix, profiling.getValueOrDef<long long>(100000, "max_trace_events"), rank);
+        }
+
         // For extra speed with fast likelihood evaluations, disable the logs while the scans runs
         bool disable_logs_during_scan = iniFile.getValueOrDef<bool>(false, "disable_logs_during_scan");
         if(disable_logs_during_scan) logger().disable();
@@ -228,6 +237,7 @@ int main(int argc, char* argv[])
         if (rank == 0) std::cerr << "Starting scan." << std::endl;
         scan.Run(); // Note: the likelihood container will unblock signals when it is safe to receive them.
         logger().enable(); // Turn logs back on (in case they were disabled for speed)
+        profiler().write(); // Write out the functor profile (if profiling)
         // Check why we have exited the scanner; scan may have been terminated early by a signal.
         // We assume here that because the scanner has exited that it has already down whatever
         // cleanup it requires, including finalising the printers, i.e. the 'do_cleanup()' function will NOT run.
@@ -34,6 +34,9 @@
 ///          (christopher.chang@uqconnect.edu.au)
 ///  \date 2022 Aug
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #include "gambit/Core/likelihood_container.hpp"
@@ -41,6 +44,9 @@
 #include "gambit/Utils/signal_handling.hpp"
 #include "gambit/Utils/mpiwrapper.hpp"
 #include "gambit/Utils/lnlike_modifiers.hpp"
+#include "gambit/Elements/functor_profiler.hpp"
+
+#include <fstream>
 
 //#define CORE_DEBUG
 
@@ -75,10 +81,12 @@ namespace Gambit
     scancodeID(Printers::get_main_param_id("scanID")),
     print_scanID(iniFile.getValueOrDef<bool>(true, "print_scanID")),
     #ifdef CORE_DEBUG
-      debug            (true)
+      debug            (true),
     #else
-      debug            (iniFile.getValueOrDef<bool>(false, "debug") or iniFile.getValueOrDef<bool>(false, "likelihood", "debug"))
+      debug            (iniFile.getValueOrDef<bool>(false, "debug") or iniFile.getValueOrDef<bool>(false, "likelihood", "debug")),
     #endif
+    reorder_interval (iniFile.getValueOrDef<long long>(0, "likelihood", "reorder_interval")),
+    evaluations_since_reorder (0)
   {
     // Get the parameter node for the chosen lnlike_modifier (if any)
     if (lnlike_modifier_name != "identity")
@@ -91,6 +99,17 @@ namespace Gambit
     // Set the ScanID
     set_scanID();
 
+    // Compile the list of scanned parameters and where their values live, so that the
+    // keys need not be rebuilt, nor the values looked up by name, at every point.
+    for (auto act_it = functorMap.begin(), act_end = functorMap.end(); act_it != act_end; act_it++)
+    {
+      ModelParameters* params = act_it->second->getcontentsPtr();
+      for (const str& par : params->getKeys())
+      {
+        parameter_bindings.push_back({act_it->first + "::" + par, params->getValuePtr(par)});
+      }
+    }
+
     // Find subset of vertices that match requested purpose
     auto all_vertices = dependencyResolver.getObsLikeOrder();
     for (auto it = all_vertices.begin(); it != all_vertices.end(); ++it)
@@ -105,6 +124,71 @@ namespace Gambit
         aux_vertices.push_back(std::move(*it));
       }
     }
+
+    // If the target vertices are to be re-sorted during the scan, pick up where any previous run left off.
+    if (reorder_interval > 0)
+    {
+      target_order_file = Scanner::Plugins::plugin_info.temp_file_path() + "target_order_" + purpose
+                          + "_" + std::to_string(Scanner::Plugins::plugin_info.getRank());
+      if (Scanner::Plugins::plugin_info.resume_mode()) loadTargetOrder();
+    }
+  }
+
+  /// Re-sort the target vertices according to the latest runtime and invalidation statistics of their functors
+  void Likelihood_Container::reorderTargetVertices()
+  {
+    evaluations_since_reorder = 0;
+    std::vector<DRes::VertexID> new_order = dependencyResolver.getObsLikeOrder(target_vertices);
+    if (new_order == target_vertices) return;
+    target_vertices = std::move(new_order);
+    logger() << LogTags::core << "Re-sorted likelihood components. New order of evaluation:";
+    for (const auto& v : target_vertices)
+    {
+      logger() << endl << "  " << dependencyResolver.get_functor(v)->origin() << "::" << dependencyResolver.get_functor(v)->name();
+    }
+    logger() << EOM;
+    saveTargetOrder();
+  }
+
+  /// Save the current order of the target vertices to disk
+  void Likelihood_Container::saveTargetOrder() const
+  {
+    std::ofstream out(target_order_file);
+    for (const auto& v : target_vertices)
+    {
+      out << dependencyResolver.get_functor(v)->origin() << "::" << dependencyResolver.get_functor(v)->name() << endl;
+    }
+  }
+
+  /// Restore the order of the target vertices saved by a previous run
+  void Likelihood_Container::loadTargetOrder()
+  {
+    std::ifstream in(target_order_file);
+    if (not in.good()) return;
+    std::map<str, DRes::VertexID> vertex_from_name;
+    for (const auto& v : target_vertices)
+    {
+      vertex_from_name[dependencyResolver.get_functor(v)->origin() + "::" + dependencyResolver.get_functor(v)->name()] = v;
+    }
+    std::vector<DRes::VertexID> saved_order;
+    str name;
+    while (std::getline(in, name))
+    {
+      if (name.empty()) continue;
+      auto it = vertex_from_name.find(name);
+      if (it == vertex_from_name.end()) break;
+      saved_order.push_back(it->second);
+      vertex_from_name.erase(it);
+    }
+    // Only use the saved order if it contains exactly the same likelihoods as this run.
+    if (saved_order.size() != target_vertices.size())
+    {
+      logger() << LogTags::core << LogTags::warn << "Order of likelihood components saved in " << target_order_file
+               << " does not match the likelihoods in this scan; ignoring it." << EOM;
+      return;
+    }
+    target_vertices = std::move(saved_order);
+    logger() << LogTags::core << "Restored order of likelihood components from " << target_order_file << "." << EOM;
   }
 
   /// Work out what the scanID should be and set it
@@ -113,58 +197,100 @@ namespace Gambit
     scancode = dependencyResolver.scanID;
   }
 
-  /// Do the prior transformation and populate the parameter map
-  void Likelihood_Container::setParameters (const std::unordered_map<std::string, double> &parameterMap)
+  /// Destructor
+  Likelihood_Container::~Likelihood_Container()
   {
-    // Set up a stream containing the parameter values, for diagnostic output
-    std::ostringstream parstream;
+    // Don't leave the exceptions with a parameter string generator that refers to this container.
+    exception::set_parameters(str());
+  }
+
+  /// Raise an error for a parameter missing from the map returned by the prior
+  void Likelihood_Container::missingParameter(const str &key, const std::unordered_map<std::string, double> &parameterMap) const
+  {
+    std::ostringstream err;
+    err << "Error! Failed to set parameter '"<<key<<"' following prior transformation! The parameter could not be found in the map returned by the prior. This probably means that the prior you are using contains a bug." << std::endl;
+    err << "The parameters and values that *were* returned by the prior were:" <<std::endl;
+    if(parameterMap.size()==0){ err << "None! Size of map was zero." << std::endl; }
+    else {
+      for (auto par_jt = parameterMap.begin(); par_jt != parameterMap.end(); ++par_jt)
+      {
+        err << par_jt->first << "=" << par_jt->second << std::endl;
+      }
+    }
+    core_error().raise(LOCAL_INFO,err.str());
+  }
 
+  /// Get the YAML-ready values of the parameters at the current point, for diagnostic output
+  str Likelihood_Container::parameterString() const
+  {
+    std::ostringstream parstream;
     // Iterate over the primary_model_parameters functors of all the models being scanned.
     for (auto act_it = functorMap.begin(), act_end = functorMap.end(); act_it != act_end; act_it++)
     {
       parstream << "  " << act_it->first << ":" << endl;
-      // Get the names of the parameters for this model.
-      auto paramkeys = act_it->second->getcontentsPtr()->getKeys();
-      // Iterate over the parameters, setting their values in the primary_model_parameters functors from the parameterMap.
-      for (auto par_it = paramkeys.begin(), par_end = paramkeys.end(); par_it != par_end; par_it++)
+      for (const auto& par : act_it->second->getcontentsPtr()->getValues())
       {
-        str key = act_it->first + "::" + *par_it;
-        auto tmp_it = parameterMap.find(key);
-        if(tmp_it == parameterMap.end())
-        {
-           std::ostringstream err;
-           err << "Error! Failed to set parameter '"<<key<<"' following prior transformation! The parameter could not be found in the map returned by the prior. This probably means that the prior you are using contains a bug." << std::endl;
-           err << "The parameters and values that *were* returned by the prior were:" <<std::endl;
-           if(parameterMap.size()==0){ err << "None! Size of map was zero." << std::endl; }
-           else {
-             for (auto par_jt = parameterMap.begin(); par_jt != parameterMap.end(); ++par_jt)
-             {
-               err << par_jt->first << "=" << par_jt->second << std::endl;
-             }
-           }
-           core_error().raise(LOCAL_INFO,err.str());
-        }
-        parstream << "    " << *par_it << ": " << tmp_it->second << endl;
-        act_it->second->getcontentsPtr()->setValue(*par_it, tmp_it->second);
+        parstream << "    " << par.first << ": " << par.second << endl;
+      }
+    }
+    return parstream.str();
+  }
+
+  /// Look up the entries of this container's own parameter map that hold the values of the parameter bindings
+  void Likelihood_Container::resolveParameterSources(const std::unordered_map<std::string, double> &parameterMap)
+  {
+    std::vector<const double*> sources;
+    sources.reserve(parameter_bindings.size());
+    for (const auto& binding : parameter_bindings)
+    {
+      auto tmp_it = parameterMap.find(binding.key);
+      if (tmp_it == parameterMap.end()) missingParameter(binding.key, parameterMap);
+      sources.push_back(&(tmp_it->second));
+    }
+    parameter_sources = std::move(sources);
+  }
+
+  /// Do the prior transformation and populate the parameter map
+  void Likelihood_Container::setParameters (const std::unordered_map<std::string, double> &parameterMap)
+  {
+    // Set the values of the parameters in the primary_model_parameters functors of all the models being scanned.
+    if (&parameterMap == &getMap())
+    {
+      // The scanner's priors fill this container's own map, and only ever overwrite its entries once they
+      // exist.  Elements of an unordered_map do not move when it grows, so the entries are looked up once,
+      // at the first point, and then copied straight through.
+      if (parameter_sources.empty() and not parameter_bindings.empty()) resolveParameterSources(parameterMap);
+      for (std::size_t i = 0, end = parameter_bindings.size(); i < end; ++i)
+      {
+        *parameter_bindings[i].target = *parameter_sources[i];
+      }
+    }
+    else
+    {
+      // Any other map may be rebuilt between points, so its entries are looked up afresh.
+      for (const auto& binding : parameter_bindings)
+      {
+        auto tmp_it = parameterMap.find(binding.key);
+        if (tmp_it == parameterMap.end()) missingParameter(binding.key, parameterMap);
+        *binding.target = tmp_it->second;
       }
     }
 
-    // Notify all exceptions of the values of the parameters for this point.
-    exception::set_parameters("\n\nYAML-ready parameter values at failed point:\n"+parstream.str());
+    // Notify all exceptions of how to obtain the values of the parameters for this point.  The string
+    // itself is only generated if a fatal exception is actually raised.
+    exception::set_parameters([this]() { return "\n\nYAML-ready parameter values at failed point:\n" + parameterString(); });
 
     // Print out the MPI rank and values of the parameters for this point if in debug mode.
     if (debug)
     {
+      str parstring = parameterString();
       #ifdef WITH_MPI
         GMPI::Comm COMM_WORLD;
         std::cout << "MPI process rank: "<< COMM_WORLD.Get_rank() << std::endl;
       #endif
-      cout << parstream.str();
-      logger() << LogTags::core << "\nBeginning computations for parameter point:\n" << parstream.str() << EOM;
+      cout << parstring;
+      logger() << LogTags::core << "\nBeginning computations for parameter point:\n" << parstring << EOM;
     }
-    // Print the parameter point to the logs, even if not in debug mode
-    //logger() << LogTags::core << "\nBeginning computations for parameter point:\n" << parstream.str() << EOM;
-
 
   }
 
@@ -387,6 +513,10 @@ namespace Gambit
     if (debug) cout << "Total log-likelihood: " << lnlike << endl << endl;
     logger() << "Total lnL: " << lnlike << EOM;
     dependencyResolver.resetAll();
+    if (functor_profiler::enabled()) profiler().point_done();
+
+    // Periodically re-sort the likelihood components, so that the cheapest way to rule out a point is tried first.
+    if (reorder_interval > 0 and ++evaluations_since_reorder >= reorder_interval) reorderTargetVertices();
 
     // Disable the printer so that it doesn't try to output the min_valid_lnlike as a valid likelihood value. ScannerBit will re-enable it when needed again.
     // Disable only for the next print call
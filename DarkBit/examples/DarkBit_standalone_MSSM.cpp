@@ -484,13 +484,14 @@ int main(int argc, char* argv[])
       cascadeMC_DecayTable.reset_and_calculate();
 
       // cascadeMC_LoopManager.setOption<int>("cMC_maxEvents", 100000);
-      // cascadeMC_Histograms.setOption<double>("cMC_endCheckFrequency", 25);
+      // cascadeMC_EndCheckFrequency.setOption<int>("cMC_endCheckFrequency", 25);
       // cascadeMC_Histograms.setOption<double>("cMC_gammaRelError", .05);
       // cascadeMC_Histograms.setOption<int>("cMC_numSpecSamples", 25);
       // cascadeMC_Histograms.setOption<int>("cMC_NhistBins", 300);
 
       // Set up MC loop manager for cascade MC
       cascadeMC_LoopManager.resolveDependency(&cascadeMC_InitialStates);
+      cascadeMC_LoopManager.resolveDependency(&cascadeMC_EndCheckFrequency);
       std::vector<functor*> nested_functions = initVector<functor*>(
               &cascadeMC_GenerateChain, &cascadeMC_Histograms, &cascadeMC_EventCount);
       cascadeMC_LoopManager.setNestedList(nested_functions);
@@ -504,12 +505,14 @@ int main(int argc, char* argv[])
       cascadeMC_Histograms.resolveDependency(&TH_ProcessCatalog_DS5_MSSM);
       cascadeMC_Histograms.resolveDependency(&Combine_SimYields);
       cascadeMC_Histograms.resolveDependency(&cascadeMC_FinalStates);
+      cascadeMC_Histograms.resolveDependency(&cascadeMC_EndCheckFrequency);
       cascadeMC_Histograms.resolveLoopManager(&cascadeMC_LoopManager);
 
       // Check convergence of cascade MC
       cascadeMC_EventCount.resolveLoopManager(&cascadeMC_LoopManager);
 
       // Start cascade MC loop
+      cascadeMC_EndCheckFrequency.reset_and_calculate();
       cascadeMC_LoopManager.reset_and_calculate();
 
       // Infer gamma-ray spectra for recorded MC results
@@ -768,6 +771,7 @@ int main(int argc, char* argv[])
 
       // Set up MC loop manager for cascade MC
       cascadeMC_LoopManager.resolveDependency(&cascadeMC_InitialStates);
+      cascadeMC_LoopManager.resolveDependency(&cascadeMC_EndCheckFrequency);
       std::vector<functor*> nested_functions = initVector<functor*>(
               &cascadeMC_GenerateChain, &cascadeMC_Histograms, &cascadeMC_EventCount);
       cascadeMC_LoopManager.setNestedList(nested_functions);
@@ -781,12 +785,14 @@ int main(int argc, char* argv[])
       cascadeMC_Histograms.resolveDependency(&TH_ProcessCatalog_DS_MSSM);
       cascadeMC_Histograms.resolveDependency(&Combine_SimYields);
       cascadeMC_Histograms.resolveDependency(&cascadeMC_FinalStates);
+      cascadeMC_Histograms.resolveDependency(&cascadeMC_EndCheckFrequency);
       cascadeMC_Histograms.resolveLoopManager(&cascadeMC_LoopManager);
 
       // Check convergence of cascade MC
       cascadeMC_EventCount.resolveLoopManager(&cascadeMC_LoopManager);
 
       // Start cascade MC loop
+      cascadeMC_EndCheckFrequency.reset_and_calculate();
       cascadeMC_LoopManager.reset_and_calculate();
 
       // Infer gamma-ray spectra for recorded MC results
@@ -1100,6 +1106,7 @@ int main(int argc, char* argv[])
 
       // Set up MC loop manager for cascade MC
       cascadeMC_LoopManager.resolveDependency(&cascadeMC_InitialStates);
+      cascadeMC_LoopManager.resolveDependency(&cascadeMC_EndCheckFrequency);
       std::vector<functor*> nested_functions = initVector<functor*>(
               &cascadeMC_GenerateChain, &cascadeMC_Histograms, &cascadeMC_EventCount);
       cascadeMC_LoopManager.setNestedList(nested_functions);
@@ -1113,12 +1120,14 @@ int main(int argc, char* argv[])
       cascadeMC_Histograms.resolveDependency(&TH_ProcessCatalog_DS_MSSM);
       cascadeMC_Histograms.resolveDependency(&Combine_SimYields);
       cascadeMC_Histograms.resolveDependency(&cascadeMC_FinalStates);
+      cascadeMC_Histograms.resolveDependency(&cascadeMC_EndCheckFrequency);
       cascadeMC_Histograms.resolveLoopManager(&cascadeMC_LoopManager);
 
       // Check convergence of cascade MC
       cascadeMC_EventCount.resolveLoopManager(&cascadeMC_LoopManager);
 
       // Start cascade MC loop
+      cascadeMC_EndCheckFrequency.reset_and_calculate();
       cascadeMC_LoopManager.reset_and_calculate();
 
       // Infer gamma-ray spectra for recorded MC results
@@ -1430,6 +1439,7 @@ int main(int argc, char* argv[])
 
       // Set up MC loop manager for cascade MC
       cascadeMC_LoopManager.resolveDependency(&cascadeMC_InitialStates);
+      cascadeMC_LoopManager.resolveDependency(&cascadeMC_EndCheckFrequency);
       std::vector<functor*> nested_functions = initVector<functor*>(
               &cascadeMC_GenerateChain, &cascadeMC_Histograms, &cascadeMC_EventCount);
       cascadeMC_LoopManager.setNestedList(nested_functions);
@@ -1443,12 +1453,14 @@ int main(int argc, char* argv[])
       cascadeMC_Histograms.resolveDependency(&TH_ProcessCatalog_DS_MSSM);
       cascadeMC_Histograms.resolveDependency(&Combine_SimYields);
       cascadeMC_Histograms.resolveDependency(&cascadeMC_FinalStates);
+      cascadeMC_Histograms.resolveDependency(&cascadeMC_EndCheckFrequency);
       cascadeMC_Histograms.resolveLoopManager(&cascadeMC_LoopManager);
 
       // Check convergence of cascade MC
       cascadeMC_EventCount.resolveLoopManager(&cascadeMC_LoopManager);
 
       // Start cascade MC loop
+      cascadeMC_EndCheckFrequency.reset_and_calculate();
       cascadeMC_LoopManager.reset_and_calculate();
 
       // Infer gamma-ray spectra for recorded MC results
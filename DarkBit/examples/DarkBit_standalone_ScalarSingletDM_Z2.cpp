@@ -395,6 +395,7 @@ int main()
 
     // Set up MC loop manager for cascade MC
     cascadeMC_LoopManager.resolveDependency(&cascadeMC_InitialStates);
+    cascadeMC_LoopManager.resolveDependency(&cascadeMC_EndCheckFrequency);
     std::vector<functor*> nested_functions = initVector<functor*>(
         &cascadeMC_GenerateChain, &cascadeMC_Histograms, &cascadeMC_EventCount);
     cascadeMC_LoopManager.setNestedList(nested_functions);
@@ -408,12 +409,14 @@ int main()
     cascadeMC_Histograms.resolveDependency(&TH_ProcessCatalog_ScalarSingletDM_Z2);
     cascadeMC_Histograms.resolveDependency(&Combine_SimYields);
     cascadeMC_Histograms.resolveDependency(&cascadeMC_FinalStates);
+    cascadeMC_Histograms.resolveDependency(&cascadeMC_EndCheckFrequency);
     cascadeMC_Histograms.resolveLoopManager(&cascadeMC_LoopManager);
 
     // Check convergence of cascade MC
     cascadeMC_EventCount.resolveLoopManager(&cascadeMC_LoopManager);
 
     // Start cascade MC loop
+    cascadeMC_EndCheckFrequency.reset_and_calculate();
     cascadeMC_LoopManager.reset_and_calculate();
 
     // Infer gamma-ray spectra for recorded MC results
@@ -92,6 +92,7 @@ void dumpSpectrum(std::vector<std::string> filenames, double mWIMP, double sv, s
   cascadeMC_FinalStates.reset_and_calculate();
   cascadeMC_InitialStates.reset_and_calculate();
   cascadeMC_DecayTable.reset_and_calculate();
+  cascadeMC_EndCheckFrequency.reset_and_calculate();
   cascadeMC_LoopManager.reset_and_calculate();
   cascadeMC_gammaSpectra.reset_and_calculate();
   GA_AnnYield_General.reset_and_calculate();
@@ -437,11 +438,12 @@ int main(int argc, char* argv[])
 
     // Set up MC loop manager for cascade MC
     cascadeMC_LoopManager.setOption<int>("cMC_maxEvents", 20000);
-    cascadeMC_Histograms.setOption<double>("cMC_endCheckFrequency", 25);
+    cascadeMC_EndCheckFrequency.setOption<int>("cMC_endCheckFrequency", 25);
     cascadeMC_Histograms.setOption<double>("cMC_gammaRelError", .05);
     cascadeMC_Histograms.setOption<int>("cMC_numSpecSamples", 25);
     cascadeMC_Histograms.setOption<int>("cMC_NhistBins", 300);
     cascadeMC_LoopManager.resolveDependency(&cascadeMC_InitialStates);
+    cascadeMC_LoopManager.resolveDependency(&cascadeMC_EndCheckFrequency);
     std::vector<functor*> nested_functions = initVector<functor*>(
         &cascadeMC_GenerateChain, &cascadeMC_Histograms, &cascadeMC_EventCount);
     cascadeMC_LoopManager.setNestedList(nested_functions);
@@ -455,6 +457,7 @@ int main(int argc, char* argv[])
     cascadeMC_Histograms.resolveDependency(&TH_ProcessCatalog_WIMP);
     cascadeMC_Histograms.resolveDependency(&Combine_SimYields);
     cascadeMC_Histograms.resolveDependency(&cascadeMC_FinalStates);
+    cascadeMC_Histograms.resolveDependency(&cascadeMC_EndCheckFrequency);
     cascadeMC_Histograms.resolveLoopManager(&cascadeMC_LoopManager);
 
     // Check convergence of cascade MC
@@ -712,6 +715,7 @@ int main(int argc, char* argv[])
           cascadeMC_FinalStates.reset_and_calculate();
           cascadeMC_InitialStates.reset_and_calculate();
           cascadeMC_DecayTable.reset_and_calculate();
+          cascadeMC_EndCheckFrequency.reset_and_calculate();
           cascadeMC_LoopManager.reset_and_calculate();
           cascadeMC_gammaSpectra.reset_and_calculate();
           GA_AnnYield_General.reset_and_calculate();
@@ -784,6 +788,7 @@ int main(int argc, char* argv[])
           cascadeMC_FinalStates.reset_and_calculate();
           cascadeMC_InitialStates.reset_and_calculate();
           cascadeMC_DecayTable.reset_and_calculate();
+          cascadeMC_EndCheckFrequency.reset_and_calculate();
           cascadeMC_LoopManager.reset_and_calculate();
           cascadeMC_gammaSpectra.reset_and_calculate();
           GA_AnnYield_General.reset_and_calculate();
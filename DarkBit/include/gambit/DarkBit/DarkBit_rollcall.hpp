@@ -105,6 +105,10 @@
 /// \author Sowmiya Balan
 ///         (sowmiya.balan@kit.edu)
 /// \date 2022
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #pragma once
@@ -795,12 +799,21 @@ START_MODULE
     #undef FUNCTION
   #undef CAPABILITY
 
+  /// Number of cascade decay chains between successive convergence checks
+  #define CAPABILITY cascadeMC_EndCheckFrequency
+  START_CAPABILITY
+    #define FUNCTION cascadeMC_EndCheckFrequency
+      START_FUNCTION(int)
+    #undef FUNCTION
+  #undef CAPABILITY
+
   /// Loop manager for cascade decays
   #define CAPABILITY cascadeMC_LoopManagement
   START_CAPABILITY
     #define FUNCTION cascadeMC_LoopManager
       START_FUNCTION(std::string, CAN_MANAGE_LOOPS)
       DEPENDENCY(cascadeMC_InitialStates, std::set<std::string>)
+      DEPENDENCY(cascadeMC_EndCheckFrequency, int)
     #undef FUNCTION
   #undef CAPABILITY
 
@@ -832,6 +845,7 @@ START_MODULE
       DEPENDENCY(TH_ProcessCatalog, TH_ProcessCatalog)
       DEPENDENCY(FullSimYieldTable, SimYieldTable)
       DEPENDENCY(cascadeMC_FinalStates,std::set<std::string>)
+      DEPENDENCY(cascadeMC_EndCheckFrequency, int)
       NEEDS_MANAGER(cascadeMC_LoopManagement, std::string)
     #undef FUNCTION
   #undef CAPABILITY
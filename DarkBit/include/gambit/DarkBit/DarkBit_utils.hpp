@@ -12,18 +12,26 @@
 ///          (torsten.bringmann@fys.uio.no)
 ///  \date 2015 May
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 
 #ifndef __DarkBit_utils_hpp__
 #define __DarkBit_utils_hpp__
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 #include <map>
 
 #include "gambit/Utils/util_types.hpp"
+#include "gambit/Utils/integration.hpp"
 #include "gambit/cmake/cmake_variables.hpp"
 #include "gambit/Elements/daFunk.hpp"
+#include "gambit/Elements/decay_table.hpp"
+#include "gambit/DarkBit/ProcessCatalog.hpp"
 
 
 namespace Gambit
@@ -57,6 +65,39 @@ namespace Gambit
       */
       template <int i>
       double gamma3bdy_limits(double Eg, double M_DM, double m1, double m2);
+
+      /*! \brief Integral over the projected radius r in [rmin, rmax] of a spherical source seen face-on:
+      *   int dr r int_r^rsun drho rho/sqrt(rho^2 - r^2) g(rho)
+      *
+      * Notes:
+      * - rho = r + (rsun - r) u^2 removes the 1/sqrt(rho - r) endpoint singularity of the inner integrand.
+      * - The inner integrals are done separately for each radius, as the kinks of a tabulated g sit
+      *   at different u for each r.
+      * - Tolerances are (absolute, relative) for the outer and for each inner integral; limit caps the panels of each.
+      * - The outer integral uses GK51 panels, as the qag integration the tabulated CAST counts were made with.
+      */
+      template <typename Emissivity>
+      double projected_disc_integral(const Emissivity& g, double rmin, double rmax, double rsun,
+                                     double abseps, double releps, double inner_abseps, double inner_releps, size_t limit = 1000)
+      {
+        Utils::batch_integrand outer = [&](const double* r, size_t n, double* fr)
+        {
+          for (size_t k = 0; k < n; ++k)
+          {
+            const double depth = std::max(rsun - r[k], 0.0);
+            Utils::batch_integrand inner = [&](const double* u, size_t nu, double* fu)
+            {
+              for (size_t i = 0; i < nu; ++i)
+              {
+                const double rho = r[k] + depth*u[i]*u[i];
+                fu[i] = 2.0*std::sqrt(depth)*rho/std::sqrt(rho + r[k])*g(rho);
+              }
+            };
+            fr[k] = r[k]*Utils::integrate_gk21(inner, 0.0, 1.0, inner_abseps, inner_releps, limit);
+          }
+        };
+        return Utils::integrate_gk51(outer, rmin, rmax, abseps, releps, limit);
+      }
     }
 
   }
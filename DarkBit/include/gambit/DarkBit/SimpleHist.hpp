@@ -13,6 +13,9 @@
 ///          (l.a.dal@fys.uio.no)
 ///  \date 2015 Feb
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 
@@ -60,6 +63,12 @@ namespace Gambit
         /// Important: Input histogram MUST have identical binning for this to give correct results.
         void addHistAsWeights_sameBin(SimpleHist &in);
 
+        /// Add the contents of an identically binned histogram filled with other events
+        void addHist_sameBin(const SimpleHist &in);
+
+        /// Remove all entries, keeping the binning
+        void clear();
+
         /// Get error for a specified bin
         double getError(int bin) const;
 
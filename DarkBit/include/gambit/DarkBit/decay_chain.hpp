@@ -13,11 +13,15 @@
 ///          (l.a.dal@fys.uio.no)
 ///  \date 2014 Oct, Nov, Dec
 ///  \date 2015 Jan
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
 ///  *********************************************
 
 #ifndef __decay_chain_hpp__
 #define __decay_chain_hpp__
 
+#include <cstdint>
 #include <vector>
 #include <unordered_map>
 #include <string>
@@ -127,7 +131,12 @@ namespace Gambit
             // Generate a random number between -1 and 1
             double rand_m1_1();
             // Generate a random number between 0 and 1
-            inline double rand_0_1(){return Random::draw();}
+            double rand_0_1();
+            // Give this thread its own random number stream for the chain it generates next,
+            // so that the chain depends only on the seed and not on thread scheduling
+            void seedChainRNG(std::uint64_t seed);
+            // Go back to drawing from Random::draw() on this thread
+            void unseedChainRNG();
             // Generate a 3-vector to a random point on the unit sphere
             vec3 randOnSphere();
             // Calculate Lorentz boost matrix corresponding to beta_xyz.
@@ -653,21 +653,21 @@ namespace Gambit
 
     // Constant numbers for precision etc.
     const double abs_prec = 1.0E-1, rel_prec = 1.0E-6;
-    const int method = 5;
     // Auxillary structure for passing the model parameters to the gsl solver.
-    struct SolarModel_params1 {double erg; double rad; SolarModel* sol;};
-    struct SolarModel_params2 {double erg; double rs; SolarModel* sol;};
-    struct SolarModel_params3 {double rs; double ma0; SolarModel* sol; AxionInterpolator* eff_exp;};
     struct SolarModel_params4 {double ma0; AxionInterpolator* eff_exp; AxionInterpolator* gaee_flux;};
 
-    double rho_integrand (double rho, void * params)
+    // Coherence factor of the axion-photon conversion in the CAST magnet for an axion of mass m_ax (in eV) and energy erg (in keV).
+    double CAST_coherence(double erg, double m_ax)
     {
-      // Retrieve parameters and other integration variables.
-      struct SolarModel_params1 * p1 = (struct SolarModel_params1 *)params;
-      double erg = (p1->erg);
-      double r = (p1->rad);
-      SolarModel* sol = (p1->sol);
+      const double eVm = gev2cm*1E7;
+      const double L = 9.26/eVm;
+      double argument = 0.25*1.0E-3*L*m_ax*m_ax/erg;
+      return gsl_pow_2(gsl_sf_sinc(argument/pi));
+    }
 
+    // Primakoff emission at energy erg from the zone at radius rho, without the line-of-sight factor rho/sqrt(rho^2 - r^2).
+    double primakoff_emissivity(double erg, double rho, SolarModel* sol)
+    {
       // Get kappa_s^2, omega_plasma^2 and the temperature.
       double ks_sq = sol->kappa_squared(rho);
       double w_pl_sq = sol->omega_pl_squared(rho);
@@ -675,79 +675,29 @@ namespace Gambit
 
       // Calculate the flux.
       double x = 4.0*(erg*erg)/ks_sq;
-      double cylinder = rho*rho - r*r;
-      cylinder = rho/sqrt(cylinder);
       double energy_factor = erg*sqrt(erg*erg - w_pl_sq)/gsl_expm1(erg/T_in_keV);
       double rate = (ks_sq*T_in_keV)*((1.0 + 1.0/x)*gsl_log1p(x) - 1.0);
 
-      return cylinder*energy_factor*rate;
+      return energy_factor*rate;
     }
 
-    double rad_integrand(double rad, void * params)
+    // Primakoff flux at energy erg from the solar disc up to the radius rs; does not depend on the axion mass.
+    double primakoff_disc_flux(double erg, double rs, SolarModel* sol)
     {
-      // Retrieve and pass on parameters.
-      struct SolarModel_params2 * p2 = (struct SolarModel_params2 *)params;
-      SolarModel* sol = (p2->sol);
-      double rmax = std::min(1.0, sol->r_hi);
-      SolarModel_params1 p1 = {p2->erg, rad, sol};
+      // Max. and min. integration radius, and the radius up to which the emission is integrated along the line of sight
+      double rmin = sol->r_lo, rmax = std::min(rs, sol->r_hi), rsun = std::min(1.0, sol->r_hi);
 
-      gsl_integration_workspace * w = gsl_integration_workspace_alloc(1E6);
-      double result, error;
-
-      gsl_function F;
-      F.function = &rho_integrand;
-      F.params = &p1;
-
-      //gsl_set_error_handler_off();
-      gsl_integration_qag (&F, rad, rmax, 1e-2*abs_prec, 1e-2*rel_prec, 1E6, method, w, &result, &error);
-      //printf ("GSL status: %s\n", gsl_strerror (status));
-      //gsl_integration_qags(&F, rad, rmax, 1e-1*abs_prec, 1e-1*rel_prec, 1E6, w, &result, &error);
-      gsl_integration_workspace_free (w);
-
-      result = rad*result;
-      return result;
-    }
-
-    double erg_integrand(double erg, void * params)
-    {
-      const double eVm = gev2cm*1E7;
-      const double L = 9.26/eVm;
-      struct SolarModel_params3 * p3 = (struct SolarModel_params3 *)params;
-      SolarModel* sol = p3->sol;
-      double m_ax = p3->ma0;
-      double rs = p3->rs;
-
-      double argument = 0.25*1.0E-3*L*m_ax*m_ax/erg;
-      double temp = gsl_pow_2(gsl_sf_sinc(argument/pi));
-      double exposure = p3->eff_exp->interpolate(erg);
-      //std::cout << "Energy: " << erg << ", expoure = " << exposure << "." << std::endl;
-      SolarModel_params2 p2 = {erg, rs, sol};
-
-      gsl_integration_workspace * w = gsl_integration_workspace_alloc(1E6);
-      double result, error;
-
-      gsl_function F;
-      F.function = &rad_integrand;
-      F.params = &p2;
-
-      // Max. and min. integration radius
-      double rmin = sol->r_lo, rmax = std::min(rs, sol->r_hi);
-
-      gsl_integration_qag (&F, rmin, rmax, 1e-1*abs_prec, 1e-1*rel_prec, 1E6, method, w, &result, &error);
-      gsl_integration_workspace_free (w);
-
-      return temp*exposure*result;
+      auto emissivity = [erg, sol](double rho) { return primakoff_emissivity(erg, rho, sol); };
+      return DarkBit_utils::projected_disc_integral(emissivity, rmin, rmax, rsun, 1e-1*abs_prec, 1e-1*rel_prec,
+                                                    1e-2*abs_prec, 1e-2*rel_prec, 1E6);
     }
 
     double alt_erg_integrand(double erg, void * params)
     {
-      const double eVm = gev2cm*1E7;
-      const double L = 9.26/eVm;
       struct SolarModel_params4 * p4 = (struct SolarModel_params4 *)params;
       double m_ax = p4->ma0;
 
-      double argument = 0.25*1.0E-3*L*m_ax*m_ax/erg;
-      double temp = gsl_pow_2(gsl_sf_sinc(argument/pi));
+      double temp = CAST_coherence(erg, m_ax);
       double exposure = p4->eff_exp->interpolate(erg);
       double gaee_flux = p4->gaee_flux->interpolate(erg);
 
@@ -855,8 +805,16 @@ namespace Gambit
                                  5.76064, 6.14217, 6.19863, 6.58874, 6.63942, 6.66482, 7.68441, 7.74104, 7.76785};
 
         // Prepare integration routine by defining the gsl functions etc.
-        gsl_function F;
-        F.function = &erg_integrand;
+        // The axion-photon integrals for all masses are done together, as the solar flux at each energy does not depend on the mass.
+        // abs_prec is met after one or two panels, so the rule largely sets the result: GK51, as in the qag integration of the tabulated counts.
+        Utils::batch_integrand F = [&](const double* erg, size_t n, double* f)
+        {
+          for (size_t j = 0; j < n; j++)
+          {
+            double flux = eff_exposure.interpolate(erg[j])*primakoff_disc_flux(erg[j], rs, &model_gagg);
+            for (int i = 0; i < n_mass_bins; i++) { f[i*n+j] = CAST_coherence(erg[j], pow(10,log_masses[i]))*flux; }
+          }
+        };
         gsl_function G;
         G.function = &alt_erg_integrand;
 
@@ -873,7 +831,6 @@ namespace Gambit
         {
           erg_lo = erg_hi;
           erg_hi += bin_delta;
-          gsl_integration_workspace * v = gsl_integration_workspace_alloc (1E6);
           gsl_integration_workspace * w = gsl_integration_workspace_alloc (1E6);
           // Only take into account the peaks relevant for the current energy bin.
           std::vector<double> relevant_peaks;
@@ -885,23 +842,24 @@ namespace Gambit
           }
           relevant_peaks.push_back(erg_hi);
 
-          for (int i = 0; i < n_mass_bins; i++)
+          // Only perform integration if axion-photon counts file does not exist.
+          if (user_gagg_file_missing)
           {
-            double gagg_result, gagg_error, gaee_result, gaee_error;
-            double m_ax = pow(10,log_masses[i]);
-            // Only perform integration if axion-photon counts file does not exist.
-            if (user_gagg_file_missing)
+            std::vector<double> gagg_results = Utils::integrate_gk51_family(F, n_mass_bins, erg_lo, erg_hi, abs_prec, rel_prec, 1E6);
+            for (int i = 0; i < n_mass_bins; i++)
             {
-              SolarModel_params3 p3 = {rs, m_ax, &model_gagg, &eff_exposure};
-              F.params = &p3;
-              gsl_integration_qag (&F, erg_lo, erg_hi, abs_prec, rel_prec, 1E6, method, v, &gagg_result, &gagg_error);
-
               #ifdef AXION_OMP_DEBUG_MODE
-                printf("gagg | % 6.4f [%3.2f, %3.2f] % 4.3e\n", log10(m_ax), erg_lo, erg_hi, log10(temp*gagg_result));
+                printf("gagg | % 6.4f [%3.2f, %3.2f] % 4.3e\n", log_masses[i], erg_lo, erg_hi, log10(temp*gagg_results[i]));
               #endif
 
-              gagg_counts[bin*n_mass_bins+i] = log10(temp*gagg_result);
+              gagg_counts[bin*n_mass_bins+i] = log10(temp*gagg_results[i]);
             }
+          }
+
+          for (int i = 0; i < n_mass_bins; i++)
+          {
+            double gaee_result, gaee_error;
+            double m_ax = pow(10,log_masses[i]);
             // Only perform integration if axion-electron counts file does not exist.
             if (user_gaee_file_missing)
             {
@@ -918,7 +876,6 @@ namespace Gambit
               gaee_counts[bin*n_mass_bins+i] = log10(prefactor_gaee*gaee_result);
             }
           }
-          gsl_integration_workspace_free (v);
           gsl_integration_workspace_free (w);
         }
 
@@ -16,8 +16,18 @@
 ///          (l.a.dal@fys.uio.no)
 ///  \date 2014 Mar, Jul, Sep, Oct
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+
 #include "gambit/Elements/gambit_module_headers.hpp"
 #include "gambit/DarkBit/DarkBit_rollcall.hpp"
 
@@ -37,6 +47,16 @@ namespace Gambit
     /// Special events for event loop
     enum cascadeMC_SpecialEvents {MC_INIT=-1, MC_NEXT_STATE=-2, MC_FINALIZE=-3};
 
+    /// Seed for the random number stream of a single chain (splitmix64 mixing)
+    std::uint64_t cascadeMC_chainSeed(std::uint64_t seed, const std::string &initialState, long long chain)
+    {
+      std::uint64_t z = seed ^ std::hash<std::string>()(initialState);
+      z += 0x9e3779b97f4a7c15ULL * std::uint64_t(chain);
+      z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+      return z ^ (z >> 31);
+    }
+
     /*! \brief Identification of hard-process final states for which yield tables do not exist.
      *
      * Structure
@@ -177,6 +197,17 @@ namespace Gambit
       #endif
     }
 
+    /// Number of chains between convergence checks.  The loop manager only starts a block
+    /// of chains once cascadeMC_Histograms has checked the previous block.
+    void cascadeMC_EndCheckFrequency(int& result)
+    {
+      using namespace Pipes::cascadeMC_EndCheckFrequency;
+      /// Option cMC_endCheckFrequency<int>: number of events to wait between successive
+      /// checks of the convergence criteria (default 25)
+      result = runOptions->getValueOrDef<int>(25, "cMC_endCheckFrequency");
+      if (result < 1) DarkBit_error().raise(LOCAL_INFO, "cMC_endCheckFrequency must be positive.");
+    }
+
     /// Loop manager for cascade decays
     void cascadeMC_LoopManager(std::string& result)
     {
@@ -200,33 +231,55 @@ namespace Gambit
       for (const auto& particle : chainList)
       {
         result = particle;
-        int it;
-        int counter = 0;
-        bool finished = false;
+        // Last chain number handed out
+        std::atomic<int> counter(0);
+        // Number of chains fully processed, and the first exception thrown by a chain (both guarded by block_mutex)
+        int completed = 0;
+        std::exception_ptr error = nullptr;
+        std::mutex block_mutex;
+        std::condition_variable block_checked;
+        const int blockSize = *Dep::cascadeMC_EndCheckFrequency;
         // Set next initial state
         Loop::executeIteration(MC_NEXT_STATE);
         // Event generation loop
-        #pragma omp parallel private(it) shared(counter, finished)
+        #pragma omp parallel shared(counter, completed, error)
         {
-          while (!finished)
+          while (true)
           {
-            #pragma omp critical (cascadeMC_Counter)
+            const int it = ++counter;
+            if (it > cMC_maxEvents) break;
+            // Wait until the previous block has been checked for convergence, so that the
+            // number of chains generated does not depend on the number of threads
+            const int blockStart = ((it-1)/blockSize)*blockSize;
+            {
+              std::unique_lock<std::mutex> lock(block_mutex);
+              block_checked.wait(lock, [&]() { return completed >= blockStart or *Loop::done or error != nullptr; });
+              if (error != nullptr) break;
+            }
+            if (*Loop::done and ((blockStart >= cMC_minEvents) or piped_errors.inquire())) break;
+            // Count the chain as processed even if it throws, so that no other thread waits for it forever
+            std::exception_ptr chain_error = nullptr;
+            try
+            {
+              Loop::executeIteration(it);
+            }
+            catch (...)
             {
-              counter++;
-              it = counter;
+              chain_error = std::current_exception();
             }
-            Loop::executeIteration(it);
-            #pragma omp critical (cascadeMC_Counter)
             {
-              if((*Loop::done and ((counter >= cMC_minEvents) or piped_errors.inquire()))
-                or (counter >= cMC_maxEvents))
-                  finished=true;
-              if (counter >= cMC_maxEvents)
-                DarkBit_warning().raise(LOCAL_INFO,
-                    "WARNING FCMC: cMC_maxEvents reached without convergence.");
+              std::lock_guard<std::mutex> lock(block_mutex);
+              ++completed;
+              if (error == nullptr) error = chain_error;
             }
+            block_checked.notify_all();
           }
+          DecayChain::unseedChainRNG();
         }
+        if (error != nullptr) std::rethrow_exception(error);
+        if (counter > cMC_maxEvents and not *Loop::done)
+          DarkBit_warning().raise(LOCAL_INFO,
+              "WARNING FCMC: cMC_maxEvents reached without convergence.");
         // Raise any exceptions
         piped_invalid_point.check();
         piped_warnings.check(DarkBit_warning());
@@ -267,18 +320,28 @@ namespace Gambit
       using namespace Pipes::cascadeMC_GenerateChain;
       static int    cMC_maxChainLength;
       static double cMC_Emin;
+      static std::uint64_t cMC_seed;
       switch(*Loop::iteration)
       {
         case MC_INIT:
+        {
           /// Option cMC_maxChainLength<int>: Maximum chain length, -1 is infinite (default -1)
           cMC_maxChainLength = runOptions->getValueOrDef<int>    (-1, "cMC_maxChainLength");
           /// Option cMC_Emin<double>: Cutoff energy for cascade particles (default 0)
           cMC_Emin = runOptions->getValueOrDef<double> (-1, "cMC_Emin");
+          /// Option cMC_seed<int>: Seed for the random numbers of the cascade MC, -1 takes one
+          /// from the GAMBIT random number generator (default -1)
+          int seed = runOptions->getValueOrDef<int>    (-1, "cMC_seed");
+          cMC_seed = (seed == -1) ? Random::rng()() : std::uint64_t(seed);
           return;
+        }
         case MC_NEXT_STATE:
         case MC_FINALIZE:
           return;
       }
+      // Every chain (including the sampling of its tabulated spectra in cascadeMC_Histograms)
+      // draws from its own random number stream, whichever thread generates it
+      seedChainRNG(cascadeMC_chainSeed(cMC_seed, *Dep::cascadeMC_LoopManagement, *Loop::iteration));
       shared_ptr<ChainParticle> chn;
       try
       {
@@ -300,8 +363,7 @@ namespace Gambit
         const DarkBit::DecayChain::ChainParticle* endpoint,
         std::string finalState,
         const TH_ProcessCatalog &catalog,
-        std::map<std::string, std::map<std::string, SimpleHist> > &histList,
-        std::string initialState,
+        SimpleHist &hist,
         double weight, int cMC_numSpecSamples
         )
     {
@@ -352,7 +414,7 @@ namespace Gambit
       const double msq = m*m;
       // Get histogram edges
       double histEmin, histEmax;
-      histList[initialState][finalState].getEdges(histEmin, histEmax);
+      hist.getEdges(histEmin, histEmax);
 
       // Calculate energies to sample between.  A particle decaying
       // isotropically in its rest frame will give a box spectrum.  This is
@@ -379,7 +441,6 @@ namespace Gambit
         std::cout << "p_lab = " << endpoint->p_Lab() << std::endl;
         std::cout << "Lorentz factors gamma, beta: " << gamma << ", "
           << beta << std::endl;
-        std::cout << "Initial state: " << initialState << std::endl;
         std::cout << "Channel: " << p1 << " " << p2 << std::endl;
         std::cout << "Final particles: " << finalState << std::endl;
         std::cout << "Event weight: "    << weight << std::endl;
@@ -393,12 +454,12 @@ namespace Gambit
 
       //double specSum=0; (Unused)
       int Nsampl=0;
-      SimpleHist spectrum(histList[initialState][finalState].binLower);
+      SimpleHist spectrum(hist.binLower);
       while(Nsampl<cMC_numSpecSamples)
       {
         // Draw an energy in the CoM frame of the endpoint. Logarithmic
         // sampling.
-        double E_CoM= exp(logmin+(logmax-logmin)*Random::draw());
+        double E_CoM= exp(logmin+(logmax-logmin)*DecayChain::rand_0_1());
         double dN_dE = chn.dNdE_bound->eval(E_CoM, M);
 
         double weight2 = E_CoM*dlogE*dN_dE;
@@ -418,8 +479,7 @@ namespace Gambit
         spectrum.multiply(1.0/Nsampl);
         // Add bin contents of spectrum histogram to main histogram as weighted
         // events
-        #pragma omp critical (cascadeMC_histList)
-          histList[initialState][finalState].addHistAsWeights_sameBin(spectrum);
+        hist.addHistAsWeights_sameBin(spectrum);
       }
     }
 
@@ -440,6 +500,27 @@ namespace Gambit
       static double cMC_binHigh;
       // Histogram list shared between all threads
       static std::map<std::string, std::map<std::string, SimpleHist> > histList;
+      // Initial state currently being simulated
+      static std::string initialState;
+      // Contributions of the chains of the current block, indexed by position in the block.
+      // Each chain fills only its own entry; the last chain to finish adds them all to
+      // histList in order and checks for convergence.
+      static std::vector<std::map<std::string, SimpleHist> > blockHists;
+      static std::atomic<int> blockFilled(0);
+
+      // Add the contributions of the current block to histList, in chain order
+      auto flushBlock = [&]()
+      {
+        for (auto& chainHists : blockHists)
+        {
+          for (auto& hist : chainHists)
+          {
+            histList[initialState][hist.first].addHist_sameBin(hist.second);
+            hist.second.clear();
+          }
+        }
+        blockFilled = 0;
+      };
 
       switch(*Loop::iteration)
       {
@@ -448,10 +529,24 @@ namespace Gambit
           /// Option cMC_numSpecSamples<int>: number of samples to draw from tabulated
           /// spectra (default 25)
           cMC_numSpecSamples = runOptions->getValueOrDef<int>   (25, "cMC_numSpecSamples");
-          /// Option cMC_endCheckFrequency: number of events to wait between successive
-          /// checks of the convergence criteria (default 25)
-          cMC_endCheckFrequency  =
-            runOptions->getValueOrDef<int>   (25,     "cMC_endCheckFrequency");
+          cMC_endCheckFrequency = *Dep::cascadeMC_EndCheckFrequency;
+          // cMC_endCheckFrequency used to be an option of this function.  The loop manager
+          // now takes the block size from the cascadeMC_EndCheckFrequency capability too, so
+          // an old setting here cannot be honoured; it must not be dropped silently either.
+          if (runOptions->hasKey("cMC_endCheckFrequency"))
+          {
+            const int old_setting = runOptions->getValue<int>("cMC_endCheckFrequency");
+            const std::string msg = "The option cMC_endCheckFrequency of cascadeMC_Histograms is deprecated; "
+                                    "set it as an option of the function cascadeMC_EndCheckFrequency instead.";
+            if (old_setting != cMC_endCheckFrequency)
+            {
+              DarkBit_error().raise(LOCAL_INFO, msg + "\nThe value given here (" + std::to_string(old_setting) + ") differs from "
+                                                "the one in use (" + std::to_string(cMC_endCheckFrequency) + ").");
+            }
+            static bool warned = false;
+            if (not warned) DarkBit_warning().raise(LOCAL_INFO, msg);
+            warned = true;
+          }
           /// Option cMC_gammaBGPower: power-law slope to assume for astrophysical
           /// background (default -2.5)
           cMC_gammaBGPower       =
@@ -469,8 +564,14 @@ namespace Gambit
           /// Option cMC_binHigh<double>: Histogram max energy in GeV (default 10000)
           cMC_binHigh = runOptions->getValueOrDef<double>(10000.0,"cMC_binHigh");
           histList.clear();
+          initialState.clear();
+          blockHists.assign(cMC_endCheckFrequency, std::map<std::string, SimpleHist>());
+          blockFilled = 0;
           return;
         case MC_NEXT_STATE:
+          // Collect the last, partial block of the previous initial state
+          if (not initialState.empty()) flushBlock();
+          initialState = *Dep::cascadeMC_LoopManagement;
           // Initialize histograms
           for (const auto& state : *Dep::cascadeMC_FinalStates)
           {
@@ -479,15 +580,20 @@ namespace Gambit
               std::cout << "for: " << *Dep::cascadeMC_LoopManagement << " " << state << std::endl;
             #endif
             double FinalStateMass = Dep::TH_ProcessCatalog->getParticleProperty(state).mass;
-            histList[*Dep::cascadeMC_LoopManagement][state] = SimpleHist(cMC_NhistBins,cMC_binLow+FinalStateMass,cMC_binHigh+FinalStateMass,true);
+            histList[initialState][state] = SimpleHist(cMC_NhistBins,cMC_binLow+FinalStateMass,cMC_binHigh+FinalStateMass,true);
+            for (auto& chainHists : blockHists) chainHists[state] = histList[initialState][state];
           }
           return;
         case MC_FINALIZE:
+          if (not initialState.empty()) flushBlock();
           // For performance, only return the actual result once finished
           result = histList;
           return;
       }
 
+      // Histograms for this chain's contributions
+      std::map<std::string, SimpleHist>& chainHists = blockHists[(*Loop::iteration - 1) % cMC_endCheckFrequency];
+
       // Get list of endpoint states for this chain
       vector<const ChainParticle*> endpoints;
       Dep::cascadeMC_ChainEvent->chain->collectEndpointStates(endpoints, false);
@@ -519,8 +625,7 @@ namespace Gambit
             if(endpoint->getpID() == state)
             {
               double E = endpoint->E_Lab();
-              #pragma omp critical (cascadeMC_histList)
-                histList[*Dep::cascadeMC_LoopManagement][state].addEvent(E,weight);
+              chainHists.at(state).addEvent(E,weight);
               ignored = false;
             }
             // Check if tabulated spectra exist for this final state
@@ -528,7 +633,7 @@ namespace Gambit
             {
               cascadeMC_sampleSimYield(
                   *Dep::FullSimYieldTable, endpoint, state, *Dep::TH_ProcessCatalog,
-                  histList, *Dep::cascadeMC_LoopManagement, weight,
+                  chainHists.at(state), weight,
                   cMC_numSpecSamples
                   );
               // Check if an error was raised
@@ -559,8 +664,7 @@ namespace Gambit
               {
                 hasTabulated = true;
                 cascadeMC_sampleSimYield(*Dep::FullSimYieldTable, endpoint, state,
-                    *Dep::TH_ProcessCatalog, histList,
-                    *Dep::cascadeMC_LoopManagement, weight,
+                    *Dep::TH_ProcessCatalog, chainHists.at(state), weight,
                     cMC_numSpecSamples
                     );
                 // Check if an error was raised
@@ -582,16 +686,14 @@ namespace Gambit
                 if(child->getpID() == state)
                 {
                   double E = child->E_Lab();
-                  #pragma omp critical (cascadeMC_histList)
-                    histList[*Dep::cascadeMC_LoopManagement][state].addEvent(E,weight);
+                  chainHists.at(state).addEvent(E,weight);
                   ignored = false;
                 }
                 // Check if tabulated spectra exist for this final state
                 else if((*Dep::FullSimYieldTable).hasChannel( child->getpID(), state))
                 {
                   cascadeMC_sampleSimYield(*Dep::FullSimYieldTable, child, state,
-                      *Dep::TH_ProcessCatalog, histList,
-                      *Dep::cascadeMC_LoopManagement, weight,
+                      *Dep::TH_ProcessCatalog, chainHists.at(state), weight,
                       cMC_numSpecSamples
                       );
                   // Check if an error was raised
@@ -613,9 +715,12 @@ namespace Gambit
         }
       }
 
-      // Check if finished every cMC_endCheckFrequency events
-      if((*Loop::iteration % cMC_endCheckFrequency) == 0)
+      // Check if finished every cMC_endCheckFrequency events, once all chains of the block are in.
+      // The loop manager starts no chain of the next block before then, so nothing else touches
+      // histList or blockHists here.
+      if(++blockFilled == cMC_endCheckFrequency)
       {
+        flushBlock();
         enum status{untouched,unfinished,finished};
         status cond = untouched;
         for (const auto& state : *Dep::cascadeMC_FinalStates)
@@ -624,9 +729,7 @@ namespace Gambit
           /// @TODO: consider implementing specific convergence criteria for other final states
           if (state == "gamma")
           {
-            SimpleHist hist;
-            #pragma omp critical (cascadeMC_histList)
-              hist = histList[*Dep::cascadeMC_LoopManagement][state];
+            const SimpleHist& hist = histList[initialState][state];
             #ifdef DARKBIT_DEBUG
               std::cout << "Checking whether convergence is reached" << std::endl;
               for ( int i = 0; i < hist.nBins; i++ )
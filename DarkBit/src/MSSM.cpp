@@ -127,9 +127,13 @@ namespace Gambit
       // Get SM masses
       auto getSMmass = [&](str Name, int spinX2)
       {
+        // Pole mass getters are resolved once per name and thread, then reused for every point
+        static thread_local std::map<str, SpecHandle> handles;
+        auto h = handles.find(Name);
+        if (h == handles.end()) h = handles.emplace(Name, SM.resolve(Par::Pole_Mass,Name)).first;
         catalog.particleProperties.insert(
         std::pair<std::string, TH_ParticleProperty>(
-         Name , TH_ParticleProperty(SM.get(Par::Pole_Mass,Name), spinX2)));
+         Name , TH_ParticleProperty(SM.get(h->second), spinX2)));
       };
 
       getSMmass("e-_1",     1);
@@ -192,9 +196,13 @@ namespace Gambit
       // Get MSSM masses
       auto getMSSMmass = [&](str Name, int spinX2)
       {
+        // Pole mass getters are resolved once per name and thread, then reused for every point
+        static thread_local std::map<str, SpecHandle> handles;
+        auto h = handles.find(Name);
+        if (h == handles.end()) h = handles.emplace(Name, spec.resolve(Par::Pole_Mass,Name)).first;
         catalog.particleProperties.insert(
         std::pair<std::string, TH_ParticleProperty> (
-         Name , TH_ParticleProperty(std::abs(spec.get(Par::Pole_Mass,Name)), spinX2)));
+         Name , TH_ParticleProperty(std::abs(spec.get(h->second)), spinX2)));
       };
 
       getMSSMmass("H+"      , 0);
@@ -451,9 +459,13 @@ namespace Gambit
       // Get SM masses
       auto getSMmass = [&](str Name, int spinX2)
       {
+        // Pole mass getters are resolved once per name and thread, then reused for every point
+        static thread_local std::map<str, SpecHandle> handles;
+        auto h = handles.find(Name);
+        if (h == handles.end()) h = handles.emplace(Name, SM.resolve(Par::Pole_Mass,Name)).first;
         catalog.particleProperties.insert(
         std::pair<std::string, TH_ParticleProperty>(
-         Name , TH_ParticleProperty(SM.get(Par::Pole_Mass,Name), spinX2)));
+         Name , TH_ParticleProperty(SM.get(h->second), spinX2)));
       };
 
       getSMmass("e-_1",     1);
@@ -508,9 +520,13 @@ namespace Gambit
       // Get MSSM masses
       auto getMSSMmass = [&](str Name, int spinX2)
       {
+        // Pole mass getters are resolved once per name and thread, then reused for every point
+        static thread_local std::map<str, SpecHandle> handles;
+        auto h = handles.find(Name);
+        if (h == handles.end()) h = handles.emplace(Name, spec.resolve(Par::Pole_Mass,Name)).first;
         catalog.particleProperties.insert(
         std::pair<std::string, TH_ParticleProperty>(
-         Name , TH_ParticleProperty(std::abs(spec.get(Par::Pole_Mass,Name)), spinX2)));
+         Name , TH_ParticleProperty(std::abs(spec.get(h->second)), spinX2)));
       };
 
       getMSSMmass("H+"      , 0);
@@ -750,16 +766,25 @@ namespace Gambit
     {
       using namespace Pipes::DarkMatter_ID_MSSM;
 
-      Spectrum spec = *Dep::MSSM_spectrum;
+      const Spectrum& spec = *Dep::MSSM_spectrum;
+
+      // Pole mass getters of the candidates, resolved once
+      static const SpecHandle m_d1 = spec.resolve(Par::Pole_Mass, "~d_1");
+      static const SpecHandle m_u1 = spec.resolve(Par::Pole_Mass, "~u_1");
+      static const SpecHandle m_e1 = spec.resolve(Par::Pole_Mass, "~e-_1");
+      static const SpecHandle m_nu1 = spec.resolve(Par::Pole_Mass, "~nu_1");
+      static const SpecHandle m_g = spec.resolve(Par::Pole_Mass, "~g");
+      static const SpecHandle m_chi01 = spec.resolve(Par::Pole_Mass, "~chi0_1");
+      static const SpecHandle m_chipm1 = spec.resolve(Par::Pole_Mass, "~chi+_1");
 
       // Usual candidates are the lightest neutralino, chargino, up-type squark, down-type-squark, slepton, sneutrino or gluino
-      sdpair msqd  = {"~d_1", spec.get(Par::Pole_Mass, "~d_1")};
-      sdpair msqu  = {"~u_1", spec.get(Par::Pole_Mass, "~u_1")};
-      sdpair msl   = {"~e-_1", spec.get(Par::Pole_Mass, "~e-_1")};
-      sdpair msneu = {"~nu_1", spec.get(Par::Pole_Mass, "~nu_1")};
-      sdpair mglui = {"~g", spec.get(Par::Pole_Mass, "~g")};
-      sdpair mchi0 = {"~chi0_1", std::abs(spec.get(Par::Pole_Mass, "~chi0_1"))};
-      sdpair mchip = {"~chi+_1", std::abs(spec.get(Par::Pole_Mass, "~chi+_1"))};
+      sdpair msqd  = {"~d_1", spec.get(m_d1)};
+      sdpair msqu  = {"~u_1", spec.get(m_u1)};
+      sdpair msl   = {"~e-_1", spec.get(m_e1)};
+      sdpair msneu = {"~nu_1", spec.get(m_nu1)};
+      sdpair mglui = {"~g", spec.get(m_g)};
+      sdpair mchi0 = {"~chi0_1", std::abs(spec.get(m_chi01))};
+      sdpair mchip = {"~chi+_1", std::abs(spec.get(m_chipm1))};
 
       auto min = [&](sdpair a, sdpair b) { return a.second < b.second ? a : b; };
 
@@ -777,16 +802,25 @@ namespace Gambit
     {
       using namespace Pipes::DarkMatterConj_ID_MSSM;
 
-      Spectrum spec = *Dep::MSSM_spectrum;
+      const Spectrum& spec = *Dep::MSSM_spectrum;
+
+      // Pole mass getters of the candidates, resolved once
+      static const SpecHandle m_d1 = spec.resolve(Par::Pole_Mass, "~d_1");
+      static const SpecHandle m_u1 = spec.resolve(Par::Pole_Mass, "~u_1");
+      static const SpecHandle m_e1 = spec.resolve(Par::Pole_Mass, "~e-_1");
+      static const SpecHandle m_nu1 = spec.resolve(Par::Pole_Mass, "~nu_1");
+      static const SpecHandle m_g = spec.resolve(Par::Pole_Mass, "~g");
+      static const SpecHandle m_chi01 = spec.resolve(Par::Pole_Mass, "~chi0_1");
+      static const SpecHandle m_chipm1 = spec.resolve(Par::Pole_Mass, "~chi-_1");
 
       // Usual candidates are the lightest neutralino, chargino, up-type squark, down-type-squark, slepton, sneutrino or gluino
-      sdpair msqd  = {"~d_1", spec.get(Par::Pole_Mass, "~d_1")};
-      sdpair msqu  = {"~u_1", spec.get(Par::Pole_Mass, "~u_1")};
-      sdpair msl   = {"~e+_1", spec.get(Par::Pole_Mass, "~e-_1")};
-      sdpair msneu = {"~nu_1", spec.get(Par::Pole_Mass, "~nu_1")};
-      sdpair mglui = {"~g", spec.get(Par::Pole_Mass, "~g")};
-      sdpair mchi0 = {"~chi0_1", std::abs(spec.get(Par::Pole_Mass, "~chi0_1"))};
-      sdpair mchip = {"~chi-_1", std::abs(spec.get(Par::Pole_Mass, "~chi-_1"))};
+      sdpair msqd  = {"~d_1", spec.get(m_d1)};
+      sdpair msqu  = {"~u_1", spec.get(m_u1)};
+      sdpair msl   = {"~e+_1", spec.get(m_e1)};
+      sdpair msneu = {"~nu_1", spec.get(m_nu1)};
+      sdpair mglui = {"~g", spec.get(m_g)};
+      sdpair mchi0 = {"~chi0_1", std::abs(spec.get(m_chi01))};
+      sdpair mchip = {"~chi-_1", std::abs(spec.get(m_chipm1))};
 
       auto min = [&](sdpair a, sdpair b) { return a.second < b.second ? a : b; };
 
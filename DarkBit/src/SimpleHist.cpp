@@ -13,8 +13,13 @@
 ///          (l.a.dal@fys.uio.no)
 ///  \date 2015 Feb
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
+#include <algorithm>
+
 #include "gambit/Elements/gambit_module_headers.hpp"
 #include "gambit/DarkBit/DarkBit_rollcall.hpp"
 #include "gambit/DarkBit/SimpleHist.hpp"
@@ -160,6 +165,27 @@ namespace Gambit {
       }
     }
 
+    void SimpleHist::addHist_sameBin(const SimpleHist &in)
+    {
+      if(in.nBins != nBins)
+      {
+        DarkBit_error().raise(LOCAL_INFO,
+            "SimpleHist::addHist_sameBin requires identically binned\n"
+            "histograms.");
+      }
+      for(int i=0; i<nBins;i++)
+      {
+        binVals[i]+=in.binVals[i];
+        wtSq[i]   +=in.wtSq[i];
+      }
+    }
+
+    void SimpleHist::clear()
+    {
+      std::fill(binVals.begin(), binVals.end(), 0.0);
+      std::fill(wtSq.begin(), wtSq.end(), 0.0);
+    }
+
     double SimpleHist::getError(int bin) const
     {
       return sqrt(wtSq[bin]);
@@ -21,6 +21,9 @@
 ///          (cvc1@queensu.ca)
 ///  \date 2023 Aug
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 // TODO: Temporarily disabled until project is ready
@@ -42,6 +45,7 @@
 #include "gambit/Utils/interp_collection.hpp"
 #include "gambit/Utils/numerical_constants.hpp"
 #include "gambit/Utils/util_functions.hpp"
+#include "gambit/Utils/integration.hpp"
 #include "gambit/Utils/ascii_table_reader.hpp"
 #include "gambit/Utils/statistics.hpp"
 
@@ -651,7 +655,7 @@ namespace Gambit
     {
       size_t n = 1e4;
 
-      gsl_integration_workspace *w = gsl_integration_workspace_alloc(n);
+      Utils::integration_workspace w(n);
 
       double epsabs = 0.;
       double epsrel = 1e-2;
@@ -666,8 +670,6 @@ namespace Gambit
 
       gsl_integration_qag(&F, E-delta/2., E+delta/2., epsabs, epsrel, limit, key, w, &result, &abserr);
 
-      gsl_integration_workspace_free(w);
-
       return result;
     }
 
@@ -704,7 +706,7 @@ namespace Gambit
     {
       size_t n = 1e4;
 
-      gsl_integration_workspace *w = gsl_integration_workspace_alloc(n);
+      Utils::integration_workspace w(n);
 
       double epsabs = 0.;
       double epsrel = 1e-2;
@@ -719,8 +721,6 @@ namespace Gambit
 
       gsl_integration_qag(&F, E-delta/2., E+delta/2., epsabs, epsrel, limit, key, w, &result, &abserr);
 
-      gsl_integration_workspace_free(w);
-
       return result;
     }
 
@@ -763,7 +763,7 @@ namespace Gambit
     {
       size_t n = 1e4;
 
-      gsl_integration_workspace *w =  gsl_integration_workspace_alloc(n);
+      Utils::integration_workspace w(n);
 
       double epsabs = 0.;
       double epsrel = 1e-3;
@@ -778,8 +778,6 @@ namespace Gambit
 
       gsl_integration_qagiu(&F, redshift, epsabs, epsrel, limit, w, &result, &abserr);
 
-      gsl_integration_workspace_free(w);
-
       return {result/H0, abserr/H0};
     }
 
@@ -873,7 +871,7 @@ namespace Gambit
     {
       size_t n = 1e4;
 
-      gsl_integration_workspace *w =  gsl_integration_workspace_alloc(n);
+      Utils::integration_workspace w(n);
 
       double epsabs = 0.;
       double epsrel = 1e-2;
@@ -889,8 +887,6 @@ namespace Gambit
 
       gsl_integration_qag(&F, E-delta/2., E+delta/2., epsabs, epsrel, limit, key, w, &result, &abserr);
 
-      gsl_integration_workspace_free(w);
-
       return result;
     }
 
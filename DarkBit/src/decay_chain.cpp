@@ -16,8 +16,13 @@
 ///  \date 2014 Oct, Nov, Dec
 ///  \date 2015 Jan
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
+#include <random>
+
 #include "gambit/Elements/gambit_module_headers.hpp"
 #include "gambit/DarkBit/DarkBit_rollcall.hpp"
 
@@ -252,6 +257,38 @@ namespace Gambit
       //  Utility functions
       //  *********************************************
 
+      namespace
+      {
+        struct chain_rng
+        {
+          std::mt19937_64 engine;
+          bool seeded = false;
+        };
+
+        chain_rng& local_chain_rng()
+        {
+          static thread_local chain_rng rng;
+          return rng;
+        }
+      }
+
+      double rand_0_1()
+      {
+        chain_rng& rng = local_chain_rng();
+        if(not rng.seeded) return Random::draw();
+        // 53 random bits, offset to lie strictly inside (0,1) like Random::draw()
+        return (double(rng.engine() >> 11) + 0.5) / 9007199254740992.0;
+      }
+      void seedChainRNG(std::uint64_t seed)
+      {
+        chain_rng& rng = local_chain_rng();
+        rng.engine.seed(seed);
+        rng.seeded = true;
+      }
+      void unseedChainRNG()
+      {
+        local_chain_rng().seeded = false;
+      }
       double rand_m1_1()
       {
         return -1.0 + 2.0 * rand_0_1();
@@ -0,0 +1,92 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Regression test for the nested integral over
+///  the solar disc and along the line of sight
+///  used for the CAST axion-photon counts,
+///  against the same integral with the order of
+///  integration swapped.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+#include "gambit/DarkBit/DarkBit_utils.hpp"
+#include "gambit/Utils/static_members.hpp"
+#include "unit_test.hpp"
+
+using namespace Gambit;
+using DarkBit::DarkBit_utils::projected_disc_integral;
+
+/// Integrate f over [a,b], with breakpoints at the given points inside it
+double integrate_1d(const std::function<double(double)>& f, double a, double b, std::vector<double> breaks = {})
+{
+  Utils::batch_integrand fb = [&f](const double* x, size_t n, double* fx) { for (size_t i = 0; i < n; ++i) fx[i] = f(x[i]); };
+  breaks.insert(breaks.begin(), a);
+  breaks.push_back(b);
+  double result = 0;
+  for (size_t i = 0; i + 1 < breaks.size(); ++i) result += Utils::integrate_gk21(fb, breaks[i], breaks[i+1], 0, 1e-13);
+  return result;
+}
+
+/// The disc integral with the order of integration swapped: for rmin = 0 the integral over r
+/// of r/sqrt(rho^2 - r^2) up to min(rho, rmax) is rho - sqrt(rho^2 - rmax^2) (or rho, for rho < rmax)
+double swapped_disc_integral(const std::function<double(double)>& g, double rmax, double rsun, const std::vector<double>& knots = {})
+{
+  std::vector<double> breaks;
+  for (double k : knots) if (k > 0 and k < rsun) breaks.push_back(k);
+  breaks.push_back(rmax);
+  std::sort(breaks.begin(), breaks.end());
+  auto f = [&g, rmax](double rho) { return rho*g(rho)*(rho - (rho > rmax ? std::sqrt(rho*rho - rmax*rmax) : 0.0)); };
+  return integrate_1d(f, 0, rsun, breaks);
+}
+
+int main()
+{
+  const double releps = 1e-10;
+
+  // Uniform source: int_rmin^rmax dr r sqrt(rsun^2 - r^2)
+  auto one = [](double) { return 1.0; };
+  EXPECT_CLOSE(projected_disc_integral(one, 0, 1, 1, 0, releps, 0, releps)*3, 1, 1e-9);
+  EXPECT_CLOSE(projected_disc_integral(one, 0.2, 0.7, 1, 0, releps, 0, releps)*3/(std::pow(0.96, 1.5) - std::pow(0.51, 1.5)), 1, 1e-9);
+
+  // A smooth, centrally peaked source seen over the full disc and over its inner part only
+  auto peaked = [](double rho) { return std::exp(-10*rho)*(1 + rho*rho); };
+  for (double rmax : {1.0, 0.5, 0.1})
+  {
+    EXPECT_CLOSE(projected_disc_integral(peaked, 0, rmax, 1, 0, releps, 0, releps)/swapped_disc_integral(peaked, rmax, 1), 1, 1e-9);
+  }
+
+  // A tabulated source, linearly interpolated like the solar models, with kinks at every knot
+  std::vector<double> knots, values;
+  for (int i = 0; i <= 50; ++i)
+  {
+    knots.push_back(0.95*i/50);
+    values.push_back(std::exp(-12*knots.back())*(1 + 0.1*std::sin(80*knots.back())));
+  }
+  auto tabulated = [&knots, &values](double rho)
+  {
+    const size_t i = std::min<size_t>(std::upper_bound(knots.begin(), knots.end(), rho) - knots.begin(), knots.size() - 1);
+    if (i == 0) return values[0];
+    const double t = (rho - knots[i-1])/(knots[i] - knots[i-1]);
+    return values[i-1] + t*(values[i] - values[i-1]);
+  };
+  const double rsun = knots.back();
+  for (double rmax : {rsun, 0.3})
+  {
+    EXPECT_CLOSE(projected_disc_integral(tabulated, 0, rmax, rsun, 0, 1e-6, 0, 1e-7, 1000000)/swapped_disc_integral(tabulated, rmax, rsun, knots), 1, 1e-5);
+  }
+
+  return UnitTest::result();
+}
@@ -48,6 +48,9 @@
 ///          (torsten.bringmann@fys.uio.no)
 ///  \date 2023 Nov
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #include "gambit/Elements/gambit_module_headers.hpp"
@@ -544,14 +547,15 @@ namespace Gambit
       using namespace Pipes::Ref_SM_other_Higgs_decays_table;
       const SubSpectrum& spec = Dep::MSSM_spectrum->get_HE();
       int other_higgs = (SMlike_higgs_PDG_code(spec) == 25 ? 35 : 25);
-      double m_other = Dep::MSSM_spectrum->get(Par::Pole_Mass, other_higgs, 0);
+      double m_other = (other_higgs == 25 ? pole_mass<25>(*Dep::MSSM_spectrum) : pole_mass<35>(*Dep::MSSM_spectrum));
       compute_SM_higgs_decays(result, m_other);
     }
     /// Reference SM Higgs decays from LHCHiggsXSWG: A0
     void Ref_SM_A0_decays_table(DecayTable::Entry& result)
     {
       using namespace Pipes::Ref_SM_A0_decays_table;
-      double mA0 = Dep::MSSM_spectrum->get(Par::Pole_Mass, "A0");
+      static const SpecHandle h_A0 = Dep::MSSM_spectrum->resolve(Par::Pole_Mass, "A0");
+      double mA0 = Dep::MSSM_spectrum->get(h_A0);
       compute_SM_higgs_decays(result, mA0);
     }
 
@@ -2481,8 +2485,10 @@ namespace Gambit
       const SubSpectrum& mssm = spec.get_HE();
 
       // Get SUSY masses
-      const double m_N_signed = spec.get(Par::Pole_Mass,"~chi0_1");
-      const double m_C_signed = spec.get(Par::Pole_Mass,"~chi+_1");
+      static const SpecHandle h_N = spec.resolve(Par::Pole_Mass,"~chi0_1");
+      static const SpecHandle h_C = spec.resolve(Par::Pole_Mass,"~chi+_1");
+      const double m_N_signed = spec.get(h_N);
+      const double m_C_signed = spec.get(h_C);
       const double m_N = abs(m_N_signed);
       const double m_C = abs(m_C_signed);
 
@@ -2796,7 +2802,8 @@ namespace Gambit
       const SubSpectrum& mssm = spec.get_HE();
 
       // Get neutralino mass and mixing
-      const double m_N = abs(spec.get(Par::Pole_Mass,"~chi0_1"));
+      static const SpecHandle h_N = spec.resolve(Par::Pole_Mass,"~chi0_1");
+      const double m_N = abs(spec.get(h_N));
 
       const double N11 = mssm.get(Par::Pole_Mixing,"~chi0",1,1);  // ~B component
       const double N12 = mssm.get(Par::Pole_Mixing,"~chi0",1,2);  // ~W3 component
@@ -3052,18 +3059,30 @@ namespace Gambit
       const double m_tau = sm.safeget(Par::mass1, "e-", 3);
 
       // const DecayTable::Entry &Z_decays = Dep::Z_decay_rates;
+      // Z decay channels, interned once
+      static const DecayTable::Channel Z_to_uu("u", "ubar");
+      static const DecayTable::Channel Z_to_dd("d", "dbar");
+      static const DecayTable::Channel Z_to_ss("s", "sbar");
+      static const DecayTable::Channel Z_to_cc("c", "cbar");
+      static const DecayTable::Channel Z_to_bb("b", "bbar");
+      static const DecayTable::Channel Z_to_ee("e+", "e-");
+      static const DecayTable::Channel Z_to_mumu("mu+", "mu-");
+      static const DecayTable::Channel Z_to_tautau("tau+", "tau-");
+      static const DecayTable::Channel Z_to_nue_nue("nu_e", "nubar_e");
+      static const DecayTable::Channel Z_to_numu_numu("nu_mu", "nubar_mu");
+      static const DecayTable::Channel Z_to_nutau_nutau("nu_tau", "nubar_tau");
       const double width_Z = Z_decays.width_in_GeV;
-      const double BF_Z_to_uu = Z_decays.BF("u", "ubar");
-      const double BF_Z_to_dd = Z_decays.BF("d", "dbar");
-      const double BF_Z_to_ss = Z_decays.BF("s", "sbar");
-      const double BF_Z_to_cc = Z_decays.BF("c", "cbar");
-      const double BF_Z_to_bb = Z_decays.BF("b", "bbar");
-      const double BF_Z_to_ee = Z_decays.BF("e+", "e-");
-      const double BF_Z_to_mumu = Z_decays.BF("mu+", "mu-");
-      const double BF_Z_to_tautau = Z_decays.BF("tau+", "tau-");
-      const double BF_Z_to_nue_nue = Z_decays.BF("nu_e", "nubar_e");
-      const double BF_Z_to_numu_numu = Z_decays.BF("nu_mu", "nubar_mu");
-      const double BF_Z_to_nutau_nutau = Z_decays.BF("nu_tau", "nubar_tau");
+      const double BF_Z_to_uu = Z_decays.BF(Z_to_uu);
+      const double BF_Z_to_dd = Z_decays.BF(Z_to_dd);
+      const double BF_Z_to_ss = Z_decays.BF(Z_to_ss);
+      const double BF_Z_to_cc = Z_decays.BF(Z_to_cc);
+      const double BF_Z_to_bb = Z_decays.BF(Z_to_bb);
+      const double BF_Z_to_ee = Z_decays.BF(Z_to_ee);
+      const double BF_Z_to_mumu = Z_decays.BF(Z_to_mumu);
+      const double BF_Z_to_tautau = Z_decays.BF(Z_to_tautau);
+      const double BF_Z_to_nue_nue = Z_decays.BF(Z_to_nue_nue);
+      const double BF_Z_to_numu_numu = Z_decays.BF(Z_to_numu_numu);
+      const double BF_Z_to_nutau_nutau = Z_decays.BF(Z_to_nutau_nutau);
 
       // Convenient quantities
       const double cos_alpha = sqrt(1. - pow2(sin_alpha));
@@ -4478,10 +4497,12 @@ namespace Gambit
       const SMInputs& SM = Dep::MSSM_spectrum->get_SMInputs();
 
       // Neutralino masses with phases
+      static const std::array<SpecHandle, 4> h_0 = {{spec.resolve(Par::Pole_Mass, "~chi0", 1), spec.resolve(Par::Pole_Mass, "~chi0", 2),
+                                                     spec.resolve(Par::Pole_Mass, "~chi0", 3), spec.resolve(Par::Pole_Mass, "~chi0", 4)}};
       std::array<double, 4> m_0;
       for (int i = 0; i <= 3; i += 1)
       {
-        m_0[i] = spec.get(Par::Pole_Mass, "~chi0", i + 1);
+        m_0[i] = spec.get(h_0[i]);
       }
 
       // Neutralino mixing matrix
@@ -4495,10 +4516,11 @@ namespace Gambit
       }
 
       // Chargino masses
+      static const std::array<SpecHandle, 2> h_pm = {{spec.resolve(Par::Pole_Mass, "~chi+", 1), spec.resolve(Par::Pole_Mass, "~chi+", 2)}};
       std::array<double, 2> m_pm;
       for (int i = 0; i <= 1; i += 1)
       {
-        m_pm[i] = spec.get(Par::Pole_Mass, "~chi+", i + 1);
+        m_pm[i] = spec.get(h_pm[i]);
       }
 
       // Chargino mixing matrices
@@ -4513,8 +4535,10 @@ namespace Gambit
       }
 
       // SM parameters
-      const double mh = MSSM.get(Par::Pole_Mass, "h0_1");
-      const double mw = MSSM.get(Par::Pole_Mass, "W+");
+      static const SpecHandle h_h = MSSM.resolve(Par::Pole_Mass, "h0_1");
+      static const SpecHandle h_w = MSSM.resolve(Par::Pole_Mass, "W+");
+      const double mh = MSSM.get(h_h);
+      const double mw = MSSM.get(h_w);
       const double GF = SM.GF;
       const double sw2 = MSSM.safeget(Par::dimensionless, "sinW2");
 
@@ -4682,8 +4706,10 @@ namespace Gambit
       const SMInputs& SM = Dep::SM_spectrum->get_SMInputs();
 
       // Construct SM Z two-loop object
-      const double mh_OS = Dep::SM_spectrum->get(Par::Pole_Mass, "h0_1");
-      const double MZ = Dep::SM_spectrum->get(Par::Pole_Mass, "Z0");
+      static const SpecHandle h_h = Dep::SM_spectrum->resolve(Par::Pole_Mass, "h0_1");
+      static const SpecHandle h_Z = Dep::SM_spectrum->resolve(Par::Pole_Mass, "Z0");
+      const double mh_OS = Dep::SM_spectrum->get(h_h);
+      const double MZ = Dep::SM_spectrum->get(h_Z);
       auto Z = SM_Z::TwoLoop(mh_OS, SM.mT, MZ, SM.alphaS, delta_alpha_OS);
 
       if (Z.nuisances_outside_ranges())
@@ -4745,10 +4771,12 @@ namespace Gambit
       const SMInputs& SM = Dep::MSSM_spectrum->get_SMInputs();
 
       // Neutralino masses without phases
+      static const std::array<SpecHandle, 4> h_0 = {{spec.resolve(Par::Pole_Mass, "~chi0", 1), spec.resolve(Par::Pole_Mass, "~chi0", 2),
+                                                     spec.resolve(Par::Pole_Mass, "~chi0", 3), spec.resolve(Par::Pole_Mass, "~chi0", 4)}};
       std::array<double, 4> m_0;
       for (int i = 0; i <= 3; i += 1)
       {
-        m_0[i] = std::fabs(spec.get(Par::Pole_Mass, "~chi0", i + 1));
+        m_0[i] = std::fabs(spec.get(h_0[i]));
       }
 
       // Neutralino mixing matrix
@@ -4800,17 +4828,18 @@ namespace Gambit
     {
       using namespace Pipes::lnL_W_decays_chi2;
       std::vector<double> Wtoldecays = *Dep::W_to_l_decays;
-      DecayTable::Entry decays = *Dep::W_plus_decay_rates;
+      const DecayTable::Entry& decays = *Dep::W_plus_decay_rates;
+      static const DecayTable::Channel enu("e+","nu_e"), munu("mu+","nu_mu"), taunu("tau+","nu_tau");
 
       std::vector<double> Wwidth;
       std::vector<double> Wwidth_error;
 
-      Wwidth.push_back(decays.width_in_GeV * decays.BF("e+","nu_e"));
-      Wwidth_error.push_back(sqrt(pow(decays.width_in_GeV*decays.BF_error("e+","nu_e"),2) + pow(std::max(decays.positive_error, decays.negative_error)*decays.BF("e+","nu_e"),2)));
-      Wwidth.push_back(decays.width_in_GeV * decays.BF("mu+","nu_mu"));
-      Wwidth_error.push_back(sqrt(pow(decays.width_in_GeV*decays.BF_error("mu+","nu_mu"),2) + pow(std::max(decays.positive_error, decays.negative_error)*decays.BF("mu+","nu_mu"),2)));
-      Wwidth.push_back(decays.width_in_GeV * decays.BF("tau+","nu_tau"));
-      Wwidth_error.push_back(sqrt(pow(decays.width_in_GeV*decays.BF_error("tau+","nu_tau"),2) + pow(std::max(decays.positive_error, decays.negative_error)*decays.BF("tau+","nu_tau"),2)));
+      Wwidth.push_back(decays.width_in_GeV * decays.BF(enu));
+      Wwidth_error.push_back(sqrt(pow(decays.width_in_GeV*decays.BF_error(enu),2) + pow(std::max(decays.positive_error, decays.negative_error)*decays.BF(enu),2)));
+      Wwidth.push_back(decays.width_in_GeV * decays.BF(munu));
+      Wwidth_error.push_back(sqrt(pow(decays.width_in_GeV*decays.BF_error(munu),2) + pow(std::max(decays.positive_error, decays.negative_error)*decays.BF(munu),2)));
+      Wwidth.push_back(decays.width_in_GeV * decays.BF(taunu));
+      Wwidth_error.push_back(sqrt(pow(decays.width_in_GeV*decays.BF_error(taunu),2) + pow(std::max(decays.positive_error, decays.negative_error)*decays.BF(taunu),2)));
 
       result = Stats::gaussian_loglikelihood(Wtoldecays[0], Wwidth[0], 0.0, Wwidth_error[0], false);
       result += Stats::gaussian_loglikelihood(Wtoldecays[1], Wwidth[1], 0.0, Wwidth_error[1], false);
@@ -17,6 +17,7 @@
  *  v0.1 Dec 2014
  *  v0.2 Mar 2015 - Completely rewritten internal structure
  *  v0.3 May 2016 - Extensions
+ *  v0.4 Oct 2026 - Compilation of bound functions to flat instruction tapes
  *
  *  Christoph Weniger, created Dec 2014, edited until May 2016
  *  <c.weniger@uva.nl>
@@ -59,6 +60,9 @@
 #include <map>
 #include <set>
 #include <cmath>
+#include <array>
+#include <cstdint>
+#include <cstring>
 #include <stdexcept>
 
 //#define NDEBUG
@@ -110,6 +114,7 @@ namespace daFunk
 
     class FunkBase;
     class FunkBound;
+    class FunkTape;
     class FunkIntegrate_gsl1d;
 
     typedef shared_ptr<FunkBase> Funk;
@@ -309,6 +314,8 @@ namespace daFunk
 
             // Standard binding handles
             template <typename... Args> shared_ptr<FunkBound> bind(Args... args);
+            // Binding with compilation to an instruction tape (see FunkTape)
+            template <typename... Args> shared_ptr<FunkBound> compile(Args... args);
 
             // Convenience functions
             const std::vector<std::string> & getArgs() { return this->arguments; };
@@ -329,6 +336,13 @@ namespace daFunk
             // parallel with the same Funk objects.
             virtual void resolve(std::map<std::string, size_t> datamap, size_t & datalen, size_t bindID, std::map<std::string,size_t> &argmap);
 
+            // Append the instructions for evaluating this function to a tape,
+            // and return the register that holds the result.  slots maps the
+            // entries of the data array onto tape registers (entries set by
+            // FunkDerived are moved to fresh registers).  By default the
+            // instruction simply calls value().
+            virtual size_t lower(FunkTape & tape, size_t bindID, const std::vector<size_t> & slots);
+
 
             // Singularities handling
             Singularities getSingl() { return singularities; }
@@ -372,6 +386,153 @@ namespace daFunk
             Singularities singularities;
     };
 
+    //
+    // Flat instruction tape, to which bound functions can be compiled.
+    //
+    // The tape operates on a contiguous register file: the first registers
+    // hold the data array of the bound function (arguments and workspace),
+    // followed by constants and intermediate results.  Evaluation then avoids
+    // the virtual calls and temporary data arrays of value().  Functions
+    // without native instructions are called through value().  Branch-free
+    // tapes are evaluated for blocks of points at once, with the registers
+    // laid out per block so that the inner loops vectorise.
+    //
+
+    class FunkTape
+    {
+        public:
+            enum OpCode
+            {
+                OP_copy, OP_umin, OP_cos, OP_sin, OP_tan, OP_acos, OP_asin, OP_atan,
+                OP_cosh, OP_sinh, OP_tanh, OP_acosh, OP_asinh, OP_atanh, OP_exp, OP_log,
+                OP_log10, OP_sqrt, OP_fabs, OP_Sum, OP_Mul, OP_Div, OP_Dif, OP_pow,
+                OP_fmin, OP_fmax, OP_call, OP_value, OP_jump, OP_branch
+            };
+
+            struct Instruction
+            {
+                OpCode op;
+                size_t dst, a, b;
+                // OP_call: fn(obj, a); OP_value: obj->value(data, aux), with
+                // data taken from slot_maps[b]; OP_jump/OP_branch: target aux
+                double (*fn)(void*, double);
+                void * obj;
+                size_t aux;
+            };
+
+            FunkTape(size_t n_slots) : registers(n_slots, 0.), n_slots(n_slots), result(0), branch_free(true) {}
+
+            // Construction
+            size_t add_register(double x = 0.)
+            {
+                registers.push_back(x);
+                return registers.size() - 1;
+            }
+            // Equal constants share a register.  They are compared bit by bit,
+            // so that 0. and -0. stay apart; NaNs never share.
+            size_t constant(double x)
+            {
+                if ( std::isnan(x) ) return add_register(x);
+                uint64_t bits;
+                std::memcpy(&bits, &x, sizeof(bits));
+                auto it = constants.find(bits);
+                if ( it != constants.end() ) return it->second;
+                return constants[bits] = add_register(x);
+            }
+            size_t emit(OpCode op, size_t a, size_t b = 0)
+            {
+                size_t dst = add_register();
+                code.push_back({op, dst, a, b, NULL, NULL, 0});
+                return dst;
+            }
+            void copy(size_t dst, size_t a)
+            {
+                code.push_back({OP_copy, dst, a, 0, NULL, NULL, 0});
+            }
+            size_t call(double (*fn)(void*, double), void * obj, size_t a)
+            {
+                size_t dst = add_register();
+                code.push_back({OP_call, dst, a, 0, fn, obj, 0});
+                return dst;
+            }
+            size_t value(FunkBase * f, size_t bindID, const std::vector<size_t> & slots)
+            {
+                size_t dst = add_register();
+                slot_maps.push_back(slots);
+                code.push_back({OP_value, dst, 0, slot_maps.size() - 1, NULL, f, bindID});
+                return dst;
+            }
+            // Jump to a later position (set with land()) unconditionally, or
+            // if the register a is not >= 0
+            size_t jump() { return emit_jump(OP_jump, 0); }
+            size_t branch(size_t a) { return emit_jump(OP_branch, a); }
+            void land(size_t jump_instruction) { code[jump_instruction].aux = code.size(); }
+
+            // Evaluate at a single point, with the data array given by args
+            // (missing entries are zero)
+            double eval(const double * args, size_t nargs) const
+            {
+                const size_t max_stack = 256;
+                double stack_regs[max_stack];
+                std::vector<double> heap_regs;
+                double * regs = stack_regs;
+                if ( registers.size() > max_stack )
+                {
+                    heap_regs.resize(registers.size());
+                    regs = &heap_regs[0];
+                }
+                std::copy(registers.begin(), registers.end(), regs);
+                std::copy(args, args + std::min(nargs, n_slots), regs);
+                std::vector<double> data;
+                run(regs, 1, 1, data);
+                return regs[result];
+            }
+
+            // Evaluate at n points, where the data array entries in varying
+            // are taken from columns[0..] (each of length n), the remaining
+            // ones from fixed.
+            void eval_batch(size_t n, const std::vector<size_t> & varying, const std::vector<const double *> & columns,
+                    const std::vector<double> & fixed, double * out) const
+            {
+                const size_t B = branch_free ? 64 : 1;
+                std::vector<double> regs(registers.size() * B);
+                for ( size_t r = 0; r < registers.size(); ++r )
+                {
+                    double x = (r < fixed.size() and r < n_slots) ? fixed[r] : registers[r];
+                    std::fill(regs.begin() + r*B, regs.begin() + (r+1)*B, x);
+                }
+                std::vector<double> data;
+                for ( size_t i0 = 0; i0 < n; i0 += B )
+                {
+                    const size_t nb = std::min(B, n - i0);
+                    for ( size_t k = 0; k < varying.size(); ++k )
+                        std::copy(columns[k] + i0, columns[k] + i0 + nb, regs.begin() + varying[k]*B);
+                    run(&regs[0], B, nb, data);
+                    std::copy(regs.begin() + result*B, regs.begin() + result*B + nb, out + i0);
+                }
+            }
+
+            std::vector<double> registers;  // Initial register values
+            size_t n_slots;  // Number of registers that hold the data array
+            size_t result;  // Register with the final result
+            bool branch_free;
+
+        private:
+            size_t emit_jump(OpCode op, size_t a)
+            {
+                branch_free = false;
+                code.push_back({op, 0, a, 0, NULL, NULL, 0});
+                return code.size() - 1;
+            }
+
+            // Execute the tape for nb points, with register r of point l at regs[r*B+l]
+            void run(double * regs, size_t B, size_t nb, std::vector<double> & data) const;
+
+            std::vector<Instruction> code;
+            std::vector<std::vector<size_t>> slot_maps;
+            std::map<uint64_t, size_t> constants;
+    };
+
     // A vector class with global knowledge about its health status.
     // (BoundFunk objects are occasionally destructed *after* livingVector has
     // been destructed, causing segfaults if not catched properly.)
@@ -398,11 +559,46 @@ namespace daFunk
 
             template <typename... Args> inline double eval(Args... argss)
             {
+                if ( tape )
+                {
+                    const std::array<double, sizeof...(Args)> args = {{static_cast<double>(argss)...}};
+                    return tape->eval(args.data(), args.size());
+                }
                 auto data = vec<double>(argss...);
                 data.resize(datalen);
                 return f->value(data, bindID);
             }
 
+            // Evaluate at n values x of the first argument, with the remaining
+            // arguments fixed
+            template <typename... Args> inline void eval_batch(size_t n, const double * x, double * result, Args... argss)
+            {
+                std::vector<double> fixed = vec<double>(0., argss...);
+                if ( tape )
+                {
+                    tape->eval_batch(n, vec<size_t>(0), vec<const double *>(x), fixed, result);
+                    return;
+                }
+                fixed.resize(datalen);
+                for ( size_t i = 0; i != n; ++i )
+                {
+                    fixed[0] = x[i];
+                    result[i] = f->value(fixed, bindID);
+                }
+            }
+
+            // Compile the bound function to an instruction tape, which is used
+            // by all subsequent evaluations.  Not thread-safe with respect to
+            // concurrent evaluations of the same object.
+            inline void compile()
+            {
+                if ( not tape ) tape = make_tape(f, datalen, bindID);
+            }
+            bool is_compiled() { return bool(tape); }
+
+            // Compile a bound function with data array length datalen
+            static shared_ptr<FunkTape> make_tape(Funk f, size_t datalen, size_t bindID);
+
             template <typename... Args> inline std::vector<double> vect(Args... argss)
             {
                 std::vector<std::vector<double>> coll;
@@ -462,6 +658,27 @@ namespace daFunk
                         return vec<double>();
                     }
                 }
+                // Use a tape for longer vectors (a temporary one if not compiled)
+                shared_ptr<FunkTape> my_tape = tape;
+                if ( not my_tape and size >= 16 ) my_tape = make_tape(f, datalen, bindID);
+                if ( my_tape )
+                {
+                    std::vector<size_t> varying;
+                    std::vector<const double *> columns;
+                    std::vector<double> fixed(coll.size());
+                    for ( size_t j = 0; j != coll.size(); ++j )
+                    {
+                        fixed[j] = coll[j][0];
+                        if ( vec_flag[j] )
+                        {
+                            varying.push_back(j);
+                            columns.push_back(&coll[j][0]);
+                        }
+                    }
+                    std::vector<double> r(size);
+                    my_tape->eval_batch(size, varying, columns, fixed, &r[0]);
+                    return r;
+                }
                 auto r = vec<double>();
                 auto data = vec<double>();
                 data.resize(datalen);
@@ -502,6 +719,9 @@ namespace daFunk
             // FunkBase and daughter classes) to be bound by various binding
             // functions simultaneously.
             size_t bindID;
+
+            // Instruction tape, if compiled
+            shared_ptr<FunkTape> tape;
     };
 
 
@@ -595,6 +815,13 @@ namespace daFunk
                 return c;
             }
 
+            size_t lower(FunkTape & tape, size_t bindID, const std::vector<size_t> & slots)
+            {
+                (void)bindID;
+                (void)slots;
+                return tape.constant(c);
+            }
+
         private:
             double c;
     };
@@ -671,6 +898,13 @@ namespace daFunk
                 return functions[0]->value(data2, bindID);
             }
 
+            size_t lower(FunkTape & tape, size_t bindID, const std::vector<size_t> & slots)
+            {
+                std::vector<size_t> slots2(slots);
+                slots2[my_index[bindID]] = functions[1]->lower(tape, bindID, slots);
+                return functions[0]->lower(tape, bindID, slots2);
+            }
+
         private:
             std::string my_arg;
 
@@ -892,10 +1126,20 @@ namespace daFunk
             double value(const std::vector<double> & data, size_t bindID)
             {
                 double x = data[indices[bindID][0]];
-                return exp(-pow(x-pos,2)/pow(width,2)/2)/sqrt(2*M_PI)/width;
+                return gauss(this, x);
+            }
+
+            size_t lower(FunkTape & tape, size_t bindID, const std::vector<size_t> & slots)
+            {
+                return tape.call(&FunkDelta::gauss, this, slots[indices[bindID][0]]);
             }
 
         private:
+            static double gauss(void * ptr, double x)
+            {
+                FunkDelta * f = static_cast<FunkDelta*>(ptr);
+                return exp(-pow(x-f->pos,2)/pow(f->width,2)/2)/sqrt(2*M_PI)/f->width;
+            }
             double pos, width;
     };
     inline Funk delta(std::string arg, double pos, double width) { return Funk(new FunkDelta(arg, pos, width)); }
@@ -916,6 +1160,12 @@ namespace daFunk
             {
                 return data[indices[bindID][0]];
             }
+
+            size_t lower(FunkTape & tape, size_t bindID, const std::vector<size_t> & slots)
+            {
+                (void)tape;
+                return slots[indices[bindID][0]];
+            }
     };
     inline Funk var(std::string arg) { return Funk(new FunkVar(arg)); }
 
@@ -1051,6 +1301,88 @@ namespace daFunk
         return shared_ptr<FunkBound>(new FunkBound(shared_from_this(), datalen, bindID));
     }
 
+    template <typename... Args> inline shared_ptr<FunkBound> FunkBase::compile(Args... argss)
+    {
+        shared_ptr<FunkBound> bound = bind(argss...);
+        bound->compile();
+        return bound;
+    }
+
+    inline size_t FunkBase::lower(FunkTape & tape, size_t bindID, const std::vector<size_t> & slots)
+    {
+        return tape.value(this, bindID, slots);
+    }
+
+    inline shared_ptr<FunkTape> FunkBound::make_tape(Funk f, size_t datalen, size_t bindID)
+    {
+        shared_ptr<FunkTape> tape(new FunkTape(datalen));
+        std::vector<size_t> slots(datalen);
+        for ( size_t i = 0; i != datalen; ++i ) slots[i] = i;
+        tape->result = f->lower(*tape, bindID, slots);
+        return tape;
+    }
+
+    inline void FunkTape::run(double * regs, size_t B, size_t nb, std::vector<double> & data) const
+    {
+#define TAPE_LANES(EXPR) for ( size_t l = 0; l != nb; ++l ) d[l] = EXPR; break;
+        for ( size_t pc = 0; pc != code.size(); ++pc )
+        {
+            const Instruction & in = code[pc];
+            double * d = regs + in.dst*B;
+            const double * a = regs + in.a*B;
+            const double * b = regs + in.b*B;
+            switch ( in.op )
+            {
+                case OP_copy:  TAPE_LANES(a[l])
+                case OP_umin:  TAPE_LANES(-a[l])
+                case OP_cos:   TAPE_LANES(std::cos(a[l]))
+                case OP_sin:   TAPE_LANES(std::sin(a[l]))
+                case OP_tan:   TAPE_LANES(std::tan(a[l]))
+                case OP_acos:  TAPE_LANES(std::acos(a[l]))
+                case OP_asin:  TAPE_LANES(std::asin(a[l]))
+                case OP_atan:  TAPE_LANES(std::atan(a[l]))
+                case OP_cosh:  TAPE_LANES(std::cosh(a[l]))
+                case OP_sinh:  TAPE_LANES(std::sinh(a[l]))
+                case OP_tanh:  TAPE_LANES(std::tanh(a[l]))
+                case OP_acosh: TAPE_LANES(std::acosh(a[l]))
+                case OP_asinh: TAPE_LANES(std::asinh(a[l]))
+                case OP_atanh: TAPE_LANES(std::atanh(a[l]))
+                case OP_exp:   TAPE_LANES(std::exp(a[l]))
+                case OP_log:   TAPE_LANES(std::log(a[l]))
+                case OP_log10: TAPE_LANES(std::log10(a[l]))
+                case OP_sqrt:  TAPE_LANES(std::sqrt(a[l]))
+                case OP_fabs:  TAPE_LANES(std::fabs(a[l]))
+                case OP_Sum:   TAPE_LANES(a[l] + b[l])
+                case OP_Mul:   TAPE_LANES(a[l] * b[l])
+                case OP_Div:   TAPE_LANES(a[l] / b[l])
+                case OP_Dif:   TAPE_LANES(a[l] - b[l])
+                case OP_pow:   TAPE_LANES(std::pow(a[l], b[l]))
+                case OP_fmin:  TAPE_LANES(std::fmin(a[l], b[l]))
+                case OP_fmax:  TAPE_LANES(std::fmax(a[l], b[l]))
+                case OP_call:  TAPE_LANES(in.fn(in.obj, a[l]))
+                case OP_value:
+                {
+                    const std::vector<size_t> & slots = slot_maps[in.b];
+                    data.resize(slots.size());
+                    for ( size_t l = 0; l != nb; ++l )
+                    {
+                        for ( size_t i = 0; i != slots.size(); ++i ) data[i] = regs[slots[i]*B + l];
+                        d[l] = static_cast<FunkBase*>(in.obj)->value(data, in.aux);
+                    }
+                    break;
+                }
+                // Branches only occur in tapes that are evaluated point by point
+                case OP_jump:
+                    pc = in.aux - 1;
+                    break;
+                case OP_branch:
+                    if ( not (a[0] >= 0.) ) pc = in.aux - 1;
+                    break;
+            }
+        }
+#undef TAPE_LANES
+    }
+
     inline bool FunkBase::hasArg(std::string arg)
     {
         return ( std::find(arguments.begin(), arguments.end(), arg) != arguments.end() );
@@ -1148,6 +1480,10 @@ namespace daFunk
             {
                 return -(functions[0]->value(data, bindID));
             }
+            size_t lower(FunkTape & tape, size_t bindID, const std::vector<size_t> & slots)
+            {
+                return tape.emit(FunkTape::OP_umin, functions[0]->lower(tape, bindID, slots));
+            }
     };
     inline Funk operator - (Funk f) { return Funk(new FunkMath_umin(f)); }
 
@@ -1166,6 +1502,10 @@ namespace daFunk
             {                                                                                             \
                 return OPERATION(functions[0]->value(data, bindID));                                      \
             }                                                                                             \
+            size_t lower(FunkTape & tape, size_t bindID, const std::vector<size_t> & slots)               \
+            {                                                                                             \
+                return tape.emit(FunkTape::OP_##OPERATION, functions[0]->lower(tape, bindID, slots));     \
+            }                                                                                             \
     };                                                                                                    \
     inline Funk OPERATION (Funk f) { return Funk(new FunkMath_##OPERATION(f)); }
     MATH_OPERATION(cos)
@@ -1216,6 +1556,11 @@ namespace daFunk
             {                                                                                             \
                 return functions[0]->value(data, bindID) SYMBOL functions[1]->value(data, bindID);        \
             }                                                                                             \
+            size_t lower(FunkTape & tape, size_t bindID, const std::vector<size_t> & slots)               \
+            {                                                                                             \
+                size_t a = functions[0]->lower(tape, bindID, slots);                                      \
+                return tape.emit(FunkTape::OP_##OPERATION, a, functions[1]->lower(tape, bindID, slots));  \
+            }                                                                                             \
     };                                                                                                    \
     inline Funk operator SYMBOL (Funk f1, Funk f2) { return Funk(new FunkMath_##OPERATION(f1, f2)); }     \
     inline Funk operator SYMBOL (double x, Funk f) { return Funk(new FunkMath_##OPERATION(x, f)); }       \
@@ -1255,6 +1600,11 @@ namespace daFunk
             {                                                                                             \
                 return OPERATION(functions[0]->value(data, bindID), functions[1]->value(data, bindID));   \
             }                                                                                             \
+            size_t lower(FunkTape & tape, size_t bindID, const std::vector<size_t> & slots)               \
+            {                                                                                             \
+                size_t a = functions[0]->lower(tape, bindID, slots);                                      \
+                return tape.emit(FunkTape::OP_##OPERATION, a, functions[1]->lower(tape, bindID, slots));  \
+            }                                                                                             \
     };                                                                                                    \
     inline Funk OPERATION (Funk f1, Funk f2) { return Funk(new FunkMath_##OPERATION(f1, f2)); }           \
     inline Funk OPERATION (double x, Funk f) { return Funk(new FunkMath_##OPERATION(x, f)); }             \
@@ -1301,6 +1651,13 @@ namespace daFunk
                 return (this->*ptr)(data[indices[bindID][0]]);
             }
 
+            size_t lower(FunkTape & tape, size_t bindID, const std::vector<size_t> & slots)
+            {
+                if ( indices[bindID].empty() ) return tape.value(this, bindID, slots);
+                functions[0]->lower(tape, bindID, slots);
+                return tape.call(&FunkInterp::interpolate, this, slots[indices[bindID][0]]);
+            }
+
         private:
             void setup(Funk f, std::vector<double> & Xgrid, std::vector<double> & Ygrid, std::string mode)
             {
@@ -1340,6 +1697,12 @@ namespace daFunk
                 return y0 + (x-x0)/(x1-x0)*(y1-y0);
             }
 
+            static double interpolate(void * obj, double x)
+            {
+                FunkInterp * f = static_cast<FunkInterp*>(obj);
+                return (f->*(f->ptr))(x);
+            }
+
             double(FunkInterp::*ptr)(double);
             std::vector<double> Xgrid;
             std::vector<double> Ygrid;
@@ -1368,6 +1731,17 @@ namespace daFunk
               else
                 return functions[2]->value(data,bindID);
             }
+            size_t lower(FunkTape & tape, size_t bindID, const std::vector<size_t> & slots)
+            {
+              size_t result = tape.add_register();
+              size_t to_else = tape.branch(functions[0]->lower(tape, bindID, slots));
+              tape.copy(result, functions[1]->lower(tape, bindID, slots));
+              size_t to_end = tape.jump();
+              tape.land(to_else);
+              tape.copy(result, functions[2]->lower(tape, bindID, slots));
+              tape.land(to_end);
+              return result;
+            }
     };
     inline Funk ifelse(Funk f, Funk g, Funk h) { return Funk(new FunkIfElse(f, g, h)); }
     inline Funk ifelse(Funk f, double g, Funk h) { return Funk(new FunkIfElse(f, cnst(g), h)); }
@@ -1554,6 +1928,9 @@ namespace daFunk
                     it->first->resolve(datamap, datalen, bindID, argmap);
                     it->second->resolve(datamap, datalen, bindID, argmap);
                 }
+                // Compile the integrand now, so that value() only ever reads the tapes
+                if ( integrands.size() <= bindID ) integrands.resize(bindID+1);
+                integrands[bindID] = FunkBound::make_tape(functions[0], datalen, bindID);
             }
 
             ~FunkIntegrate_gsl1d()
@@ -1565,8 +1942,19 @@ namespace daFunk
             { this->epsrel = epsrel; return static_pointer_cast<FunkIntegrate_gsl1d>(this->FunkIntegrate_gsl1d::shared_from_this()); }
             shared_ptr<FunkIntegrate_gsl1d> set_epsabs(double epsabs)
             { this->epsabs = epsabs; return static_pointer_cast<FunkIntegrate_gsl1d>(this->shared_from_this()); }
+            // value() is not re-entrant: it keeps the current point (local_data, local_tape) and the workspace
+            // in this object, and only stays correct because every call holds the critical section below.
+            // Resizing the workspace therefore takes the same critical section.
             shared_ptr<FunkIntegrate_gsl1d> set_limit(size_t limit)
-            { this->limit = limit; return static_pointer_cast<FunkIntegrate_gsl1d>(this->shared_from_this()); }
+            {
+                #pragma omp critical(FunkIntegrate_gsl1d_integration)
+                {
+                    this->limit = limit;
+                    gsl_integration_workspace_free(gsl_workspace);
+                    gsl_workspace = gsl_integration_workspace_alloc(limit);
+                }
+                return static_pointer_cast<FunkIntegrate_gsl1d>(this->shared_from_this());
+            }
             shared_ptr<FunkIntegrate_gsl1d> set_singularity_factor(double f)
             { this->singl_factor = f; return static_pointer_cast<FunkIntegrate_gsl1d>(this->shared_from_this()); }
             shared_ptr<FunkIntegrate_gsl1d> set_use_log_fallback(bool flag)
@@ -1579,6 +1967,7 @@ namespace daFunk
                 {
                     local_data = data;
                     local_bindID = bindID;
+                    local_tape = integrands.at(bindID).get();
                     double error;
                     function=&FunkIntegrate_gsl1d::invoke;
                     params=this;
@@ -1623,12 +2012,10 @@ namespace daFunk
                         std::vector<double> Xgrid = 
                             logspace(std::log10(x0), std::log10(x1), N);
                         double sum = 0, y0, y1, dx;
-                        local_data[index[bindID]] = Xgrid[0];
-                        y0 = functions[0]->value(local_data, bindID);
+                        y0 = invoke(Xgrid[0], this);
                         for (size_t i = 0; i<N-1; i++)
                         {
-                            local_data[index[bindID]] = Xgrid[i+1];
-                            y1 = functions[0]->value(local_data, bindID);
+                            y1 = invoke(Xgrid[i+1], this);
                             dx = Xgrid[i+1]-Xgrid[i];
                             sum += dx*(y0+y1)/2;
                             y0 = y1;
@@ -1666,10 +2053,11 @@ namespace daFunk
                 singularities = joinSingl(singularities, tmp_singl);
 
                 arguments = joinArgs(eraseArg(f0->getArgs(), arg), joinArgs(f1->getArgs(), f2->getArgs()));
-                gsl_workspace = gsl_integration_workspace_alloc (100000);
 
                 this->arg = arg;
                 limit = 100;
+                // The workspace only ever needs room for limit subintervals
+                gsl_workspace = gsl_integration_workspace_alloc(limit);
                 epsrel = 1e-2;
                 epsabs = 1e-2;
                 use_log_fallback = false;
@@ -1680,12 +2068,16 @@ namespace daFunk
             static double invoke(double x, void *params) {
                 FunkIntegrate_gsl1d * ptr = static_cast<FunkIntegrate_gsl1d*>(params);
                 ptr->local_data[ptr->index[ptr->local_bindID]] = x;
-                return ptr->functions[0]->value(ptr->local_data, ptr->local_bindID);
+                return ptr->local_tape->eval(&ptr->local_data[0], ptr->local_data.size());
             }
 
             // Required for rewiring input parameters
             std::vector<double> local_data;
             size_t local_bindID;
+
+            // Compiled integrands (one per bindID) and the one in use
+            std::vector<shared_ptr<FunkTape>> integrands;
+            FunkTape * local_tape;
             std::vector<std::pair<Funk, Funk>> my_singularities;
 
             // Integration range and function pointer
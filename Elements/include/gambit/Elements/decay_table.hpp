@@ -12,6 +12,9 @@
 ///          (patscott@physics.mcgill.ca)
 ///  \date 2015 Jan
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #ifndef __decay_table_hpp__
@@ -21,6 +24,7 @@
 #include <set>
 #include <string>
 #include <sstream>
+#include <vector>
 
 #include "gambit/Elements/slhaea_spec_helpers.hpp"
 #include "gambit/Elements/mssm_slhahelp.hpp"
@@ -39,6 +43,128 @@ namespace Gambit
       // Forward declaration of DecayTable entry class, for readability.  Holds the info on all decays of a given particle.
       class Entry;
 
+      /// A decay channel, i.e. a set of final state particles (PDG-context integer pairs).
+      /// Channels are interned in a global registry that gives every distinct final state a stable
+      /// integer ID the first time it is seen.  Construct a Channel once (e.g. as a static) and pass
+      /// it to the Entry accessors to look up BFs without building a set of particles on every call.
+      /// Lookups by particle names or PDG codes do not intern anything, and never touch the registry.
+      class Channel
+      {
+        public:
+
+          typedef std::multiset< std::pair<int,int> > key_type;
+
+          /// Intern a set of final state particles
+          Channel(const key_type&);
+
+          /// Intern a final state given as PDG-context integer pairs
+          template <typename... Args>
+          explicit Channel(std::pair<int,int> p1, Args... args) : Channel(make_key(p1, args...)) {}
+
+          /// Intern a final state given as full particle names or short names and indices
+          template <typename... Args>
+          explicit Channel(str p1, Args... args) : Channel(make_key(p1, args...)) {}
+
+          /// Stable integer ID of this channel
+          int id() const { return my_id; }
+
+          /// Final state particles of this channel
+          const key_type& particles() const { return *my_key; }
+          operator const key_type&() const { return *my_key; }
+          key_type::const_iterator begin() const { return my_key->begin(); }
+          key_type::const_iterator end() const { return my_key->end(); }
+          std::size_t size() const { return my_key->size(); }
+
+          /// Channels are equal if their IDs are; they are ordered by their final states.
+          bool operator==(const Channel& other) const { return my_id == other.my_id; }
+          bool operator!=(const Channel& other) const { return my_id != other.my_id; }
+          bool operator<(const Channel& other) const { return *my_key < *other.my_key; }
+
+          /// Construct a set of particles from a variadic list of full names or short names and indices
+          /// @{
+          template <typename... Args>
+          static key_type make_key(str p1, Args... args)
+          {
+            key_type key;
+            construct_key(key, p1, args...);
+            return key;
+          }
+          template <typename... Args>
+          static key_type make_key(std::pair<int,int> p1, Args... args)
+          {
+            return key_type{p1, args...};
+          }
+          /// @}
+
+        private:
+
+          int my_id;
+          const key_type* my_key;
+
+          /// Helpers for make_key
+          /// @{
+          /// Base function version
+          static void construct_key(key_type&) {}
+          /// Templated version for long names
+          template <typename... Args>
+          static void construct_key(key_type& key, str p1, Args... args)
+          {
+            construct_key(key, args...);
+            key.insert(Models::ParticleDB().pdg_pair(p1));
+          }
+          /// Templated version for short names and indices
+          template <typename... Args>
+          static void construct_key(key_type& key, str p1, int i1, Args... args)
+          {
+            construct_key(key, args...);
+            key.insert(Models::ParticleDB().pdg_pair(p1, i1));
+          }
+          /// @}
+      };
+
+      /// The channels of a DecayTable entry with their BFs and errors, stored contiguously in the
+      /// order of their final states (the order of the std::map that used to hold them).  Supports
+      /// the map-like operations used on DecayTable::Entry::channels.  Lookups by Channel scan the
+      /// channel IDs, which beats a binary search for the sizes of real decay tables (up to a few
+      /// hundred channels); lookups by set of particles bisect the final-state order.
+      class ChannelList
+      {
+        public:
+
+          typedef std::pair<Channel, std::pair<double, double> > value_type;
+          typedef std::vector<value_type>::iterator iterator;
+          typedef std::vector<value_type>::const_iterator const_iterator;
+
+          iterator begin() { return data.begin(); }
+          iterator end() { return data.end(); }
+          const_iterator begin() const { return data.begin(); }
+          const_iterator end() const { return data.end(); }
+          std::size_t size() const { return data.size(); }
+          bool empty() const { return data.empty(); }
+          void clear() { data.clear(); }
+          iterator erase(const_iterator it) { return data.erase(it); }
+
+          iterator find(const Channel&);
+          const_iterator find(const Channel&) const;
+          iterator find(const Channel::key_type&);
+          const_iterator find(const Channel::key_type&) const;
+          std::size_t count(const Channel& c) const { return find(c) == end() ? 0 : 1; }
+          std::size_t count(const Channel::key_type& k) const { return find(k) == end() ? 0 : 1; }
+
+          /// BF and error of a channel, throwing std::out_of_range if absent
+          std::pair<double, double>& at(const Channel&);
+          const std::pair<double, double>& at(const Channel&) const;
+          std::pair<double, double>& at(const Channel::key_type&);
+          const std::pair<double, double>& at(const Channel::key_type&) const;
+
+          /// BF and error of a channel, adding the channel if absent
+          std::pair<double, double>& operator[](const Channel&);
+
+        private:
+
+          std::vector<value_type> data;
+      };
+
       /// Constructors
       /// @{
       /// Default constructor
@@ -101,30 +227,13 @@ namespace Gambit
           void init(const SLHAea::Block&, int, bool force_SM_fermion_gauge_eigenstates = false);
 
           /// Make sure all particles listed in a set are actually known to the GAMBIT particle database
-          void check_particles_exist(std::multiset< std::pair<int,int> >&) const;
+          void check_particles_exist(const Channel::key_type&) const;
 
           /// Make sure no NaNs have been passed to the DecayTable by nefarious backends
-          void check_BF_validity(double, double, std::multiset< std::pair<int,int> >&) const;
+          void check_BF_validity(double, double, const Channel::key_type&) const;
 
-          /// Construct a set of particles from a variadic list of full names or short names and indices
-          /// @{
-          /// Base function version
-          static void construct_key(std::multiset< std::pair<int,int> >&) {}
-          /// Templated version for long names
-          template <typename... Args>
-          static void construct_key(std::multiset< std::pair<int,int> >& key, str p1, Args... args)
-          {
-            construct_key(key, args...);
-            key.insert(Models::ParticleDB().pdg_pair(p1));
-          }
-          /// Templated version for short names and indices
-          template <typename... Args>
-          static void construct_key(std::multiset< std::pair<int,int> >& key, str p1, int i1, Args... args)
-          {
-            construct_key(key, args...);
-            key.insert(Models::ParticleDB().pdg_pair(p1, i1));
-          }
-          /// @}
+          /// Raise an error for a channel that is not in this entry
+          void missing_channel_error(const Channel::key_type&) const;
 
         public:
 
@@ -140,194 +249,151 @@ namespace Gambit
 
           /// Set branching fraction for decay to a given final state.
           /// Supports arbitrarily many final state particles.
-          /// Five ways to specify final states:
+          /// Six ways to specify final states:
           ///  1. PDG-context integer pairs (vector)
           ///  2. full particle names (vector)
           ///  3. PDG-context integer pairs (arguments)
           ///  4. full particle names (arguments)
           ///  5. short particle names + index integers (arguments)
+          ///  6. interned Channel
           /// @{
           void set_BF(double, double, const std::vector<std::pair<int,int> >&);
           void set_BF(double, double, const std::vector<str>&);
+          void set_BF(double, double, const Channel&);
 
           template <typename... Args>
           void set_BF(double BF, double error, std::pair<int,int> p1, Args... args)
           {
-            std::pair<int,int> particles[] = {p1, args...};
-            std::multiset< std::pair<int,int> > key(particles, particles+sizeof...(Args)+1);
-            check_particles_exist(key);
-            check_BF_validity(BF, error, key);
-            channels[key] = std::pair<double, double>(BF, error);
+            Channel channel(p1, args...);
+            check_particles_exist(channel);
+            set_BF(BF, error, channel);
           }
 
           template <typename... Args>
           void set_BF(double BF, double error, str p1, Args... args)
           {
-            std::multiset< std::pair<int,int> > key;
-            construct_key(key, p1, args...);
-            check_BF_validity(BF, error, key);
-            channels[key] = std::pair<double, double>(BF, error);
+            set_BF(BF, error, Channel(p1, args...));
           }
           /// @}
 
           /// Check if a given final state exists in this DecayTable::Entry.
           /// Supports arbitrarily many final state particles.
-          /// Five ways to specify final states:
+          /// Seven ways to specify final states:
           ///  1. PDG-context integer pairs (vector)
           ///  2. full particle names (vector)
           ///  3. PDG-context integer pairs (arguments)
           ///  4. full particle names (arguments)
           ///  5. short particle names + index integers (arguments)
+          ///  6. interned Channel
+          ///  7. set of PDG-context integer pairs
           /// @{
           bool has_channel(const std::vector<std::pair<int,int> >&) const;
           bool has_channel(const std::vector<str>&) const;
+          bool has_channel(const Channel& channel) const { return channels.find(channel) != channels.end(); }
+          bool has_channel(const Channel::key_type& key) const { return channels.find(key) != channels.end(); }
 
           template <typename... Args>
           bool has_channel(std::pair<int,int> p1, Args... args) const
           {
-            std::pair<int,int> particles[] = {p1, args...};
-            std::multiset< std::pair<int,int> > key(particles, particles+sizeof...(Args)+1);
+            Channel::key_type key = Channel::make_key(p1, args...);
             check_particles_exist(key);
-            return channels.find(key) != channels.end();
+            return has_channel(key);
           }
 
           template <typename... Args>
           bool has_channel(str p1, Args... args) const
           {
-            std::multiset< std::pair<int,int> > key;
-            construct_key(key, p1, args...);
-            return channels.find(key) != channels.end();
+            return has_channel(Channel::make_key(p1, args...));
           }
           /// @}
 
           /// Retrieve branching fraction for decay to a given final state.
-          /// Five ways to specify final states:
+          /// Seven ways to specify final states:
           ///  1. PDG-context integer pairs (vector)
           ///  2. full particle names (vector)
           ///  3. PDG-context integer pairs (arguments)
           ///  4. full particle names (arguments)
           ///  5. short particle names + index integers (arguments)
+          ///  6. interned Channel
+          ///  7. set of PDG-context integer pairs
           /// Supports arbitrarily many final state particles.
           /// @{
           double BF(const std::vector<std::pair<int, int> >&) const;
           double BF(const std::vector<str>&) const;
+          double BF(const Channel& channel) const { return BF_with_error(channel).first; }
+          double BF(const Channel::key_type& key) const { return BF_with_error(key).first; }
 
           template <typename... Args>
           double BF(std::pair<int,int> p1, Args... args) const
           {
-            std::pair<int,int> particles[] = {p1, args...};
-            std::multiset< std::pair<int,int> > key(particles, particles+sizeof...(Args)+1);
-            if (channels.find(key) == channels.end())
-            {
-              std::ostringstream err;
-              err << "No branching fraction exists for the requested final states:";
-              for (auto particle = key.begin(); particle != key.end(); ++particle)
-              {
-                err << " {" << particle->first << ", " << particle->second << "}";
-              }
-              model_error().raise(LOCAL_INFO,err.str());
-            }
-            return channels.at(key).first;
+            return BF(Channel::make_key(p1, args...));
           }
 
           template <typename... Args>
           double BF(str p1, Args... args) const
           {
-            std::multiset< std::pair<int,int> > key;
-            construct_key(key, p1, args...);
-            if (channels.find(key) == channels.end())
-            {
-              std::ostringstream err;
-              err << "No branching fraction exists for the requested final states:";
-              for (auto particle = key.begin(); particle != key.end(); ++particle)
-              {
-                err << " {" << particle->first << ", " << particle->second << "}";
-              }
-              model_error().raise(LOCAL_INFO,err.str());
-            }
-            return channels.at(key).first;
+            return BF(Channel::make_key(p1, args...));
           }
           /// @}
 
           /// Retrieve branching fraction error for decay to a given final state.
-          /// Three ways to specify final states: PDG-context integer pairs, full particle names, short particle names + index integers.
+          /// Five ways to specify final states: PDG-context integer pairs, full particle names, short particle names + index integers,
+          /// interned Channel, set of PDG-context integer pairs.
           /// Supports arbitrarily many final state particles.
           /// @{
+          double BF_error(const Channel& channel) const { return BF_with_error(channel).second; }
+          double BF_error(const Channel::key_type& key) const { return BF_with_error(key).second; }
+
           template <typename... Args>
           double BF_error(std::pair<int,int> p1, Args... args) const
           {
-            std::pair<int,int> particles[] = {p1, args...};
-            std::multiset< std::pair<int,int> > key(particles, particles+sizeof...(Args)+1);
-            if (channels.find(key) == channels.end())
-            {
-              std::ostringstream err;
-              err << "No branching fraction exists for the requested final states:";
-              for (auto particle = key.begin(); particle != key.end(); ++particle)
-              {
-                err << " {" << particle->first << ", " << particle->second << "}";
-              }
-              model_error().raise(LOCAL_INFO,err.str());
-            }
-            return channels.at(key).second;
+            return BF_error(Channel::make_key(p1, args...));
           }
 
           template <typename... Args>
           double BF_error(str p1, Args... args) const
           {
-            std::multiset< std::pair<int,int> > key;
-            construct_key(key, p1, args...);
-            if (channels.find(key) == channels.end())
-            {
-              std::ostringstream err;
-              err << "No branching fraction exists for the requested final states:";
-              for (auto particle = key.begin(); particle != key.end(); ++particle)
-              {
-                err << " {" << particle->first << ", " << particle->second << "}";
-              }
-              model_error().raise(LOCAL_INFO,err.str());
-            }
-            return channels.at(key).second;
+            return BF_error(Channel::make_key(p1, args...));
           }
           /// @}
 
           /// Retrieve branching fraction and error for decay to a given final state.
-          /// Three ways to specify final states: PDG-context integer pairs, full particle names, short particle names + index integers.
+          /// Five ways to specify final states: PDG-context integer pairs, full particle names, short particle names + index integers,
+          /// interned Channel, set of PDG-context integer pairs.
           /// Supports arbitrarily many final state particles.
           /// @{
-          template <typename... Args>
-          std::pair<double, double> BF_with_error(std::pair<int,int> p1, Args... args) const
+          const std::pair<double, double>& BF_with_error(const Channel& channel) const
           {
-            std::pair<int,int> particles[] = {p1, args...};
-            std::multiset< std::pair<int,int> > key(particles, particles+sizeof...(Args)+1);
-            if (channels.find(key) == channels.end())
+            ChannelList::const_iterator it = channels.find(channel);
+            if (it == channels.end())
             {
-              std::ostringstream err;
-              err << "No branching fraction exists for the requested final states:";
-              for (auto particle = key.begin(); particle != key.end(); ++particle)
-              {
-                err << " {" << particle->first << ", " << particle->second << "}";
-              }
-              model_error().raise(LOCAL_INFO,err.str());
+              missing_channel_error(channel);
+              return channels.at(channel);
             }
-            return channels.at(key);
+            return it->second;
           }
 
-          template <typename... Args>
-          std::pair<double, double> BF_with_error(str p1, Args... args) const
+          const std::pair<double, double>& BF_with_error(const Channel::key_type& key) const
           {
-            std::multiset< std::pair<int,int> > key;
-            construct_key(key, p1, args...);
-            if (channels.find(key) == channels.end())
+            ChannelList::const_iterator it = channels.find(key);
+            if (it == channels.end())
             {
-              std::ostringstream err;
-              err << "No branching fraction exists for the requested final states:";
-              for (auto particle = key.begin(); particle != key.end(); ++particle)
-              {
-                err << " {" << particle->first << ", " << particle->second << "}";
-              }
-              model_error().raise(LOCAL_INFO,err.str());
+              missing_channel_error(key);
+              return channels.at(key);
             }
-            return channels.at(key);
+            return it->second;
+          }
+
+          template <typename... Args>
+          std::pair<double, double> BF_with_error(std::pair<int,int> p1, Args... args) const
+          {
+            return BF_with_error(Channel::make_key(p1, args...));
+          }
+
+          template <typename... Args>
+          std::pair<double, double> BF_with_error(str p1, Args... args) const
+          {
+            return BF_with_error(Channel::make_key(p1, args...));
           }
           /// @}
 
@@ -359,9 +425,9 @@ namespace Gambit
           /// Errors from the calculator
           str errors;
 
-          /// The actual underlying map of channels to their BFs.
+          /// The actual underlying list of channels and their BFs.
           /// Just iterate over this directly if you need to iterate over all decays of this particle.
-          std::map< std::multiset< std::pair<int,int> >, std::pair<double, double> > channels;
+          ChannelList channels;
 
       };
 
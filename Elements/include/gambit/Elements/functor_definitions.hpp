@@ -107,7 +107,7 @@ namespace Gambit
         backend_error().raise(LOCAL_INFO, ss.str());
       }
       boost::io::ios_flags_saver ifs(cout);        // Don't allow module functions to change the output precision of cout
-      int thread_num = omp_get_thread_num();
+      int thread_num = (iRunNested ? omp_get_thread_num() : 0); // Functors not run in loops only have a single slot
       init_memory();                               // Init memory if this is the first run through.
       if (needs_recalculating[thread_num])         // Do the actual calculation if required.
       {
@@ -292,6 +292,7 @@ namespace Gambit
     template <typename TYPE, typename... ARGS>
     TYPE backend_functor<TYPE(*)(ARGS...), TYPE, ARGS...>::operator()(ARGS&&... args)
     {
+      functor_profiler::scope profile(this, true);
       logger().entering_backend(this->myLogTag);
       TYPE tmp = this->myFunction(std::forward<ARGS>(args)...);
       logger().leaving_backend();
@@ -319,6 +320,7 @@ namespace Gambit
     template <typename... ARGS>
     void backend_functor<void(*)(ARGS...), void, ARGS...>::operator()(ARGS&&... args)
     {
+      functor_profiler::scope profile(this, true);
       logger().entering_backend(this->myLogTag);
       this->myFunction(std::forward<ARGS>(args)...);
       logger().leaving_backend();
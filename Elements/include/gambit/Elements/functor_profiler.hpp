@@ -0,0 +1,163 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Profiler for module and backend functors.
+///  Aggregates inclusive and exclusive runtimes,
+///  call counts and invalidations for every call
+///  path of functors, separately for each thread,
+///  samples the memory high-water mark of the
+///  whole process once per parameter point, and
+///  writes them out as collapsed stacks (for
+///  flamegraphs) and Chrome trace JSON.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#ifndef __functor_profiler_hpp__
+#define __functor_profiler_hpp__
+
+#include <map>
+#include <vector>
+#include <chrono>
+
+#include "gambit/Utils/util_types.hpp"
+
+namespace Gambit
+{
+
+  class functor;
+
+  /// Profiler for module and backend functors
+  class functor_profiler
+  {
+
+    public:
+
+      /// Switch on profiling, with output files starting with prefix, at most max_trace_events
+      /// individual calls recorded in the Chrome trace (per process), and the given MPI rank.
+      void enable(const str& prefix, long long max_trace_events, int rank);
+
+      /// Check if profiling is switched on
+      static bool enabled() { return active; }
+
+      /// Record the start of a call to a functor on the current thread
+      void enter(const functor*, bool is_backend = false);
+
+      /// Record the end of a call to a functor on the current thread
+      void leave(const functor*);
+
+      /// Record that a functor has invalidated the current point
+      void invalidation(const functor*);
+
+      /// Record the end of a parameter point, sampling the memory high-water mark of the process
+      void point_done();
+
+      /// Write out the profile (collapsed stacks, Chrome trace and summary table)
+      void write();
+
+      /// Profiling scope for a single functor call; records the call if profiling is switched on
+      class scope
+      {
+        public:
+          scope(const functor* f, bool is_backend = false);
+          ~scope();
+        private:
+          const functor* myFunctor;
+      };
+
+    private:
+
+      typedef std::chrono::steady_clock clock;
+
+      /// Statistics of a single call path
+      struct node
+      {
+        const functor* f;
+        bool is_backend;
+        int parent;
+        std::map<const functor*, int> children;
+        double inclusive = 0;
+        double exclusive = 0;
+        long long calls = 0;
+        long long invalidations = 0;
+      };
+
+      /// A call in progress
+      struct frame
+      {
+        int node;
+        clock::time_point start;
+        double child_time;
+      };
+
+      /// A single call, for the Chrome trace
+      struct trace_event
+      {
+        int node;
+        double start_us;
+        double duration_us;
+      };
+
+      /// Memory high-water mark of the whole process at the end of a parameter point
+      struct memory_sample
+      {
+        double time_us;
+        long max_rss_kb;
+      };
+
+      /// Everything recorded by a single thread
+      struct thread_data
+      {
+        std::vector<node> nodes;
+        std::map<const functor*, int> roots;
+        std::vector<frame> stack;
+        std::vector<trace_event> events;
+      };
+
+      /// Get the label of a call path node, e.g. DarkBit::RD_oh2 or DarkSUSY_6.4.0::dsrdomega
+      static str label(const node&);
+
+      /// Full call path of a node, separated by semicolons
+      static str path(const thread_data&, int);
+
+      /// Get the current thread's data (NULL if it is beyond the number of threads allowed)
+      thread_data* this_thread();
+
+      /// Flag indicating whether profiling is switched on
+      static bool active;
+
+      /// Per-thread data
+      std::vector<thread_data> threads;
+
+      /// Start of profiling
+      clock::time_point origin;
+
+      /// Output file prefix
+      str prefix;
+
+      /// MPI rank of this process
+      int rank = 0;
+
+      /// Maximum and current number of events recorded for the Chrome trace
+      long long max_events = 0;
+      long long n_events = 0;
+
+      /// Memory samples for the Chrome trace (at most max_events), and the number of points done
+      std::vector<memory_sample> memory;
+      long long n_points = 0;
+
+  };
+
+  /// Global profiler for module and backend functors
+  functor_profiler& profiler();
+
+}
+
+#endif //#def __functor_profiler_hpp__
@@ -60,6 +60,7 @@
 #include "gambit/Utils/model_parameters.hpp"
 #include "gambit/Logs/logger.hpp"
 #include "gambit/Logs/logmaster.hpp" // Need full declaration of LogMaster class
+#include "gambit/Elements/functor_profiler.hpp"
 
 /// Decay rate of average runtime estimate [(number of functor evaluations)^-1]
 #define FUNCTORS_FADE_RATE 0.01
@@ -169,6 +170,10 @@ namespace Gambit
       void setVertexID(int);
       /// Set ID for timing 'vertex' (used in printer system)
       void setTimingVertexID(int);
+      /// Setter for indicating whether the functor may be calculated concurrently with other functors
+      void setThreadsafe(bool);
+      /// Getter indicating whether the functor may be calculated concurrently with other functors
+      bool isThreadsafe() const;
       /// Getter for the wrapped function's name
       str name() const;
       /// Getter for the wrapped function's reported capability
@@ -428,6 +433,8 @@ namespace Gambit
       int myTimingVertexID;
       /// Debug flag
       bool verbose;
+      /// Flag indicating whether the functor may be calculated concurrently with other functors
+      bool myThreadsafe;
 
       /// Internal storage of function options, as a YAML node
       Options myOptions;
@@ -1040,6 +1047,7 @@ namespace Gambit
       template <typename... VARARGS>
       TYPE operator()(VARARGS&&... varargs)
       {
+        functor_profiler::scope profile(this, true);
         logger().entering_backend(this->myLogTag);
         TYPE tmp = this->myFunction(std::forward<VARARGS>(varargs)...);
         logger().leaving_backend();
@@ -1066,6 +1074,7 @@ namespace Gambit
       template <typename... VARARGS>
       void operator()(VARARGS&&... varargs)
       {
+        functor_profiler::scope profile(this, true);
         logger().entering_backend(this->myLogTag);
         this->myFunction(std::forward<VARARGS>(varargs)...);
         logger().leaving_backend();
@@ -0,0 +1,36 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file                                       
+///                                               
+///  Compile-time registration of GAMBIT module   
+///  types.                                       
+///                                               
+///  This file was automatically generated by     
+///  module_harvester.py. Do not modify.          
+///                                               
+///  Do not add to this if you want to add new    
+///  types associated with a new (or old) module. 
+///  Just add your model type header as           
+///  XBit/include/gambit/XBit/XBit_types.hpp and  
+///  rest assured that module_harvester.py will   
+///  make sure it ends up here.                   
+///                                               
+///  *********************************************
+///                                               
+///  Authors:                                     
+///                                               
+///  \author The GAMBIT Collaboration            
+///  \date 06:54PM on October 16, 2026
+///                                               
+///  *********************************************
+                                                  
+#ifndef __module_types_rollcall_hpp__             
+#define __module_types_rollcall_hpp__             
+                                                  
+// Automatically-generated list of module types.  
+#include "gambit/DarkBit/DarkBit_types.hpp"
+#include "gambit/ColliderBit/ColliderBit_types.hpp"
+#include "gambit/CosmoBit/CosmoBit_types.hpp"
+#include "gambit/FlavBit/FlavBit_types.hpp"
+
+#endif // defined __module_types_rollcall_hpp__
@@ -18,6 +18,9 @@
 ///          (benjamin.farmer@fysik.su.se)
 ///  \date 2014, 2015 Jan - Jul
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #ifndef __SubSpectrum_hpp__
@@ -49,8 +52,8 @@ namespace Gambit {
       else if(check_overrides == ignore_overrides){overrides=false; override_only=false;}
 
       /* Create finder object, tell it what maps to search, and do the search */
-      const OverrideMaps         overridecoll = override_maps.at(partype);
-      const MapCollection<MTget> mapcoll      = getter_maps.at(partype);
+      const OverrideMaps&         overridecoll = override_maps.at(partype);
+      const MapCollection<MTget>& mapcoll      = getter_maps.at(partype);
       FptrFinder<Spec<DerivedSpec>,MapTag::Get> finder =
                        SetMaps<Spec<DerivedSpec>,MapTag::Get>(Par::toString.at(partype),this)
                               .omap0(  overridecoll.m0 )
@@ -80,8 +83,8 @@ namespace Gambit {
       else if(check_overrides == ignore_overrides){overrides=false; override_only=false;}
 
      /* Create finder object, tell it what maps to search, and do the search */
-      const OverrideMaps         overridecoll = override_maps.at(partype);
-      const MapCollection<MTget> mapcoll      = getter_maps.at(partype);
+      const OverrideMaps&         overridecoll = override_maps.at(partype);
+      const MapCollection<MTget>& mapcoll      = getter_maps.at(partype);
       FptrFinder<Spec<DerivedSpec>,MapTag::Get> finder =
                        SetMaps<Spec<DerivedSpec>,MapTag::Get>(Par::toString.at(partype),this)
                               .omap0(  overridecoll.m0 )
@@ -109,7 +112,7 @@ namespace Gambit {
       /* Before trying to set parameter, check if there is an override defined
          for it, so that we can warn people that the value they are trying to
          set will be masked by the override */
-      const OverrideMaps overridecoll = override_maps.at(partype);
+      const OverrideMaps& overridecoll = override_maps.at(partype);
       FptrFinder<Spec<DerivedSpec>,MapTag::Set> override_finder =
                        SetMaps<Spec<DerivedSpec>,MapTag::Set>(Par::toString.at(partype),this)
                               .omap0( overridecoll.m0 )
@@ -125,7 +128,7 @@ namespace Gambit {
       // else no problem
 
       /* Create finder object, tell it what maps to search, and do the search */
-      const MapCollection<MTset> mapcoll = setter_maps.at(partype);
+      const MapCollection<MTset>& mapcoll = setter_maps.at(partype);
       FptrFinder<Spec<DerivedSpec>,MapTag::Set> finder =
                        SetMaps<Spec<DerivedSpec>,MapTag::Set>(Par::toString.at(partype),this)
                               .map0(  mapcoll.map0 )
@@ -153,8 +156,8 @@ namespace Gambit {
       else if(check_overrides == ignore_overrides){overrides=false; override_only=false;}
 
       /* Create finder object, tell it what maps to search, and do the search */
-      const OverrideMaps         overridecoll = override_maps.at(partype);
-      const MapCollection<MTget> mapcoll      = getter_maps.at(partype);
+      const OverrideMaps&         overridecoll = override_maps.at(partype);
+      const MapCollection<MTget>& mapcoll      = getter_maps.at(partype);
       FptrFinder<Spec<DerivedSpec>,MapTag::Get> finder =
                        SetMaps<Spec<DerivedSpec>,MapTag::Get>(Par::toString.at(partype),this)
                               .omap0( overridecoll.m0 )
@@ -184,8 +187,8 @@ namespace Gambit {
       else if(check_overrides == ignore_overrides){overrides=false; override_only=false;}
 
       /* Create finder object, tell it what maps to search, and do the search */
-      const OverrideMaps         overridecoll = override_maps.at(partype);
-      const MapCollection<MTget> mapcoll      = getter_maps.at(partype);
+      const OverrideMaps&         overridecoll = override_maps.at(partype);
+      const MapCollection<MTget>& mapcoll      = getter_maps.at(partype);
       FptrFinder<Spec<DerivedSpec>,MapTag::Get> finder =
                        SetMaps<Spec<DerivedSpec>,MapTag::Get>(Par::toString.at(partype),this)
                               .omap0( overridecoll.m0 )
@@ -213,7 +216,7 @@ namespace Gambit {
       /* Before trying to set parameter, check if there is an override defined
          for it, so that we can warn people that the value they are trying to
          set will be masked by the override */
-      const OverrideMaps overridecoll = override_maps.at(partype);
+      const OverrideMaps& overridecoll = override_maps.at(partype);
       FptrFinder<Spec<DerivedSpec>,MapTag::Set> override_finder =
                        SetMaps<Spec<DerivedSpec>,MapTag::Set>(Par::toString.at(partype),this)
                               .omap0( overridecoll.m0 )
@@ -229,7 +232,7 @@ namespace Gambit {
       // else no problem
 
       /* Create finder object, tell it what maps to search, and do the search */
-      const MapCollection<MTset> mapcoll = setter_maps.at(partype);
+      const MapCollection<MTset>& mapcoll = setter_maps.at(partype);
       FptrFinder<Spec<DerivedSpec>,MapTag::Set> finder =
                        SetMaps<Spec<DerivedSpec>,MapTag::Set>(Par::toString.at(partype),this)
                               .map0(  mapcoll.map0 )
@@ -259,8 +262,8 @@ namespace Gambit {
       else if(check_overrides == ignore_overrides){overrides=false; override_only=false;}
 
       /* Create finder object, tell it what maps to search, and do the search */
-      const OverrideMaps         overridecoll = override_maps.at(partype);
-      const MapCollection<MTget> mapcoll      = getter_maps.at(partype);
+      const OverrideMaps&         overridecoll = override_maps.at(partype);
+      const MapCollection<MTget>& mapcoll      = getter_maps.at(partype);
       FptrFinder<Spec<DerivedSpec>,MapTag::Get> finder =
                        SetMaps<Spec<DerivedSpec>,MapTag::Get>(Par::toString.at(partype),this)
                               .omap2( overridecoll.m2 )
@@ -285,8 +288,8 @@ namespace Gambit {
       else if(check_overrides == ignore_overrides){overrides=false; override_only=false;}
 
       /* Create finder object, tell it what maps to search, and do the search */
-      const OverrideMaps         overridecoll = override_maps.at(partype);
-      const MapCollection<MTget> mapcoll      = getter_maps.at(partype);
+      const OverrideMaps&         overridecoll = override_maps.at(partype);
+      const MapCollection<MTget>& mapcoll      = getter_maps.at(partype);
       FptrFinder<Spec<DerivedSpec>,MapTag::Get> finder =
                        SetMaps<Spec<DerivedSpec>,MapTag::Get>(Par::toString.at(partype),this)
                               .omap2( overridecoll.m2 )
@@ -307,7 +310,7 @@ namespace Gambit {
       typedef typename DerivedSpec::MTset MTset;
 
       /* Create finder object, tell it what maps to search, and do the search */
-      const MapCollection<MTset> mapcoll = setter_maps.at(partype);
+      const MapCollection<MTset>& mapcoll = setter_maps.at(partype);
       FptrFinder<Spec<DerivedSpec>,MapTag::Set> finder =
                        SetMaps<Spec<DerivedSpec>,MapTag::Set>(Par::toString.at(partype),this)
                               .map2(  mapcoll.map2 )
@@ -320,6 +323,86 @@ namespace Gambit {
 
    /// @}
 
+   /// @{ Resolved parameter access
+
+   /// Getter found by a SpecHandle in the getter maps of a wrapper class
+   template <class DerivedSpec>
+   class ResolvedGetter : public SpecHandleGetter
+   {
+      public:
+         ResolvedGetter(const SetMaps<Spec<DerivedSpec>,MapTag::Get>& params) : finder(params) {}
+
+         /// Not copyable, as the finder refers to itself
+         ResolvedGetter(const ResolvedGetter&) = delete;
+         ResolvedGetter& operator=(const ResolvedGetter&) = delete;
+
+         double operator()(const SubSpectrum& spec) const
+         {
+            return finder.callfcn(static_cast<const Spec<DerivedSpec>*>(&spec));
+         }
+
+         /// Only the search result is used; the spectrum it searched from is not kept
+         FptrFinder<Spec<DerivedSpec>,MapTag::Get> finder;
+   };
+
+   template <class DerivedSpec>
+   std::shared_ptr<const SpecHandleGetter> Spec<DerivedSpec>::resolve_getter(const SpecHandle& h) const
+   {
+      const MapCollection<MTget>& mapcoll = getter_maps.at(h.tag());
+      std::shared_ptr<ResolvedGetter<DerivedSpec>> getter = std::make_shared<ResolvedGetter<DerivedSpec>>(
+                       SetMaps<Spec<DerivedSpec>,MapTag::Get>(Par::toString.at(h.tag()),this)
+                              .map0(  mapcoll.map0 )
+                              .map1(  mapcoll.map1 )
+                              .map2(  mapcoll.map2 )
+                              .map0W( mapcoll.map0W )
+                              .map1W( mapcoll.map1W )
+                              .map2W( mapcoll.map2W )
+                              .map0M( mapcoll.map0_extraM )
+                              .map1M( mapcoll.map1_extraM )
+                              .map2M( mapcoll.map2_extraM )
+                              .map0I( mapcoll.map0_extraI )
+                              .map1I( mapcoll.map1_extraI )
+                              .map2I( mapcoll.map2_extraI )
+                              .no_overrides(true));
+      bool found;
+      switch(h.nindices())
+      {
+         case 0:  found = getter->finder.find(h.name(),true,SafeBool(h.check_antiparticle())); break;
+         case 1:  found = getter->finder.find(h.name(),h.index1(),true,SafeBool(h.check_antiparticle())); break;
+         default: found = getter->finder.find(h.name(),h.index1(),h.index2());
+      }
+      if(found) return getter;
+      return nullptr;
+   }
+
+   template <class DerivedSpec>
+   std::vector<SpecHandle> Spec<DerivedSpec>::resolve_all(const SpecOverrideOptions check_overrides) const
+   {
+      std::vector<SpecHandle> handles;
+      const std::vector<SpectrumParameter> parameters = Contents().all_parameters();
+      for(std::vector<SpectrumParameter>::const_iterator it = parameters.begin(); it != parameters.end(); ++it)
+      {
+         const std::vector<int> shape = it->shape();
+         if(shape.size()==1 and shape[0]==1)
+         {
+            handles.push_back(this->resolve(it->tag(), it->name(), check_overrides));
+         }
+         else if(shape.size()==1)
+         {
+            for(int i = 1; i<=shape[0]; ++i) handles.push_back(this->resolve(it->tag(), it->name(), i, check_overrides));
+         }
+         else if(shape.size()==2)
+         {
+            for(int i = 1; i<=shape[0]; ++i)
+               for(int j = 1; j<=shape[1]; ++j)
+                  handles.push_back(this->resolve(it->tag(), it->name(), i, j, check_overrides));
+         }
+      }
+      return handles;
+   }
+
+   /// @}
+
    /// @}
 
 }
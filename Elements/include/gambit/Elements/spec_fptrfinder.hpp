@@ -15,6 +15,9 @@
 ///          (benjamin.farmer@fysik.su.se)
 ///  \date 2015 Jul
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #ifndef __SpecFptrFinder_hpp__
@@ -788,12 +791,19 @@ namespace Gambit {
       {}
 
       double operator()()
+      {
+         return (*this)(ff->const_fakethis);
+      }
+
+      /// Call the function found on another host object of the same type
+      /// (only valid for results from the wrapper maps, which are shared by all hosts)
+      double operator()(const HostSpec* host) const
       {
          double result(-1); // should not be returned in this state
          if(ff->error_code==0)
          {
-            const Model& model = ff->const_fakethis->model();
-            const Input& input = ff->const_fakethis->input();
+            const Model& model = host->model();
+            const Input& input = host->input();
             switch( ff->whichiter )
             {
                // Override retrieval cases
@@ -871,17 +881,17 @@ namespace Gambit {
                  ff->check(ff->it0W_safe());
                  typename MT::FSptrW f = ff->it0W->second;
                  // These are member functions of DerivedSpec, but "HostSpec"
-                 // (and therefore the fakethis pointers) is going to be of
+                 // (and therefore the host pointer) is going to be of
                  // type Spec<DerivedSpec>. Therefore need to cast to the
                  // derived type to call the function.
-                 const DerivedSpec* wrapper = static_cast<const DerivedSpec*>(ff->const_fakethis);
+                 const DerivedSpec* wrapper = static_cast<const DerivedSpec*>(host);
                  result = (wrapper->*f)();
                  break;}
                case 13: {
                  ff->check(ff->it1W_safe());
                  ff->check_index_initd(LOCAL_INFO,ff->index1,"index1");
                  typename MT::FSptr1W f = ff->it1W->second.fptr;
-                 const DerivedSpec* wrapper = static_cast<const DerivedSpec*>(ff->const_fakethis);
+                 const DerivedSpec* wrapper = static_cast<const DerivedSpec*>(host);
                  result = (wrapper->*f)(ff->index1);
                  break;}
                case 14: {
@@ -889,7 +899,7 @@ namespace Gambit {
                  ff->check_index_initd(LOCAL_INFO,ff->index1,"index1");
                  ff->check_index_initd(LOCAL_INFO,ff->index2,"index2");
                  typename MT::FSptr2W f = ff->it2W->second.fptr;
-                 const DerivedSpec* wrapper = static_cast<const DerivedSpec*>(ff->const_fakethis);
+                 const DerivedSpec* wrapper = static_cast<const DerivedSpec*>(host);
                  result = (wrapper->*f)(ff->index1,ff->index2);
                  break;}
               default:{
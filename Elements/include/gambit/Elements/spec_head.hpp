@@ -20,6 +20,9 @@
 ///          (benjamin.farmer@fysik.su.se)
 ///  \date 2014, 2015 Jan - Jul
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #ifndef __spec_hpp__
@@ -72,6 +75,7 @@ namespace Gambit
    template<class,class> class SetMaps;
    template<class,class> class FptrFinder;  
    template<class,class> class CallFcn; 
+   template<class> class ResolvedGetter;
 
    /// Simpler helper class to run the verify_contents function only
    /// once, the first time a particular wrapper class is constructed.
@@ -119,6 +123,10 @@ namespace Gambit
          bool   has(const Par::Tags, const str&, const int, const int, const SpecOverrideOptions=use_overrides) const;
          double get(const Par::Tags, const str&, const int, const int, const SpecOverrideOptions=use_overrides) const;
 
+         /* The other getters and checkers of the base class (PDG codes, resolved handles), otherwise hidden by these */
+         using SubSpectrum::has;
+         using SubSpectrum::get;
+
          /* Setter declarations, for setting parameters in a derived model object,
             and for overriding model object values with values stored outside
             the model object (for when values cannot be inserted back into the
@@ -128,6 +136,9 @@ namespace Gambit
          void set(const Par::Tags, const double, const str&, const int, const SafeBool=SafeBool(true));
          void set(const Par::Tags, const double, const str&, const int, const int);
 
+         /// Handles to all parameters listed in the Contents class
+         std::vector<SpecHandle> resolve_all(const SpecOverrideOptions=use_overrides) const;
+
          /// @{ Default (empty) map filler functions
          /// Override as needed in derived classes
          static const std::map<Par::Tags,MapCollection<MTget>> fill_getter_maps()
@@ -146,6 +157,13 @@ namespace Gambit
          static int index_offset() { return 0; } 
 
 
+      protected:
+         /// The static getter maps identify the wrapper class for SpecHandles
+         const void* wrapper_id() const { return &getter_maps; }
+
+         /// Find the getter of a SpecHandle in the getter maps
+         std::shared_ptr<const SpecHandleGetter> resolve_getter(const SpecHandle&) const;
+
       private:
          /// Function to retrieve the possibly overridden index offset from the derived class via CRTP
          static int get_index_offset() { return D::index_offset(); }
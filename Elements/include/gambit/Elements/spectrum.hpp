@@ -32,6 +32,9 @@
 ///          (a.m.b.krislock@fys.uio.no)
 ///  \date 2016 Feb
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #ifndef __Spectrum_hpp__
@@ -223,6 +226,17 @@ namespace Gambit
          double safeget(const Par::Tags partype, const std::pair<str,int> shortpr) const;
          /// @}
 
+         /// @{ Resolved pole mass getters
+         /// Handles resolved for both hosted SubSpectrum objects (see SubSpectrum::resolve),
+         /// with the same HE-then-LE priority as the getters above.
+         SpecHandle resolve(const Par::Tags partype, const std::string& mass) const;
+         SpecHandle resolve(const Par::Tags partype, const std::string& mass, const int index) const;
+         SpecHandle resolve(const Par::Tags partype, const std::string& mass, const int index1, const int index2) const;
+         SpecHandle resolve(const Par::Tags partype, const int pdg_code, const int context) const;
+         bool   has(const SpecHandle&) const;
+         double get(const SpecHandle&) const;
+         /// @}
+
          /// @}
 
          /// SLHAea object getter
@@ -255,6 +269,15 @@ namespace Gambit
          /// @}
    };
 
+   /// Pole mass of the particle with a fixed PDG code, from a handle resolved on first use.
+   /// Spectra of other wrapper classes fall back to the string-based search.
+   template <int pdg_code, int context = 0>
+   double pole_mass(const Spectrum& spec)
+   {
+      static const SpecHandle h = spec.resolve(Par::Pole_Mass, pdg_code, context);
+      return spec.get(h);
+   }
+
 } // end namespace Gambit
 
 
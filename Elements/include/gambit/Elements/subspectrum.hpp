@@ -21,6 +21,9 @@
 ///          (a.m.b.krislock@fys.uio.no)
 ///  \date 2016 Feb
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #ifndef __subspectrum_hpp__
@@ -29,6 +32,7 @@
 #include <map>
 #include <set>
 #include <cfloat>
+#include <memory>
 #include <sstream>
 
 #include "gambit/Utils/cats.hpp"
@@ -81,6 +85,70 @@ namespace Gambit
 
 
 
+   /// Base class of the wrapper-specific part of a SpecHandle, i.e. a getter
+   /// function found in the (static) function pointer maps of one wrapper class.
+   class SpecHandleGetter
+   {
+      public:
+         virtual ~SpecHandleGetter() {}
+         /// Call the getter on a SubSpectrum of the wrapper class it was found for
+         virtual double operator()(const SubSpectrum&) const = 0;
+   };
+
+   /// Handle to a SubSpectrum parameter, resolved once by SubSpectrum::resolve.
+   /// Retrieving a parameter through a handle skips the string searches of the
+   /// function pointer maps and the particle database.  The function pointer
+   /// maps are the same for all objects of a wrapper class, so a handle stays
+   /// valid for every spectrum of the wrapper class(es) it was resolved for (e.g.
+   /// the new spectrum of each point); for other spectra it falls back to the
+   /// usual string-based retrieval.  Override values are still checked on each
+   /// retrieval, by looking up the override entries that the search would hit.
+   class SpecHandle
+   {
+      public:
+         SpecHandle(const Par::Tags tag, const str& name, const int nindices, const int i, const int j,
+                    const SpecOverrideOptions check_overrides, const bool check_antiparticle)
+          : my_tag(tag), my_name(name), my_nindices(nindices), my_i(i), my_j(j)
+          , my_check_overrides(check_overrides), my_check_antiparticle(check_antiparticle)
+         {}
+
+         /// @{ Parameter retrieved through this handle
+         Par::Tags  tag()      const { return my_tag; }
+         const str& name()     const { return my_name; }
+         int        nindices() const { return my_nindices; }
+         int        index1()   const { return my_i; }
+         int        index2()   const { return my_j; }
+         SpecOverrideOptions check_overrides() const { return my_check_overrides; }
+         bool check_antiparticle() const { return my_check_antiparticle; }
+         /// @}
+
+      private:
+         friend class SubSpectrum;
+
+         Par::Tags my_tag;
+         str my_name;
+         int my_nindices;
+         int my_i;
+         int my_j;
+         SpecOverrideOptions my_check_overrides;
+         bool my_check_antiparticle;
+
+         /// Override map entry that hides the wrapper value if it exists
+         struct OverrideKey
+         {
+            int nindices;
+            str name;
+            int i;
+            int j;
+         };
+         /// Override entries to check, in the order that the string-based search checks them
+         std::vector<OverrideKey> override_keys;
+
+         /// Getters found for each wrapper class this handle was resolved for
+         /// (NULL if the wrapper class does not provide the parameter)
+         std::vector<std::pair<const void*, std::shared_ptr<const SpecHandleGetter>>> getters;
+   };
+
    /// Virtual base class for interacting with spectrum generator output
    // Includes facilities for running RGEs
    // This is the interface class that most module-writers see
@@ -252,6 +320,31 @@ namespace Gambit
 
          /// TODO: extra PDB overloads to handle all the one and two index cases (well all the ones that are feasible...)
 
+         /// @{ Resolved parameter access
+
+         /* Resolve a parameter lookup once, for fast repeated retrieval with get(SpecHandle) (same
+            arguments and search rules as the corresponding getters). Resolving a parameter that
+            does not exist is not an error; has(SpecHandle) is then false and get(SpecHandle)
+            raises the usual error. */
+         SpecHandle resolve(const Par::Tags, const str&, const SpecOverrideOptions=use_overrides, const SafeBool check_antiparticle = SafeBool(true)) const;
+         SpecHandle resolve(const Par::Tags, const str&, const int, const SpecOverrideOptions=use_overrides, const SafeBool check_antiparticle = SafeBool(true)) const;
+         SpecHandle resolve(const Par::Tags, const str&, const int, const int, const SpecOverrideOptions=use_overrides) const;
+
+         /// Also resolve an existing handle for the wrapper class of this object
+         void resolve(SpecHandle&) const;
+
+         /// Handles to all parameters of the Contents class of the wrapper (vector and matrix
+         /// parameters are expanded into one handle per entry)
+         virtual std::vector<SpecHandle> resolve_all(const SpecOverrideOptions=use_overrides) const { vfcn_error(LOCAL_INFO); return std::vector<SpecHandle>(); }
+
+         bool   has(const SpecHandle&) const;
+         double get(const SpecHandle&) const;
+
+         /// Retrieve many parameters at once into a flat array, in the order of the handles
+         void snapshot(const std::vector<SpecHandle>&, std::vector<double>&) const;
+
+         /// @}
+
 
          /// PDG code translation map, for special cases where an SLHA file has been read in and the PDG codes changed.
          virtual const std::map<int, int>& PDG_translator() const { return empty_map; }
@@ -263,7 +356,19 @@ namespace Gambit
          /// Initialiser function for override_maps
          static std::map<Par::Tags,OverrideMaps> create_override_maps();
 
+         /// Look up the override entries of a handle; true if one exists
+         bool find_override(const SpecHandle&, double&) const;
+
+         /// Getter of a handle for the wrapper class of this object; false if not yet resolved for it
+         bool find_getter(const SpecHandle&, const SpecHandleGetter*&) const;
+
      protected:
+         /// Identifier of the wrapper class, shared by all of its objects (NULL if none)
+         virtual const void* wrapper_id() const { return NULL; }
+
+         /// Find the getter of a handle in the function pointer maps of the wrapper class (NULL if absent)
+         virtual std::shared_ptr<const SpecHandleGetter> resolve_getter(const SpecHandle&) const { return nullptr; }
+
          /// Map of override maps
          std::map<Par::Tags,OverrideMaps> override_maps;
 
@@ -12,9 +12,14 @@
 ///          (patscott@physics.mcgill.ca)
 ///  \date 2015 Jan
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
+#include <algorithm>
 #include <fstream>
+#include <mutex>
 
 #include "gambit/Elements/decay_table.hpp"
 #include "gambit/Elements/mssm_slhahelp.hpp"
@@ -55,6 +60,92 @@ namespace Gambit
   }
 
 
+  // DecayTable::Channel methods
+
+  /// Intern a set of final state particles
+  DecayTable::Channel::Channel(const key_type& key)
+  {
+    // Registry of all channels seen so far; map keys never move, so channels can point to them.
+    static std::mutex registry_mutex;
+    static std::map<key_type, int> registry;
+    // Channels this thread has already interned.  After the first few points every channel is
+    // found here, so building decay tables does not take the registry lock.
+    thread_local std::map<key_type, std::pair<int, const key_type*> > seen;
+    auto known = seen.find(key);
+    if (known == seen.end())
+    {
+      std::lock_guard<std::mutex> lock(registry_mutex);
+      auto it = registry.find(key);
+      if (it == registry.end()) it = registry.emplace(key, int(registry.size())).first;
+      known = seen.emplace(key, std::make_pair(it->second, &it->first)).first;
+    }
+    my_id = known->second.first;
+    my_key = known->second.second;
+  }
+
+
+  // DecayTable::ChannelList methods
+
+  DecayTable::ChannelList::iterator DecayTable::ChannelList::find(const Channel& channel)
+  {
+    return std::find_if(data.begin(), data.end(), [&](const value_type& v) { return v.first == channel; });
+  }
+
+  DecayTable::ChannelList::const_iterator DecayTable::ChannelList::find(const Channel& channel) const
+  {
+    return std::find_if(data.begin(), data.end(), [&](const value_type& v) { return v.first == channel; });
+  }
+
+  DecayTable::ChannelList::iterator DecayTable::ChannelList::find(const Channel::key_type& key)
+  {
+    iterator it = std::lower_bound(data.begin(), data.end(), key, [](const value_type& v, const Channel::key_type& k) { return v.first.particles() < k; });
+    return (it != data.end() and it->first.particles() == key) ? it : data.end();
+  }
+
+  DecayTable::ChannelList::const_iterator DecayTable::ChannelList::find(const Channel::key_type& key) const
+  {
+    const_iterator it = std::lower_bound(data.begin(), data.end(), key, [](const value_type& v, const Channel::key_type& k) { return v.first.particles() < k; });
+    return (it != data.end() and it->first.particles() == key) ? it : data.end();
+  }
+
+  std::pair<double, double>& DecayTable::ChannelList::at(const Channel& channel)
+  {
+    iterator it = find(channel);
+    if (it == data.end()) throw std::out_of_range("DecayTable::ChannelList::at");
+    return it->second;
+  }
+
+  const std::pair<double, double>& DecayTable::ChannelList::at(const Channel& channel) const
+  {
+    const_iterator it = find(channel);
+    if (it == data.end()) throw std::out_of_range("DecayTable::ChannelList::at");
+    return it->second;
+  }
+
+  std::pair<double, double>& DecayTable::ChannelList::at(const Channel::key_type& key)
+  {
+    iterator it = find(key);
+    if (it == data.end()) throw std::out_of_range("DecayTable::ChannelList::at");
+    return it->second;
+  }
+
+  const std::pair<double, double>& DecayTable::ChannelList::at(const Channel::key_type& key) const
+  {
+    const_iterator it = find(key);
+    if (it == data.end()) throw std::out_of_range("DecayTable::ChannelList::at");
+    return it->second;
+  }
+
+  std::pair<double, double>& DecayTable::ChannelList::operator[](const Channel& channel)
+  {
+    iterator it = find(channel);
+    if (it != data.end()) return it->second;
+    // Insert new channels in the order of their final states
+    it = std::lower_bound(data.begin(), data.end(), channel, [](const value_type& v, const Channel& c) { return v.first < c; });
+    return data.insert(it, value_type(channel, std::pair<double, double>(0.0, 0.0)))->second;
+  }
+
+
   // DecayTable methods
 
   /// Create a DecayTable from an SLHA file
@@ -285,7 +376,7 @@ namespace Gambit
   }
 
   /// Make sure all particles listed in a set are actually known to the GAMBIT particle database
-  void DecayTable::Entry::check_particles_exist(std::multiset< std::pair<int,int> >& particles) const
+  void DecayTable::Entry::check_particles_exist(const Channel::key_type& particles) const
   {
     for (auto final_state = particles.begin(); final_state != particles.end(); ++final_state)
     {
@@ -301,7 +392,7 @@ namespace Gambit
   }
 
   /// Make sure no NaNs have been passed to the DecayTable by nefarious backends
-  void DecayTable::Entry::check_BF_validity(double BF, double error, std::multiset< std::pair<int,int> >& key) const
+  void DecayTable::Entry::check_BF_validity(double BF, double error, const Channel::key_type& key) const
   {
     if (Utils::isnan(BF) or Utils::isnan(error))
     {
@@ -319,46 +410,63 @@ namespace Gambit
     }
   }
 
+  /// Raise an error for a channel that is not in this entry
+  void DecayTable::Entry::missing_channel_error(const Channel::key_type& key) const
+  {
+    std::ostringstream err;
+    err << "No branching fraction exists for the requested final states:";
+    for (auto particle = key.begin(); particle != key.end(); ++particle)
+    {
+      err << " {" << particle->first << ", " << particle->second << "}";
+    }
+    model_error().raise(LOCAL_INFO,err.str());
+  }
+
   /// Set branching fraction for decay to a given final state. 1. PDG-context integer pairs (vector)
   void DecayTable::Entry::set_BF(double BF, double error, const std::vector<std::pair<int,int> >& daughters)
   {
-    std::multiset< std::pair<int,int> > key(daughters.begin(), daughters.end());
-    check_particles_exist(key);
-    check_BF_validity(BF, error, key);
-    channels[key] = std::pair<double, double>(BF, error);
+    Channel channel(Channel::key_type(daughters.begin(), daughters.end()));
+    check_particles_exist(channel);
+    set_BF(BF, error, channel);
   }
 
   /// Set branching fraction for decay to a given final state. 2. full particle names (vector)
   void DecayTable::Entry::set_BF(double BF, double error, const std::vector<str>& daughters)
   {
-    std::multiset< std::pair<int,int> > key;
+    Channel::key_type key;
     for (auto p = daughters.begin(); p != daughters.end(); ++p) key.insert(Models::ParticleDB().pdg_pair(*p));
     check_particles_exist(key);
-    check_BF_validity(BF, error, key);
-    channels[key] = std::pair<double, double>(BF, error);
+    set_BF(BF, error, Channel(key));
+  }
+
+  /// Set branching fraction for decay to a given final state. 6. interned Channel
+  void DecayTable::Entry::set_BF(double BF, double error, const Channel& channel)
+  {
+    check_BF_validity(BF, error, channel);
+    channels[channel] = std::pair<double, double>(BF, error);
   }
 
   /// Check if a given final state exists in this DecayTable::Entry. 1. PDG-context integer pairs (vector)
   bool DecayTable::Entry::has_channel(const std::vector<std::pair<int,int> >& daughters) const
   {
-    std::multiset< std::pair<int,int> > key(daughters.begin(), daughters.end());
+    Channel::key_type key(daughters.begin(), daughters.end());
     check_particles_exist(key);
-    return channels.find(key) != channels.end();
+    return has_channel(key);
   }
 
   /// Check if a given final state exists in this DecayTable::Entry. 2. full particle names (vector)
   bool DecayTable::Entry::has_channel(const std::vector<str>& daughters) const
   {
-    std::multiset< std::pair<int,int> > key;
+    Channel::key_type key;
     for (auto p = daughters.begin(); p != daughters.end(); ++p) key.insert(Models::ParticleDB().pdg_pair(*p));
     check_particles_exist(key);
-    return channels.find(key) != channels.end();
+    return has_channel(key);
   }
 
   /// Retrieve branching fraction for decay to a given final state. 1. PDG-context integer pairs (vector)
   double DecayTable::Entry::BF(const std::vector<std::pair<int, int> >& daughters) const
   {
-    std::multiset< std::pair<int,int> > key(daughters.begin(), daughters.end());
+    Channel::key_type key(daughters.begin(), daughters.end());
     check_particles_exist(key);
     return channels.at(key).first;
   }
@@ -366,7 +474,7 @@ namespace Gambit
   /// Retrieve branching fraction for decay to a given final state. 2. full particle names (vector)
   double DecayTable::Entry::BF(const std::vector<str>& daughters) const
   {
-    std::multiset< std::pair<int,int> > key;
+    Channel::key_type key;
     for (auto p = daughters.begin(); p != daughters.end(); ++p) key.insert(Models::ParticleDB().pdg_pair(*p));
     check_particles_exist(key);
     return channels.at(key).first;
@@ -0,0 +1,257 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Profiler for module and backend functors.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+#include <sys/resource.h>
+#include <omp.h>
+
+#include "gambit/Elements/functor_profiler.hpp"
+#include "gambit/Elements/functors.hpp"
+#include "gambit/Logs/logger.hpp"
+
+namespace Gambit
+{
+
+  bool functor_profiler::active = false;
+
+  /// Get the high-water mark of the resident memory of this process, in kB
+  static long current_max_rss_kb()
+  {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    #ifdef __APPLE__
+      return usage.ru_maxrss/1024; // bytes on macOS
+    #else
+      return usage.ru_maxrss;
+    #endif
+  }
+
+  /// Switch on profiling
+  void functor_profiler::enable(const str& output_prefix, long long max_trace_events, int mpirank)
+  {
+    // Like the logger, keep separate records for as many threads as OpenMP allows.
+    threads.assign(omp_get_max_threads(), thread_data());
+    origin = clock::now();
+    prefix = output_prefix;
+    max_events = max_trace_events;
+    n_events = 0;
+    memory.clear();
+    n_points = 0;
+    rank = mpirank;
+    active = true;
+    logger() << LogTags::core << "Profiling of module and backend functors switched on. Profiles will be written to "
+             << prefix << "*." << EOM;
+  }
+
+  /// Get the current thread's data
+  functor_profiler::thread_data* functor_profiler::this_thread()
+  {
+    size_t thread = omp_get_thread_num();
+    return (thread < threads.size() ? &threads[thread] : NULL);
+  }
+
+  /// Record the start of a call to a functor on the current thread
+  void functor_profiler::enter(const functor* f, bool is_backend)
+  {
+    thread_data* t = this_thread();
+    if (t == NULL) return;
+    int parent = (t->stack.empty() ? -1 : t->stack.back().node);
+    std::map<const functor*, int>& siblings = (parent >= 0 ? t->nodes[parent].children : t->roots);
+    auto it = siblings.find(f);
+    int index;
+    if (it != siblings.end()) index = it->second;
+    else
+    {
+      // First call of f along this call path
+      index = t->nodes.size();
+      siblings[f] = index;
+      node n;
+      n.f = f;
+      n.is_backend = is_backend;
+      n.parent = parent;
+      t->nodes.push_back(n);
+    }
+    t->stack.push_back({index, clock::now(), 0.0});
+  }
+
+  /// Record the end of a call to a functor on the current thread
+  void functor_profiler::leave(const functor* f)
+  {
+    thread_data* t = this_thread();
+    if (t == NULL) return;
+    clock::time_point now = clock::now();
+    // Close any calls left open by an exception, up to and including the call to f.
+    while (not t->stack.empty())
+    {
+      frame fr = t->stack.back();
+      t->stack.pop_back();
+      node& n = t->nodes[fr.node];
+      double duration = std::chrono::duration<double>(now - fr.start).count();
+      n.inclusive += duration;
+      n.exclusive += duration - fr.child_time;
+      n.calls++;
+      if (not t->stack.empty()) t->stack.back().child_time += duration;
+      long long count;
+      #pragma omp atomic capture
+      count = ++n_events;
+      if (count <= max_events)
+      {
+        t->events.push_back({fr.node, 1e6*std::chrono::duration<double>(fr.start - origin).count(), 1e6*duration});
+      }
+      if (n.f == f) break;
+    }
+  }
+
+  /// Record that a functor has invalidated the current point
+  void functor_profiler::invalidation(const functor* f)
+  {
+    thread_data* t = this_thread();
+    if (t == NULL) return;
+    for (auto fr = t->stack.rbegin(); fr != t->stack.rend(); ++fr)
+    {
+      if (t->nodes[fr->node].f == f)
+      {
+        t->nodes[fr->node].invalidations++;
+        return;
+      }
+    }
+  }
+
+  /// Record the end of a parameter point.  getrusage only knows the high-water mark of the
+  /// whole process, so memory is sampled here rather than attributed to individual functors.
+  void functor_profiler::point_done()
+  {
+    #pragma omp critical (functor_profiler_point_done)
+    {
+      n_points++;
+      if ((long long)memory.size() < max_events)
+      {
+        memory.push_back({1e6*std::chrono::duration<double>(clock::now() - origin).count(), current_max_rss_kb()});
+      }
+    }
+  }
+
+  /// Get the label of a call path node
+  str functor_profiler::label(const node& n)
+  {
+    if (n.is_backend) return n.f->origin() + "_" + n.f->version() + "::" + n.f->name();
+    return n.f->origin() + "::" + n.f->name();
+  }
+
+  /// Full call path of a node, separated by semicolons
+  str functor_profiler::path(const thread_data& t, int index)
+  {
+    str result = label(t.nodes[index]);
+    for (int i = t.nodes[index].parent; i >= 0; i = t.nodes[i].parent) result = label(t.nodes[i]) + ";" + result;
+    return result;
+  }
+
+  /// Write out the profile
+  void functor_profiler::write()
+  {
+    if (not active) return;
+    const str stem = prefix + "profile_rank" + std::to_string(rank);
+
+    // Collapsed stacks, one line per call path and thread, weighted by exclusive time in microseconds.
+    std::ofstream folded(stem + ".folded");
+    for (size_t thread = 0; thread < threads.size(); ++thread)
+    {
+      const thread_data& t = threads[thread];
+      for (size_t i = 0; i < t.nodes.size(); ++i)
+      {
+        folded << "rank_" << rank << ";thread_" << thread << ";" << path(t, i) << " "
+               << (long long)(1e6*t.nodes[i].exclusive) << std::endl;
+      }
+    }
+
+    // Chrome trace of individual calls (see chrome://tracing or https://ui.perfetto.dev)
+    std::ofstream trace(stem + ".trace.json");
+    trace << std::fixed << std::setprecision(3) << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+    bool first = true;
+    for (size_t thread = 0; thread < threads.size(); ++thread)
+    {
+      const thread_data& t = threads[thread];
+      for (const trace_event& e : t.events)
+      {
+        const node& n = t.nodes[e.node];
+        trace << (first ? "" : ",") << std::endl << "  {\"name\": \"" << label(n) << "\", \"cat\": \""
+              << (n.is_backend ? "backend" : "module") << "\", \"ph\": \"X\", \"ts\": " << e.start_us
+              << ", \"dur\": " << e.duration_us << ", \"pid\": " << rank << ", \"tid\": " << thread << "}";
+        first = false;
+      }
+    }
+    for (const memory_sample& m : memory)
+    {
+      trace << (first ? "" : ",") << std::endl << "  {\"name\": \"process peak RSS\", \"ph\": \"C\", \"ts\": " << m.time_us
+            << ", \"pid\": " << rank << ", \"args\": {\"MB\": " << m.max_rss_kb/1024.0 << "}}";
+      first = false;
+    }
+    trace << std::endl << "]}" << std::endl;
+
+    // Summary table of each functor on each thread, summed over all call paths.
+    struct totals { double inclusive = 0, exclusive = 0; long long calls = 0, invalidations = 0; };
+    std::ofstream summary(stem + ".txt");
+    summary << "# Profile of module and backend functors on MPI rank " << rank << std::endl
+            << "# Peak resident memory of the whole process (not per functor): " << current_max_rss_kb()/1024.0
+            << " MB after " << n_points << " points" << std::endl
+            << "#  thread    calls invalid  inclusive[s]  exclusive[s]  functor" << std::endl;
+    for (size_t thread = 0; thread < threads.size(); ++thread)
+    {
+      std::map<str, totals> per_functor;
+      for (const node& n : threads[thread].nodes)
+      {
+        totals& tot = per_functor[label(n)];
+        tot.inclusive += n.inclusive;
+        tot.exclusive += n.exclusive;
+        tot.calls += n.calls;
+        tot.invalidations += n.invalidations;
+      }
+      std::vector<std::pair<str, totals>> sorted(per_functor.begin(), per_functor.end());
+      std::sort(sorted.begin(), sorted.end(), [](const std::pair<str, totals>& a, const std::pair<str, totals>& b)
+       { return a.second.exclusive > b.second.exclusive; });
+      for (const auto& entry : sorted)
+      {
+        summary << std::setw(8) << thread << " " << std::setw(8) << entry.second.calls << " "
+                << std::setw(8) << entry.second.invalidations << " " << std::setw(13) << entry.second.inclusive << " "
+                << std::setw(13) << entry.second.exclusive << "  " << entry.first << std::endl;
+      }
+    }
+
+    logger() << LogTags::core << "Wrote profile of module and backend functors to " << stem << ".{folded,trace.json,txt}";
+    if (n_events > max_events) logger() << endl << "The trace is truncated to the first " << max_events << " calls.";
+    logger() << EOM;
+  }
+
+  /// Profiling scope for a single functor call
+  functor_profiler::scope::scope(const functor* f, bool is_backend) : myFunctor(functor_profiler::enabled() ? f : NULL)
+  {
+    if (myFunctor != NULL) profiler().enter(myFunctor, is_backend);
+  }
+
+  functor_profiler::scope::~scope()
+  {
+    if (myFunctor != NULL) profiler().leave(myFunctor);
+  }
+
+  /// Global profiler for module and backend functors
+  functor_profiler& profiler()
+  {
+    static functor_profiler global_profiler;
+    return global_profiler;
+  }
+
+}
@@ -77,7 +77,8 @@ namespace Gambit
      myStatus        (FunctorStatus::Model_incompatible),
      myVertexID      (-1),       // (Note: myVertexID = -1 is intended to mean that no vertexID has been assigned)
      myTimingVertexID(-1),       // Not actually a graph vertex; ID assigned by "get_main_param_id" function.
-     verbose         (false)     // For debugging.
+     verbose         (false),    // For debugging.
+     myThreadsafe    (false)     // Switched on by the dependency resolver for functions listed in concurrent_functions.
     {}
 
     /// Virtual calculate(); needs to be redefined in daughters.
@@ -106,6 +107,12 @@ namespace Gambit
     /// Acquire ID for timing 'vertex' (used in printer system)
     void functor::setTimingVertexID(int ID) { myTimingVertexID = ID; }
 
+    /// Setter for indicating whether the functor may be calculated concurrently with other functors
+    void functor::setThreadsafe(bool flag) { myThreadsafe = flag; }
+
+    /// Getter indicating whether the functor may be calculated concurrently with other functors
+    bool functor::isThreadsafe() const { return myThreadsafe; }
+
     /// Setter for status
     void functor::setStatus(FunctorStatus stat)
     {
@@ -831,6 +838,7 @@ namespace Gambit
       #pragma omp atomic
       pInvalidation += fadeRate*(1-FUNCTORS_BASE_INVALIDATION_RATE);
       if (f==NULL) f = this;
+      if (functor_profiler::enabled()) profiler().invalidation(f);
       #pragma omp critical (raised_point_exception)
       {
         e.set_thrower(f);
@@ -1796,6 +1804,7 @@ namespace Gambit
     /// Do pre-calculate timing things
     void module_functor_common::startTiming(int thread_num)
     {
+      if (functor_profiler::enabled()) profiler().enter(this);
       start[thread_num] = std::chrono::system_clock::now();
     }
 
@@ -1810,6 +1819,7 @@ namespace Gambit
         pInvalidation = pInvalidation*(1-fadeRate) + fadeRate*FUNCTORS_BASE_INVALIDATION_RATE;
       }
       needs_recalculating[thread_num] = false;
+      if (functor_profiler::enabled()) profiler().leave(this);
     }
 
   /// Class methods for actual module functors for TYPE=void.
@@ -32,6 +32,9 @@
 ///          (a.m.b.krislock@fys.uio.no)
 ///  \date 2016 Feb
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #include "gambit/Elements/spectrum.hpp"
@@ -424,6 +427,62 @@ namespace Gambit
 
    /// @}
 
+   /// @{ Resolved pole mass getters
+
+   SpecHandle Spectrum::resolve(const Par::Tags partype, const std::string& mass) const
+   {
+      SpecHandle h = HE->resolve(partype,mass);
+      LE->resolve(h);
+      return h;
+   }
+
+   SpecHandle Spectrum::resolve(const Par::Tags partype, const std::string& mass, const int index) const
+   {
+      SpecHandle h = HE->resolve(partype,mass,index);
+      LE->resolve(h);
+      return h;
+   }
+
+   SpecHandle Spectrum::resolve(const Par::Tags partype, const std::string& mass, const int index1, const int index2) const
+   {
+      SpecHandle h = HE->resolve(partype,mass,index1,index2);
+      LE->resolve(h);
+      return h;
+   }
+
+   /* Input PDG code plus context integer, translated as in get(partype, pdgpr) */
+   SpecHandle Spectrum::resolve(const Par::Tags partype, const int pdg_code, const int context) const
+   {
+      const std::pair<int,int> pdgpr(pdg_code,context);
+      if( Models::ParticleDB().has_short_name(pdgpr) )
+      {
+        const std::pair<str,int> p = Models::ParticleDB().short_name_pair(pdgpr);
+        return resolve(partype, p.first, p.second);
+      }
+      return resolve(partype, Models::ParticleDB().long_name(pdgpr));
+   }
+
+   bool Spectrum::has(const SpecHandle& h) const
+   {
+      return (HE->has(h) or LE->has(h));
+   }
+
+   double Spectrum::get(const SpecHandle& h) const
+   {
+      if( HE->has(h) ) return HE->get(h);
+      if( LE->has(h) ) return LE->get(h);
+      std::ostringstream errmsg;
+      errmsg << "Error retrieving particle spectrum data!" << std::endl;
+      errmsg << "No "<<Par::toString.at(h.tag())<<" with string reference '"<<h.name()<<"'";
+      if(h.nindices()>0) errmsg << " and indices '"<<h.index1()<<"'";
+      if(h.nindices()>1) errmsg << ",'"<<h.index2()<<"'";
+      errmsg << " could be found in either LE or HE SubSpectrum!" << std::endl;
+      utils_error().raise(LOCAL_INFO,errmsg.str());
+      return -1;
+   }
+
+   /// @}
+
    /// SLHAea object getter
    /// First constructs an SLHAea object from the SMINPUTS object, then adds the info from
    /// the LE subspectrum (if possible), followed by the HE subspectrum (if possible). Any duplicate
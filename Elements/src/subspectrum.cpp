@@ -21,6 +21,9 @@
 ///          (a.m.b.krislock@fys.uio.no)
 ///  \date 2016 Feb
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #include <fstream>
@@ -547,6 +550,158 @@ namespace Gambit
       this->set_override_vector(tag,value,params,indices,allow_new,decouple);
    }
 
+   /// @}
+
+   /// @{ Resolved parameter access
+
+   /* The override keys follow the order of the searches in FptrFinder::find */
+   SpecHandle SubSpectrum::resolve(const Par::Tags partype, const str& name, const SpecOverrideOptions check_overrides, const SafeBool check_antiparticle) const
+   {
+      SpecHandle h(partype, name, 0, -1, -1, check_overrides, bool(check_antiparticle));
+      if(not (check_overrides == ignore_overrides))
+      {
+         h.override_keys.push_back({0, name, -1, -1});
+         if(Models::ParticleDB().has_short_name(name))
+         {
+            std::pair<str,int> p = Models::ParticleDB().short_name_pair(name);
+            h.override_keys.push_back({1, p.first, p.second, -1});
+         }
+         if(check_antiparticle and Models::ParticleDB().has_particle(name) and Models::ParticleDB().has_antiparticle(name))
+         {
+            str antiname = Models::ParticleDB().get_antiparticle(name);
+            h.override_keys.push_back({0, antiname, -1, -1});
+            if(Models::ParticleDB().has_short_name(antiname))
+            {
+               std::pair<str,int> p = Models::ParticleDB().short_name_pair(antiname);
+               h.override_keys.push_back({1, p.first, p.second, -1});
+            }
+         }
+      }
+      resolve(h);
+      return h;
+   }
+
+   SpecHandle SubSpectrum::resolve(const Par::Tags partype, const str& name, const int i, const SpecOverrideOptions check_overrides, const SafeBool check_antiparticle) const
+   {
+      SpecHandle h(partype, name, 1, i, -1, check_overrides, bool(check_antiparticle));
+      if(not (check_overrides == ignore_overrides))
+      {
+         h.override_keys.push_back({1, name, i, -1});
+         if(Models::ParticleDB().has_particle(name,i)) h.override_keys.push_back({0, Models::ParticleDB().long_name(name,i), -1, -1});
+         if(check_antiparticle and Models::ParticleDB().has_particle(name,i) and Models::ParticleDB().has_antiparticle(name,i))
+         {
+            std::pair<str,int> p = Models::ParticleDB().get_antiparticle(name,i);
+            h.override_keys.push_back({1, p.first, p.second, -1});
+            if(Models::ParticleDB().has_particle(p.first,i)) h.override_keys.push_back({0, Models::ParticleDB().long_name(p.first,p.second), -1, -1});
+         }
+      }
+      resolve(h);
+      return h;
+   }
+
+   SpecHandle SubSpectrum::resolve(const Par::Tags partype, const str& name, const int i, const int j, const SpecOverrideOptions check_overrides) const
+   {
+      SpecHandle h(partype, name, 2, i, j, check_overrides, false);
+      if(not (check_overrides == ignore_overrides)) h.override_keys.push_back({2, name, i, j});
+      resolve(h);
+      return h;
+   }
+
+   /// Also resolve an existing handle for the wrapper class of this object
+   void SubSpectrum::resolve(SpecHandle& h) const
+   {
+      const SpecHandleGetter* getter;
+      if(h.check_overrides() == overrides_only or find_getter(h, getter)) return;
+      h.getters.push_back(std::make_pair(wrapper_id(), resolve_getter(h)));
+   }
+
+   bool SubSpectrum::has(const SpecHandle& h) const
+   {
+      double value;
+      if(not (h.check_overrides() == ignore_overrides) and find_override(h, value)) return true;
+      if(h.check_overrides() == overrides_only) return false;
+      const SpecHandleGetter* getter;
+      if(find_getter(h, getter)) return getter != NULL;
+      // Not resolved for this wrapper class; use the string-based search
+      switch(h.nindices())
+      {
+         case 0:  return has(h.tag(), h.name(), h.check_overrides(), SafeBool(h.check_antiparticle()));
+         case 1:  return has(h.tag(), h.name(), h.index1(), h.check_overrides(), SafeBool(h.check_antiparticle()));
+         default: return has(h.tag(), h.name(), h.index1(), h.index2(), h.check_overrides());
+      }
+   }
+
+   double SubSpectrum::get(const SpecHandle& h) const
+   {
+      double value;
+      if(not (h.check_overrides() == ignore_overrides) and find_override(h, value)) return value;
+      const SpecHandleGetter* getter;
+      if(not (h.check_overrides() == overrides_only) and find_getter(h, getter) and getter != NULL) return (*getter)(*this);
+      // Not resolved for this wrapper class, or not found; the string-based search raises the usual error
+      switch(h.nindices())
+      {
+         case 0:  return get(h.tag(), h.name(), h.check_overrides(), SafeBool(h.check_antiparticle()));
+         case 1:  return get(h.tag(), h.name(), h.index1(), h.check_overrides(), SafeBool(h.check_antiparticle()));
+         default: return get(h.tag(), h.name(), h.index1(), h.index2(), h.check_overrides());
+      }
+   }
+
+   /// Retrieve many parameters at once into a flat array, in the order of the handles
+   void SubSpectrum::snapshot(const std::vector<SpecHandle>& handles, std::vector<double>& values) const
+   {
+      values.resize(handles.size());
+      for(std::size_t k = 0; k < handles.size(); ++k) values[k] = get(handles[k]);
+   }
+
+   /// Look up the override entries of a handle; true if one exists
+   bool SubSpectrum::find_override(const SpecHandle& h, double& value) const
+   {
+      const OverrideMaps& om = override_maps.at(h.tag());
+      if(om.m0.empty() and om.m1.empty() and om.m2.empty()) return false;
+      for(const SpecHandle::OverrideKey& key : h.override_keys)
+      {
+         if(key.nindices == 0)
+         {
+            auto it = om.m0.find(key.name);
+            if(it != om.m0.end()) { value = it->second; return true; }
+         }
+         else if(key.nindices == 1)
+         {
+            auto it = om.m1.find(key.name);
+            if(it == om.m1.end()) continue;
+            auto jt = it->second.find(key.i);
+            if(jt != it->second.end()) { value = jt->second; return true; }
+         }
+         else
+         {
+            auto it = om.m2.find(key.name);
+            if(it == om.m2.end()) continue;
+            auto jt = it->second.find(key.i);
+            if(jt == it->second.end()) continue;
+            auto kt = jt->second.find(key.j);
+            if(kt != jt->second.end()) { value = kt->second; return true; }
+         }
+      }
+      return false;
+   }
+
+   /// Getter of a handle for the wrapper class of this object; false if not yet resolved for it
+   bool SubSpectrum::find_getter(const SpecHandle& h, const SpecHandleGetter*& getter) const
+   {
+      const void* id = wrapper_id();
+      for(const auto& entry : h.getters)
+      {
+         if(entry.first == id)
+         {
+            getter = entry.second.get();
+            return true;
+         }
+      }
+      return false;
+   }
+
+   /// @}
+
    void SubSpectrum::RunToScale(double scale, const int behave)
    {
       if(behave==0 or behave==1)
@@ -592,9 +747,6 @@ namespace Gambit
    }
 
 
-   /// @}
-
-
    /// @}
 
    /// @}
@@ -0,0 +1,151 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Unit tests for module functors that invalidate
+///  the point or raise an error while they are
+///  calculated concurrently, the way the dependency
+///  resolver calculates independent functors.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <vector>
+#include <omp.h>
+
+#include "gambit/Elements/functor_definitions.hpp"
+#include "gambit/Models/models.hpp"
+#include "gambit/Utils/static_members.hpp"
+#include "unit_test.hpp"
+
+using namespace Gambit;
+
+namespace
+{
+  const int n_threads = 4;
+
+  /// Module functions that succeed, invalidate the point with their own message, or raise an error.
+  void succeeds(double& result) { result = 1; }
+  template <int N> void invalidates(double& result)
+  {
+    result = 0;
+    invalid_point().raise("Invalidated by function " + std::to_string(N) + ".", N);
+  }
+  void fails(double& result)
+  {
+    result = 0;
+    utils_error().raise(LOCAL_INFO, "Error raised by a concurrently calculated function.");
+  }
+
+  /// Calculate the functors on a pool of threads, as DependencyResolver::calcObsLikeConcurrently does.
+  /// Returns the first error thrown by any of them; invalidations stay recorded in the functors.
+  std::exception_ptr calculate_concurrently(const std::vector<module_functor<double>*>& functors)
+  {
+    std::atomic<size_t> next(0);
+    std::exception_ptr error = nullptr;
+    #pragma omp parallel num_threads(n_threads)
+    {
+      parallel_exception_scope catching;
+      for (size_t i = next++; i < functors.size(); i = next++)
+      {
+        try
+        {
+          functors[i]->calculate();
+        }
+        catch (...)
+        {
+          #pragma omp critical (test_concurrent_invalidation)
+          {
+            if (error == nullptr) error = std::current_exception();
+          }
+        }
+      }
+    }
+    return error;
+  }
+}
+
+int main()
+{
+  Models::ModelFunctorClaw claw;
+
+  // Exceptions may only be thrown by threads inside a parallel_exception_scope, at the level it was created at.
+  EXPECT(parallel_exception_scope::may_throw());
+  #pragma omp parallel num_threads(2)
+  {
+    bool outside = parallel_exception_scope::may_throw();
+    bool inside, after, nested = true;
+    {
+      parallel_exception_scope catching;
+      inside = parallel_exception_scope::may_throw();
+      #pragma omp parallel num_threads(2)
+      {
+        #pragma omp critical (test_concurrent_invalidation)
+        nested = nested and parallel_exception_scope::may_throw();
+      }
+    }
+    after = parallel_exception_scope::may_throw();
+    #pragma omp critical (test_concurrent_invalidation)
+    {
+      EXPECT(not outside);
+      EXPECT(inside);
+      EXPECT(not nested);
+      EXPECT(not after);
+    }
+  }
+  EXPECT(parallel_exception_scope::may_throw());
+
+  // Several functors invalidate the point at once, between functors that succeed.
+  std::vector<std::unique_ptr<module_functor<double>>> owned;
+  auto make = [&](void (*f)(double&), const str& name)
+  {
+    owned.emplace_back(new module_functor<double>(f, name, name, "double", "ExampleBit_A", claw));
+    return owned.back().get();
+  };
+  std::vector<module_functor<double>*> ok = {make(&succeeds, "a"), make(&succeeds, "b"), make(&succeeds, "c")};
+  std::vector<module_functor<double>*> invalid = {make(&invalidates<1>, "i1"), make(&invalidates<2>, "i2"),
+                                                  make(&invalidates<3>, "i3"), make(&invalidates<4>, "i4")};
+  std::vector<module_functor<double>*> all = {ok[0], invalid[0], invalid[1], ok[1], invalid[2], invalid[3], ok[2]};
+  EXPECT(calculate_concurrently(all) == nullptr);
+  for (module_functor<double>* f : ok)
+  {
+    EXPECT(f->retrieve_invalid_point_exception() == NULL);
+    EXPECT((*f)(0) == 1);
+  }
+  for (size_t i = 0; i < invalid.size(); ++i)
+  {
+    invalid_point_exception* e = invalid[i]->retrieve_invalid_point_exception();
+    EXPECT(e != NULL);
+    if (e == NULL) continue;
+    EXPECT(e->thrower() == invalid[i]);
+    EXPECT(e->message() == "Invalidated by function " + std::to_string(i+1) + ".");
+    EXPECT(e->invalidcode == int(i+1));
+  }
+
+  // A functor raising an error hands it back to the caller instead of aborting the run.
+  std::vector<module_functor<double>*> failing = {make(&succeeds, "d"), make(&fails, "e"), make(&succeeds, "f")};
+  std::exception_ptr error = calculate_concurrently(failing);
+  EXPECT(error != nullptr);
+  bool is_gambit_error = false;
+  try { if (error != nullptr) std::rethrow_exception(error); }
+  catch (Gambit::exception&) { is_gambit_error = true; }
+  catch (...) {}
+  EXPECT(is_gambit_error);
+  EXPECT((*failing[0])(0) == 1);
+  EXPECT((*failing[2])(0) == 1);
+
+  // Serially, both still throw as before.
+  EXPECT_THROWS(invalid_point().raise("Serial invalidation."));
+  EXPECT_THROWS(utils_error().raise(LOCAL_INFO, "Serial error."));
+
+  return UnitTest::result();
+}
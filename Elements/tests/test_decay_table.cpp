@@ -0,0 +1,111 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Unit tests for DecayTable::Channel interning
+///  and the DecayTable::Entry channel lookups.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#include <thread>
+#include <vector>
+
+#include "gambit/Elements/decay_table.hpp"
+#include "gambit/Utils/static_members.hpp"
+#include "unit_test.hpp"
+
+using namespace Gambit;
+
+int main()
+{
+  typedef DecayTable::Channel Channel;
+
+  // The same final state gets the same ID however it is specified
+  Channel bb("b", "bbar");
+  EXPECT(Channel("bbar", "b") == bb);
+  EXPECT(Channel(std::pair<int,int>(5,1), std::pair<int,int>(-5,1)) == bb);
+  EXPECT(Channel(Channel::key_type{{-5,1}, {5,1}}) == bb);
+  EXPECT(Channel(Channel::key_type{{-5,1}, {5,1}}).particles() == bb.particles());
+  EXPECT(Channel("d", 3, "dbar", 3) == Channel(std::pair<int,int>(5,0), std::pair<int,int>(-5,0)));
+  EXPECT(Channel("d", 3, "dbar", 3) != bb);
+
+  // Different final states get different IDs
+  Channel tautau("tau+", "tau-");
+  Channel bbg("b", "bbar", "g");
+  EXPECT(tautau != bb);
+  EXPECT(bbg != bb);
+  EXPECT(bbg.size() == 3);
+
+  // Channels interned concurrently get the same IDs as on the main thread
+  std::vector<int> ids(8, -1);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; ++i) threads.emplace_back([&ids, i]() { ids[i] = Channel(i % 2 ? "tau-" : "b", i % 2 ? "tau+" : "bbar").id(); });
+  for (auto& t : threads) t.join();
+  for (int i = 0; i < 8; ++i) EXPECT(ids[i] == (i % 2 ? tautau.id() : bb.id()));
+
+  // Fill an entry in no particular order
+  DecayTable::Entry h(0.004);
+  h.set_BF(0.25, 0.01, "tau+", "tau-");
+  h.set_BF(0.5, 0.02, bb);
+  h.set_BF(0.125, 0.0, std::vector<std::pair<int,int> >{{22,0}, {22,0}});
+  h.set_BF(0.0625, 0.0, std::vector<str>{"g", "g"});
+  h.set_BF(0.03125, 0.0, std::pair<int,int>(5,1), std::pair<int,int>(-5,1), std::pair<int,int>(21,0));
+  EXPECT(h.channels.size() == 5);
+
+  // Overwriting a channel does not add a new one
+  h.set_BF(0.5, 0.03, "bbar", "b");
+  EXPECT(h.channels.size() == 5);
+  EXPECT_CLOSE(h.BF_error(bb), 0.03, 0.0);
+
+  // Channels are kept in the order of their final states
+  for (auto it = h.channels.begin(); it+1 != h.channels.end(); ++it) EXPECT(it->first.particles() < (it+1)->first.particles());
+
+  // Every way of asking for a channel finds the same BF
+  EXPECT_CLOSE(h.BF(bb), 0.5, 0.0);
+  EXPECT_CLOSE(h.BF("b", "bbar"), 0.5, 0.0);
+  EXPECT_CLOSE(h.BF(std::pair<int,int>(-5,1), std::pair<int,int>(5,1)), 0.5, 0.0);
+  EXPECT_CLOSE(h.BF(std::vector<str>{"bbar", "b"}), 0.5, 0.0);
+  EXPECT_CLOSE(h.BF(std::vector<std::pair<int,int> >{{5,1}, {-5,1}}), 0.5, 0.0);
+  EXPECT_CLOSE(h.BF(Channel::key_type{{5,1}, {-5,1}}), 0.5, 0.0);
+  EXPECT_CLOSE(h.BF("gamma", "gamma"), 0.125, 0.0);
+  EXPECT_CLOSE(h.BF(Channel("g", "g")), 0.0625, 0.0);
+  EXPECT_CLOSE(h.BF(bbg), 0.03125, 0.0);
+  EXPECT_CLOSE(h.BF_with_error("tau-", "tau+").second, 0.01, 0.0);
+  EXPECT_CLOSE(h.sum_BF(), 0.5+0.25+0.125+0.0625+0.03125, 1e-15);
+
+  // Missing channels
+  Channel cc("c", "cbar");
+  EXPECT(h.has_channel(bb));
+  EXPECT(h.has_channel("tau+", "tau-"));
+  EXPECT(h.has_channel(std::vector<str>{"g", "g"}));
+  EXPECT(not h.has_channel(cc));
+  EXPECT(not h.has_channel("c", "cbar"));
+  EXPECT(not h.has_channel("mu+", "mu-"));
+  EXPECT(not h.has_channel("d", 3, "dbar", 3));
+  EXPECT(h.channels.count(cc) == 0);
+  EXPECT(h.channels.count(Channel::key_type{{4,1}, {-4,1}}) == 0);
+  EXPECT_THROWS(h.BF(cc));
+  EXPECT_THROWS(h.BF("c", "cbar"));
+  EXPECT_THROWS(h.channels.at(cc));
+
+  // Copies of an entry answer the same lookups
+  DecayTable table;
+  table("h0_1") = h;
+  EXPECT_CLOSE(table.at("h0_1").BF(tautau), 0.25, 0.0);
+  EXPECT_CLOSE(table.at("h0_1").BF("b", "bbar", "g"), 0.03125, 0.0);
+
+  // Removing a channel
+  h.channels.erase(h.channels.find(tautau));
+  EXPECT(not h.has_channel(tautau));
+  EXPECT(h.channels.size() == 5-1);
+  EXPECT_CLOSE(h.BF(bb), 0.5, 0.0);
+
+  return UnitTest::result();
+}
@@ -0,0 +1,81 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Unit tests for the constants of daFunk
+///  instruction tapes.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#include <limits>
+
+#include "gambit/Elements/daFunk.hpp"
+#include "gambit/Utils/static_members.hpp"
+#include "unit_test.hpp"
+
+using namespace Gambit;
+using namespace daFunk;
+
+int main()
+{
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  const double inf = std::numeric_limits<double>::infinity();
+
+  // Equal constants share a register
+  FunkTape tape(2);
+  size_t one = tape.constant(1.);
+  EXPECT(tape.constant(1.) == one);
+  EXPECT(one >= 2);
+  EXPECT(tape.registers[one] == 1.);
+
+  // Zeros of different sign do not
+  size_t pzero = tape.constant(0.);
+  size_t nzero = tape.constant(-0.);
+  EXPECT(pzero != nzero);
+  EXPECT(tape.constant(-0.) == nzero);
+  EXPECT(not std::signbit(tape.registers[pzero]));
+  EXPECT(std::signbit(tape.registers[nzero]));
+
+  // NaNs never share, and do not disturb the lookup of other constants
+  size_t nan1 = tape.constant(nan);
+  size_t nan2 = tape.constant(nan);
+  EXPECT(nan1 != nan2);
+  EXPECT(std::isnan(tape.registers[nan1]) and std::isnan(tape.registers[nan2]));
+  size_t two = tape.constant(2.);
+  EXPECT(two != nan1 and two != nan2);
+  EXPECT(tape.registers[two] == 2.);
+  EXPECT(tape.constant(1.) == one);
+  EXPECT(tape.constant(2.) == two);
+
+  // Compiled functions keep the sign of zero constants...
+  Funk f = var("x")*cnst(0.) + cnst(1.)/(var("x")*cnst(-0.));
+  auto bound = f->bind("x");
+  EXPECT(bound->eval(2.) == -inf);
+  bound->compile();
+  EXPECT(bound->is_compiled());
+  EXPECT(bound->eval(2.) == -inf);
+
+  // ...and their NaN constants
+  Funk g = cnst(nan) + var("x")*cnst(3.) + cnst(nan);
+  auto bound_g = g->bind("x");
+  bound_g->compile();
+  EXPECT(std::isnan(bound_g->eval(1.)));
+  Funk h = var("x")*cnst(3.) + cnst(0.)*cnst(nan) - cnst(3.);
+  auto bound_h = h->bind("x");
+  bound_h->compile();
+  EXPECT(std::isnan(bound_h->eval(1.)));
+
+  // Batch evaluation agrees
+  std::vector<double> x{1., 2., 3.}, y(3);
+  bound->eval_batch(3, &x[0], &y[0]);
+  for (double yi : y) EXPECT(yi == -inf);
+
+  return UnitTest::result();
+}
@@ -0,0 +1,122 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Unit tests for resolved SpecHandle access to
+///  SubSpectrum and Spectrum parameters, against
+///  the string-based getters.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#include "gambit/Elements/spectrum.hpp"
+#include "gambit/Models/SimpleSpectra/SMSimpleSpec.hpp"
+#include "gambit/Models/SimpleSpectra/SMHiggsSimpleSpec.hpp"
+#include "gambit/Models/SimpleSpectra/DiracSingletDM_Z2SimpleSpec.hpp"
+#include "gambit/Utils/static_members.hpp"
+#include "unit_test.hpp"
+
+using namespace Gambit;
+
+/// SM inputs with every entry set
+SMInputs test_inputs()
+{
+  SMInputs smi;
+  smi.alphainv = 127.9; smi.GF = 1.166e-5; smi.alphaS = 0.118;
+  smi.mZ = 91.1876; smi.mBmB = 4.18; smi.mT = 173.1; smi.mTau = 1.777;
+  smi.mNu3 = 0; smi.mE = 5.11e-4; smi.mNu1 = 0; smi.mMu = 0.1057; smi.mNu2 = 0;
+  smi.mD = 4.7e-3; smi.mU = 2.2e-3; smi.mS = 0.095; smi.mCmC = 1.28;
+  smi.CKM = {0.225, 0.81, 0.16, 0.35};
+  smi.PMNS = {0.58, 0.84, 0.15, 0, 0, 0};
+  smi.mW = 80.38;
+  return smi;
+}
+
+int main()
+{
+  const SMInputs smi = test_inputs();
+  SMSimpleSpec sm(smi);
+
+  // Handles give the same values as the string-based getters, for all index forms
+  const SpecHandle mZ = sm.resolve(Par::Pole_Mass, "Z0");
+  const SpecHandle mmu = sm.resolve(Par::Pole_Mass, "e-", 2);
+  const SpecHandle mmu_long = sm.resolve(Par::Pole_Mass, "mu-");
+  const SpecHandle mmu_anti = sm.resolve(Par::Pole_Mass, "mu+");
+  EXPECT(sm.has(mZ) and sm.has(mmu) and sm.has(mmu_long) and sm.has(mmu_anti));
+  EXPECT(sm.get(mZ) == sm.get(Par::Pole_Mass, "Z0"));
+  EXPECT_CLOSE(sm.get(mZ), smi.mZ, 1e-12);
+  EXPECT(sm.get(mmu) == sm.get(Par::Pole_Mass, "e-", 2));
+  EXPECT(sm.get(mmu_long) == sm.get(Par::Pole_Mass, "mu-"));
+  EXPECT(sm.get(mmu_anti) == sm.get(Par::Pole_Mass, "mu+"));
+
+  // Overrides set after resolution are seen, under the name or under the long name of a short name + index
+  sm.set_override(Par::Pole_Mass, 91.0, "Z0");
+  EXPECT(sm.get(mZ) == 91.0);
+  sm.set_override(Par::Pole_Mass, 0.1, "e-_2");
+  EXPECT(sm.get(mmu) == 0.1);
+  EXPECT(sm.get(Par::Pole_Mass, "e-", 2) == 0.1);
+  sm.set_override(Par::Pole_Mass, 0.2, "mu-");
+  EXPECT(sm.get(mmu_long) == 0.2);
+  EXPECT(sm.get(mmu_anti) == sm.get(Par::Pole_Mass, "mu+"));
+  const SpecHandle mZ_raw = sm.resolve(Par::Pole_Mass, "Z0", ignore_overrides);
+  EXPECT_CLOSE(sm.get(mZ_raw), smi.mZ, 1e-12);
+  const SpecHandle mZ_only = sm.resolve(Par::Pole_Mass, "Z0", overrides_only);
+  EXPECT(sm.get(mZ_only) == 91.0);
+
+  // Overrides are per object; a fresh object of the same wrapper class uses the resolved getter
+  SMSimpleSpec fresh(smi);
+  EXPECT_CLOSE(fresh.get(mZ), smi.mZ, 1e-12);
+  EXPECT(fresh.get(mmu) == fresh.get(Par::Pole_Mass, "e-", 2));
+  EXPECT(not fresh.has(mZ_only));
+  EXPECT_THROWS(fresh.get(mZ_only));
+
+  // A wrapper class the handle was not resolved for falls back to its own getters
+  SpecBit::SMHiggsModel higgs_model;
+  higgs_model.HiggsPoleMass = 125.1;
+  higgs_model.HiggsVEV = 246.2;
+  SpecBit::SMHiggsSimpleSpec higgs(higgs_model);
+  Models::DiracSingletDM_Z2Model dirac_model = Models::DiracSingletDM_Z2Model();
+  dirac_model.HiggsPoleMass = 124.0;
+  dirac_model.DiracPoleMass = 500.0;
+  Models::DiracSingletDM_Z2SimpleSpec dirac(dirac_model);
+  const SpecHandle mh = higgs.resolve(Par::Pole_Mass, "h0_1");
+  EXPECT(higgs.get(mh) == 125.1);
+  EXPECT(dirac.has(mh));
+  EXPECT(dirac.get(mh) == 124.0);
+  dirac.set_override(Par::Pole_Mass, 123.0, "h0_1");
+  EXPECT(dirac.get(mh) == 123.0);
+
+  // Unknown parameters resolve, but are not there; getting them raises the usual error
+  const SpecHandle unknown = sm.resolve(Par::Pole_Mass, "~chi0_1");
+  const SpecHandle bad_index = sm.resolve(Par::Pole_Mass, "e-", 4);
+  EXPECT(not sm.has(unknown));
+  EXPECT(not sm.has(bad_index));
+  EXPECT(not higgs.has(mZ));
+  EXPECT_THROWS(sm.get(unknown));
+  EXPECT_THROWS(sm.get(bad_index));
+  EXPECT_THROWS(higgs.get(mZ));
+
+  // Spectrum handles keep the HE-then-LE priority; PDG codes resolve like the PDG getters
+  Spectrum spec(fresh, higgs, smi, NULL, Spectrum::mc_info(), Spectrum::mr_info());
+  const SpecHandle spec_mh = spec.resolve(Par::Pole_Mass, "h0_1");
+  const SpecHandle spec_mZ = spec.resolve(Par::Pole_Mass, "Z0");
+  EXPECT(spec.get(spec_mh) == 125.1);
+  EXPECT_CLOSE(spec.get(spec_mZ), smi.mZ, 1e-12);
+  EXPECT(spec.get(spec.resolve(Par::Pole_Mass, 13, 0)) == spec.get(Par::Pole_Mass, 13, 0));
+  EXPECT(pole_mass<25>(spec) == 125.1);
+  EXPECT_CLOSE(pole_mass<23>(spec), smi.mZ, 1e-12);
+  spec.get_HE().set_override(Par::Pole_Mass, 126.0, "h0_1");
+  EXPECT(pole_mass<25>(spec) == 126.0);
+  const SpecHandle spec_unknown = spec.resolve(Par::Pole_Mass, "~chi0_1");
+  EXPECT(not spec.has(spec_unknown));
+  EXPECT_THROWS(spec.get(spec_unknown));
+  EXPECT_THROWS(pole_mass<1000022>(spec));
+
+  return UnitTest::result();
+}
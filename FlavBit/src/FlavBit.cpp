@@ -583,7 +583,8 @@ namespace Gambit
       else if (ModelInUse("WC")  || ModelInUse("WC_LR") || ModelInUse("WC_LUV") )
       {
         // The Higgs mass doesn't come through in the SLHAea object, as that's only for SLHA2 SM inputs.
-        result.mass_h0 = Dep::SM_spectrum->get(Par::Pole_Mass, "h0_1");
+        static const SpecHandle h_h0 = Dep::SM_spectrum->resolve(Par::Pole_Mass, "h0_1");
+        result.mass_h0 = Dep::SM_spectrum->get(h_h0);
         // Set the scale.
         result.Q = result.mass_Z;
       }
@@ -609,11 +610,13 @@ namespace Gambit
       {
         if (ModelInUse("MSSM63atMGUT") or ModelInUse("MSSM63atQ"))
         {
-          result.mass_h0 = Dep::MSSM_spectrum->get(Par::Pole_Mass, "h0_1");
+          static const SpecHandle h_h0 = Dep::MSSM_spectrum->resolve(Par::Pole_Mass, "h0_1");
+          result.mass_h0 = Dep::MSSM_spectrum->get(h_h0);
         }
         else if (ModelInUse("WC") || ModelInUse("WC_LUV") || ModelInUse("WC_LR") )
         {
-          result.mass_h0 = Dep::SM_spectrum->get(Par::Pole_Mass, "h0_1");
+          static const SpecHandle h_h0 = Dep::SM_spectrum->resolve(Par::Pole_Mass, "h0_1");
+          result.mass_h0 = Dep::SM_spectrum->get(h_h0);
         }
         result.mass_b_1S = BEreq::mb_1S(&result);
       }
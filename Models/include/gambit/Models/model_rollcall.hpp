@@ -0,0 +1,88 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file                                       
+///                                               
+///  Compile-time registration of GAMBIT models.  
+///                                               
+///  This file was automatically generated by     
+///  model_harvester.py. Do not modify.           
+///                                               
+///  Do not add to this if you want to add a new  
+///  model -- just add your model header to       
+///  Models/include/gambit/Models/models and rest 
+///  assured that model_harvester.py will make    
+///  sure it ends up here.                        
+///                                               
+///  *********************************************
+///                                               
+///  Authors (add name and date if you modify):   
+///                                               
+///  \author The GAMBIT Collaboration            
+///  \date 08:32PM on October 16, 2026
+///                                               
+///  *********************************************
+                                                  
+#ifndef __model_rollcall_hpp__                    
+#define __model_rollcall_hpp__                    
+                                                  
+// Include the model macro definitions            
+#include "gambit/Models/model_macros.hpp"       
+                                                  
+// Automatically-generated list of models.        
+#include "gambit/Models/models/HaloModels_Einasto.hpp"
+#include "gambit/Models/models/MSSMatQ.hpp"
+#include "gambit/Models/models/DiracSingletDM_Z2.hpp"
+#include "gambit/Models/models/DMEFT.hpp"
+#include "gambit/Models/models/VectorSingletDM_Z2.hpp"
+#include "gambit/Models/models/MajoranaSingletDM_Z2.hpp"
+#include "gambit/Models/models/MSSMatMSUSY_mG.hpp"
+#include "gambit/Models/models/CosmoNuisanceModels.hpp"
+#include "gambit/Models/models/MSSMatMGUT_mA.hpp"
+#include "gambit/Models/models/Axions.hpp"
+#include "gambit/Models/models/MSSMatMSUSY_mA.hpp"
+#include "gambit/Models/models/mSUGRA.hpp"
+#include "gambit/Models/models/MSSMatQ_mA.hpp"
+#include "gambit/Models/models/WC.hpp"
+#include "gambit/Models/models/SuperRenormHP.hpp"
+#include "gambit/Models/models/DMsimpVectorMedMajoranaDM.hpp"
+#include "gambit/Models/models/MSSM_translation_helpers.hpp"
+#include "gambit/Models/models/NUHM1.hpp"
+#include "gambit/Models/models/MSSMatQ_mA_mG.hpp"
+#include "gambit/Models/models/CosmoEnergyInjection.hpp"
+#include "gambit/Models/models/StandardModel_mNudiff.hpp"
+#include "gambit/Models/models/NUHM2.hpp"
+#include "gambit/Models/models/MSSMatMGUT_mA_mG.hpp"
+#include "gambit/Models/models/DMsimpVectorMedScalarDM.hpp"
+#include "gambit/Models/models/MSSMatMGUT.hpp"
+#include "gambit/Models/models/ColliderBit_SLHA_scan_model.hpp"
+#include "gambit/Models/models/RightHandedNeutrinos.hpp"
+#include "gambit/Models/models/StandardModel_Higgs.hpp"
+#include "gambit/Models/models/ModifiedGravityYukawa.hpp"
+#include "gambit/Models/models/MSSMatQ_mG.hpp"
+#include "gambit/Models/models/MSSMatMSUSY.hpp"
+#include "gambit/Models/models/nuclear_params.hpp"
+#include "gambit/Models/models/StandardModel_SLHA2.hpp"
+#include "gambit/Models/models/StandardModel_Higgs_running.hpp"
+#include "gambit/Models/models/HaloModels_gNFW.hpp"
+#include "gambit/Models/models/demo.hpp"
+#include "gambit/Models/models/SubGeVDM.hpp"
+#include "gambit/Models/models/ColliderBit_SLHA_file_model.hpp"
+#include "gambit/Models/models/ScalarSingletDM_Z2_running.hpp"
+#include "gambit/Models/models/CosmoModels.hpp"
+#include "gambit/Models/models/WIMP_sigmav.hpp"
+#include "gambit/Models/models/MSSMatMSUSY_mA_mG.hpp"
+#include "gambit/Models/models/SuperRenormHP_solar_neutrino.hpp"
+#include "gambit/Models/models/ScalarSingletDM_Z2.hpp"
+#include "gambit/Models/models/ScalarSingletDM_Z3.hpp"
+#include "gambit/Models/models/DMsimpVectorMedDiracDM.hpp"
+#include "gambit/Models/models/SuperRenormHP_relic_density_param.hpp"
+#include "gambit/Models/models/MDM.hpp"
+#include "gambit/Models/models/MSSMatMGUT_mG.hpp"
+#include "gambit/Models/models/RightHandedNeutrinos_diff.hpp"
+#include "gambit/Models/models/symmetron.hpp"
+#include "gambit/Models/models/NREO.hpp"
+#include "gambit/Models/models/ScalarSingletDM_Z3_running.hpp"
+#include "gambit/Models/models/CMSSM.hpp"
+#include "gambit/Models/models/DMsimpVectorMedVectorDM.hpp"
+
+#endif // defined __model_rollcall_hpp__
@@ -38,6 +38,7 @@
 ///  *********************************************
 
 #include <algorithm>
+#include <array>
 
 #include "gambit/Elements/gambit_module_headers.hpp"
 #include "gambit/Elements/smlike_higgs.hpp"
@@ -648,7 +649,8 @@ namespace Gambit
     {
       using namespace Pipes::mw_from_SM_spectrum;
       const SubSpectrum& LE = Dep::SM_spectrum->get_LE();
-      result.central = LE.get(Par::Pole_Mass, "W+");;
+      static const SpecHandle h_mw = LE.resolve(Par::Pole_Mass, "W+");
+      result.central = LE.get(h_mw);
       result.upper = result.central * LE.get(Par::Pole_Mass_1srd_high, "W+");
       result.lower = result.central * LE.get(Par::Pole_Mass_1srd_low, "W+");
     }
@@ -656,7 +658,8 @@ namespace Gambit
     {
       using namespace Pipes::mw_from_ScalarSingletDM_Z2_spectrum;
       const SubSpectrum& LE = Dep::ScalarSingletDM_Z2_spectrum->get_LE();
-      result.central = LE.get(Par::Pole_Mass, "W+");;
+      static const SpecHandle h_mw = LE.resolve(Par::Pole_Mass, "W+");
+      result.central = LE.get(h_mw);
       result.upper = result.central * LE.get(Par::Pole_Mass_1srd_high, "W+");
       result.lower = result.central * LE.get(Par::Pole_Mass_1srd_low, "W+");
     }
@@ -664,7 +667,8 @@ namespace Gambit
     {
       using namespace Pipes::mw_from_ScalarSingletDM_Z3_spectrum;
       const SubSpectrum& LE = Dep::ScalarSingletDM_Z3_spectrum->get_LE();
-      result.central = LE.get(Par::Pole_Mass, "W+");;
+      static const SpecHandle h_mw = LE.resolve(Par::Pole_Mass, "W+");
+      result.central = LE.get(h_mw);
       result.upper = result.central * LE.get(Par::Pole_Mass_1srd_high, "W+");
       result.lower = result.central * LE.get(Par::Pole_Mass_1srd_low, "W+");
     }
@@ -672,7 +676,8 @@ namespace Gambit
     {
       using namespace Pipes::mw_from_VectorSingletDM_Z2_spectrum;
       const SubSpectrum& LE = Dep::VectorSingletDM_Z2_spectrum->get_LE();
-      result.central = LE.get(Par::Pole_Mass, "W+");
+      static const SpecHandle h_mw = LE.resolve(Par::Pole_Mass, "W+");
+      result.central = LE.get(h_mw);
       result.upper = result.central * LE.get(Par::Pole_Mass_1srd_high, "W+");
       result.lower = result.central * LE.get(Par::Pole_Mass_1srd_low, "W+");
     }
@@ -680,7 +685,8 @@ namespace Gambit
     {
       using namespace Pipes::mw_from_MajoranaSingletDM_Z2_spectrum;
       const SubSpectrum& LE = Dep::MajoranaSingletDM_Z2_spectrum->get_LE();
-      result.central = LE.get(Par::Pole_Mass, "W+");
+      static const SpecHandle h_mw = LE.resolve(Par::Pole_Mass, "W+");
+      result.central = LE.get(h_mw);
       result.upper = result.central * LE.get(Par::Pole_Mass_1srd_high, "W+");
       result.lower = result.central * LE.get(Par::Pole_Mass_1srd_low, "W+");
     }
@@ -688,7 +694,8 @@ namespace Gambit
     {
       using namespace Pipes::mw_from_DiracSingletDM_Z2_spectrum;
       const SubSpectrum& LE = Dep::DiracSingletDM_Z2_spectrum->get_LE();
-      result.central = LE.get(Par::Pole_Mass, "W+");
+      static const SpecHandle h_mw = LE.resolve(Par::Pole_Mass, "W+");
+      result.central = LE.get(h_mw);
       result.upper = result.central * LE.get(Par::Pole_Mass_1srd_high, "W+");
       result.lower = result.central * LE.get(Par::Pole_Mass_1srd_low, "W+");
     }
@@ -696,7 +703,8 @@ namespace Gambit
     {
       using namespace Pipes::mw_from_MSSM_spectrum;
       const SubSpectrum& HE = Dep::MSSM_spectrum->get_HE();
-      result.central = HE.get(Par::Pole_Mass, "W+");
+      static const SpecHandle h_mw = HE.resolve(Par::Pole_Mass, "W+");
+      result.central = HE.get(h_mw);
       result.upper = result.central * HE.get(Par::Pole_Mass_1srd_high, "W+");
       result.lower = result.central * HE.get(Par::Pole_Mass_1srd_low, "W+");
     }
@@ -948,6 +956,14 @@ namespace Gambit
       using namespace Pipes::GM2C_SUSY;
       const SubSpectrum& mssm = Dep::MSSM_spectrum->get_HE();
 
+      // Pole mass getters, resolved once
+      static const SpecHandle h_snu2 = mssm.resolve(Par::Pole_Mass, "~nu", 2);
+      static const std::array<SpecHandle, 4> h_chi0 = {{mssm.resolve(Par::Pole_Mass, "~chi0", 1), mssm.resolve(Par::Pole_Mass, "~chi0", 2),
+                                                        mssm.resolve(Par::Pole_Mass, "~chi0", 3), mssm.resolve(Par::Pole_Mass, "~chi0", 4)}};
+      static const std::array<SpecHandle, 2> h_chip = {{mssm.resolve(Par::Pole_Mass, "~chi+", 1), mssm.resolve(Par::Pole_Mass, "~chi+", 2)}};
+      static const SpecHandle h_A0 = mssm.resolve(Par::Pole_Mass, "A0");
+      static const SpecHandle h_mw = mssm.resolve(Par::Pole_Mass, "W+");
+
       gm2calc_default::gm2calc::MSSMNoFV_onshell model;
 
       try
@@ -955,7 +971,7 @@ namespace Gambit
         /// fill pole masses.
         /// note: that the indices start from 0 in gm2calc,
         /// gambit indices start from 1, hence the offsets here
-        model.get_physical().MSvmL = mssm.get(Par::Pole_Mass, "~nu", 2); // 1L
+        model.get_physical().MSvmL = mssm.get(h_snu2); // 1L
         str msm1, msm2;
         // PA: todo: I think we shouldn't be too sensitive to mixing in this case.
         // If we get a successful convergence to the pole mass scheme in the end it's OK
@@ -965,14 +981,14 @@ namespace Gambit
         model.get_physical().MSm(0)  =  mssm.get(Par::Pole_Mass, msm1); // 1L
         model.get_physical().MSm(1)  =  mssm.get(Par::Pole_Mass, msm2); // 1L
 
-        model.get_physical().MChi(0) = mssm.get(Par::Pole_Mass, "~chi0", 1); // 1L
-        model.get_physical().MChi(1) =  mssm.get(Par::Pole_Mass, "~chi0", 2); // 1L
-        model.get_physical().MChi(2) = mssm.get(Par::Pole_Mass, "~chi0", 3); // 1L
-        model.get_physical().MChi(3) = mssm.get(Par::Pole_Mass, "~chi0", 4); // 1L
+        model.get_physical().MChi(0) = mssm.get(h_chi0[0]); // 1L
+        model.get_physical().MChi(1) =  mssm.get(h_chi0[1]); // 1L
+        model.get_physical().MChi(2) = mssm.get(h_chi0[2]); // 1L
+        model.get_physical().MChi(3) = mssm.get(h_chi0[3]); // 1L
 
-        model.get_physical().MCha(0) =  mssm.get(Par::Pole_Mass, "~chi+", 1); // 1L
-        model.get_physical().MCha(1) =  mssm.get(Par::Pole_Mass, "~chi+", 2); // 1L
-        model.get_physical().MAh(1)  = mssm.get(Par::Pole_Mass, "A0"); // 2L
+        model.get_physical().MCha(0) =  mssm.get(h_chip[0]); // 1L
+        model.get_physical().MCha(1) =  mssm.get(h_chip[1]); // 1L
+        model.get_physical().MAh(1)  = mssm.get(h_A0); // 2L
 
         model.set_TB(mssm.get(Par::dimensionless,"tanbeta"));
         model.set_Mu(mssm.get(Par::mass1, "Mu"));
@@ -1014,7 +1030,7 @@ namespace Gambit
         model.get_physical().MFb =smin.mBmB;
         model.get_physical().MFt =smin.mT;
         model.get_physical().MFtau =smin.mTau;
-        model.get_physical().MVWm =mssm.get(Par::Pole_Mass, "W+");  //GAMBIT can get the pole mas but it may have been improved by FeynHiggs calcualtion
+        model.get_physical().MVWm =mssm.get(h_mw);  //GAMBIT can get the pole mas but it may have been improved by FeynHiggs calcualtion
         model.get_physical().MFm =smin.mMu;
         //use SM alphaS(MZ) instead of MSSM g3(MSUSY) -- appears at two-loop so difference should be three-loop
         // (it is used for correctuions to yb and DRbar --> MS bar conversion)
@@ -0,0 +1,44 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file                                       
+///                                               
+///  Compile-time registration of GAMBIT printers.
+///                                               
+///  This file was automatically generated by     
+///  printer_harvester.py. Do not modify.         
+///                                               
+///  Do not add to this if you want to add a new  
+///  printer -- just add your printer header to   
+///  Printers/include/gambit/Printers/            
+///  and rest assured that printer_harvester.py   
+///  will make sure it ends up here.              
+///                                               
+///  *********************************************
+///                                               
+///  Authors (add name and date if you modify):   
+///                                               
+///  \author The GAMBIT Collaboration            
+///  \date 06:54PM on October 16, 2026
+///                                               
+///  *********************************************
+                                                  
+#ifndef __printer_rollcall_hpp__                  
+#define __printer_rollcall_hpp__                  
+                                                  
+// Automatically-generated list of printers.      
+#include "gambit/Printers/printers/asciiprinter.hpp"
+#include "gambit/Printers/printers/asciireader.hpp"
+#include "gambit/Printers/printers/sqlitereader.hpp"
+#include "gambit/Printers/printers/hdf5printer.hpp"
+#include "gambit/Printers/printers/coutprinter.hpp"
+#include "gambit/Printers/printers/hdf5reader.hpp"
+#include "gambit/Printers/printers/sqliteprinter.hpp"
+#include "gambit/Printers/printers/hdf5types.hpp"
+#include "gambit/Printers/printers/hdf5printer_v2.hpp"
+#include "gambit/Printers/printers/asciitypes.hpp"
+#include "gambit/Printers/printers/noneprinter.hpp"
+#include "gambit/Printers/printers/common_print_overloads.hpp"
+#include "gambit/Printers/printers/sqlitebase.hpp"
+#include "gambit/Printers/printers/sqlitetypes.hpp"
+
+#endif // defined __printer_rollcall_hpp__
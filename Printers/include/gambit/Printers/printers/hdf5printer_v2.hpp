@@ -30,6 +30,9 @@
 ///          (tomas.gonzalo@monash.edu)
 ///  \date 2020 June
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 
@@ -40,6 +43,11 @@
 #include <set>
 #include <iterator>
 #include <string>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
 
 // BOOST_PP
 #include <boost/preprocessor/seq/for_each_i.hpp>
@@ -110,6 +118,27 @@ namespace Gambit
         return result;
     }
 
+#ifdef WITH_MPI
+    /// Agree with all processes in a communicator on whether a step of a collective write succeeded,
+    /// so that an error on one process does not leave the others waiting in the next collective call.
+    /// Every process must call this after the step; if the step failed on any of them, a printer_error
+    /// is raised on all of them.  The error message is empty if the step succeeded on this process.
+    inline void agree_on_errors(GMPI::Comm& comm, const std::string& step, const std::string& error)
+    {
+        int failed = error.empty() ? 0 : 1;
+        int any_failed = 0;
+        comm.Allreduce(failed, any_failed, MPI_MAX);
+        if(any_failed)
+        {
+            std::ostringstream errmsg;
+            errmsg<<"Collective write of hdf5 output failed while "<<step;
+            if(failed) errmsg<<": "<<error;
+            else errmsg<<" on another process (see the logs of the other processes for the error).";
+            printer_error().raise(LOCAL_INFO, errmsg.str());
+        }
+    }
+#endif
+
     /// Base class for interfacing to a HDF5 dataset
     class HDF5DataSetBase
     {
@@ -270,6 +299,66 @@ namespace Gambit
              return new_dset_size;
          }
 
+#if defined(WITH_MPI) && defined(H5_HAVE_PARALLEL)
+         /// Write a vector of data to disk at the target position, using the supplied
+         /// data transfer properties (e.g. collective MPI-IO). Every process with the file
+         /// open must call this, even with no data to write. The dataset must already be
+         /// long enough, since extending it is a separate collective operation.
+         void write_vector_collective(const hid_t loc_id, const std::vector<T>& data, const std::size_t target_pos, const hid_t dxpl_id, GMPI::Comm& comm)
+         {
+             std::string error;
+             hid_t memspace_id = -1;
+             hid_t dspace_id = -1;
+             try
+             {
+                 open_dataset(loc_id);
+                 if(data.size()>0)
+                 {
+                     std::pair<hid_t,hid_t> selection_ids = select_hyperslab(target_pos,data.size());
+                     memspace_id = selection_ids.first;
+                     dspace_id   = selection_ids.second;
+                 }
+                 else
+                 {
+                     // Take part in the write without selecting anything
+                     hsize_t one[DSETRANK] = {1};
+                     memspace_id = H5Screate_simple(DSETRANK, one, NULL);
+                     dspace_id   = H5Dget_space(get_dset_id());
+                     if(memspace_id<0 or dspace_id<0 or H5Sselect_none(memspace_id)<0 or H5Sselect_none(dspace_id)<0)
+                     {
+                         error = "Failed to create empty selection for dataset (with name=\""+myname()+"\").";
+                     }
+                 }
+             }
+             catch(const std::exception& e)
+             {
+                 error = e.what();
+             }
+             agree_on_errors(comm, "preparing to write to dataset \""+myname()+"\"", error);
+
+             T dummy[1];
+             herr_t status = H5Dwrite(get_dset_id(), get_hdftype_id(), memspace_id, dspace_id, dxpl_id, data.size()>0 ? data.data() : dummy);
+             if(status<0)
+             {
+                std::ostringstream errmsg;
+                errmsg << "Error writing block of "<<data.size()<<" elements at position "<<target_pos<<" to dataset (with name=\""<<myname()<<"\") in HDF5 file. H5Dwrite failed.";
+                error = errmsg.str();
+             }
+
+             H5Sclose(dspace_id);
+             H5Sclose(memspace_id);
+             try
+             {
+                 close_dataset();
+             }
+             catch(const std::exception& e)
+             {
+                 if(error.empty()) error = e.what();
+             }
+             agree_on_errors(comm, "writing to dataset \""+myname()+"\"", error);
+         }
+#endif
+
          /// Write a block of data to disk at the end of the dataset
          /// This is the lower-level function. There is a fixed-size
          /// buffer that cannot be exceeded. If more data than
@@ -606,6 +695,54 @@ namespace Gambit
     }
 
 
+    /// Base class for blocks of buffer data detached from their buffer,
+    /// waiting to be written to disk by a background writer thread
+    class HDF5BlockBase
+    {
+      public:
+        virtual ~HDF5BlockBase() {}
+
+        /// Write the block to its datasets, starting at target_pos
+        virtual void write(const hid_t loc_id, const std::size_t target_pos) = 0;
+    };
+
+    /// Ordered data of one buffer, detached from the buffer
+    template<class T>
+    class HDF5Block: public HDF5BlockBase
+    {
+      public:
+
+        HDF5Block(const std::string& name, std::vector<T>&& values, std::vector<int>&& valid)
+          : my_dataset(name)
+          , my_dataset_valid(name+"_isvalid")
+          , values(std::move(values))
+          , valid(std::move(valid))
+        {}
+
+        void write(const hid_t loc_id, const std::size_t target_pos)
+        {
+            // Extend the output datasets to the target position (in case some have been left behind)
+            my_dataset      .ensure_dataset_exists(loc_id, target_pos);
+            my_dataset_valid.ensure_dataset_exists(loc_id, target_pos);
+
+            std::size_t newsize   = my_dataset      .write_vector(loc_id,values,target_pos);
+            std::size_t newsize_v = my_dataset_valid.write_vector(loc_id,valid ,target_pos);
+            if(newsize!=newsize_v)
+            {
+                std::ostringstream errmsg;
+                errmsg<<"Inconsistent dataset sizes detected after writing detached block! (newsize="<<newsize<<", newsize_v="<<newsize_v<<")";
+                printer_error().raise(LOCAL_INFO, errmsg.str());
+            }
+        }
+
+      private:
+
+        HDF5DataSet<T> my_dataset;
+        HDF5DataSet<int> my_dataset_valid;
+        std::vector<T> values;
+        std::vector<int> valid;
+    };
+
     /// Base class for buffers
     class HDF5BufferBase
     {
@@ -629,6 +766,15 @@ namespace Gambit
         /// Empty buffer to disk as a block
         virtual void block_flush(const hid_t loc_id, const std::vector<PPIDpair>& order, const std::size_t target_pos) = 0;
 
+        /// Empty buffer into a detached block with the specified order, for writing to disk later
+        virtual std::unique_ptr<HDF5BlockBase> detach_block(const std::vector<PPIDpair>& order) = 0;
+
+#if defined(WITH_MPI) && defined(H5_HAVE_PARALLEL)
+        /// Empty buffer to disk as a block, using the supplied data transfer properties
+        /// (for collective writes; the datasets must already be long enough)
+        virtual void collective_flush(const hid_t loc_id, const std::vector<PPIDpair>& order, const std::size_t target_pos, const hid_t dxpl_id) = 0;
+#endif
+
         /// Empty buffer to disk as arbitrarily positioned data
         virtual void random_flush(const hid_t loc_id, const std::map<PPIDpair,std::size_t>& position_map) = 0;
 
@@ -735,53 +881,10 @@ namespace Gambit
         /// (only allowed if target_pos is beyond the current end of the dataset!)
         void block_flush(const hid_t loc_id, const std::vector<PPIDpair>& order, const std::size_t target_pos)
         {
-            // Make sure output order is same size as the buffer to be output
-            if(order.size() != buffer.size())
-            {
-                std::ostringstream errmsg;
-                errmsg << "Supplied buffer ordering vector is not the same size as the buffer (buffer.size()="<<buffer.size()<<", order.size()="<<order.size()<<"; dset_name()="<<dset_name()<<"). This is a bug, please report it." <<std::endl;
-                errmsg << "Extra debug information:" << std::endl;
-                errmsg << "  buffer.size()       = "<<buffer.size()<<std::endl;
-                errmsg << "  buffer_valid.size() = "<<buffer_valid.size()<<std::endl;
-                errmsg << "  buffer_set.size() = "<<buffer_set.size()<<std::endl;
-                printer_error().raise(LOCAL_INFO, errmsg.str());
-            }
-
-            // Need to keep track of whether buffer points have been added to the ordered output
-            std::set<PPIDpair> done;
-
             // Create a vector version of the buffer in the specified order
             std::vector<T> ordered_buffer;
             std::vector<int> ordered_buffer_valid;
-            for(auto ppid_it=order.begin(); ppid_it!=order.end(); ++ppid_it)
-            {
-                if(done.count(*ppid_it)!=0)
-                {
-                    std::ostringstream errmsg;
-                    errmsg << "Supplied buffer ordering vector contains a duplicate PPIDpair! This is a bug, please report it.";
-                    printer_error().raise(LOCAL_INFO, errmsg.str());
-                }
-                ordered_buffer      .push_back(buffer      .at(*ppid_it));
-                ordered_buffer_valid.push_back(buffer_valid.at(*ppid_it));
-                done.insert(*ppid_it);
-            }
-
-            // Check if any points were not added to the ordered buffer
-            std::set<PPIDpair> not_done = set_diff(buffer_set,done);
-
-            if(not_done.size()>0)
-            {
-                std::ostringstream errmsg;
-                errmsg << "Supplied buffer ordering vector does not specify order positions for all points in the buffer! This is a bug, please report it.";
-                printer_error().raise(LOCAL_INFO, errmsg.str());
-            }
-
-            if(ordered_buffer.size() != buffer.size())
-            {
-                std::ostringstream errmsg;
-                errmsg << "The ordered buffer we just constructed is not the same size as the original buffer! This is a bug, please report it.";
-                printer_error().raise(LOCAL_INFO, errmsg.str());
-            }
+            get_ordered_buffer(order, ordered_buffer, ordered_buffer_valid);
 
             // Perform dataset writes
         #ifdef HDF5PRINTER2_DEBUG
@@ -810,6 +913,50 @@ namespace Gambit
             buffer_set.clear();
         }
 
+        /// Empty the buffer into a detached block with the specified order
+        /// (for writing to disk by a background thread while the buffer refills)
+        std::unique_ptr<HDF5BlockBase> detach_block(const std::vector<PPIDpair>& order)
+        {
+            std::vector<T> ordered_buffer;
+            std::vector<int> ordered_buffer_valid;
+            get_ordered_buffer(order, ordered_buffer, ordered_buffer_valid);
+
+            // Clear buffer variables
+            buffer      .clear();
+            buffer_valid.clear();
+            buffer_set.clear();
+
+            return std::unique_ptr<HDF5BlockBase>(new HDF5Block<T>(dset_name(),std::move(ordered_buffer),std::move(ordered_buffer_valid)));
+        }
+
+#if defined(WITH_MPI) && defined(H5_HAVE_PARALLEL)
+        /// Empty the buffer to disk as a block with the specified order into the target position,
+        /// using the supplied data transfer properties (for collective MPI-IO writes)
+        void collective_flush(const hid_t loc_id, const std::vector<PPIDpair>& order, const std::size_t target_pos, const hid_t dxpl_id)
+        {
+            std::vector<T> ordered_buffer;
+            std::vector<int> ordered_buffer_valid;
+            std::string error;
+            try
+            {
+                get_ordered_buffer(order, ordered_buffer, ordered_buffer_valid);
+            }
+            catch(const std::exception& e)
+            {
+                error = e.what();
+            }
+            agree_on_errors(myComm, "ordering the buffer for dataset \""+dset_name()+"\"", error);
+
+            my_dataset      .write_vector_collective(loc_id,ordered_buffer      ,target_pos,dxpl_id,myComm);
+            my_dataset_valid.write_vector_collective(loc_id,ordered_buffer_valid,target_pos,dxpl_id,myComm);
+
+            // Clear buffer variables
+            buffer      .clear();
+            buffer_valid.clear();
+            buffer_set.clear();
+        }
+#endif
+
         /// Empty the buffer to disk as "random access" data at pre-existing positions matching the point IDs
         /// May not completely empty the buffer; points will be removed from the buffer if they are included
         /// in the supplied position map.
@@ -1142,6 +1289,56 @@ namespace Gambit
         /// Buffer containing points to be written to disk upon "flush"
         std::map<PPIDpair,T> buffer;
 
+        /// Copy the buffer contents into vectors in the specified order
+        /// (the order must contain every buffered point exactly once)
+        void get_ordered_buffer(const std::vector<PPIDpair>& order, std::vector<T>& ordered_buffer, std::vector<int>& ordered_buffer_valid) const
+        {
+            // Make sure output order is same size as the buffer to be output
+            if(order.size() != buffer.size())
+            {
+                std::ostringstream errmsg;
+                errmsg << "Supplied buffer ordering vector is not the same size as the buffer (buffer.size()="<<buffer.size()<<", order.size()="<<order.size()<<"; dset_name()="<<dset_name()<<"). This is a bug, please report it." <<std::endl;
+                errmsg << "Extra debug information:" << std::endl;
+                errmsg << "  buffer.size()       = "<<buffer.size()<<std::endl;
+                errmsg << "  buffer_valid.size() = "<<buffer_valid.size()<<std::endl;
+                errmsg << "  buffer_set.size() = "<<buffer_set.size()<<std::endl;
+                printer_error().raise(LOCAL_INFO, errmsg.str());
+            }
+
+            // Need to keep track of whether buffer points have been added to the ordered output
+            std::set<PPIDpair> done;
+
+            for(auto ppid_it=order.begin(); ppid_it!=order.end(); ++ppid_it)
+            {
+                if(done.count(*ppid_it)!=0)
+                {
+                    std::ostringstream errmsg;
+                    errmsg << "Supplied buffer ordering vector contains a duplicate PPIDpair! This is a bug, please report it.";
+                    printer_error().raise(LOCAL_INFO, errmsg.str());
+                }
+                ordered_buffer      .push_back(buffer      .at(*ppid_it));
+                ordered_buffer_valid.push_back(buffer_valid.at(*ppid_it));
+                done.insert(*ppid_it);
+            }
+
+            // Check if any points were not added to the ordered buffer
+            std::set<PPIDpair> not_done = set_diff(buffer_set,done);
+
+            if(not_done.size()>0)
+            {
+                std::ostringstream errmsg;
+                errmsg << "Supplied buffer ordering vector does not specify order positions for all points in the buffer! This is a bug, please report it.";
+                printer_error().raise(LOCAL_INFO, errmsg.str());
+            }
+
+            if(ordered_buffer.size() != buffer.size())
+            {
+                std::ostringstream errmsg;
+                errmsg << "The ordered buffer we just constructed is not the same size as the original buffer! This is a bug, please report it.";
+                printer_error().raise(LOCAL_INFO, errmsg.str());
+            }
+        }
+
 #ifdef WITH_MPI
         // Gambit MPI communicator context for use within the hdf5 printer system
         GMPI::Comm& myComm;
@@ -1201,7 +1398,7 @@ namespace Gambit
       public:
 
         /// Constructor
-        HDF5MasterBuffer(const std::string& filename, const std::string& groupname, const std::string& metadata_groupname, const bool sync, const std::size_t buffer_length
+        HDF5MasterBuffer(const std::string& filename, const std::string& groupname, const std::string& metadata_groupname, const bool sync, const std::size_t buffer_length, const bool async
 #ifdef WITH_MPI
           , GMPI::Comm& comm
 #endif
@@ -1268,8 +1465,17 @@ namespace Gambit
         }
 
         /// Empty all buffers to disk
+        /// (in async mode, hand them over to the background writer thread instead)
         void flush();
 
+        /// Wait for the background writer thread to finish any pending write and stop it.
+        /// Later flushes are done directly. Errors from the writer thread are rethrown,
+        /// or only logged if abnormal=true.
+        void stop_writer_thread(const bool abnormal=false);
+
+        /// Report whether synchronised flushes are done by a background writer thread
+        bool is_async();
+
         /// Print metadata directly to disk
         void print_metadata(std::map<std::string,std::string>, bool);
 
@@ -1326,8 +1532,19 @@ namespace Gambit
         // Add a vector of buffer chunk data to the buffers managed by this object
         void add_to_buffers(const std::vector<HDF5bufferchunk>& blocks, const std::vector<std::pair<std::string,int>>& buf_types);
 
+        #ifdef H5_HAVE_PARALLEL
+        /// Open output HDF5 file on all processes via the MPI-IO driver (collective)
+        void open_file_collective();
+
+        /// Close output HDF5 file opened by open_file_collective (collective)
+        void close_file_collective();
         #endif
 
+        #endif
+
+        /// Retrieve the buffer for a given output label and integer type code, creating it if needed
+        HDF5BufferBase& get_buffer_of_type(const std::string& label, const int type);
+
         /// Clear all data in buffers ***and on disk*** for this printer
         void reset();
 
@@ -1464,6 +1681,32 @@ namespace Gambit
         /// Ensure HDF5 file is open (and locked for us to use)
         void ensure_file_is_open() const;
 
+        /// Mutex held while any HDF5MasterBuffer in this process has the output file open.
+        /// Serialises HDF5 calls between the scan and the background writer threads.
+        static std::mutex& file_access_mutex();
+
+        /// @{ Background writer thread for async flushes
+        /// At most one set of detached blocks is waiting for (or being written to) disk, while
+        /// the buffers refill. A flush has to wait for the previous one to finish.
+        bool async;
+        std::thread writer_thread;
+        std::mutex writer_mutex;
+        std::condition_variable writer_cv;
+        std::vector<std::unique_ptr<HDF5BlockBase>> pending_blocks;
+        bool write_pending;
+        bool writer_stop;
+        std::exception_ptr writer_error;
+
+        /// Detach buffer contents and queue them for the writer thread
+        void queue_async_flush();
+
+        /// Main loop of the writer thread
+        void writer_loop();
+
+        /// Write a set of detached blocks to the end of the datasets
+        void write_blocks(const std::vector<std::unique_ptr<HDF5BlockBase>>& blocks);
+        /// @}
+
         /// Buffer manager objects
         //  Need a map for every directly printable type, and a specialisation
         //  of 'get_buffer' to access it.
@@ -1572,6 +1815,9 @@ namespace Gambit
         /// Last PPID pair printed
         PPIDpair lastPointID;
 
+        /// Write the final sync buffer data collectively via MPI-IO, rather than gathering it on rank 0
+        bool parallel_io;
+
 #ifdef WITH_MPI
         /// Gambit MPI communicator context for use within the hdf5 printer system
         GMPI::Comm myComm; // initially attaches to MPI_COMM_WORLD
@@ -1585,6 +1831,11 @@ namespace Gambit
        // Gather (via MPI) all HDF5 buffer chunk data from a set of managed buffers
        std::vector<HDF5bufferchunk> gather_all(GMPI::Comm& comm, const std::vector<HDF5MasterBuffer*>& masterbuffers, const std::map<std::string,int>& buf_ids);
 
+#if defined(WITH_MPI) && defined(H5_HAVE_PARALLEL)
+        /// Write sync buffer data from all processes directly to disk via collective MPI-IO
+        void write_collective(const std::vector<HDF5MasterBuffer*>& masterbuffers);
+#endif
+
         static constexpr double RAMlimit = 500; // MB; dump data if buffer size exceeds this
         static constexpr std::size_t MAXrecv = 100; // Maximum number of processes to send buffer data at one time
 
@@ -1619,6 +1870,9 @@ namespace Gambit
         /// Report whether this printer prints in synchronised or 'random' mode
         bool get_sync(const Options& options);
 
+        /// Report whether sync buffers are flushed by a background thread (from options or primary printer)
+        bool get_async(const Options& options);
+
         /// Helper print functions
         /// Used to reduce repetition in definitions of virtual function overloads
         /// (useful since there is no automatic type conversion possible)
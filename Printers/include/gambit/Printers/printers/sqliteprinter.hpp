@@ -12,6 +12,9 @@
 ///          (b.farmer@imperial.ac.uk)
 ///  \date 2018 Dec
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #ifndef __sqliteprinter_hpp__
@@ -21,6 +24,8 @@
 #include <map>
 #include <string>
 #include <limits>
+#include <tuple>
+#include <type_traits>
 #include <sqlite3.h> // SQLite3 C interface
 
 // Gambit
@@ -35,6 +40,24 @@ namespace Gambit
   namespace Printers
   {
 
+    /// A value in the SQLitePrinter buffer: null, an integer or a real number
+    struct sql_value
+    {
+        enum value_kind { NULL_VALUE, INTEGER_VALUE, REAL_VALUE };
+        value_kind kind;
+        union
+        {
+            llint i;
+            double d;
+        };
+
+        sql_value() : kind(NULL_VALUE), i(0) {}
+        template<class T>
+        explicit sql_value(T value, typename std::enable_if<std::is_integral<T>::value>::type* = 0) : kind(INTEGER_VALUE), i(value) {}
+        template<class T>
+        explicit sql_value(T value, typename std::enable_if<std::is_floating_point<T>::value>::type* = 0) : kind(REAL_VALUE), d(value) {}
+    };
+
     /// The main printer class for output to SQLite database
     class SQLitePrinter : public BasePrinter, SQLiteBase
     {
@@ -43,7 +66,7 @@ namespace Gambit
         SQLitePrinter(const Options&, BasePrinter* const primary = NULL);
 
         /// Destructor
-        ~SQLitePrinter() {}
+        ~SQLitePrinter();
 
         /// Virtual function overloads:
         ///@{
@@ -62,6 +85,8 @@ namespace Gambit
         ///@}
 
        std::size_t get_max_buffer_length();
+       std::string get_journal_mode();
+       std::string get_synchronous();
 
         ///@{ Print functions
         using BasePrinter::_print; // Tell compiler we are using some of the base class overloads of this on purpose.
@@ -84,11 +109,7 @@ namespace Gambit
         template<class T>
         void template_print(T const& value, const std::string& label, const int /*IDcode*/, const unsigned int mpirank, const unsigned long pointID, const std::string& col_type)
         {
-            typedef std::numeric_limits<T> lims;
-            std::stringstream sdata;
-            sdata.precision(lims::max_digits10);
-            sdata<<value;
-            insert_data(mpirank, pointID, label, col_type, sdata.str());
+            insert_data(mpirank, pointID, label, col_type, sql_value(value));
         }
 
      private:
@@ -117,6 +138,10 @@ namespace Gambit
 
         std::size_t max_buffer_length;
 
+        // Journal mode and synchronous setting of the database connection (SQLite pragmas)
+        std::string journal_mode;
+        std::string synchronous;
+
         // Map from column name to (buffer column position, column type) pair
         std::map<std::string,std::pair<std::size_t,std::string>,Utils::ci_less> buffer_info;
 
@@ -124,11 +149,19 @@ namespace Gambit
         std::vector<std::string> buffer_header;
 
         // Buffer for SQLite insertions. Kind of a 2D "array" of column data
-        // to be transformed into one big INSERT operation once full.
-        std::map<std::size_t,std::vector<std::string>> transaction_data_buffer;
+        // to be written in a single transaction once full.
+        std::map<std::size_t,std::vector<sql_value>> transaction_data_buffer;
 
         /// @}
 
+        // Kinds of prepared statements used to write the buffer
+        enum statement_kind { INSERT_ROW, UPDATE_ROW };
+
+        // Cache of prepared statements, keyed by kind and the range [first,last) of buffer
+        // columns that they write. Columns are only ever appended to the buffer header, so
+        // a statement stays valid for as long as the database is open.
+        std::map<std::tuple<statement_kind,std::size_t,std::size_t>,sqlite3_stmt*> statements;
+
         // Determines whether output is new row insertions, or updates previously existing rows
         bool synchronised;
 
@@ -139,17 +172,17 @@ namespace Gambit
         // Check that a table column exists, and create it if needed
         void ensure_column_exists(const std::string&, const std::string&, const std::string&);
 
-        // Create an SQL table insert operation for the current transaction_data_buffer
-        // Modifies 'sql' stringstream in-place
-        void turn_buffer_into_insert(std::stringstream& sql, const std::string& table);
+        // Get the prepared statement writing buffer columns [first,last) of a row
+        sqlite3_stmt* get_statement(statement_kind, std::size_t first, std::size_t last);
+
+        // Bind the pairID and buffer columns [first,last) of a row to a statement, and execute it
+        void write_row(sqlite3_stmt*, std::size_t pairID, const std::vector<sql_value>& row, std::size_t first, std::size_t last);
 
         // Queue a table insert operation, and submit the queue if it is filled
-        void insert_data(const unsigned int mpirank, const unsigned long pointID, const std::string& col_name, const std::string& col_type, const std::string& data);
+        void insert_data(const unsigned int mpirank, const unsigned long pointID, const std::string& col_name, const std::string& col_type, const sql_value& data);
 
         // Submit and clear insert operation queue
         void dump_buffer();
-        void dump_buffer_as_INSERT();
-        void dump_buffer_as_UPDATE();
 
         // Delete all buffer data and reset all buffer variables
         void clear_buffer();
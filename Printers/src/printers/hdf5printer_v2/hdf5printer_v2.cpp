@@ -16,6 +16,9 @@
 ///          (tomas.gonzalo@monash.edu)
 ///  \date 2020 June
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 //
 #include <math.h>
@@ -389,7 +392,7 @@ namespace Gambit
 
     /// @{ Member functions of HDF5MasterBuffer
 
-    HDF5MasterBuffer::HDF5MasterBuffer(const std::string& filename, const std::string& groupname, const std::string& metadata_groupname, const bool sync, const std::size_t buflen
+    HDF5MasterBuffer::HDF5MasterBuffer(const std::string& filename, const std::string& groupname, const std::string& metadata_groupname, const bool sync, const std::size_t buflen, const bool async_writes
 #ifdef WITH_MPI
         , GMPI::Comm& comm
 #endif
@@ -406,6 +409,9 @@ namespace Gambit
         , hdf5out(file)
         , file_open(false)
         , have_lock(false)
+        , async(sync and async_writes) // Only synchronised flushes can be done in the background
+        , write_pending(false)
+        , writer_stop(false)
 #ifdef WITH_MPI
         , hdf5_buffers_int(sync,comm)
         , hdf5_buffers_uint(sync,comm)
@@ -434,6 +440,7 @@ namespace Gambit
 
     HDF5MasterBuffer::~HDF5MasterBuffer()
     {
+        stop_writer_thread(true);
         if(file_open) close_and_unlock_file();
     }
 
@@ -442,6 +449,11 @@ namespace Gambit
         return synchronised;
     }
 
+    bool HDF5MasterBuffer::is_async()
+    {
+        return async;
+    }
+
     /// Report length of buffer for HDF5 output
     std::size_t HDF5MasterBuffer::get_buffer_length()
     {
@@ -475,7 +487,12 @@ namespace Gambit
     /// (or as much of them as is currently possible in RA case)
     void HDF5MasterBuffer::flush()
     {
-        if(get_Npoints()>0) // No point trying to flush an already empty buffer
+        if(get_Npoints()>0 and async)
+        {
+            // Hand the buffer contents over to the background writer thread
+            queue_async_flush();
+        }
+        else if(get_Npoints()>0) // No point trying to flush an already empty buffer
         {
             // Obtain lock on the output file
             lock_and_open_file();
@@ -595,6 +612,121 @@ namespace Gambit
         }
     }
 
+    /// Detach buffer contents and queue them for the writer thread
+    void HDF5MasterBuffer::queue_async_flush()
+    {
+        std::unique_lock<std::mutex> lock(writer_mutex);
+
+        // Bounded backpressure: wait until the previous block set is on disk
+        writer_cv.wait(lock, [this]{ return not write_pending; });
+        if(writer_error)
+        {
+            std::exception_ptr error = writer_error;
+            writer_error = nullptr;
+            std::rethrow_exception(error);
+        }
+
+        for(auto it=all_buffers.begin(); it!=all_buffers.end(); ++it)
+        {
+            pending_blocks.push_back(it->second->detach_block(buffered_points));
+        }
+        buffered_points.clear();
+        buffered_points_set.clear();
+        write_pending = true;
+
+        if(not writer_thread.joinable())
+        {
+            writer_thread = std::thread(&HDF5MasterBuffer::writer_loop, this);
+        }
+        lock.unlock();
+        writer_cv.notify_all();
+    }
+
+    /// Main loop of the writer thread
+    void HDF5MasterBuffer::writer_loop()
+    {
+        std::unique_lock<std::mutex> lock(writer_mutex);
+        while(true)
+        {
+            writer_cv.wait(lock, [this]{ return write_pending or writer_stop; });
+            if(not write_pending) break; // Stop requested and nothing left to write
+
+            std::vector<std::unique_ptr<HDF5BlockBase>> blocks;
+            blocks.swap(pending_blocks);
+            lock.unlock();
+
+            std::exception_ptr error;
+            try
+            {
+                write_blocks(blocks);
+            }
+            catch(...)
+            {
+                error = std::current_exception();
+            }
+            blocks.clear();
+
+            lock.lock();
+            if(error) writer_error = error;
+            write_pending = false;
+            writer_cv.notify_all();
+        }
+    }
+
+    /// Write a set of detached blocks to the end of the datasets
+    void HDF5MasterBuffer::write_blocks(const std::vector<std::unique_ptr<HDF5BlockBase>>& blocks)
+    {
+        lock_and_open_file();
+        try
+        {
+            std::size_t target_pos = get_next_free_position();
+            for(auto it=blocks.begin(); it!=blocks.end(); ++it)
+            {
+                (*it)->write(location_id, target_pos);
+            }
+        }
+        catch(...)
+        {
+            close_and_unlock_file();
+            throw;
+        }
+        close_and_unlock_file();
+    }
+
+    /// Wait for the writer thread to finish any pending write, and stop it
+    void HDF5MasterBuffer::stop_writer_thread(const bool abnormal)
+    {
+        if(writer_thread.joinable())
+        {
+            {
+                std::lock_guard<std::mutex> lock(writer_mutex);
+                writer_stop = true;
+            }
+            writer_cv.notify_all();
+            writer_thread.join();
+        }
+        async = false; // Any later flushes are done directly
+
+        if(writer_error)
+        {
+            std::exception_ptr error = writer_error;
+            writer_error = nullptr;
+            if(not abnormal) std::rethrow_exception(error);
+            try
+            {
+                std::rethrow_exception(error);
+            }
+            catch(const std::exception& e)
+            {
+                logger()<<LogTags::printers<<LogTags::err<<"Background write to HDF5 file "<<file<<" failed during shutdown: "<<e.what()<<EOM;
+            }
+            catch(...)
+            {
+                logger()<<LogTags::printers<<LogTags::err<<"Background write to HDF5 file "<<file<<" failed during shutdown."<<EOM;
+            }
+        }
+    }
+
     /// Print metadata directly to file
     void HDF5MasterBuffer::print_metadata(map_str_str datasets, bool sameset=false)
     {
@@ -810,6 +942,26 @@ namespace Gambit
 
     #endif
 
+    /// Retrieve the buffer for a given output label and integer type code, creating it if needed
+    HDF5BufferBase& HDF5MasterBuffer::get_buffer_of_type(const std::string& label, const int type)
+    {
+        switch(type)
+        {
+            case h5v2_type<int      >(): return get_buffer<int      >(label, buffered_points);
+            case h5v2_type<uint     >(): return get_buffer<uint     >(label, buffered_points);
+            case h5v2_type<long     >(): return get_buffer<long     >(label, buffered_points);
+            case h5v2_type<ulong    >(): return get_buffer<ulong    >(label, buffered_points);
+            //case h5v2_type<longlong >(): return get_buffer<longlong >(label, buffered_points);
+            //case h5v2_type<ulonglong>(): return get_buffer<ulonglong>(label, buffered_points);
+            case h5v2_type<float    >(): return get_buffer<float    >(label, buffered_points);
+            case h5v2_type<double   >(): return get_buffer<double   >(label, buffered_points);
+        }
+        std::ostringstream errmsg;
+        errmsg<<"Unrecognised datatype integer (value = "<<type<<") requested for buffer "<<label<<"!";
+        printer_error().raise(LOCAL_INFO, errmsg.str());
+        return get_buffer<double>(label, buffered_points); // Never reached
+    }
+
     /// Ensure HDF5 file is open (and locked for us to use)
     void HDF5MasterBuffer::ensure_file_is_open() const
     {
@@ -824,6 +976,9 @@ namespace Gambit
     /// Open (and lock) output HDF5 file and obtain HDF5 handles
     void HDF5MasterBuffer::lock_and_open_file(const char access_type)
     {
+        // Held until close_and_unlock_file (released here if anything below fails)
+        std::unique_lock<std::mutex> access(file_access_mutex());
+
         if(have_lock)
         {
             std::stringstream err;
@@ -851,6 +1006,14 @@ namespace Gambit
 
         file_open=true;
         have_lock=true;
+        access.release();
+    }
+
+    /// Mutex held while any HDF5MasterBuffer in this process has the output file open
+    std::mutex& HDF5MasterBuffer::file_access_mutex()
+    {
+        static std::mutex m;
+        return m;
     }
 
     /// Close (and unlock) output HDF5 file and release HDF5 handles
@@ -863,6 +1026,9 @@ namespace Gambit
             printer_error().raise(LOCAL_INFO, err.str());
         }
 
+        // Taken in lock_and_open_file; released on return
+        std::unique_lock<std::mutex> access(file_access_mutex(), std::adopt_lock);
+
         if(not file_open)
         {
             std::stringstream err;
@@ -906,6 +1072,100 @@ namespace Gambit
         have_lock=false;
     }
 
+    #if defined(WITH_MPI) && defined(H5_HAVE_PARALLEL)
+    /// Open output HDF5 file on all processes via the MPI-IO driver
+    /// Must be called by all processes in the communicator. Rank 0 holds the
+    /// file lock on behalf of everyone until close_file_collective is called.
+    void HDF5MasterBuffer::open_file_collective()
+    {
+        std::string error;
+        if(have_lock or file_open)
+        {
+            error = "HDF5MasterBuffer attempted to open the output hdf5 file for collective access, but it is already open or locked! This is a bug, please report it.";
+        }
+        agree_on_errors(myComm, "opening the output hdf5 file", error);
+
+        std::unique_lock<std::mutex> access(file_access_mutex());
+        hid_t fapl_id = -1;
+        try
+        {
+            if(myComm.Get_rank()==0) hdf5out.get_lock();
+            fapl_id = H5Pcreate(H5P_FILE_ACCESS);
+            if(fapl_id<0 or H5Pset_fapl_mpio(fapl_id, *(myComm.get_boundcomm()), MPI_INFO_NULL)<0)
+            {
+                error = "Failed to set up MPI-IO file access properties for output hdf5 file '"+file+"'!";
+            }
+        }
+        catch(const std::exception& e)
+        {
+            error = e.what();
+        }
+        agree_on_errors(myComm, "setting up collective access to the output hdf5 file", error);
+
+        file_id = H5Fopen(file.c_str(), H5F_ACC_RDWR, fapl_id);
+        H5Pclose(fapl_id);
+        if(file_id<0)
+        {
+            error = "Failed to open output hdf5 file '"+file+"' via the MPI-IO driver! (H5Fopen failed)";
+        }
+        agree_on_errors(myComm, "opening the output hdf5 file", error);
+
+        try
+        {
+            group_id = HDF5::openGroup(file_id,group);
+            metadata_id = HDF5::openGroup(file_id,metadata_group);
+        }
+        catch(const std::exception& e)
+        {
+            error = e.what();
+        }
+        agree_on_errors(myComm, "opening the output groups", error);
+        location_id = group_id;
+
+        file_open=true;
+        have_lock=true;
+        access.release();
+    }
+
+    /// Close output HDF5 file opened by open_file_collective
+    void HDF5MasterBuffer::close_file_collective()
+    {
+        std::string error;
+        if(not (file_open and have_lock))
+        {
+            error = "HDF5MasterBuffer attempted to close the collectively opened output hdf5 file, but it is not open! This is a bug, please report it.";
+        }
+        agree_on_errors(myComm, "closing the output hdf5 file", error);
+
+        try
+        {
+            HDF5::closeGroup(group_id);
+            HDF5::closeGroup(metadata_id);
+        }
+        catch(const std::exception& e)
+        {
+            error = e.what();
+        }
+        agree_on_errors(myComm, "closing the output groups", error);
+
+        try
+        {
+            HDF5::closeFile(file_id);
+        }
+        catch(const std::exception& e)
+        {
+            error = e.what();
+        }
+
+        if(myComm.Get_rank()==0) hdf5out.release_lock();
+        file_access_mutex().unlock();
+
+        file_open=false;
+        have_lock=false;
+        agree_on_errors(myComm, "closing the output hdf5 file", error);
+    }
+    #endif
+
     /// Clear all data in buffers ***and on disk*** for this printer
     void HDF5MasterBuffer::reset()
     {
@@ -1420,10 +1680,11 @@ namespace Gambit
       , myRank(0)
       , mpiSize(1)
       , lastPointID(nullpoint)
+      , parallel_io(options.getValueOrDef<bool>(false,"parallel_io"))
 #ifdef WITH_MPI
       , myComm() // initially attaches to MPI_COMM_WORLD
 #endif
-      , buffermaster(get_filename(options),get_groupname(options),get_metadata_groupname(options),get_sync(options),get_buffer_length(options)
+      , buffermaster(get_filename(options),get_groupname(options),get_metadata_groupname(options),get_sync(options),get_buffer_length(options),get_async(options)
 #ifdef WITH_MPI
         , myComm
 #endif
@@ -1459,6 +1720,19 @@ namespace Gambit
             // Attempt repairs on existing HDF5 output if inconsistencies detected
             bool attempt_repair = !options.getValueOrDef<bool>(false,"disable_autorepair");
 
+            // Collective writes need HDF5 built with MPI-IO support
+            if(parallel_io)
+            {
+#ifndef WITH_MPI
+                printer_warning().raise(LOCAL_INFO, "The 'parallel_io' option of the hdf5 printer has no effect since GAMBIT was built without MPI. It will be ignored.");
+                parallel_io = false;
+#elif !defined(H5_HAVE_PARALLEL)
+                std::ostringstream errmsg;
+                errmsg<<"The 'parallel_io' option of the hdf5 printer was set, but the HDF5 library that GAMBIT was built against does not support parallel (MPI-IO) access. Please rebuild GAMBIT against a parallel HDF5 installation, or remove the 'parallel_io' option to use the default (serial) output mode.";
+                printer_error().raise(LOCAL_INFO, errmsg.str());
+#endif
+            }
+
             std::vector<ulong> highests(mpiSize);
 
             std::string file  = get_filename();
@@ -1877,8 +2151,9 @@ namespace Gambit
     }
 
     // Make sure printer output is fully on disk and safe
-    // No distinction between final and early termination procedure for this printer.
-    void HDF5Printer2::finalise(bool /*abnormal*/)
+    // No distinction between final and early termination procedure for this printer,
+    // except that errors from background writes are only logged in the latter case.
+    void HDF5Printer2::finalise(bool abnormal)
     {
         // DEBUG h5v2_BLOCK message counter
         //recv_counter = 0;
@@ -1887,6 +2162,13 @@ namespace Gambit
         // The primary printer will take care of finalising all output.
         if(not is_auxilliary_printer())
         {
+            // Let any background writes finish before anything else touches the file
+            buffermaster.stop_writer_thread(abnormal);
+            for(auto it=aux_buffers.begin(); it!=aux_buffers.end(); ++it)
+            {
+                (*it)->stop_writer_thread(abnormal);
+            }
+
             // On HPC systems we are likely to be using hundreds or thousands of processes,
             // over a networked filesystem. If each process tries to write to the
             // output file all at once, it will create an enormous bottleneck and be very
@@ -1895,6 +2177,8 @@ namespace Gambit
             // and have the master process write everything to disk. Fortunately all the
             // processes can be synced here, so we can do some big collective
             // operations to send everything.
+            // Alternatively, with the 'parallel_io' option and a parallel HDF5 library,
+            // every process writes its own block of the sync datasets collectively via MPI-IO.
 
             #ifdef WITH_MPI
             // Gather and print the sync buffer data
@@ -1918,8 +2202,18 @@ namespace Gambit
             logger()<<"# sync printer streams: "<<sync_buffers.size()<<std::endl;
             logger()<<"# RA printer streams  : "<<RA_buffers.size()<<EOM;
             #endif
-            logger()<<LogTags::printers<<LogTags::info<<"Gathering sync buffer data from all processes to rank 0 process..."<<EOM;
-            gather_and_print(buffermaster,sync_buffers,true);
+            #ifdef H5_HAVE_PARALLEL
+            if(parallel_io)
+            {
+                logger()<<LogTags::printers<<LogTags::info<<"Writing sync buffer data from all processes collectively via MPI-IO..."<<EOM;
+                write_collective(sync_buffers);
+            }
+            else
+            #endif
+            {
+                logger()<<LogTags::printers<<LogTags::info<<"Gathering sync buffer data from all processes to rank 0 process..."<<EOM;
+                gather_and_print(buffermaster,sync_buffers,true);
+            }
             #endif
 
             // Flush remaining buffer data
@@ -1967,7 +2261,7 @@ namespace Gambit
             // Gather RA print buffer data from all other processes
 
             // Create a dedicate unsynchronised 'aux' buffer handler to receive data from other processes (and also this one!)
-            HDF5MasterBuffer RAbuffer(get_filename(),get_groupname(),get_metadata_groupname(),false,get_buffer_length(),myComm);
+            HDF5MasterBuffer RAbuffer(get_filename(),get_groupname(),get_metadata_groupname(),false,get_buffer_length(),false,myComm);
 
             // Add it to RA_buffers in case there are none, to satisfy various collective operation requirements
             RA_buffers.push_back(&RAbuffer);
@@ -2166,6 +2460,16 @@ namespace Gambit
         return options.getValueOrDef<bool>(true,"synchronised");
     }
 
+    /// Report whether sync buffers are flushed by a background thread (from options or primary printer)
+    bool HDF5Printer2::get_async(const Options& options)
+    {
+        if(is_auxilliary_printer())
+        {
+            return get_HDF5_primary_printer()->buffermaster.is_async();
+        }
+        return options.getValueOrDef<bool>(false,"async_flush");
+    }
+
     // Get options required to construct a reader object that can read
     // the previous output of this printer.
     Options HDF5Printer2::resume_reader_options()
@@ -2518,6 +2822,137 @@ namespace Gambit
         }
     }
 
+    #if defined(WITH_MPI) && defined(H5_HAVE_PARALLEL)
+    // Write sync buffer data from all processes directly to disk via collective MPI-IO.
+    // Each process writes its own contiguous block of every dataset, so nothing has to
+    // pass through rank 0 except the (small) dataset creation and extension step.
+    // Before every collective operation, all processes agree on whether the preceding
+    // steps succeeded everywhere, so that an error on one process is raised on all of
+    // them rather than leaving the others waiting.
+    void HDF5Printer2::write_collective(const std::vector<HDF5MasterBuffer*>& masterbuffers)
+    {
+        std::string error;
+
+        // Agree on the names and types of all datasets to be written, in the same order on all processes
+        std::pair<std::map<std::string,int>,std::vector<std::pair<std::string,int>>> ids_and_types = get_buffer_idcodes(masterbuffers);
+        std::vector<std::string> names(ids_and_types.first.size());
+        std::vector<int> types(names.size());
+        try
+        {
+            for(auto it=ids_and_types.first.begin(); it!=ids_and_types.first.end(); ++it)
+            {
+                names.at(it->second) = it->first;
+            }
+            if(myRank==0)
+            {
+                for(std::size_t i=0; i<names.size(); i++) types[i] = ids_and_types.second.at(i).second;
+            }
+        }
+        catch(const std::exception& e)
+        {
+            error = e.what();
+        }
+        agree_on_errors(myComm, "collecting the dataset names", error);
+        myComm.Bcast(types, types.size(), 0);
+
+        // Points buffered on this process, in the order they will be written
+        std::vector<PPIDpair> order;
+
+        // Collect our buffer for every dataset. All processes have to take part in every
+        // write, so create (all-invalid) buffers for datasets that we have no data for.
+        std::vector<HDF5BufferBase*> buffers;
+        try
+        {
+            std::set<PPIDpair> all_points;
+            for(auto bt=masterbuffers.begin(); bt!=masterbuffers.end(); ++bt)
+            {
+                const std::set<PPIDpair>& points = (*bt)->get_all_points();
+                all_points.insert(points.begin(), points.end());
+            }
+            order.assign(all_points.begin(), all_points.end());
+
+            for(std::size_t i=0; i<names.size(); i++)
+            {
+                HDF5BufferBase* buffer = NULL;
+                for(auto bt=masterbuffers.begin(); bt!=masterbuffers.end() and buffer==NULL; ++bt)
+                {
+                    const std::map<std::string,HDF5BufferBase*>& all_buffers = (*bt)->get_all_buffers();
+                    auto jt = all_buffers.find(names[i]);
+                    if(jt!=all_buffers.end()) buffer = jt->second;
+                }
+                if(buffer==NULL) buffer = &(masterbuffers.at(0)->get_buffer_of_type(names[i],types[i]));
+                for(auto pt=order.begin(); pt!=order.end(); ++pt) buffer->update(*pt);
+                buffers.push_back(buffer);
+            }
+        }
+        catch(const std::exception& e)
+        {
+            error = e.what();
+        }
+        agree_on_errors(myComm, "collecting the buffers to write", error);
+
+        // Work out where our block of points goes
+        std::vector<unsigned long> npoints(1,order.size());
+        std::vector<unsigned long> npoints_all(mpiSize);
+        myComm.AllGather(npoints, npoints_all);
+        std::size_t offset = 0;
+        std::size_t total = 0;
+        for(std::size_t r=0; r<mpiSize; r++)
+        {
+            if(r<myRank) offset += npoints_all[r];
+            total += npoints_all[r];
+        }
+        logger()<<LogTags::printers<<LogTags::info<<"Writing "<<order.size()<<" points (of "<<total<<" from all processes) to "<<buffers.size()<<" datasets, at offset "<<offset<<" from the current end of the output"<<EOM;
+
+        // Rank 0 creates any missing datasets and extends all of them to their final size, so
+        // that the collective phase only has to write data (the usual serial, locked access)
+        std::vector<unsigned long> start(1,0);
+        if(myRank==0)
+        {
+            try
+            {
+                HDF5MasterBuffer& target = *masterbuffers.at(0);
+                target.lock_and_open_file();
+                start[0] = target.get_next_free_position();
+                for(auto it=buffers.begin(); it!=buffers.end(); ++it)
+                {
+                    (*it)->ensure_dataset_exists(target.get_location_id(), start[0]+total);
+                }
+                target.close_and_unlock_file();
+            }
+            catch(const std::exception& e)
+            {
+                error = e.what();
+            }
+        }
+        agree_on_errors(myComm, "creating and extending the datasets", error);
+        myComm.Bcast(start, 1, 0);
+
+        // Write all the blocks
+        HDF5MasterBuffer& target = *masterbuffers.at(0);
+        target.open_file_collective();
+        hid_t dxpl_id = H5Pcreate(H5P_DATASET_XFER);
+        if(dxpl_id<0 or H5Pset_dxpl_mpio(dxpl_id, H5FD_MPIO_COLLECTIVE)<0)
+        {
+            error = "Failed to set up collective MPI-IO data transfer properties!";
+        }
+        agree_on_errors(myComm, "setting up the collective data transfer", error);
+        for(auto it=buffers.begin(); it!=buffers.end(); ++it)
+        {
+            (*it)->collective_flush(target.get_location_id(), order, start[0]+offset, dxpl_id);
+        }
+        H5Pclose(dxpl_id);
+        target.close_file_collective();
+
+        // Buffers are now empty; stop tracking the points
+        for(auto bt=masterbuffers.begin(); bt!=masterbuffers.end(); ++bt)
+        {
+            std::set<PPIDpair> points = (*bt)->get_all_points();
+            (*bt)->untrack_points(points);
+        }
+    }
+    #endif
+
     // Gather (via MPI) all HDF5 buffer chunk data from a set of managed buffers
     std::vector<HDF5bufferchunk> HDF5Printer2::gather_all(GMPI::Comm& comm, const std::vector<HDF5MasterBuffer*>& masterbuffers, const std::map<std::string,int>& buf_ids)
     {
@@ -12,6 +12,9 @@
 ///          (b.farmer@imperial.ac.uk)
 ///  \date 2018 Dec
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 ///
 ///  TODO: Turns out SQLite is case-insensitive, so need
@@ -22,6 +25,7 @@
 #include <sstream>
 #include <chrono>
 #include <thread>
+#include <algorithm>
 
 // SQLite3 C interface
 #include <sqlite3.h>
@@ -52,9 +56,12 @@ namespace Gambit
     , lastMetadataID(0)
     , lastPointID(nullpoint)
     , max_buffer_length(options.getValueOrDef<std::size_t>(1,"buffer_length"))
+    , journal_mode(options.getValueOrDef<std::string>("DELETE","journal_mode"))
+    , synchronous(options.getValueOrDef<std::string>("FULL","synchronous"))
     , buffer_info()
     , buffer_header()
     , transaction_data_buffer()
+    , statements()
     , synchronised(!options.getValueOrDef<bool>(false,"auxilliary"))
     {
         std::string database_file;
@@ -70,6 +77,8 @@ namespace Gambit
             table_name          = primary_printer->get_table_name();
             metadata_table_name = primary_printer->get_metadata_table_name();
             max_buffer_length   = primary_printer->get_max_buffer_length();
+            journal_mode        = primary_printer->get_journal_mode();
+            synchronous         = primary_printer->get_synchronous();
         }
         else
         {
@@ -151,6 +160,22 @@ namespace Gambit
         // Create/open the database file
         open_db(database_file,'+');
 
+        // Set the journal mode and how often the database syncs to disk. WAL (with synchronous
+        // NORMAL) makes commits much cheaper, but needs all processes writing to the database
+        // to be on the same host, i.e. it is not safe on network filesystems.
+        const std::vector<std::string> journal_modes = {"DELETE", "TRUNCATE", "PERSIST", "MEMORY", "WAL", "OFF"};
+        const std::vector<std::string> synchronous_modes = {"OFF", "NORMAL", "FULL", "EXTRA", "0", "1", "2", "3"};
+        if(std::none_of(journal_modes.begin(), journal_modes.end(), [&](const std::string& m){ return Utils::iequals(m,journal_mode); }))
+        {
+            printer_error().raise(LOCAL_INFO, "Unknown SQLite journal_mode '"+journal_mode+"' requested for the sqlite printer! Valid options are DELETE, TRUNCATE, PERSIST, MEMORY, WAL and OFF.");
+        }
+        if(std::none_of(synchronous_modes.begin(), synchronous_modes.end(), [&](const std::string& m){ return Utils::iequals(m,synchronous); }))
+        {
+            printer_error().raise(LOCAL_INFO, "Unknown SQLite synchronous setting '"+synchronous+"' requested for the sqlite printer! Valid options are OFF, NORMAL, FULL and EXTRA.");
+        }
+        submit_sql(LOCAL_INFO, "PRAGMA journal_mode="+journal_mode+";");
+        submit_sql(LOCAL_INFO, "PRAGMA synchronous="+synchronous+";");
+
         // Create the results table in the database (if it doesn't already exist)
         make_table(table_name);
         make_metadata_table(metadata_table_name);
@@ -241,7 +266,16 @@ namespace Gambit
         }
     }
 
+    // Destructor
+    SQLitePrinter::~SQLitePrinter()
+    {
+        // Statements must be finalised before the database can be closed
+        for(auto& stmt : statements) sqlite3_finalize(stmt.second);
+    }
+
     std::size_t SQLitePrinter::get_max_buffer_length() {return max_buffer_length;}
+    std::string SQLitePrinter::get_journal_mode() {return journal_mode;}
+    std::string SQLitePrinter::get_synchronous() {return synchronous;}
 
     void SQLitePrinter::initialise(const std::vector<int>&)
     {
@@ -517,7 +551,7 @@ namespace Gambit
     }
 
     // Queue data for a table insert operation into the SQLitePrinter internal buffer
-    void SQLitePrinter::insert_data(const unsigned int mpirank, const unsigned long pointID, const std::string& col_name, const std::string& col_type, const std::string& data)
+    void SQLitePrinter::insert_data(const unsigned int mpirank, const unsigned long pointID, const std::string& col_name, const std::string& col_type, const sql_value& data)
     {
         // Get the pairID for this rank/pointID combination
         std::size_t rowID = pairfunc(mpirank,pointID);
@@ -545,7 +579,7 @@ namespace Gambit
 
             // Data is set to 'null' until we add some.
             std::size_t current_row_size=buffer_info.size();
-            transaction_data_buffer.emplace(rowID,std::vector<std::string>(current_row_size,"null"));
+            transaction_data_buffer.emplace(rowID,std::vector<sql_value>(current_row_size));
         }
 
         // Check if this column exists in the current output buffer
@@ -571,11 +605,11 @@ namespace Gambit
             for(auto jt=transaction_data_buffer.begin();
                      jt!=transaction_data_buffer.end(); ++jt)
             {
-               std::vector<std::string>& row = jt->second;
+               std::vector<sql_value>& row = jt->second;
 
                // Add new empty column to every row
                // Values are null until we add them
-               row.push_back("null");
+               row.push_back(sql_value());
 
                // Make sure size is correct
                if(row.size()!=buffer_header.size())
@@ -615,102 +649,120 @@ namespace Gambit
         transaction_data_buffer.clear();
     }
 
-    // Create an SQL table insert operation for the current transaction_data_buffer
-    // Modifies 'sql' stringstream in-place
-    void SQLitePrinter::turn_buffer_into_insert(std::stringstream& sql, const std::string& table)
+    // Get the prepared statement writing buffer columns [first,last) of a row.
+    // Parameter 1 is the pairID, and parameters 2,3,... are the columns.
+    sqlite3_stmt* SQLitePrinter::get_statement(statement_kind kind, std::size_t first, std::size_t last)
     {
-        sql<<"INSERT INTO "<<table<<" (\npairID,\n";
-        for(auto col_name_it=buffer_header.begin(); col_name_it!=buffer_header.end(); ++col_name_it)
+        auto key = std::make_tuple(kind,first,last);
+        auto it = statements.find(key);
+        if(it!=statements.end()) return it->second;
+
+        std::stringstream sql;
+        if(kind==INSERT_ROW)
         {
-            sql<<"`"<<(*col_name_it)<<"`"<<comma_unless_last(col_name_it,buffer_header)<<"\n";
+            sql<<"INSERT INTO "<<get_table_name()<<" (pairID";
+            for(std::size_t i=first; i<last; ++i) sql<<",`"<<buffer_header[i]<<"`";
+            sql<<") VALUES (?1";
+            for(std::size_t i=first; i<last; ++i) sql<<",?"<<i-first+2;
+            sql<<");";
         }
-        sql<<") VALUES ";
-        for(auto row_it=transaction_data_buffer.begin();
-                 row_it!=transaction_data_buffer.end(); ++row_it)
+        else
         {
-            sql<<"(\n";
-            std::size_t pairID = row_it->first;
-            std::vector<std::string>& row = row_it->second;
-            sql<<pairID<<",\n";
-            for(auto col_it=row.begin(); col_it!=row.end(); ++col_it)
-            {
-                sql<<(*col_it)<<comma_unless_last(col_it,row)<<"\n";
-            }
-            sql<<")\n"<<comma_unless_last(row_it,transaction_data_buffer);
+            sql<<"UPDATE "<<get_table_name()<<" SET ";
+            for(std::size_t i=first; i<last; ++i) sql<<(i>first ? "," : "")<<"`"<<buffer_header[i]<<"`=?"<<i-first+2;
+            sql<<" WHERE pairID=?1;";
         }
-        sql<<";"; // End statement
-    }
 
-    // Execute an SQLite transaction to write the buffer to the output table
-    void SQLitePrinter::dump_buffer_as_INSERT()
-    {
-        // Add the table INSERT operation to a stream
-        std::stringstream sql;
-        turn_buffer_into_insert(sql,get_table_name());
-
-        //std::cout<<sql.str(); // DEBUG
-
-        /* Execute SQL statement */
-        submit_sql(LOCAL_INFO,sql.str());
+        sqlite3_stmt* stmt;
+        int rc;
+        while((rc = sqlite3_prepare_v2(get_db(), sql.str().c_str(), -1, &stmt, NULL)) == SQLITE_BUSY)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        if(rc != SQLITE_OK)
+        {
+            std::stringstream err;
+            err<<"Encountered SQLite error while preparing statement to write the printer buffer: "<<sqlite3_errmsg(get_db())<<std::endl;
+#ifdef SQL_DEBUG
+            err<<"The attempted SQL statement was:"<<std::endl;
+            err<<sql.str()<<std::endl;
+#endif
+            printer_error().raise(LOCAL_INFO, err.str());
+        }
+        statements[key] = stmt;
+        return stmt;
     }
 
-    void SQLitePrinter::dump_buffer_as_UPDATE()
+    // Bind the pairID and buffer columns [first,last) of a row to a statement, and execute it
+    void SQLitePrinter::write_row(sqlite3_stmt* stmt, std::size_t pairID, const std::vector<sql_value>& row, std::size_t first, std::size_t last)
     {
-        std::stringstream sql;
-        // So for this is seems like the best thing to do is create a temporary
-        // table with this new data, and then update the main output table from
-        // this. Otherwise we have to write tonnes of separate 'update' statements,
-        // which is probably not very fast.
-        // So first we need to create the temporary table.
-        sql << "DROP TABLE IF EXISTS temp_table;\n"
-            << "CREATE TEMPORARY TABLE temp_table("
-            << "pairID   INT PRIMARY KEY NOT NULL,\n";
-        for(auto col_it=buffer_info.begin(); col_it!=buffer_info.end(); ++col_it)
+        sqlite3_bind_int64(stmt, 1, pairID);
+        for(std::size_t i=first; i<last; ++i)
         {
-            const std::string& col_name(col_it->first);
-            const std::string& col_type(col_it->second.second);
-            sql<<"`"<<col_name<<"`   "<<col_type<<comma_unless_last(col_it,buffer_info)<<"\n";
+            const int param = i-first+2;
+            switch(row[i].kind)
+            {
+                case sql_value::INTEGER_VALUE: sqlite3_bind_int64(stmt, param, row[i].i); break;
+                case sql_value::REAL_VALUE:    sqlite3_bind_double(stmt, param, row[i].d); break;
+                default:                       sqlite3_bind_null(stmt, param);
+            }
         }
-        sql <<");\n";
-
-        // Insert data into the temporary table
-        turn_buffer_into_insert(sql,"temp_table");
 
-        // Update the primary output table using the temporary table
-        // Following: https://stackoverflow.com/a/47753166/1447953
-        sql<<"UPDATE "<<get_table_name()<<" SET (\n";
-        for(auto col_name_it=buffer_header.begin(); col_name_it!=buffer_header.end(); ++col_name_it)
+        int rc;
+        while((rc = sqlite3_step(stmt)) == SQLITE_BUSY)
         {
-            sql<<*col_name_it<<comma_unless_last(col_name_it,buffer_header)<<"\n";
+            // Wait at least a short time to avoid slamming the filesystem too much
+            sqlite3_reset(stmt);
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
         }
-        sql<<") = (SELECT \n";
-        for(auto col_name_it=buffer_header.begin(); col_name_it!=buffer_header.end(); ++col_name_it)
+        if(rc != SQLITE_DONE)
         {
-            sql<<"temp_table."<<*col_name_it<<comma_unless_last(col_name_it,buffer_header)<<"\n";
+            std::stringstream err;
+            err<<"SQL error while writing the printer buffer: "<<sqlite3_errmsg(get_db())<<std::endl;
+#ifdef SQL_DEBUG
+            err<<"The attempted SQL statement was:"<<std::endl;
+            err<<sqlite3_sql(stmt)<<std::endl;
+#endif
+            sqlite3_reset(stmt);
+            printer_error().raise(LOCAL_INFO, err.str());
         }
-        sql<<" FROM temp_table WHERE temp_table.pairID = "<<get_table_name()<<".pairID)\n";
-        sql<<" WHERE EXISTS ( SELECT * FROM temp_table WHERE temp_table.pairID = "<<get_table_name()<<".pairID);\n";
-
-        /* Execute SQL statement */
-        submit_sql(LOCAL_INFO,sql.str());
+        sqlite3_reset(stmt);
     }
 
+    // Execute an SQLite transaction to write the buffer to the output table
     void SQLitePrinter::dump_buffer()
     {
         require_output_ready();
         // Don't try to dump the buffer if it is empty!
         if(transaction_data_buffer.size()>0)
         {
-            if(synchronised)
+            // Statements can only bind a limited number of parameters, so
+            // very wide rows are written in chunks of columns.
+            const std::size_t ncols = buffer_header.size();
+            const std::size_t chunk = std::max(1, sqlite3_limit(get_db(), SQLITE_LIMIT_VARIABLE_NUMBER, -1) - 1);
+
+            submit_sql(LOCAL_INFO, "BEGIN IMMEDIATE;");
+            try
             {
-                // Primary dataset writes can be performed as INSERT operations
-                dump_buffer_as_INSERT();
+                for(auto row_it=transaction_data_buffer.begin(); row_it!=transaction_data_buffer.end(); ++row_it)
+                {
+                    for(std::size_t first=0; first<ncols; first+=chunk)
+                    {
+                        // Primary dataset writes insert new rows, whereas asynchronous
+                        // ('auxilliary') writes need to update previously existing rows
+                        statement_kind kind = (synchronised and first==0) ? INSERT_ROW : UPDATE_ROW;
+                        std::size_t last = std::min(first+chunk,ncols);
+                        write_row(get_statement(kind,first,last), row_it->first, row_it->second, first, last);
+                    }
+                }
             }
-            else
+            catch(...)
             {
-                // Asynchronous ('auxilliary') writes need to be performed as UPDATE operations
-                dump_buffer_as_UPDATE();
+                submit_sql(LOCAL_INFO, "ROLLBACK;", true);
+                throw;
             }
+            submit_sql(LOCAL_INFO, "COMMIT;");
+
             // Clear all the buffer data
             clear_buffer();
         }
@@ -0,0 +1,100 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Unit tests for the agreement on errors between
+///  the processes taking part in a collective
+///  write of the hdf5 printer.  Run with mpirun
+///  on any number of processes.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#include <stdexcept>
+
+#include "gambit/Printers/printers/hdf5printer_v2.hpp"
+#include "gambit/Utils/static_members.hpp"
+#include "unit_test.hpp"
+
+using namespace Gambit;
+
+/// Run a step that fails on the processes selected by fail_on, followed by a collective
+/// operation; return whether the step raised an error on this process.
+bool step(GMPI::Comm& comm, const std::function<bool(int)>& fail_on, std::string& message)
+{
+  std::string error;
+  try
+  {
+    if (fail_on(comm.Get_rank())) throw std::runtime_error("step failed on rank " + std::to_string(comm.Get_rank()));
+  }
+  catch (const std::exception& e)
+  {
+    error = e.what();
+  }
+  try
+  {
+    Printers::agree_on_errors(comm, "running the test step", error);
+    // Stands in for the next collective HDF5 call, which a process that raised never reaches
+    std::vector<int> value(1, 0);
+    comm.Bcast(value, 1, 0);
+  }
+  catch (const std::exception& e)
+  {
+    message = e.what();
+    return true;
+  }
+  return false;
+}
+
+/// Number of processes on which a step raised an error
+int count_raised(GMPI::Comm& comm, bool raised)
+{
+  int mine = raised ? 1 : 0;
+  int total = 0;
+  comm.Allreduce(mine, total, MPI_SUM);
+  return total;
+}
+
+int main()
+{
+  GMPI::Init();
+  {
+    GMPI::Comm comm;
+    const int rank = comm.Get_rank();
+    const int size = comm.Get_size();
+    std::string message;
+
+    // A step that succeeds everywhere raises nothing
+    EXPECT(count_raised(comm, step(comm, [](int) { return false; }, message)) == 0);
+
+    // A step that fails on any one process raises on all of them, without any of them
+    // waiting for the others in the following collective operation
+    for (int r = 0; r < size; ++r)
+    {
+      message.clear();
+      bool raised = step(comm, [r](int me) { return me == r; }, message);
+      EXPECT(raised);
+      EXPECT(count_raised(comm, raised) == size);
+      // The failing process reports its own error; the others point to it
+      if (rank == r) EXPECT(message.find("step failed on rank " + std::to_string(r)) != std::string::npos);
+      else EXPECT(message.find("on another process") != std::string::npos);
+    }
+
+    // Likewise if the step fails on several processes
+    message.clear();
+    bool raised = step(comm, [](int me) { return me % 2 == 1; }, message);
+    EXPECT(count_raised(comm, raised) == (size > 1 ? size : 0));
+
+    // Agreement still works after errors have been raised
+    EXPECT(count_raised(comm, step(comm, [](int) { return false; }, message)) == 0);
+  }
+  int result = UnitTest::result();
+  GMPI::Finalize();
+  return result;
+}
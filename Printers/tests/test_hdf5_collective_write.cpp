@@ -0,0 +1,190 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Unit test comparing the output of the hdf5
+///  printer with collective MPI-IO writes
+///  (parallel_io) to that of the default serial
+///  writer, for a new run and for a resumed one.
+///  Run with mpirun on any number of processes,
+///  against a parallel HDF5 build.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#include <cstdio>
+#include <map>
+#include <utility>
+
+#include "gambit/Printers/printers/hdf5printer_v2.hpp"
+#include "gambit/Utils/static_members.hpp"
+#include "unit_test.hpp"
+
+using namespace Gambit;
+
+/// Valid flag and value of every dataset at one point
+typedef std::map<std::string, std::pair<int, double>> point_record;
+/// Contents of an output group, keyed by MPI rank and point ID
+typedef std::map<std::pair<int, unsigned long long>, point_record> file_contents;
+
+/// Number of points printed by a process in a run; different on every process,
+/// so that the processes write blocks of different lengths
+unsigned long long points_on(int rank) { return 11 + 3*rank; }
+
+/// Print the points [first, first + points_on(rank)) of this process with a printer of the given options
+void run(const std::string& filename, bool parallel_io, bool resume, unsigned long long first, int rank, int size)
+{
+  YAML::Node node;
+  node["output_path"] = ".";
+  node["output_file"] = filename;
+  node["group"] = "/data";
+  node["delete_file_on_restart"] = true;
+  node["resume"] = resume;
+  node["buffer_length"] = 5;   // Shorter than a run, so that part of each run is flushed before finalise
+  node["parallel_io"] = parallel_io;
+  Printers::HDF5Printer2 printer{Options(node)};
+  // Set by the printer manager in a scan; the metadata group is not written collectively
+  printer.set_output_metadata(false);
+
+  for (unsigned long long id = first; id < first + points_on(rank); ++id)
+  {
+    printer.print(id, "pointID", rank, id);
+    printer.print(rank, "MPIrank", rank, id);
+    printer.print(0.5*id - rank, "LogLike", rank, id);
+    // Only some of the points, and none on the last process, so that some processes
+    // have no data at all for this dataset
+    if (id % 3 == 0 and rank != size - 1) printer.print(int(id*size + rank), "flag", rank, id);
+  }
+  printer.finalise();
+}
+
+/// Read one dataset of a group, converted to the given type
+template <typename T>
+std::vector<T> read_dataset(hid_t group_id, const std::string& name, hid_t type)
+{
+  hid_t dset_id = H5Dopen2(group_id, name.c_str(), H5P_DEFAULT);
+  hid_t space_id = H5Dget_space(dset_id);
+  std::vector<T> data(H5Sget_simple_extent_npoints(space_id));
+  if (not data.empty()) H5Dread(dset_id, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, &data[0]);
+  H5Sclose(space_id);
+  H5Dclose(dset_id);
+  return data;
+}
+
+/// Read the output group of a file; also check that all its datasets have the same length
+file_contents read_file(const std::string& filename, bool& same_lengths)
+{
+  same_lengths = false;
+  hid_t file_id = H5Fopen(filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  if (file_id < 0) return file_contents();
+  hid_t group_id = H5Gopen2(file_id, "/data", H5P_DEFAULT);
+  if (group_id < 0)
+  {
+    H5Fclose(file_id);
+    return file_contents();
+  }
+
+  std::vector<std::string> names;
+  H5G_info_t info;
+  H5Gget_info(group_id, &info);
+  for (hsize_t i = 0; i < info.nlinks; ++i)
+  {
+    char name[256];
+    H5Lget_name_by_idx(group_id, ".", H5_INDEX_NAME, H5_ITER_INC, i, name, sizeof(name), H5P_DEFAULT);
+    std::string s(name);
+    if (s.size() < 8 or s.substr(s.size() - 8) != "_isvalid") names.push_back(s);
+  }
+
+  const std::vector<int> ranks = read_dataset<int>(group_id, "MPIrank", H5T_NATIVE_INT);
+  const std::vector<unsigned long long> ids = read_dataset<unsigned long long>(group_id, "pointID", H5T_NATIVE_ULLONG);
+  const std::vector<int> ids_valid = read_dataset<int>(group_id, "pointID_isvalid", H5T_NATIVE_INT);
+  same_lengths = (ids.size() == ranks.size() and ids.size() == ids_valid.size());
+
+  file_contents contents;
+  for (const std::string& name : names)
+  {
+    const std::vector<double> values = read_dataset<double>(group_id, name, H5T_NATIVE_DOUBLE);
+    const std::vector<int> valid = read_dataset<int>(group_id, name + "_isvalid", H5T_NATIVE_INT);
+    same_lengths = same_lengths and values.size() == ids.size() and valid.size() == ids.size();
+    for (size_t i = 0; i < std::min(values.size(), ids.size()); ++i)
+    {
+      // Rows not holding any point are not part of the output
+      if (not ids_valid[i]) continue;
+      contents[{ranks[i], ids[i]}][name] = {valid[i], valid[i] ? values[i] : 0.0};
+    }
+  }
+
+  H5Gclose(group_id);
+  H5Fclose(file_id);
+  return contents;
+}
+
+int main()
+{
+  GMPI::Init();
+  {
+    GMPI::Comm comm;
+    const int rank = comm.Get_rank();
+    const int size = comm.Get_size();
+    const std::string serial_file = "test_hdf5_collective_write_serial.hdf5";
+    const std::string parallel_file = "test_hdf5_collective_write_parallel.hdf5";
+
+    // A new run, then a run resumed from its output (which checks the consistency of the
+    // existing file first), with the serial writer and with collective writes
+    const unsigned long long first_resumed = 100;
+    for (const bool parallel_io : {false, true})
+    {
+      const std::string& file = parallel_io ? parallel_file : serial_file;
+      try
+      {
+        run(file, parallel_io, false, 1, rank, size);
+        comm.Barrier();
+        run(file, parallel_io, true, first_resumed, rank, size);
+        comm.Barrier();
+      }
+      catch (const std::exception& e)
+      {
+        std::cerr << "rank " << rank << ": " << (parallel_io ? "collective" : "serial") << " run failed: " << e.what() << std::endl;
+        EXPECT(false);
+      }
+    }
+
+    if (rank == 0)
+    {
+      bool serial_lengths = false, parallel_lengths = false;
+      const file_contents serial = read_file(serial_file, serial_lengths);
+      const file_contents parallel = read_file(parallel_file, parallel_lengths);
+      EXPECT(serial_lengths);
+      EXPECT(parallel_lengths);
+
+      // Every point of both runs of every process is there once
+      size_t expected = 0;
+      for (int r = 0; r < size; ++r) expected += 2*points_on(r);
+      EXPECT(serial.size() == expected);
+      EXPECT(parallel.size() == expected);
+
+      // Spot-check the serial output itself, then require the collective output to match it
+      const auto last = serial.find({size - 1, first_resumed});
+      EXPECT(last != serial.end());
+      if (last != serial.end())
+      {
+        EXPECT(last->second.at("LogLike").first == 1);
+        EXPECT_CLOSE(last->second.at("LogLike").second, 0.5*first_resumed - (size - 1), 1e-12);
+        EXPECT(last->second.count("flag") == 0 or last->second.at("flag").first == 0);
+      }
+      EXPECT(parallel == serial);
+
+      std::remove(serial_file.c_str());
+      std::remove(parallel_file.c_str());
+    }
+  }
+  int result = UnitTest::result();
+  GMPI::Finalize();
+  return result;
+}
@@ -24,6 +24,9 @@
 ///          (anders.kvellestad@fys.uio.no
 ///  \date 2021 Feb
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #ifndef __FACTORY_DEFS_HPP__
@@ -32,6 +35,8 @@
 #include <string>
 #include <typeinfo>
 #include <memory>
+#include <vector>
+#include <algorithm>
 
 #ifdef WITH_MPI
   #include <chrono>
@@ -325,6 +330,49 @@ namespace Gambit
         private:
             typedef scan_ptr<double (std::unordered_map<std::string, double> &)> s_ptr;
 
+            /// Things that stay the same from one point to the next, looked up once per call or batch.
+            struct point_context
+            {
+                std::unordered_map<std::string, double> &map;
+                int rank;
+                std::string purpose;
+                std::string modified_purpose;
+                bool print_unitcube;
+                std::vector<double> unitcube;
+            };
+
+            point_context get_context()
+            {
+                std::string purpose = (*this)->getPurpose();
+                return point_context{(*this)->getMap(), (*this)->getRank(), purpose, "Modified" + purpose,
+                                     (*this)->getPrinter().get_printUnitcube(), std::vector<double>()};
+            }
+
+            /// Transform, evaluate and print a single point in the unit hypercube, recording its point ID in id_out if given.
+            double evaluate(hyper_cube_ref<double> vec, point_context &ctx, unsigned long long *id_out = nullptr)
+            {
+                (*this)->getPrior().transform(vec, ctx.map);
+                double ret_val = (*this)->operator()(ctx.map);
+                double modified_ret_val = (*this)->purposeModifier(ret_val);
+                unsigned long long int id = Gambit::Printers::get_point_id();
+                if (id_out != nullptr) *id_out = id;
+                (*this)->getPrinter().print(ret_val, ctx.purpose, ctx.rank, id);
+                (*this)->getPrinter().print(modified_ret_val, ctx.modified_purpose, ctx.rank, id);
+                if (vec.size() > 0 && ctx.print_unitcube)
+                {
+                    ctx.unitcube.resize(vec.size());
+                    for (int i = 0, end = vec.size(); i < end; ++i)
+                        ctx.unitcube[i] = vec[i];
+                    (*this)->getPrinter().print(ctx.unitcube, "unitCubeParameters", ctx.rank, id);
+                }
+                (*this)->getPrinter().print(id,   "pointID", ctx.rank, id);
+                (*this)->getPrinter().print(ctx.rank, "MPIrank", ctx.rank, id);
+                (*this)->getPrinter().enable(); // Make sure printer is re-enabled (might have been disabled by invalid point error)
+
+                // Return the value of the function, offset by any offset set
+                return modified_ret_val + (*this)->getPurposeOffset();
+            }
+
         public:
             using s_ptr::s_ptr;
             like_ptr(){}
@@ -337,27 +385,106 @@ namespace Gambit
             
             double operator()(hyper_cube_ref<double> vec)
             {
-                std::unordered_map<std::string, double> &map = (*this)->getMap();
-                int rank = (*this)->getRank();
-                (*this)->getPrior().transform(vec, map);
-                double ret_val = (*this)->operator()(map);
-                double modified_ret_val = (*this)->purposeModifier(ret_val);
-                unsigned long long int id = Gambit::Printers::get_point_id();
-                (*this)->getPrinter().print(ret_val, (*this)->getPurpose(), rank, id);
-                (*this)->getPrinter().print(modified_ret_val, "Modified" + (*this)->getPurpose(), rank, id);
-                if (vec.size() > 0 && (*this)->getPrinter().get_printUnitcube())
+                point_context ctx = get_context();
+                return evaluate(vec, ctx);
+            }
+
+            /// Evaluate a batch of points in the unit hypercube (one point per column), writing the
+            /// (modified and offset) return values into lnlike in the same order, and their point IDs into ids if given.
+            void batch(hyper_cube_batch_ref<double> points, Eigen::Ref<vector<double>> lnlike, unsigned long long *ids = nullptr)
+            {
+                if (lnlike.size() != points.cols())
                 {
-                    std::vector<double> temp(vec.size());
-                    for (int i = 0, end = vec.size(); i < end; ++i)
-                        temp[i] =vec[i];
-                    (*this)->getPrinter().print(temp, "unitCubeParameters", rank, id);
+                    scan_err << "like_ptr::batch was given " << points.cols() << " points but room for "
+                             << lnlike.size() << " return values." << scan_end;
                 }
-                (*this)->getPrinter().print(id,   "pointID", rank, id);
-                (*this)->getPrinter().print(rank, "MPIrank", rank, id);
-                (*this)->getPrinter().enable(); // Make sure printer is re-enabled (might have been disabled by invalid point error)
+                point_context ctx = get_context();
+                ctx.unitcube.reserve(points.rows());
+                for (int i = 0, end = points.cols(); i < end; ++i)
+                {
+                    lnlike[i] = evaluate(points.col(i), ctx, ids == nullptr ? nullptr : ids + i);
+                }
+            }
 
-                // Return the value of the function, offset by any offset set
-                return modified_ret_val + (*this)->getPurposeOffset();
+            /// Evaluate a batch of points that every process holds a copy of, spreading the points over all processes.
+            /// Every process must call this with the same points.  Point i is calculated and printed by process
+            /// i % (number of processes), and every process gets back the return values, point IDs and ranks of all
+            /// points.  Without MPI this is the same as batch.
+            void batch_shared(hyper_cube_batch_ref<double> points, Eigen::Ref<vector<double>> lnlike,
+                              unsigned long long *ids = nullptr, int *ranks = nullptr)
+            {
+                if (lnlike.size() != points.cols())
+                {
+                    scan_err << "like_ptr::batch_shared was given " << points.cols() << " points but room for "
+                             << lnlike.size() << " return values." << scan_end;
+                }
+                const int n = points.cols();
+                #ifdef WITH_MPI
+                    int numtasks, myrank;
+                    MPI_Comm_size(MPI_COMM_WORLD, &numtasks);
+                    MPI_Comm_rank(MPI_COMM_WORLD, &myrank);
+
+                    // Calculate this process' share of the points.
+                    point_context ctx = get_context();
+                    ctx.unitcube.reserve(points.rows());
+                    std::vector<double> my_lnlike;
+                    std::vector<unsigned long long> my_ids;
+                    for (int i = myrank; i < n; i += numtasks)
+                    {
+                        unsigned long long id;
+                        my_lnlike.push_back(evaluate(points.col(i), ctx, &id));
+                        my_ids.push_back(id);
+                    }
+
+                    // Collect everyone's results, stacked in order of rank, and put them back in point order.
+                    std::vector<int> counts(numtasks), displs(numtasks, 0), printer_ranks(numtasks);
+                    for (int r = 0; r < numtasks; r++)
+                    {
+                        counts[r] = (r < n) ? (n - r + numtasks - 1)/numtasks : 0;
+                        if (r > 0) displs[r] = displs[r-1] + counts[r-1];
+                    }
+                    std::vector<double> all_lnlike(n);
+                    std::vector<unsigned long long> all_ids(n);
+                    MPI_Allgatherv(my_lnlike.data(), my_lnlike.size(), MPI_DOUBLE,
+                                   all_lnlike.data(), counts.data(), displs.data(), MPI_DOUBLE, MPI_COMM_WORLD);
+                    MPI_Allgatherv(my_ids.data(), my_ids.size(), MPI_UNSIGNED_LONG_LONG,
+                                   all_ids.data(), counts.data(), displs.data(), MPI_UNSIGNED_LONG_LONG, MPI_COMM_WORLD);
+                    MPI_Allgather(&ctx.rank, 1, MPI_INT, printer_ranks.data(), 1, MPI_INT, MPI_COMM_WORLD);
+                    for (int r = 0; r < numtasks; r++)
+                    {
+                        for (int k = 0; k < counts[r]; k++)
+                        {
+                            const int i = r + k*numtasks;
+                            lnlike[i] = all_lnlike[displs[r] + k];
+                            if (ids != nullptr) ids[i] = all_ids[displs[r] + k];
+                            if (ranks != nullptr) ranks[i] = printer_ranks[r];
+                        }
+                    }
+                #else
+                    batch(points, lnlike, ids);
+                    if (ranks != nullptr) std::fill(ranks, ranks + n, (*this)->getRank());
+                #endif
+            }
+
+            /// Evaluate a batch of n_points points of dimension dim, stored contiguously one point after another.
+            void batch(const double *points, int n_points, int dim, double *lnlike, unsigned long long *ids = nullptr)
+            {
+                map_batch<double> pts(const_cast<double *>(points), dim, n_points, Eigen::Stride<Eigen::Dynamic, 1>(dim, 1));
+                map_vector<double> out(lnlike, n_points);
+                batch(pts, out, ids);
+            }
+
+            /// Evaluate a batch of points, each given as its own vector.
+            std::vector<double> batch(const std::vector<std::vector<double>> &points)
+            {
+                std::vector<double> lnlike(points.size());
+                if (points.empty()) return lnlike;
+                const int dim = points[0].size();
+                std::vector<double> flat;
+                flat.reserve(dim*points.size());
+                for (const auto &point : points) flat.insert(flat.end(), point.begin(), point.end());
+                batch(flat.data(), points.size(), dim, lnlike.data());
+                return lnlike;
             }
 
             double operator()(std::unordered_map<std::string, double> &map, bool use_prior = false)
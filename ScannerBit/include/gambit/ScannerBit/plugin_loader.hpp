@@ -21,6 +21,9 @@
 ///          (benjamin.farmer@fysik.su.se)
 ///  \date 2016 Aug
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #ifndef __PLUGIN_LOADER_HPP
@@ -123,7 +126,11 @@ namespace Gambit
             #ifdef HAVE_PYBIND11
                 std::map<std::string, std::map<std::string, PyPlugin_Details>> python_plugin_map;
             #endif
+                /// Plugin symbols found in each library, with the size and mtime of the library when they were read
+                YAML::Node manifest;
+                bool manifest_changed;
                 std::vector<Plugin_Details> loadExcluded(const std::string &);
+                std::vector<std::string> pluginSymbols(const std::string &);
                 void process(const std::string &, const std::string &, const std::string &, std::vector<Plugin_Details>&);
 
             public:
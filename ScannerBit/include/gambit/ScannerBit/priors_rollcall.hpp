@@ -0,0 +1,32 @@
+// GAMBIT: Global and Modular BSM Inference Tool  
+//************************************************
+/// \file                                        
+///                                               
+///  Priors rollcall file for ScannerBit.         
+///                                               
+///  This file has been automatically generated by
+///  scanner+_harvester.py.  Please do not modify.
+///                                               
+///***********************************************
+///                                               
+///  Authors:                                     
+///                                               
+///  \author The GAMBIT Collaboration            
+///  \date 06:26PM on October 16, 2026
+///                                               
+///***********************************************
+
+#ifndef PRIOR_LIST_HPP
+#define PRIOR_LIST_HPP
+
+#include "gambit/ScannerBit/priors/cauchy.hpp"
+#include "gambit/ScannerBit/priors/composite.hpp"
+#include "gambit/ScannerBit/priors/doublelogflatjoin.hpp"
+#include "gambit/ScannerBit/priors/dummy.hpp"
+#include "gambit/ScannerBit/priors/fixed_same_as.hpp"
+#include "gambit/ScannerBit/priors/flat_log.hpp"
+#include "gambit/ScannerBit/priors/gaussian.hpp"
+#include "gambit/ScannerBit/priors/lognormal.hpp"
+#include "gambit/ScannerBit/priors/plugin.hpp"
+
+#endif
@@ -13,6 +13,9 @@
 ///          (gregory.david.martinez@gmail.com)
 ///  \date 2023 Dec
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #pragma once
@@ -21,11 +24,13 @@
 
 #ifdef HAVE_PYBIND11
 
+#include <mutex>
 #include <unordered_map>
 #include "gambit/Utils/begin_ignore_warnings_pybind11.hpp"
 #include "gambit/Utils/begin_ignore_warnings_eigen.hpp"
 #include <pybind11/embed.h>
 #include <pybind11/eigen.h>
+#include <pybind11/numpy.h>
 #include <pybind11/stl.h>
 #include <pybind11/stl_bind.h>
 #include "gambit/Utils/end_ignore_warnings.hpp"
@@ -34,6 +39,7 @@
 #include "gambit/ScannerBit/plugin_defs.hpp"
 #include "gambit/ScannerBit/scanner_utils.hpp"
 #include "gambit/ScannerBit/python_utils.hpp"
+#include "gambit/Utils/python_interpreter.hpp"
 
 namespace py = pybind11;
 
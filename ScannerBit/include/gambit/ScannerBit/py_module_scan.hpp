@@ -13,6 +13,9 @@
 ///          (gregory.david.martinez@gmail.com)
 ///  \date 2023 Dec
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 namespace Gambit
@@ -350,6 +353,35 @@ namespace Gambit
                         
                         return like;
                     }
+
+                    /**
+                     * @brief Checks whether batch likelihood calls may release the GIL.
+                     * 
+                     * Only true if the "release_gil" option of the scanner is set, and no Python code may be called while the likelihood is evaluated (Python backends or objective plugins), which needs the GIL.
+                     * Batches then only exclude each other through batch_mutex(), so a plugin setting this option must not evaluate the likelihood through the single-point callables (loglike, loglike_hypercube, loglike_physical, log_target_density) from other threads while a batch runs.
+                     * 
+                     * @return Returns true if the GIL is released while a batch is evaluated.
+                     */
+                    static bool release_gil()
+                    {
+                        static bool release = getNode()["release_gil"] ? getNode()["release_gil"].template as<bool>() : false;
+                        
+                        return release && !::Gambit::Utils::python_interpreter::get().called_in_likelihood;
+                    }
+
+                    /**
+                     * @brief Retrieves the mutex that serialises batch likelihood calls made without the GIL.
+                     * 
+                     * The likelihood is not thread safe, so Python threads calling it concurrently must still take turns.
+                     * 
+                     * @return Returns a reference to the mutex.
+                     */
+                    static std::mutex &batch_mutex()
+                    {
+                        static std::mutex mtx;
+                        
+                        return mtx;
+                    }
                     
                 #ifdef WITH_MPI
                     /**
@@ -812,6 +844,43 @@ PYBIND11_EMBEDDED_MODULE(scanner_plugin, m)
                                         
         return like_hypercube;
     })
+    .def_static("loglike_hypercube_batch", [](py::array_t<double, py::array::c_style | py::array::forcecast> points, bool return_point_ids)->py::object
+    {
+        if (scanner_base::getLike() == nullptr)
+        {
+            scan_err << "\"loglike_hypercube_batch\" needs a \"like\" entry in the scanner options." << scan_end;
+        }
+        if (points.ndim() != 2 || points.shape(1) != static_cast<py::ssize_t>(get_dimension()))
+        {
+            scan_err << "\"loglike_hypercube_batch\" expects an array of shape (N, " << get_dimension() << "), one point per row." << scan_end;
+        }
+        
+        // A C-contiguous float64 array is used in place; anything else is converted once by pybind11
+        static scanner_base::s_hyper_func like_hypercube(*scanner_base::getLike().get());
+        const int n_points = points.shape(0), dim = points.shape(1);
+        const double *in = points.data();
+        py::array_t<double> lnlike(n_points);
+        double *out = lnlike.mutable_data();
+        py::array_t<unsigned long long> ids(return_point_ids ? n_points : 0);
+        unsigned long long *ids_out = return_point_ids ? ids.mutable_data() : nullptr;
+        
+        // Other Python threads run while the batch is evaluated, if the scanner asked for it
+        if (scanner_base::release_gil())
+        {
+            py::gil_scoped_release release;
+            std::lock_guard<std::mutex> lock(scanner_base::batch_mutex());
+            like_hypercube.get().batch(in, n_points, dim, out, ids_out);
+        }
+        else
+        {
+            like_hypercube.get().batch(in, n_points, dim, out, ids_out);
+        }
+        
+        if (!return_point_ids)
+            return lnlike;
+        
+        return py::make_tuple(lnlike, ids);
+    }, py::arg("points"), py::arg("return_point_ids")=false)
     .def_property_readonly_static("loglike_physical", [](py::object)
     {
         static std::shared_ptr<scanner_base::s_phys_func> like_physical(scanner_base::getLike() == nullptr ? nullptr : new scanner_base::s_phys_func(*scanner_base::getLike().get()));
@@ -56,6 +56,16 @@ namespace Gambit
         template <typename T>
         using map_vector = Eigen::Map<vector<T>, Eigen::Unaligned, Eigen::Stride<1, 1>>;
         
+        /// \brief Represents a batch of points in the unit hypercube (one point per column).
+        ///
+        template <typename T>
+        using hyper_cube_batch_ref = Eigen::Ref<matrix<T>, 0, Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>>;
+        
+        /// \brief Batch of points using raw data (one point per column, each point contiguous).
+        ///
+        template <typename T>
+        using map_batch = Eigen::Map<matrix<T>, Eigen::Unaligned, Eigen::Stride<Eigen::Dynamic, 1>>;
+        
     }
     
 }
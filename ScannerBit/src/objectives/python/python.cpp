@@ -118,6 +118,7 @@ objective_plugin(python, version(1, 0, 0))
             
             instance = py::dict(file.attr("__plugins__"))[plugin_name.c_str()](**options);
             run_func = instance.attr("run");
+            Gambit::Utils::python_interpreter::get().called_in_likelihood = true;
         }
         catch (std::exception &ex)
         {
@@ -22,14 +22,22 @@
 ///          (benjamin.farmer@fysik.su.se)
 ///  \date 2016 Aug
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include <iomanip>
 #include <unistd.h>
 #include <iostream>
 #include <fstream>
 #include <stdio.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "gambit/ScannerBit/scanner_utils.hpp"
 #include "gambit/ScannerBit/plugin_comparators.hpp"
@@ -41,6 +49,10 @@
 #include "gambit/Utils/util_functions.hpp"
 #include "gambit/ScannerBit/priors_rollcall.hpp"
 
+#ifdef HAVE_LINK_H
+  #include <elf.h>
+#endif
+
 #ifdef HAVE_PYBIND11
   #include "gambit/Utils/begin_ignore_warnings_pybind11.hpp"
   #include <pybind11/embed.h>
@@ -132,19 +144,13 @@ namespace Gambit
                     auto sys_list = py::list(py::module::import("sys").attr("path"));
                     sys_list.append(py::cast(path));
 
-                    if (FILE* p_f = popen((std::string("ls ") + path).c_str(), "r"))
+                    if (Utils::file_exists(path))
                     {
-                        char path_buffer[1024];
-                        int p_n;
-                        std::string fname;
-                        std::stringstream ss;
-
-                        while ((p_n = fread(path_buffer, 1, sizeof path_buffer, p_f)) > 0)
-                        {
-                            ss << std::string(path_buffer, p_n);
-                        }
-                        while (ss >> fname)
+                        std::vector<std::string> fnames = Utils::ls_dir(path);
+                        std::sort(fnames.begin(), fnames.end());
+                        for (std::string fname : fnames)
                         {
+                            if (fname == "." || fname == "..") continue;
                             std::string loc = path + "/" + fname;
                             if (fname.substr(fname.size() - 3) == ".py")
                                 fname = fname.substr(0, fname.size() - 3);
@@ -342,12 +348,166 @@ namespace Gambit
                 return table.str();
             }
 
-            Plugin_Loader::Plugin_Loader() : path(GAMBIT_DIR "/ScannerBit/lib/")//, python_plugin_map(pyplugin_info())
+            namespace
+            {
+
+            const char *plugin_symbol_tag = "__gambit_plugin_pluginInit_";
+
+            /// List the plugin initialisation functions in a library with nm.
+            std::vector<std::string> nm_plugin_symbols(const std::string &lib)
+            {
+                std::vector<std::string> symbols;
+                if (FILE* f = popen((std::string("nm ") + lib + std::string(" | grep \"") + plugin_symbol_tag + "\"").c_str(), "r"))
+                {
+                    char buffer[1024];
+                    int n;
+                    std::string str;
+                    std::stringstream ss;
+
+                    while ((n = fread(buffer, 1, sizeof buffer, f)) > 0)
+                    {
+                        ss << std::string(buffer, n);
+                    }
+
+                    while(std::getline(ss, str))
+                    {
+                        std::string::size_type pos = str.find(plugin_symbol_tag);
+
+                        if (pos != std::string::npos &&
+                                (str.rfind(" T ", pos) != std::string::npos || str.rfind(" t ", pos) != std::string::npos))
+                        {
+                            symbols.push_back(str.substr(str.rfind(' ', pos) + 1));
+                        }
+                    }
+
+                    pclose(f);
+                }
+                return symbols;
+            }
+
+        #ifdef HAVE_LINK_H
+            /// Collect the plugin initialisation functions from the symbol tables of a mapped ELF file, i.e. the
+            /// symbols that nm would list as T or t (defined in an executable section).  Returns false if the
+            /// file is malformed.
+            template <typename Ehdr, typename Shdr, typename Sym>
+            bool elf_plugin_symbols(const char *data, size_t size, std::vector<std::string> &symbols)
+            {
+                const Ehdr *ehdr = reinterpret_cast<const Ehdr *>(data);
+                if (size < sizeof(Ehdr) || ehdr->e_shoff > size || ehdr->e_shnum > (size - ehdr->e_shoff) / sizeof(Shdr))
+                    return false;
+                const Shdr *shdrs = reinterpret_cast<const Shdr *>(data + ehdr->e_shoff);
+                auto in_file = [&](const Shdr &sh) { return sh.sh_offset <= size && sh.sh_size <= size - sh.sh_offset; };
+
+                for (size_t i = 0; i < ehdr->e_shnum; ++i)
+                {
+                    const Shdr &symtab = shdrs[i];
+                    if (symtab.sh_type != SHT_SYMTAB && symtab.sh_type != SHT_DYNSYM) continue;
+                    if (symtab.sh_link >= ehdr->e_shnum || !in_file(symtab) || !in_file(shdrs[symtab.sh_link])) return false;
+                    const Shdr &strtab = shdrs[symtab.sh_link];
+                    const Sym *syms = reinterpret_cast<const Sym *>(data + symtab.sh_offset);
+
+                    for (size_t j = 0, n = symtab.sh_size / sizeof(Sym); j < n; ++j)
+                    {
+                        const Sym &sym = syms[j];
+                        if (sym.st_shndx == SHN_UNDEF || sym.st_shndx >= ehdr->e_shnum) continue;
+                        if (!(shdrs[sym.st_shndx].sh_flags & SHF_EXECINSTR) || sym.st_name >= strtab.sh_size) continue;
+                        const char *name = data + strtab.sh_offset + sym.st_name;
+                        std::string str(name, strnlen(name, strtab.sh_size - sym.st_name));
+                        // The dynamic symbol table repeats the global entries of the full one
+                        if (str.find(plugin_symbol_tag) != std::string::npos && std::find(symbols.begin(), symbols.end(), str) == symbols.end())
+                            symbols.push_back(str);
+                    }
+                }
+                return true;
+            }
+        #endif
+
+            /// List the plugin initialisation functions in a library.  ELF files are read in-process;
+            /// anything else (e.g. Mach-O) is handed to nm.
+            std::vector<std::string> read_plugin_symbols(const std::string &lib)
+            {
+            #ifdef HAVE_LINK_H
+                int fd = open(lib.c_str(), O_RDONLY);
+                if (fd != -1)
+                {
+                    struct stat info;
+                    void *map = MAP_FAILED;
+                    if (fstat(fd, &info) == 0 && info.st_size > EI_NIDENT)
+                        map = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                    close(fd);
+
+                    if (map != MAP_FAILED)
+                    {
+                        const char *data = static_cast<const char *>(map);
+                        const size_t size = info.st_size;
+                        const bool native = (data[EI_DATA] == ELFDATA2LSB) == (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__);
+                        std::vector<std::string> symbols;
+                        bool ok = false;
+                        if (memcmp(data, ELFMAG, SELFMAG) == 0 && native)
+                        {
+                            if (data[EI_CLASS] == ELFCLASS64)
+                                ok = elf_plugin_symbols<Elf64_Ehdr, Elf64_Shdr, Elf64_Sym>(data, size, symbols);
+                            else if (data[EI_CLASS] == ELFCLASS32)
+                                ok = elf_plugin_symbols<Elf32_Ehdr, Elf32_Shdr, Elf32_Sym>(data, size, symbols);
+                        }
+                        munmap(map, size);
+                        // Same order as nm
+                        std::sort(symbols.begin(), symbols.end());
+                        if (ok) return symbols;
+                    }
+                }
+            #endif
+                return nm_plugin_symbols(lib);
+            }
+
+            /// Read the plugin manifest, which lists the plugin symbols found in each library
+            YAML::Node load_plugin_manifest(const std::string &file)
+            {
+                try
+                {
+                    if (Utils::file_exists(file))
+                    {
+                        YAML::Node manifest = YAML::LoadFile(file);
+                        if (manifest.IsMap()) return manifest;
+                    }
+                }
+                catch (YAML::Exception &) {}
+                return YAML::Node(YAML::NodeType::Map);
+            }
+
+            /// Write the plugin manifest.  Other processes, possibly on other nodes sharing the file system, may be
+            /// doing the same, so write to a file created exclusively by mkstemp and move it into place.  The
+            /// manifest is only a cache, so failure to write it is not an error.
+            void save_plugin_manifest(const std::string &file, const YAML::Node &manifest)
+            {
+                std::string temp = file + ".XXXXXX";
+                const int fd = mkstemp(&temp[0]);
+                if (fd == -1) return;
+                // mkstemp creates the file readable by its owner only
+                fchmod(fd, 0644);
+                close(fd);
+                {
+                    std::ofstream out(temp);
+                    if (!out) { std::remove(temp.c_str()); return; }
+                    out << "# Plugin symbols found in each ScannerBit library, keyed by the library's size and mtime.\n"
+                        << "# Generated automatically; delete to force a rescan.\n"
+                        << manifest << "\n";
+                    if (!out) { std::remove(temp.c_str()); return; }
+                }
+                if (std::rename(temp.c_str(), file.c_str()) != 0) std::remove(temp.c_str());
+            }
+
+            }
+
+            Plugin_Loader::Plugin_Loader() : path(GAMBIT_DIR "/ScannerBit/lib/"), manifest_changed(false)//, python_plugin_map(pyplugin_info())
             {
                 std::string p_str;
                 std::ifstream lib_list(path + "plugin_libraries.list");
                 if (lib_list.is_open())
                 {
+                    const std::string manifest_file = path + "plugin_manifest.yaml";
+                    manifest = load_plugin_manifest(manifest_file);
+
                     while (lib_list >> p_str)
                     {
                         //if (p_str.find(".so") != std::string::npos && p_str.find(".so.") == std::string::npos)
@@ -358,6 +518,8 @@ namespace Gambit
                             scan_warn << "Could not find plugin library \"" << p_str << "\"." << scan_end;
                     }
 
+                    if (manifest_changed) save_plugin_manifest(manifest_file, manifest);
+
                     auto excluded_plugins = loadExcluded(Utils::buildtime_scratch+"scanbit_excluded_libs.yaml");
                     const str linked_libs(Utils::buildtime_scratch+"scanbit_linked_libs.yaml");
                     const str reqd_entries(Utils::buildtime_scratch+"scanbit_reqd_entries.yaml");
@@ -471,39 +633,44 @@ namespace Gambit
                 return excluded_plugins;
             }
 
-            void Plugin_Loader::loadLibrary (const std::string &p_str, const std::string &plug)
+            /// List the plugin initialisation functions in a library, from the manifest if it is up to date
+            std::vector<std::string> Plugin_Loader::pluginSymbols (const std::string &p_str)
             {
-                std::string str;
-                if (FILE* f = popen((std::string("nm ") + p_str + std::string(" | grep \"__gambit_plugin_pluginInit_\"")).c_str(), "r"))
+                struct stat info;
+                if (stat(p_str.c_str(), &info) != 0) return std::vector<std::string>();
+                const long long size = info.st_size, mtime = info.st_mtime;
+
+                try
                 {
-                    char buffer[1024];
-                    int n;
-                    std::stringstream ss;
+                    const YAML::Node entry = static_cast<const YAML::Node &>(manifest)[p_str];
+                    if (entry && entry["size"].as<long long>() == size && entry["mtime"].as<long long>() == mtime)
+                        return entry["symbols"].as<std::vector<std::string>>();
+                }
+                catch (YAML::Exception &) {}
+
+                std::vector<std::string> symbols = read_plugin_symbols(p_str);
+                YAML::Node entry;
+                entry["size"] = size;
+                entry["mtime"] = mtime;
+                entry["symbols"] = symbols;
+                manifest[p_str] = entry;
+                manifest_changed = true;
+                return symbols;
+            }
 
-                    while ((n = fread(buffer, 1, sizeof buffer, f)) > 0)
-                    {
-                        ss << std::string(buffer, n);
-                    }
+            void Plugin_Loader::loadLibrary (const std::string &p_str, const std::string &plug)
+            {
+                for (const std::string &str : pluginSymbols(p_str))
+                {
+                    std::string::size_type pos = str.find(plugin_symbol_tag);
+                    Plugin_Details temp(str.substr(pos + 27, str.rfind("__") - pos - 27));
 
-                    while(std::getline(ss, str))
+                    if (plug == "" || temp.plugin == plug)
                     {
-                        std::string::size_type pos = str.find("__gambit_plugin_pluginInit_");
-
-                        if (pos != std::string::npos &&
-                                (str.rfind(" T ", pos) != std::string::npos || str.rfind(" t ", pos) != std::string::npos))
-                        {
-                            Plugin_Details temp(str.substr(pos + 27, str.rfind("__") - pos - 27));
-
-                            if (plug == "" || temp.plugin == plug)
-                            {
-                                temp.path = p_str;
-                                plugins.push_back(temp);
-                                total_plugins.push_back(temp);
-                            }
-                        }
+                        temp.path = p_str;
+                        plugins.push_back(temp);
+                        total_plugins.push_back(temp);
                     }
-
-                    pclose(f);
                 }
             }
 
@@ -29,6 +29,7 @@ An affine invariant ensemble sampler.  See https://emcee.readthedocs.io/en/stabl
 There are additional arguments:
     
     nwalkers (1):  Number of walkers
+    vectorize (True):  Without MPI, evaluate all walkers of a step in one likelihood call
     filename ('emcee.h5'): For passing the name of a h5 file to which to save results using the emcee writer.
     pkl_name ('emcee.pkl'):  File name where results will be pickled
     """
@@ -58,6 +59,19 @@ There are additional arguments:
         else:
             return  (-np.inf, -1, -1)
 
+    @classmethod
+    def my_like_batch(cls, params):
+        
+        inside = ((params < 1.0) & (params > 0.0)).all(axis=1)
+        lnew = np.full(len(params), -np.inf)
+        ranks = np.full(len(params), -1)
+        ids = np.full(len(params), -1)
+        if inside.any():
+            lnew[inside], ids[inside] = cls.loglike_hypercube_batch(np.ascontiguousarray(params[inside]), return_point_ids=True)
+            ranks[inside] = cls.mpi_rank
+        
+        return list(zip(lnew, ranks, ids))
+
     @copydoc(emcee_EnsembleSampler)
     def __init__(self, nwalkers=1, pkl_name='emcee.pkl', filename='emcee.h5', **kwargs):
         
@@ -83,10 +97,13 @@ There are additional arguments:
             if initial_state is None:
                 initial_state = np.random.rand(self.nwalkers, self.dim)
                 
+            # all walkers of a step are evaluated in one likelihood call
+            vectorize = self.init_args.pop('vectorize', True)
             self.sampler = emcee.EnsembleSampler(self.nwalkers,
                                                  self.dim,
-                                                 self.my_like,
+                                                 self.my_like_batch if vectorize else self.my_like,
                                                  backend=self.backend(self.filename, self.reset),
+                                                 vectorize=vectorize,
                                                  **self.init_args)
             
             self.sampler.run_mcmc(initial_state, nsteps,
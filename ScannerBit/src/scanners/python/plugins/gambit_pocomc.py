@@ -32,6 +32,7 @@ There are additional arguments:
 
 n_particles (1000):  Number of preconditioned points
 pkl_name ('ocomc.pkl'):  File name where results will be pickled
+vectorize_likelihood (True):  Without MPI, evaluate all particles of a step in one likelihood call
     """
     __version__ = pocomc_version
     ids=None
@@ -66,6 +67,14 @@ pkl_name ('ocomc.pkl'):  File name where results will be pickled
         cls.ids.save(tuple(params), (cls.mpi_rank, cls.point_id))
         
         return lnew
+    
+    @classmethod
+    def my_like_batch(cls, params):
+        lnew, ids = cls.loglike_hypercube_batch(np.ascontiguousarray(params, dtype=np.float64), return_point_ids=True)
+        for pt, id in zip(params, ids):
+            cls.ids.save(tuple(pt), (cls.mpi_rank, int(id)))
+        
+        return lnew
         
     @staticmethod
     def log_prior(x):
@@ -112,12 +121,14 @@ pkl_name ('ocomc.pkl'):  File name where results will be pickled
         if self.mpi_size == 1:
             if prior_samples is None:
                 prior_samples = np.random.rand(self.n_particles, self.dim).astype(np.float32)
+            # all particles of a step are evaluated in one likelihood call
+            vectorize = self.init_args.pop('vectorize_likelihood', True)
             self.sampler = self.make_sampler(self.n_particles,
                                              self.dim,
-                                             log_likelihood=self.my_like,
+                                             log_likelihood=self.my_like_batch if vectorize else self.my_like,
                                              log_prior=self.log_prior,
                                              bounds=np.array([[0.0, 1.0]]*self.dim),
-                                             vectorize_likelihood=False,
+                                             vectorize_likelihood=vectorize,
                                              vectorize_prior=False,
                                              infer_vectorization=False,
                                              output_dir=self.log_dir,
@@ -48,6 +48,7 @@ There are additional arguments:
     nwalkers (8):  Number of walkers
     pkl_name ('zeus.pkl'):  File name where results will be pickled
     use_chain_manager (False):  Use the internal chain manager to manage mpi processes.  This will run mpi_size chains in parrellel
+    vectorize (True):  Without MPI, evaluate all walkers of a step in one likelihood call
     
 AVAILABLE CALLBACKS
 -------------------"""
@@ -96,6 +97,19 @@ AVAILABLE CALLBACKS
         else:
             return  (-np.inf, -1, -1)
 
+    @classmethod
+    def my_like_batch(cls, params):
+        
+        inside = ((params < 1.0) & (params > 0.0)).all(axis=1)
+        lnew = np.full(len(params), -np.inf)
+        ranks = np.full(len(params), -1)
+        ids = np.full(len(params), -1)
+        if inside.any():
+            lnew[inside], ids[inside] = cls.loglike_hypercube_batch(np.ascontiguousarray(params[inside]), return_point_ids=True)
+            ranks[inside] = cls.mpi_rank
+        
+        return list(zip(lnew, ranks, ids))
+
     @copydoc(zeus_EnsembleSampler)
     def __init__(self, nwalkers=8, pkl_name='zeus.pkl', use_chain_manager=False, **kwargs):
         super().__init__(use_mpi=True, use_resume=False)
@@ -118,10 +132,13 @@ AVAILABLE CALLBACKS
         if self.mpi_size == 1:
             if start is None:
                 start = np.random.rand(self.nwalkers, self.dim)
+            # all walkers of a step are evaluated in one likelihood call
+            vectorize = self.init_args.pop('vectorize', True)
             self.sampler = zeus.EnsembleSampler(self.nwalkers, 
                                                 self.dim, 
-                                                self.my_like, 
+                                                self.my_like_batch if vectorize else self.my_like, 
                                                 blobs_dtype=[("rank", int), ("ptid", int)], 
+                                                vectorize=vectorize, 
                                                 **self.init_args)
             self.sampler.run_mcmc(start, 
                                   nsteps, 
@@ -30,6 +30,7 @@ YAML options:
     grid_pts[10]: The number of points along each dimension on the grid.  A vector is given with each element corresponding to each dimension.
     like:            Use the functors thats corresponds to the specified purpose.
     parameters:      Specifies the order of parameters that corresponds to the grid points specified by the tag "grid_pts".
+    batch_size[100]: The number of points evaluated per likelihood call.  Keep it below the printer's buffer length.
 """
 
     # This specifies the version number.
@@ -38,9 +39,11 @@ YAML options:
     # All the inifile options are passed into the construct as arguments.
     # Optionally, you can interface directly with ScannerBit to get this.
     # A Constructor that takes in arguments is required.
-    def __init__(self, grid_pts=10, parameters=[], **options):
+    def __init__(self, grid_pts=10, parameters=[], batch_size=100, **options):
         
         super().__init__(use_mpi=True, use_resume=False)
+        
+        self.batch_size = max(int(batch_size), 1)
 
         # You can access plugin data without using base class as follows:
         #
@@ -102,18 +105,26 @@ YAML options:
     def run(self):
 
         # scan the grid of points, divided evenly across the numper of MPI processes
-        for pt in np.vstack(np.meshgrid(*self.vecs)).reshape(self.dim, -1).T[self.mpi_rank:self.size:self.mpi_size]:
+        pts = np.vstack(np.meshgrid(*self.vecs)).reshape(self.dim, -1).T[self.mpi_rank:self.size:self.mpi_size]
 
-            # run likelihood
-            self.loglike_hypercube(pt)
-            
-            # prints value
-            self.print(1.0, "Posterior")
-            
-            # # or equivalently, you can go the same if using the low-level interface:
-            # self.like(pt)
-            # id = self.like.getPtID()
-            # splug.get_printer().get_stream().print(1.0, "mult", self.rank, id)
+        # run likelihood in batches of points, printing each batch against its point IDs before the next
+        # one is evaluated, so the points are printed in the order they were evaluated
+        for start in range(0, len(pts), self.batch_size):
+            _, ids = self.loglike_hypercube_batch(np.ascontiguousarray(pts[start:start + self.batch_size]), return_point_ids=True)
+
+            # prints values
+            for id in ids:
+                self.print(1.0, "Posterior", self.mpi_rank, int(id))
+
+        # # or equivalently, you can do the same one point at a time:
+        # for pt in pts:
+        #     self.loglike_hypercube(pt)
+        #     self.print(1.0, "Posterior")
+        #
+        # # or if using the low-level interface:
+        # self.like(pt)
+        # id = self.like.getPtID()
+        # splug.get_printer().get_stream().print(1.0, "mult", self.rank, id)
         
         return 0
 
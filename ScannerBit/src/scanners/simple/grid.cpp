@@ -25,6 +25,7 @@
 #include <cmath>
 #include <iostream>
 #include <sstream>
+#include <algorithm>
 
 #include "gambit/ScannerBit/scanner_plugin.hpp"
 
@@ -139,7 +140,12 @@ scanner_plugin(grid, version(1, 0, 0))
 
         like_ptr LogLike;
         LogLike = get_purpose(get_inifile_value<std::string>("like"));
-        std::vector<double> vec(ma, 0.0);
+        
+        // Points are passed to the likelihood in batches, one point per column.
+        int batch_size = std::max(get_inifile_value<int>("batch_size", 64), 1);
+        Gambit::Scanner::matrix<double> batch(ma, batch_size);
+        Gambit::Scanner::vector<double> lnlike(batch_size);
+        int filled = 0;
 
         for (int i = rank, end = NTot; i < end; i+=numtasks)
         {
@@ -147,14 +153,18 @@ scanner_plugin(grid, version(1, 0, 0))
             for (int j = 0; j < ma; j++)
             {
                 if (N[j] == 1)
-                    vec[j] = 0.5;
+                    batch(j, filled) = 0.5;
                 else
-                    vec[j] = double(n%N[j])/double(N[j]-1);
+                    batch(j, filled) = double(n%N[j])/double(N[j]-1);
 
                 n /= N[j];
             }
 
-            LogLike(vec);
+            if (++filled == batch_size || i + numtasks >= end)
+            {
+                LogLike.batch(batch.leftCols(filled), lnlike.head(filled));
+                filled = 0;
+            }
         }
 
         return 0;
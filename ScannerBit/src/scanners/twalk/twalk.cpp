@@ -183,31 +183,38 @@ namespace Gambit
             else
             {
                 resumed = true;
-                for (t = 0; t < NChains; t++)
+                // Draw the starting points of all chains on rank 0, and then calculate them as a single
+                // batch spread over all processes.
+                Gambit::Scanner::matrix<double> starts(dimension, NChains);
+                if (rank == 0)
                 {
-                    if (rank == 0)
-                    {
+                    for (t = 0; t < NChains; t++)
                         for (int j = 0; j < dimension; j++)
                             a0[t][j] = (gDev[t]->Doub());
-                        chisq[t] = -LogLike(a0[t]);
-                        quit = Gambit::Scanner::Plugins::plugin_info.early_shutdown_in_progress();
-                        ids[t] = LogLike->getPtID();
-                        ranks[t] = rank;
-                    }
+                }
+                for (t = 0; t < NChains; t++)
+                {
                     #ifdef WITH_MPI
-                        MPI_Barrier(MPI_COMM_WORLD);
                         MPI_Bcast (c_ptr(a0[t]), a0[t].size(), MPI_DOUBLE, 0, MPI_COMM_WORLD);
-                        MPI_Bcast (&quit, 1, MPI_UNSIGNED, 0, MPI_COMM_WORLD);
                     #endif
-                    if(quit)
-                    {
-                       std::cout
-                       #ifdef WITH_MPI
-                         <<"Rank "<<rank<<": "
-                       #endif
-                       <<"Quit signal received during TWalk chain initialisation, aborting run" << std::endl;
-                       break;
-                    }
+                    for (int j = 0; j < dimension; j++)
+                        starts(j, t) = a0[t][j];
+                }
+                Gambit::Scanner::vector<double> lnlike(NChains);
+                LogLike.batch_shared(starts, lnlike, c_ptr(ids), c_ptr(ranks));
+                for (t = 0; t < NChains; t++)
+                    chisq[t] = -lnlike[t];
+                quit = Gambit::Scanner::Plugins::plugin_info.early_shutdown_in_progress();
+                #ifdef WITH_MPI
+                    MPI_Allreduce (MPI_IN_PLACE, &quit, 1, MPI_UNSIGNED, MPI_MAX, MPI_COMM_WORLD);
+                #endif
+                if(quit)
+                {
+                   std::cout
+                   #ifdef WITH_MPI
+                     <<"Rank "<<rank<<": "
+                   #endif
+                   <<"Quit signal received during TWalk chain initialisation, aborting run" << std::endl;
                 }
             }
 
@@ -19,6 +19,7 @@
 #include <fstream>
 #include <vector>
 #include <map>
+#include <memory>
 #include <sstream>
 
 #include "gambit/Utils/standalone_error_handlers.hpp"
@@ -33,17 +34,43 @@
 //    std::cout << ascii["mass"][0] << std::endl;
 //    std::cout << ascii["BR1"][1] << std::endl;
 //    std::cout << ascii["BR2"][2] << std::endl;
+//
+// Tables can also be stored in a binary format (written with write_binary, or the
+// table2binary tool), which is memory-mapped rather than parsed.  If a binary file
+// named binary_name(filename) exists and records the current size and modification
+// time of the ASCII file it was made from, it is read instead.  Columns of binary tables obtained with column() are not copied, so
+// processes on the same node share the same memory for them.
 
 namespace Gambit
 {
+
+  /// Read-only view of a column of a table
+  class table_column
+  {
+    public:
+      table_column() : ptr(NULL), n(0) {}
+      table_column(const double* p, size_t size) : ptr(p), n(size) {}
+      table_column(const std::vector<double>& vec) : ptr(vec.data()), n(vec.size()) {}
+
+      const double & operator[] (size_t i) const { return ptr[i]; }
+      size_t size() const { return n; }
+      bool empty() const { return n == 0; }
+      const double* data() const { return ptr; }
+      const double* begin() const { return ptr; }
+      const double* end() const { return ptr + n; }
+      operator std::vector<double>() const { return std::vector<double>(ptr, ptr + n); }
+
+    private:
+      const double* ptr;
+      size_t n;
+  };
+
   class ASCIItableReader
   {
     public:
       ASCIItableReader(std::string filename)
       {
         read(filename);
-        ncol = data.size();
-        nrow = data[0].size();
       };
       ASCIItableReader() : ncol(0), nrow(0) {};  // Dummy initializer
       ~ASCIItableReader() {}
@@ -51,6 +78,17 @@ namespace Gambit
       int read(std::string filename);
       void setcolnames(std::vector<std::string> names);
 
+      /// Write the table in the binary format, recording the size and modification time of
+      /// the ASCII file it was read from (if given), so that it is only used in place of that file
+      /// while the file is unchanged
+      void write_binary(std::string filename, std::string source = "") const;
+
+      /// Check if a file is a binary table
+      static bool is_binary(std::string filename);
+
+      /// Name of the binary table that is read in place of an ASCII table, if present
+      static std::string binary_name(std::string filename) { return filename + ".gbt"; }
+
       template <typename... Args>
       void setcolnames(std::string name, Args... args)
       {
@@ -65,16 +103,26 @@ namespace Gambit
         setcolnames(vec, args...);
       }
 
-      const std::vector<double> & operator[] (int i) { return data[i]; };
-      const std::vector<double> & operator[] (std::string name) { return data[colnames[name]]; };
+      const std::vector<double> & operator[] (int i);
+      const std::vector<double> & operator[] (std::string name) { return (*this)[colnames[name]]; };
       int getncol() { return ncol; }
       int getnrow() { return nrow; }
 
+      /// Get a column without copying it
+      table_column column(int i) const;
+      table_column column(std::string name) const { return column(colnames.at(name)); }
+
     private:
+      int read_binary(std::string filename);
+
       std::vector<std::vector<double> > data;
       std::map<std::string, int> colnames;
       int ncol;
       int nrow;
+
+      /// Memory map of a binary table (shared between copies of the reader), and its columns
+      std::shared_ptr<const void> mapping;
+      std::vector<table_column> mapped_columns;
   };
 }
 
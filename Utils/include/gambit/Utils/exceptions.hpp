@@ -12,6 +12,9 @@
 ///          (patscott@physics.mcgill.ca)
 ///  \date 2014 Mar
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  Distantly inspired by SUFIT classes of the
 ///  same name by Johan Lundberg, Aug 2011.
 ///
@@ -26,6 +29,7 @@
 #include <exception>
 #include <vector>
 #include <utility>
+#include <functional>
 
 #include "gambit/Utils/util_macros.hpp"
 #include "gambit/Logs/log_tags.hpp"
@@ -92,6 +96,10 @@ namespace Gambit
       /// Set the parameter point string to append if a fatal exception is thrown
       static void set_parameters(std::string);
 
+      /// Set a function that generates the parameter point string on demand.  The string is then
+      /// only built if a fatal exception is actually thrown, rather than for every point.
+      static void set_parameters(std::function<std::string()>);
+
     protected:
 
       /// The set of tags to be passed to the logger
@@ -126,9 +134,15 @@ namespace Gambit
       /// Flag indicating if this exception should be considered fatal or not.
       bool isFatal;
 
+      /// Get the parameter point string to append to fatal exceptions.
+      static std::string get_parameters();
+
       /// Shared string indicating the current values of the paramters.
       static std::string parameters;
 
+      /// Shared generator of the parameter point string (takes precedence over parameters if set).
+      static std::function<std::string()> parameter_generator;
+
   };
 
 
@@ -332,6 +346,29 @@ namespace Gambit
   /// Global instance of Piped_exceptions class for warnings.
   extern Piped_exceptions piped_warnings;
 
+  /// Scope in which the constructing thread throws GAMBIT exceptions instead of aborting, even inside an OpenMP
+  /// parallel region.  Only create one in a parallel region that catches everything its threads throw and
+  /// rethrows it after the region.  Deeper nested regions still abort, as their threads are not covered.
+  class EXPORT_SYMBOLS parallel_exception_scope
+  {
+    public:
+      /// Constructor
+      parallel_exception_scope();
+
+      /// Destructor
+      ~parallel_exception_scope();
+
+      /// Check whether the calling thread may throw an exception at its current OpenMP level.
+      static bool may_throw();
+
+    private:
+      /// The OpenMP level at which this thread could throw before this scope was created.
+      int previous_level;
+
+      /// The OpenMP level at which the calling thread may throw.
+      static int& throw_level();
+  };
+
   /// Special exception used during clean exit from diagnostics
   class SilentShutdownException : public std::exception
   {
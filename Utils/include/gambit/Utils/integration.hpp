@@ -16,10 +16,18 @@
 ///          (tomas.gonzalo@monash.edu)
 ///  \date 2020 Feb
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
+#ifndef __integration_hpp__
+#define __integration_hpp__
+
 #include "gambit/Utils/util_functions.hpp"
+#include <gsl/gsl_integration.h>
 #include <functional>
+#include <vector>
 
 namespace Gambit
 {
@@ -30,12 +38,65 @@ namespace Gambit
     /// Unwrapper for passing std::function to GSL integrator
     /// Based on example from https://martin-ueding.de/articles/cpp-lambda-into-gsl/index.html
     double unwrap(double x, void *p);
- 
+
     /// Integrate a std::function using GSL cquad
     double integrate_cquad(std::function<double(double)> ftor, double a, double b, double abseps, double releps);
 
+    /// GSL integration workspace with room for at least limit subintervals, borrowed from a
+    /// per-thread pool for the lifetime of this object.  Nested integrals each get their own.
+    class integration_workspace
+    {
+      public:
+        explicit integration_workspace(size_t limit);
+        ~integration_workspace();
+        integration_workspace(const integration_workspace&) = delete;
+        integration_workspace& operator=(const integration_workspace&) = delete;
+        operator gsl_integration_workspace*() const { return w; }
+      private:
+        gsl_integration_workspace* w;
+    };
+
+    /// GSL cquad workspace with room for at least size intervals, borrowed from a per-thread pool.
+    class cquad_workspace
+    {
+      public:
+        explicit cquad_workspace(size_t size);
+        ~cquad_workspace();
+        cquad_workspace(const cquad_workspace&) = delete;
+        cquad_workspace& operator=(const cquad_workspace&) = delete;
+        operator gsl_integration_cquad_workspace*() const { return w; }
+      private:
+        gsl_integration_cquad_workspace* w;
+    };
+
+    /// Integrand(s) evaluated at many abscissae in one call, as f(x, n, fx).  A single integrand
+    /// sets fx[i] = f(x[i]) for i < n; a family of m integrands sets fx[k*n+i] = f_k(x[i]).
+    typedef std::function<void(const double*, size_t, double*)> batch_integrand;
+
+    /// Integrate over [a,b] with 21-point Gauss-Kronrod panels.  All panels of a refinement step
+    /// are passed to the integrand in one batch.  A smooth integrand needs just one batch
+    /// of 21 points.  Otherwise the panels holding too much of the error are bisected, up
+    /// to limit panels in total.  Each panel's error is estimated as in QUADPACK (and GSL's
+    /// qag), and as there the first panel is always bisected if its error estimate is
+    /// saturated at the variation of the integrand over it.  An invalid point is raised if the result is NaN, or if the tolerance is not
+    /// reached within limit panels or before the panels become too narrow to bisect.
+    double integrate_gk21(const batch_integrand& f, double a, double b, double abseps, double releps,
+                          size_t limit = 1000, double* abserr = nullptr);
+
+    /// As integrate_gk21, for a family of m integrands (e.g. one integrand at m outer points)
+    /// sharing the same abscissae.  Refinement continues until every member has converged.
+    std::vector<double> integrate_gk21_family(const batch_integrand& f, size_t m, double a, double b, double abseps,
+                                              double releps, size_t limit = 1000, std::vector<double>* abserr = nullptr);
+
+    /// As integrate_gk21 and integrate_gk21_family, with 51-point Gauss-Kronrod panels: the rule of
+    /// GSL's qag with GSL_INTEG_GAUSS51, for results that must reproduce those of such an integration.
+    double integrate_gk51(const batch_integrand& f, double a, double b, double abseps, double releps,
+                          size_t limit = 1000, double* abserr = nullptr);
+    std::vector<double> integrate_gk51_family(const batch_integrand& f, size_t m, double a, double b, double abseps,
+                                              double releps, size_t limit = 1000, std::vector<double>* abserr = nullptr);
+
   }
 
 }
 
-
+#endif //__integration_hpp__
@@ -25,11 +25,14 @@
 
 #include <vector>
 #include <string>
+#include <unordered_map>
 
 #include <gsl/gsl_spline.h>
 #include <gsl/gsl_interp2d.h>
 #include <gsl/gsl_spline2d.h>
 
+#include "gambit/Utils/ascii_table_reader.hpp"
+
 namespace Gambit
 {
 
@@ -212,6 +215,51 @@ namespace Gambit
     };
 
 
+    /// A class for looking up the cells of a rectilinear grid, given the grid points in any order (e.g. as read from a
+    /// tabulated ascii file). Uniformly spaced axes are indexed directly, and the others by binary search.
+    class interp_grid_index
+    {
+      public:
+
+        /// Maximum number of dimensions
+        static const size_t max_dim = 5;
+
+        // Constructors
+        interp_grid_index();
+        interp_grid_index(const std::vector<std::vector<double>>&, const std::vector<table_column>&);
+
+        /// Find the table rows at the 2^N corners of the grid cell containing a point, where corner c takes the upper
+        /// grid value in dimension d if bit d of c is set, as well as the lower and upper grid values in each dimension.
+        /// Returns false if the point is outside the grid or any of the corners is missing from the table.
+        bool find_corners(const double*, long*, double*, double*) const;
+
+      private:
+
+        /// Number of dimensions
+        size_t ndim;
+
+        /// Sorted unique grid values along each axis
+        std::vector<std::vector<double>> axes;
+
+        /// Spacing of the grid values along each axis (zero if not uniform)
+        std::vector<double> steps;
+
+        /// Strides of the axes in the cell numbering
+        std::vector<size_t> strides;
+
+        /// Table row of each grid point (-1 if missing), stored densely or sparsely depending on the size of the grid
+        bool dense;
+        std::vector<long> dense_rows;
+        std::unordered_map<size_t,long> sparse_rows;
+
+        /// Find the grid values either side of x along an axis (the same value twice if x lies on it)
+        bool locate(size_t, double, size_t&, size_t&) const;
+
+        /// Table row of a grid point
+        long row(size_t) const;
+    };
+
+
     /// A class for holding a collection of 4D interpolators, created from reading a tabulated ascii file. 
     /// - The first 4 columns are taken to be the x1,x2,x3,x4 grid points. 
     /// - A series of 1D interpolations is performed repeatedly to form the result.
@@ -233,12 +281,15 @@ namespace Gambit
         std::vector<double> x2_vec;
         std::vector<double> x3_vec;
         std::vector<double> x4_vec;
-        std::vector<double> x1_vec_unsorted;
-        std::vector<double> x2_vec_unsorted;
-        std::vector<double> x3_vec_unsorted;
-        std::vector<double> x4_vec_unsorted;
+        table_column x1_vec_unsorted;
+        table_column x2_vec_unsorted;
+        table_column x3_vec_unsorted;
+        table_column x4_vec_unsorted;
 
-        std::vector<std::vector<double>> interp_data;
+        // Table read from the file. The grid coordinates and interpolation data are views of its columns,
+        // so tables in the binary format are used directly from the memory map.
+        ASCIItableReader table;
+        std::vector<table_column> interp_data;
 
         double x1_min;
         double x1_max;
@@ -254,11 +305,18 @@ namespace Gambit
         bool allow_missing_pts;
         double missing_point_val;
 
+        // Index of the grid points
+        interp_grid_index grid;
+
         // Class methods
 
         // Constructor
         interp4d_collection(const std::string, const std::string, const std::vector<std::string>, bool, double);
 
+        // The columns are views of the table, so no copying
+        interp4d_collection(const interp4d_collection&) = delete;
+        interp4d_collection& operator=(const interp4d_collection&) = delete;
+
         // Destructor
         ~interp4d_collection();
 
@@ -268,6 +326,9 @@ namespace Gambit
         // Evaluate a given interpolation
         double eval(double, double, double, double, size_t);
 
+        // Evaluate all interpolations at once
+        void eval(double, double, double, double, std::vector<double>&);
+
         // Check if point is inside interpolation range
         bool is_inside_range(double, double, double, double);
     };
@@ -296,13 +357,16 @@ namespace Gambit
         std::vector<double> x3_vec;
         std::vector<double> x4_vec;
         std::vector<double> x5_vec;
-        std::vector<double> x1_vec_unsorted;
-        std::vector<double> x2_vec_unsorted;
-        std::vector<double> x3_vec_unsorted;
-        std::vector<double> x4_vec_unsorted;
-        std::vector<double> x5_vec_unsorted;
+        table_column x1_vec_unsorted;
+        table_column x2_vec_unsorted;
+        table_column x3_vec_unsorted;
+        table_column x4_vec_unsorted;
+        table_column x5_vec_unsorted;
 
-        std::vector<std::vector<double>> interp_data;
+        // Table read from the file. The grid coordinates and interpolation data are views of its columns,
+        // so tables in the binary format are used directly from the memory map.
+        ASCIItableReader table;
+        std::vector<table_column> interp_data;
 
         double x1_min;
         double x1_max;
@@ -320,11 +384,18 @@ namespace Gambit
         bool allow_missing_pts;
         double missing_point_val;
 
+        // Index of the grid points
+        interp_grid_index grid;
+
         // Class methods
 
         // Constructor
         interp5d_collection(const std::string, const std::string, const std::vector<std::string>, bool, double);
 
+        // The columns are views of the table, so no copying
+        interp5d_collection(const interp5d_collection&) = delete;
+        interp5d_collection& operator=(const interp5d_collection&) = delete;
+
         // Destructor
         ~interp5d_collection();
 
@@ -334,6 +405,9 @@ namespace Gambit
         // Evaluate a given interpolation
         double eval(double, double, double, double, double, size_t);
 
+        // Evaluate all interpolations at once
+        void eval(double, double, double, double, double, std::vector<double>&);
+
         // Check if point is inside interpolation range
         bool is_inside_range(double, double,double,double,double);
 
@@ -96,6 +96,10 @@ namespace Gambit {
 
       /// Set single parameter value
       void setValue(std::string const &inkey,double const&value);
+
+      /// Get a pointer to the stored value of a parameter, for setting it repeatedly without key lookups.
+      /// The pointer remains valid for the lifetime of this object.
+      double* getValuePtr(std::string const &inkey);
   
       /// Set many parameter values using a map
       void setValues(std::map<std::string,double> const &params_map, bool missing_is_error = true);
@@ -62,6 +62,10 @@
       
           /// os module loaded at construction time
           pybind11::module* os;
+
+          /// Set once Python code may be called while a likelihood is evaluated (Python backends
+          /// or objective plugins), in which case scanners must hold the GIL during evaluations
+          bool called_in_likelihood;
     
         private:
       
@@ -30,6 +30,9 @@ namespace Gambit
   /// Shared string indicating the current values of the paramters.
   str exception::parameters = "";
 
+  /// Shared generator of the parameter point string.
+  std::function<str()> exception::parameter_generator = nullptr;
+
 }
 
 #endif //#ifndef __static_members_hpp__
@@ -12,16 +12,81 @@
 ///          <c.weniger@uva.nl>
 ///  \date Dec 2014
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
 #include "gambit/Utils/ascii_table_reader.hpp"
 
 namespace Gambit
 {
 
+  /// Layout of binary tables: an 8 byte magic string, a 64 bit byte order marker,
+  /// the size and modification time (seconds and nanoseconds) of the ASCII table it
+  /// was made from, the number of columns and the length of each column (all 64 bit
+  /// unsigned), followed by the columns as native doubles.
+  static const char binary_magic[8] = {'G','B','T','A','B','L','E','\0'};
+  static const uint64_t binary_byte_order = 0x0102030405060708ULL;
+  static const size_t source_stamp_words = 3;
+
+  /// Size and modification time of a file, as recorded in the binary tables made from it
+  static bool source_stamp(const std::string& filename, uint64_t stamp[source_stamp_words])
+  {
+    struct stat file_stat;
+    if (stat(filename.c_str(), &file_stat) != 0) return false;
+    stamp[0] = file_stat.st_size;
+    stamp[1] = file_stat.st_mtime;
+    #ifdef __APPLE__
+      stamp[2] = file_stat.st_mtimespec.tv_nsec;
+    #else
+      stamp[2] = file_stat.st_mtim.tv_nsec;
+    #endif
+    return true;
+  }
+
+  /// Source stamp recorded in the header of a binary table
+  static bool recorded_source_stamp(const std::string& filename, uint64_t stamp[source_stamp_words])
+  {
+    std::ifstream in(filename.c_str(), std::ios::binary);
+    char magic[8];
+    uint64_t byte_order;
+    return in.read(magic, 8) and std::memcmp(magic, binary_magic, 8) == 0
+       and in.read(reinterpret_cast<char*>(&byte_order), sizeof(uint64_t)) and byte_order == binary_byte_order
+       and in.read(reinterpret_cast<char*>(stamp), source_stamp_words*sizeof(uint64_t));
+  }
+
+  bool ASCIItableReader::is_binary(std::string filename)
+  {
+    std::ifstream in(filename.c_str(), std::ios::binary);
+    char magic[8];
+    return in.read(magic, 8) and std::memcmp(magic, binary_magic, 8) == 0;
+  }
 
   int ASCIItableReader::read(std::string filename)
   {
+    data.clear();
+    mapping.reset();
+    mapped_columns.clear();
+
+    // Read a binary version of the table instead, if there is one made from the current ASCII file.
+    if (is_binary(filename)) return read_binary(filename);
+    const std::string binfile = binary_name(filename);
+    uint64_t text_stamp[source_stamp_words], bin_stamp[source_stamp_words];
+    if (source_stamp(filename, text_stamp) and recorded_source_stamp(binfile, bin_stamp)
+        and std::equal(text_stamp, text_stamp + source_stamp_words, bin_stamp))
+    {
+      return read_binary(binfile);
+    }
+
     std::ifstream in(filename.c_str(), std::ios::binary);
     if (in.fail())
     {
@@ -45,9 +110,97 @@ namespace Gambit
       }
     }
     in.close();
+    ncol = data.size();
+    nrow = (ncol > 0 ? data[0].size() : 0);
     return 0;
   }
 
+  int ASCIItableReader::read_binary(std::string filename)
+  {
+    int fd = open(filename.c_str(), O_RDONLY);
+    struct stat file_stat;
+    if (fd < 0 or fstat(fd, &file_stat) != 0)
+    {
+      if (fd >= 0) close(fd);
+      utils_error().raise(LOCAL_INFO, "Failed to read binary table '" + filename + "'.");
+    }
+    size_t size = file_stat.st_size;
+    // Map the file read-only and shared, so that all processes on a node use the same pages.
+    void* addr = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) utils_error().raise(LOCAL_INFO, "Failed to memory-map binary table '" + filename + "'.");
+    mapping = std::shared_ptr<const void>(addr, [size](const void* p) { munmap(const_cast<void*>(p), size); });
+
+    const uint64_t* header = reinterpret_cast<const uint64_t*>(addr);
+    const size_t words = size/sizeof(uint64_t);
+    const size_t header_words = 3 + source_stamp_words;
+    if (words < header_words or header[1] != binary_byte_order)
+    {
+      utils_error().raise(LOCAL_INFO, "Binary table '" + filename + "' is corrupt or was written on a machine with different byte order.");
+    }
+    const uint64_t cols = header[header_words-1];
+    uint64_t offset = header_words + cols;
+    if (cols > words or offset > words)
+    {
+      utils_error().raise(LOCAL_INFO, "Binary table '" + filename + "' is corrupt.");
+    }
+    for (uint64_t i = 0; i < cols; i++)
+    {
+      uint64_t length = header[header_words+i];
+      if (length > words - offset) utils_error().raise(LOCAL_INFO, "Binary table '" + filename + "' is truncated.");
+      mapped_columns.push_back(table_column(reinterpret_cast<const double*>(header + offset), length));
+      offset += length;
+    }
+    data.resize(cols);
+    ncol = cols;
+    nrow = (ncol > 0 ? mapped_columns[0].size() : 0);
+    return 0;
+  }
+
+  void ASCIItableReader::write_binary(std::string filename, std::string source) const
+  {
+    uint64_t stamp[source_stamp_words] = {0, 0, 0};
+    if (not source.empty() and not source_stamp(source, stamp))
+    {
+      utils_error().raise(LOCAL_INFO, "Failed to read the size and modification time of '" + source + "'.");
+    }
+    std::ofstream out(filename.c_str(), std::ios::binary);
+    uint64_t cols = ncol;
+    out.write(binary_magic, 8);
+    out.write(reinterpret_cast<const char*>(&binary_byte_order), sizeof(uint64_t));
+    out.write(reinterpret_cast<const char*>(stamp), source_stamp_words*sizeof(uint64_t));
+    out.write(reinterpret_cast<const char*>(&cols), sizeof(uint64_t));
+    for (int i = 0; i < ncol; i++)
+    {
+      uint64_t length = column(i).size();
+      out.write(reinterpret_cast<const char*>(&length), sizeof(uint64_t));
+    }
+    for (int i = 0; i < ncol; i++)
+    {
+      table_column col = column(i);
+      out.write(reinterpret_cast<const char*>(col.data()), col.size()*sizeof(double));
+    }
+    out.close();
+    if (out.fail()) utils_error().raise(LOCAL_INFO, "Failed to write binary table '" + filename + "'.");
+  }
+
+  /// Columns of binary tables are only copied out of the memory map when first accessed this way.
+  const std::vector<double> & ASCIItableReader::operator[] (int i)
+  {
+    if (mapping)
+    {
+      #pragma omp critical (ASCIItableReader_copy_column)
+      if (data[i].empty()) data[i] = mapped_columns[i];
+    }
+    return data[i];
+  }
+
+  table_column ASCIItableReader::column(int i) const
+  {
+    if (mapping) return mapped_columns[i];
+    return table_column(data[i]);
+  }
+
 
   void ASCIItableReader::setcolnames(std::vector<std::string> names)
   {
@@ -12,6 +12,9 @@
 ///          (patscott@physics.mcgill.ca)
 ///  \date 2014 Mar
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  Distantly inspired by SUFIT classes of the
 ///  same name by Johan Lundberg, Aug 2011.
 ///
@@ -193,7 +196,7 @@ namespace Gambit
     /// This is the regular way to trigger a GAMBIT error or warning.
     void exception::raise(const std::string& origin, const std::string& specific_message)
     {
-      str full_message = isFatal ? specific_message+parameters : specific_message;
+      str full_message = isFatal ? specific_message+get_parameters() : specific_message;
       #pragma omp critical (GAMBIT_exception)
       {
         log_exception(origin, full_message);
@@ -206,7 +209,7 @@ namespace Gambit
     {
       #pragma omp critical (GAMBIT_exception)
       {
-        log_exception(origin, specific_message+parameters);
+        log_exception(origin, specific_message+get_parameters());
       }
       throw(*this);
     }
@@ -227,10 +230,24 @@ namespace Gambit
     void exception::set_parameters(str params)
     {
       parameters = params;
+      parameter_generator = nullptr;
+    }
+
+    /// Set a function that generates the parameter point string on demand
+    void exception::set_parameters(std::function<str()> generator)
+    {
+      parameters = "";
+      parameter_generator = generator;
     }
 
   // Private members of GAMBIT exception base class.
 
+    /// Get the parameter point string to append to fatal exceptions.
+    str exception::get_parameters()
+    {
+      return parameter_generator ? parameter_generator() : parameters;
+    }
+
     /// Get a map of pointers to all instances of this class.
     std::map<const char*,exception*>& exception::exception_map()
     {
@@ -264,7 +281,7 @@ namespace Gambit
     /// Throw the exception onward if running serially, abort if not.
     void exception::throw_iff_outside_parallel()
     {
-      if (omp_get_level()==0) // If not in an OpenMP parallel block, throw onwards
+      if (parallel_exception_scope::may_throw()) // If not in an OpenMP parallel block (or in one that catches), throw onwards
       {
         throw(*this);
       }
@@ -430,14 +447,17 @@ namespace Gambit
     /// Raise the invalid point exception, i.e. throw it with a message and a code.
     void invalid_point_exception::raise(const std::string& msg, const int mycode)
     {
-      if (omp_get_level()==0) // If not in an OpenMP parallel block, throw onwards
+      if (parallel_exception_scope::may_throw()) // If not in an OpenMP parallel block (or in one that catches), throw onwards
       {
+        // Throw a copy made under the lock, in case other threads are raising the same exception concurrently.
+        invalid_point_exception thrown;
         #pragma omp critical (GAMBIT_exception)
         {
           myMessage = msg;
+          invalidcode = mycode;
+          thrown = *this;
         }
-        invalidcode = mycode;
-        throw(*this);
+        throw(thrown);
       }
       else
       {
@@ -482,7 +502,7 @@ namespace Gambit
     /// Check whether a piped invalid point exception was requested, and throw if necessary.
     void Piped_invalid_point::check()
     {
-      if (omp_get_level()==0) // If not in an OpenMP parallel block, throw onwards
+      if (parallel_exception_scope::may_throw()) // If not in an OpenMP parallel block (or in one that catches), throw onwards
       {
         if (this->flag)
         {
@@ -542,6 +562,33 @@ namespace Gambit
     const char* MPIShutdownException::what() const throw() { return myWhat.c_str(); }
     /// @}
 
+  /// Parallel exception scope class methods.
+
+    /// Constructor
+    parallel_exception_scope::parallel_exception_scope() : previous_level(throw_level())
+    {
+      throw_level() = omp_get_level();
+    }
+
+    /// Destructor
+    parallel_exception_scope::~parallel_exception_scope()
+    {
+      throw_level() = previous_level;
+    }
+
+    /// Check whether the calling thread may throw an exception at its current OpenMP level.
+    bool parallel_exception_scope::may_throw()
+    {
+      return omp_get_level() == throw_level();
+    }
+
+    /// The OpenMP level at which the calling thread may throw (0 unless it is in a parallel_exception_scope).
+    int& parallel_exception_scope::throw_level()
+    {
+      static thread_local int level = 0;
+      return level;
+    }
+
     /// Global instance of piped invalid point class.
     Piped_invalid_point piped_invalid_point;
 
@@ -565,7 +612,7 @@ namespace Gambit
     /// Check whether any exceptions were requested, and raise them.
     void Piped_exceptions::check(exception &excep)
     {
-      if (omp_get_level()==0) // If not in an OpenMP parallel block, throw onwards
+      if (parallel_exception_scope::may_throw()) // If not in an OpenMP parallel block (or in one that catches), throw onwards
       {
         if (this->flag)
         {
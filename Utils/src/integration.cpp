@@ -16,11 +16,19 @@
 ///          (tomas.gonzalo@monash.edu)
 ///  \date 2020 Feb
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #include "gambit/Utils/integration.hpp"
 #include <gsl/gsl_integration.h>
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
 #include <functional>
+#include <iterator>
+#include <sstream>
 
 namespace Gambit
 {
@@ -28,6 +36,383 @@ namespace Gambit
   namespace Utils
   {
 
+    namespace
+    {
+
+      /// Per-thread pool of free GSL workspaces of one kind, handed out smallest-fitting first.
+      template <typename W, W* (*alloc)(size_t), void (*release)(W*), size_t W::*capacity>
+      class workspace_pool
+      {
+        public:
+          static W* borrow(size_t size)
+          {
+            std::vector<W*>& free = pool().free;
+            auto best = free.end();
+            for (auto it = free.begin(); it != free.end(); ++it)
+            {
+              if ((*it)->*capacity >= size and (best == free.end() or (*it)->*capacity < (*best)->*capacity)) best = it;
+            }
+            if (best != free.end())
+            {
+              W* w = *best;
+              free.erase(best);
+              return w;
+            }
+            W* w = alloc(size);
+            if (w == nullptr) utils_error().raise(LOCAL_INFO, "Failed to allocate GSL integration workspace.");
+            return w;
+          }
+
+          static void give_back(W* w) { pool().free.push_back(w); }
+
+        private:
+          struct free_list
+          {
+            std::vector<W*> free;
+            ~free_list() { for (W* w : free) release(w); }
+          };
+
+          static free_list& pool()
+          {
+            static thread_local free_list p;
+            return p;
+          }
+      };
+
+      typedef workspace_pool<gsl_integration_workspace, gsl_integration_workspace_alloc,
+                             gsl_integration_workspace_free, &gsl_integration_workspace::limit> qag_pool;
+      typedef workspace_pool<gsl_integration_cquad_workspace, gsl_integration_cquad_workspace_alloc,
+                             gsl_integration_cquad_workspace_free, &gsl_integration_cquad_workspace::size> cquad_pool;
+
+      /// 21-point Kronrod abscissae on [-1,1] (positive half, centre last); the odd entries are the
+      /// 10-point Gauss abscissae.  Values as in GSL's qk21.
+      const double xgk[11] =
+      {
+        0.995657163025808080735527280689003,
+        0.973906528517171720077964012084452,
+        0.930157491355708226001207180059508,
+        0.865063366688984510732096688423493,
+        0.780817726586416897063717578345042,
+        0.679409568299024406234327365114874,
+        0.562757134668604683339000099272694,
+        0.433395394129247190799265943165784,
+        0.294392862701460198131126603103866,
+        0.148874338981631210884826001129720,
+        0.000000000000000000000000000000000
+      };
+
+      /// Weights of the 10-point Gauss rule
+      const double wg[5] =
+      {
+        0.066671344308688137593568809893332,
+        0.149451349150580593145776339657697,
+        0.219086362515982043995534934228163,
+        0.269266719309996355091226921569469,
+        0.295524224714752870173892994651338
+      };
+
+      /// Weights of the 21-point Kronrod rule
+      const double wgk[11] =
+      {
+        0.011694638867371874278064396062192,
+        0.032558162307964727478818972459390,
+        0.054755896574351996031381300244580,
+        0.075039674810919952767043140916190,
+        0.093125454583697605535065465083366,
+        0.109387158802297641899210590325805,
+        0.123491976262065851077600525634311,
+        0.134709217311473325928054001771707,
+        0.142775938577060080797094273138717,
+        0.147739104901338491374841515972068,
+        0.149445554002916905664936468389821
+      };
+
+      /// 51-point Kronrod abscissae on [-1,1] (positive half, centre last); the odd entries and the
+      /// centre are the 25-point Gauss abscissae.  Values as in GSL's qk51.
+      const double xgk51[26] =
+      {
+        0.999262104992609834193457486540341,
+        0.995556969790498097908784946893902,
+        0.988035794534077247637331014577406,
+        0.976663921459517511498315386479594,
+        0.961614986425842512418130033660167,
+        0.942974571228974339414011169658471,
+        0.920747115281701561746346084546331,
+        0.894991997878275368851042006782805,
+        0.865847065293275595448996969588340,
+        0.833442628760834001421021108693570,
+        0.797873797998500059410410904994307,
+        0.759259263037357630577282865204361,
+        0.717766406813084388186654079773298,
+        0.673566368473468364485120633247622,
+        0.626810099010317412788122681624518,
+        0.577662930241222967723689841612654,
+        0.526325284334719182599623778158010,
+        0.473002731445714960522182115009192,
+        0.417885382193037748851814394594572,
+        0.361172305809387837735821730127641,
+        0.303089538931107830167478909980339,
+        0.243866883720988432045190362797452,
+        0.183718939421048892015969888759528,
+        0.122864692610710396387359818808037,
+        0.061544483005685078886546392366797,
+        0.000000000000000000000000000000000
+      };
+
+      /// Weights of the 25-point Gauss rule (centre last)
+      const double wg51[13] =
+      {
+        0.011393798501026287947902964113235,
+        0.026354986615032137261901815295299,
+        0.040939156701306312655623487711646,
+        0.054904695975835191925936891540473,
+        0.068038333812356917207187185656708,
+        0.080140700335001018013234959669111,
+        0.091028261982963649811497220702892,
+        0.100535949067050644202206890392686,
+        0.108519624474263653116093957050117,
+        0.114858259145711648339325545869556,
+        0.119455763535784772228178126512901,
+        0.122242442990310041688959518945852,
+        0.123176053726715451203902873079050
+      };
+
+      /// Weights of the 51-point Kronrod rule
+      const double wgk51[26] =
+      {
+        0.001987383892330315926507851882843,
+        0.005561932135356713758040236901066,
+        0.009473973386174151607207710523655,
+        0.013236229195571674813656405846976,
+        0.016847817709128298231516667536336,
+        0.020435371145882835456568292235939,
+        0.024009945606953216220092489164881,
+        0.027475317587851737802948455517811,
+        0.030792300167387488891109020215229,
+        0.034002130274329337836748795229551,
+        0.037116271483415543560330625367620,
+        0.040083825504032382074839284467076,
+        0.042872845020170049476895792439495,
+        0.045502913049921788909870584752660,
+        0.047982537138836713906392255756915,
+        0.050277679080715671963325259433440,
+        0.052362885806407475864366712137873,
+        0.054251129888545490144543370459876,
+        0.055950811220412317308240686382747,
+        0.057437116361567832853582693939506,
+        0.058689680022394207961974175856788,
+        0.059720340324174059979099291932562,
+        0.060539455376045862945360267517565,
+        0.061128509717053048305859030416293,
+        0.061471189871425316661544131965264,
+        0.061580818067832935078759824240065
+      };
+
+      /// A Gauss-Kronrod rule: half pairs of abscissae xgk[j] and the centre xgk[half], with the Gauss
+      /// abscissae at the odd j (and the centre, if half is odd)
+      struct gk_rule
+      {
+        size_t half;
+        const double* xgk;
+        const double* wg;
+        const double* wgk;
+        size_t points() const { return 2*half + 1; }
+      };
+
+      const gk_rule gk21 = {10, xgk, wg, wgk};
+      const gk_rule gk51 = {25, xgk51, wg51, wgk51};
+
+      /// QUADPACK's error estimate for one panel, as in GSL: the Kronrod-Gauss difference err is
+      /// scaled by its size relative to the variation of the integrand over the panel (asc), so that
+      /// well-resolved panels are not refined on the strength of the cruder Gauss result alone.
+      double rescaled_error(double err, double asc)
+      {
+        err = std::abs(err);
+        if (asc != 0 and err != 0) err = asc*std::min(1.0, std::pow(200*err/asc, 1.5));
+        return err;
+      }
+
+      /// QUADPACK's lower bound on the error of one panel: the rounding error of the sum of |f| (abs).
+      double rounding_error(double abs)
+      {
+        return abs > DBL_MIN/(50*DBL_EPSILON) ? 50*DBL_EPSILON*abs : 0.0;
+      }
+
+      /// Panels of a Gauss-Kronrod integration, with the result, error estimate and rounding error of each member on each panel.
+      /// A panel is unresolved for a member if its error estimate is saturated at the variation of the integrand over it.
+      struct gk_panels
+      {
+        const gk_rule& rule;
+        size_t m;
+        std::vector<double> lo, hi, result, error, rounding;
+        std::vector<bool> unresolved;
+
+        size_t size() const { return lo.size(); }
+
+        void add(double a, double b)
+        {
+          lo.push_back(a);
+          hi.push_back(b);
+          result.resize(result.size() + m);
+          error.resize(error.size() + m);
+          rounding.resize(rounding.size() + m);
+          unresolved.resize(unresolved.size() + m);
+        }
+
+        /// Apply the rule to panels [first, size()), evaluating all their abscissae in one batch
+        void evaluate(const batch_integrand& f, size_t first, std::vector<double>& x, std::vector<double>& fx)
+        {
+          const size_t h = rule.half, points = rule.points(), n = (size() - first) * points;
+          x.resize(n);
+          fx.resize(n*m);
+          for (size_t p = first; p < size(); ++p)
+          {
+            const double centre = 0.5*(lo[p] + hi[p]), half = 0.5*(hi[p] - lo[p]);
+            double* xp = &x[(p - first)*points];
+            for (size_t j = 0; j < h; ++j)
+            {
+              xp[j] = centre - half*rule.xgk[j];
+              xp[2*h-j] = centre + half*rule.xgk[j];
+            }
+            xp[h] = centre;
+          }
+
+          f(x.data(), n, fx.data());
+
+          for (size_t k = 0; k < m; ++k)
+          {
+            for (size_t p = first; p < size(); ++p)
+            {
+              const double* fp = &fx[k*n + (p - first)*points];
+              double kronrod = rule.wgk[h]*fp[h], abs = rule.wgk[h]*std::abs(fp[h]);
+              double gauss = (h % 2 == 1 ? rule.wg[h/2]*fp[h] : 0.0);
+              for (size_t j = 0; j < h; ++j)
+              {
+                const double pair = fp[j] + fp[2*h-j];
+                kronrod += rule.wgk[j]*pair;
+                abs += rule.wgk[j]*(std::abs(fp[j]) + std::abs(fp[2*h-j]));
+                if (j % 2 == 1) gauss += rule.wg[j/2]*pair;
+              }
+              const double mean = 0.5*kronrod;
+              double asc = rule.wgk[h]*std::abs(fp[h] - mean);
+              for (size_t j = 0; j < h; ++j) asc += rule.wgk[j]*(std::abs(fp[j] - mean) + std::abs(fp[2*h-j] - mean));
+              const double half = 0.5*(hi[p] - lo[p]);
+              result[p*m + k] = kronrod*half;
+              rounding[p*m + k] = rounding_error(abs*std::abs(half));
+              error[p*m + k] = std::max(rescaled_error((kronrod - gauss)*half, asc*std::abs(half)), rounding[p*m + k]);
+              unresolved[p*m + k] = (error[p*m + k] != 0 and error[p*m + k] == asc*std::abs(half));
+            }
+          }
+        }
+      };
+
+      /// Integrate a family of batch integrands with the panels of a Gauss-Kronrod rule
+      std::vector<double> integrate_gk_family(const gk_rule& rule, const batch_integrand& f, size_t m, double a, double b,
+                                              double abseps, double releps, size_t limit, std::vector<double>* abserr)
+      {
+        std::vector<double> result(m, 0.0), error(m, 0.0), x, fx;
+        if (m == 0 or a == b) { if (abserr != nullptr) *abserr = error; return result; }
+
+        gk_panels panels{rule, m, {}, {}, {}, {}, {}, {}};
+        panels.add(a, b);
+        panels.evaluate(f, 0, x, fx);
+        std::vector<size_t> split;
+        std::vector<double> tolerance(m);
+        bool converged = false;
+
+        while (true)
+        {
+          // Totals and tolerances of each member
+          std::fill(result.begin(), result.end(), 0.0);
+          std::fill(error.begin(), error.end(), 0.0);
+          for (size_t p = 0; p < panels.size(); ++p)
+          {
+            for (size_t k = 0; k < m; ++k)
+            {
+              result[k] += panels.result[p*m + k];
+              error[k] += panels.error[p*m + k];
+            }
+          }
+          // As in GSL's qag, a single panel is not accepted while it is unresolved, whatever its error estimate
+          converged = true;
+          for (size_t k = 0; k < m; ++k)
+          {
+            tolerance[k] = std::max(abseps, releps*std::abs(result[k]));
+            if (not (error[k] <= tolerance[k]) or (panels.size() == 1 and panels.unresolved[k])) converged = false;
+          }
+          if (converged or panels.size() >= limit) break;
+
+          // Bisect the panels holding more than their share (by width) of some member's tolerance, unless their
+          // error is all rounding error, which bisection cannot reduce.  Some such panel exists until the limit
+          // is reached, unless they are all too narrow to bisect any further or only rounding error is left.
+          split.clear();
+          for (size_t p = 0; p < panels.size() and panels.size() + split.size() < limit; ++p)
+          {
+            const double width = panels.hi[p] - panels.lo[p];
+            if (std::abs(width) <= 100*DBL_EPSILON*(std::abs(panels.lo[p]) + std::abs(panels.hi[p]))) continue;
+            const double share = width/(b - a);
+            for (size_t k = 0; k < m; ++k)
+            {
+              if ((error[k] > tolerance[k] and panels.error[p*m + k] > tolerance[k]*share
+                   and panels.error[p*m + k] > panels.rounding[p*m + k]) or (panels.size() == 1 and panels.unresolved[k]))
+              {
+                split.push_back(p);
+                break;
+              }
+            }
+          }
+          if (split.empty()) break;
+
+          // Each split panel keeps its lower half; the upper halves go on the end, evaluated together
+          const size_t first = panels.size();
+          for (size_t p : split)
+          {
+            const double mid = 0.5*(panels.lo[p] + panels.hi[p]);
+            panels.add(mid, panels.hi[p]);
+            panels.hi[p] = mid;
+          }
+          for (size_t p : split) panels.add(panels.lo[p], panels.hi[p]);
+          panels.evaluate(f, first, x, fx);
+          // Copy the re-evaluated lower halves back into place and drop the duplicates
+          const size_t n_split = split.size();
+          for (size_t i = 0; i < n_split; ++i)
+          {
+            const size_t q = first + n_split + i;
+            std::copy(panels.result.begin() + q*m, panels.result.begin() + (q+1)*m, panels.result.begin() + split[i]*m);
+            std::copy(panels.error.begin() + q*m, panels.error.begin() + (q+1)*m, panels.error.begin() + split[i]*m);
+            std::copy(panels.rounding.begin() + q*m, panels.rounding.begin() + (q+1)*m, panels.rounding.begin() + split[i]*m);
+            std::copy(panels.unresolved.begin() + q*m, panels.unresolved.begin() + (q+1)*m, panels.unresolved.begin() + split[i]*m);
+          }
+          panels.lo.resize(first + n_split);
+          panels.hi.resize(first + n_split);
+          panels.result.resize((first + n_split)*m);
+          panels.error.resize((first + n_split)*m);
+          panels.rounding.resize((first + n_split)*m);
+          panels.unresolved.resize((first + n_split)*m);
+        }
+
+        for (size_t k = 0; k < m; ++k)
+        {
+          if (Utils::isnan(result[k])) invalid_point().raise("Integration returned NaN.");
+        }
+        if (abserr != nullptr) *abserr = error;
+        if (not converged)
+        {
+          std::ostringstream msg;
+          msg << "Integration did not reach the requested tolerance ";
+          if (panels.size() >= limit) msg << "within the limit of " << limit << " panels.";
+          else msg << "before roundoff error prevented further refinement.";
+          for (size_t k = 0; k < m; ++k)
+          {
+            if (not (error[k] <= tolerance[k])) msg << endl << "  Member " << k << ": result " << result[k]
+                                                    << ", error estimate " << error[k] << ", tolerance " << tolerance[k];
+          }
+          invalid_point().raise(msg.str());
+        }
+        return result;
+      }
+    }
+
     /// Unwrapper for passing std::function to GSL integrator
     /// Based on example from https://martin-ueding.de/articles/cpp-lambda-into-gsl/index.html
     double unwrap(double x, void *p)
@@ -41,14 +426,13 @@ namespace Gambit
     {
 
       double result = 0.0;
-      gsl_integration_cquad_workspace * gsl_ws = gsl_integration_cquad_workspace_alloc(100);
+      cquad_workspace gsl_ws(100);
 
       gsl_function F;
       F.function = unwrap;
       F.params = &ftor;
 
       gsl_integration_cquad(&F, a, b, abseps, releps, gsl_ws, &result, NULL, NULL);
-      gsl_integration_cquad_workspace_free(gsl_ws);
 
       // Check result
       if (Utils::isnan(result))
@@ -59,7 +443,45 @@ namespace Gambit
       return result;
     }
 
+    integration_workspace::integration_workspace(size_t limit) : w(qag_pool::borrow(limit)) {}
+
+    integration_workspace::~integration_workspace() { qag_pool::give_back(w); }
 
+    cquad_workspace::cquad_workspace(size_t size) : w(cquad_pool::borrow(size)) {}
+
+    cquad_workspace::~cquad_workspace() { cquad_pool::give_back(w); }
+
+    /// Integrate a single batch integrand with 21-point Gauss-Kronrod panels
+    double integrate_gk21(const batch_integrand& f, double a, double b, double abseps, double releps, size_t limit, double* abserr)
+    {
+      std::vector<double> err;
+      double result = integrate_gk_family(gk21, f, 1, a, b, abseps, releps, limit, &err)[0];
+      if (abserr != nullptr) *abserr = err[0];
+      return result;
+    }
+
+    /// Integrate a family of batch integrands with 21-point Gauss-Kronrod panels
+    std::vector<double> integrate_gk21_family(const batch_integrand& f, size_t m, double a, double b, double abseps,
+                                              double releps, size_t limit, std::vector<double>* abserr)
+    {
+      return integrate_gk_family(gk21, f, m, a, b, abseps, releps, limit, abserr);
+    }
+
+    /// Integrate a single batch integrand with 51-point Gauss-Kronrod panels
+    double integrate_gk51(const batch_integrand& f, double a, double b, double abseps, double releps, size_t limit, double* abserr)
+    {
+      std::vector<double> err;
+      double result = integrate_gk_family(gk51, f, 1, a, b, abseps, releps, limit, &err)[0];
+      if (abserr != nullptr) *abserr = err[0];
+      return result;
+    }
+
+    /// Integrate a family of batch integrands with 51-point Gauss-Kronrod panels
+    std::vector<double> integrate_gk51_family(const batch_integrand& f, size_t m, double a, double b, double abseps,
+                                              double releps, size_t limit, std::vector<double>* abserr)
+    {
+      return integrate_gk_family(gk51, f, m, a, b, abseps, releps, limit, abserr);
+    }
 
   }
 
@@ -23,6 +23,8 @@
 #include <vector>
 #include <map>
 #include <string>
+#include <cmath>
+#include <algorithm>
 
 #include <gsl/gsl_spline.h>
 #include <gsl/gsl_interp2d.h>
@@ -593,6 +595,135 @@ namespace Gambit
     }
 
 
+    //
+    // interp_grid_index class methods
+    //
+
+    // Default constructor
+    interp_grid_index::interp_grid_index() : ndim(0), dense(true) {}
+
+    // Constructor, taking the sorted unique grid values along each axis, and the columns of the table giving the coordinates of each row
+    interp_grid_index::interp_grid_index(const std::vector<std::vector<double>>& axes_in, const std::vector<table_column>& columns)
+     : ndim(axes_in.size()), axes(axes_in), steps(ndim, 0.0), strides(ndim, 1), dense(true)
+    {
+      if (ndim == 0 or ndim > max_dim or columns.size() != ndim)
+      {
+        utils_error().raise(LOCAL_INFO, "ERROR! Invalid number of dimensions for interpolation grid.");
+      }
+
+      // Work out which axes are uniformly spaced, so that they can be indexed directly
+      for (size_t d = 0; d < ndim; ++d)
+      {
+        const std::vector<double>& axis = axes[d];
+        if (axis.size() < 2) continue;
+        double step = (axis.back() - axis.front()) / (axis.size() - 1);
+        bool uniform = (step > 0);
+        for (size_t i = 1; i < axis.size() and uniform; ++i)
+        {
+          uniform = std::abs(axis[i] - (axis.front() + i*step)) <= 1e-9*std::abs(step);
+        }
+        if (uniform) steps[d] = step;
+      }
+
+      // Number the grid points, and store the table row of each one. The rows are held in a flat
+      // array over all grid points if the table fills most of the grid, and otherwise (for tables
+      // with many missing points) in a hash map. A hash map entry costs several times the 8 bytes
+      // of an array entry, so the array is used for tables covering at least a quarter of the grid.
+      const size_t nrows = columns[0].size();
+      size_t npoints = 1;
+      for (size_t d = 0; d < ndim; ++d)
+      {
+        strides[d] = npoints;
+        npoints *= axes[d].size();
+      }
+      dense = (npoints <= 4*nrows);
+      if (dense) dense_rows.assign(npoints, -1);
+      if (not dense) sparse_rows.reserve(nrows);
+      for (size_t k = 0; k < nrows; ++k)
+      {
+        size_t point = 0;
+        for (size_t d = 0; d < ndim; ++d)
+        {
+          size_t i = std::lower_bound(axes[d].begin(), axes[d].end(), columns[d][k]) - axes[d].begin();
+          point += i*strides[d];
+        }
+        // If a grid point appears more than once, the last row is used.
+        if (dense) dense_rows[point] = k;
+        else sparse_rows[point] = k;
+      }
+    }
+
+    // Find the grid values either side of x along an axis (the same value twice if x lies on it)
+    bool interp_grid_index::locate(size_t d, double x, size_t& lo, size_t& hi) const
+    {
+      const std::vector<double>& axis = axes[d];
+      if (not (x >= axis.front() and x <= axis.back())) return false;
+      size_t i;
+      if (steps[d] > 0)
+      {
+        // Direct lookup, corrected for rounding
+        i = std::min(size_t((x - axis.front()) / steps[d]), axis.size() - 1);
+        while (i > 0 and x < axis[i]) i--;
+        while (i + 1 < axis.size() and x >= axis[i+1]) i++;
+      }
+      else
+      {
+        i = std::upper_bound(axis.begin(), axis.end(), x) - axis.begin() - 1;
+      }
+      lo = i;
+      hi = (x == axis[i] ? i : i + 1);
+      return true;
+    }
+
+    // Table row of a grid point
+    long interp_grid_index::row(size_t point) const
+    {
+      if (dense) return dense_rows[point];
+      auto it = sparse_rows.find(point);
+      return (it == sparse_rows.end() ? -1 : it->second);
+    }
+
+    // Find the table rows at the corners of the grid cell containing a point
+    bool interp_grid_index::find_corners(const double* x, long* rows, double* lower, double* upper) const
+    {
+      size_t lo[max_dim], hi[max_dim];
+      for (size_t d = 0; d < ndim; ++d)
+      {
+        if (not locate(d, x[d], lo[d], hi[d])) return false;
+        lower[d] = axes[d][lo[d]];
+        upper[d] = axes[d][hi[d]];
+      }
+      for (size_t c = 0; c < (size_t(1) << ndim); ++c)
+      {
+        size_t point = 0;
+        for (size_t d = 0; d < ndim; ++d) point += ((c >> d) & 1 ? hi[d] : lo[d]) * strides[d];
+        rows[c] = row(point);
+        if (rows[c] < 0) return false;
+      }
+      return true;
+    }
+
+    // Linear interpolation in 1D
+    double linearinterp1D(double x1, double x2, double y1, double y2, double xtest)
+    {
+      // Avoid NaNs
+      if(x2==x1) return y1;
+      return (y1 + (xtest-x1)/(x2-x1) * (y2 - y1));
+    }
+
+    // Multilinear interpolation from the values at the corners of a grid cell, as a series of 1D interpolations
+    // along each dimension in turn. The corner values are overwritten.
+    double multilinearinterp(size_t ndim, double* fi, const double* xi_lower, const double* xi_upper, const double* xi)
+    {
+      for (size_t d = 0; d < ndim; ++d)
+      {
+        size_t n = size_t(1) << (ndim - d - 1);
+        for (size_t j = 0; j < n; ++j) fi[j] = linearinterp1D(xi_lower[d], xi_upper[d], fi[2*j], fi[2*j+1], xi[d]);
+      }
+      return fi[0];
+    }
+
+
     //
     // interp4d_collection class methods
     //
@@ -607,16 +738,16 @@ namespace Gambit
       }
 
       // Read numerical values from data file.
-      ASCIItableReader tab(file_name_in);
+      table.read(file_name_in);
 
       // Check that there's more than 4 columns
-      if (tab.getncol() < 5)
+      if (table.getncol() < 5)
       {
         utils_error().raise(LOCAL_INFO, "ERROR! Less than five columns found in the input file '" + file_name_in + "'.");
       }
 
       // Check that the number of columns matches the number of column names
-      if (colnames_in.size() != (size_t) tab.getncol())
+      if (colnames_in.size() != (size_t) table.getncol())
       {
         utils_error().raise(LOCAL_INFO, "ERROR! Mismatch between number of columns and number of column names.");
       }
@@ -626,7 +757,7 @@ namespace Gambit
       missing_point_val = missing_pts_val;
 
       // Set the column names
-      tab.setcolnames(colnames_in);
+      table.setcolnames(colnames_in);
 
       // Save some names
       collection_name = collection_name_in;
@@ -641,32 +772,32 @@ namespace Gambit
       n_interpolators = interpolator_names.size();
 
       // Get unique entries of "xi" for the grid and grid size.
-      x1_vec = tab[x1_name];
-      x1_vec_unsorted = tab[x1_name];
+      x1_vec_unsorted = table.column(x1_name);
+      x1_vec = x1_vec_unsorted;
       sort(x1_vec.begin(), x1_vec.end());
       x1_vec.erase(unique(x1_vec.begin(), x1_vec.end()), x1_vec.end());
       int nx1 = x1_vec.size();
       x1_min = x1_vec.front();
       x1_max = x1_vec.back();
 
-      x2_vec = tab[x2_name];
-      x2_vec_unsorted = tab[x2_name];
+      x2_vec_unsorted = table.column(x2_name);
+      x2_vec = x2_vec_unsorted;
       sort(x2_vec.begin(), x2_vec.end());
       x2_vec.erase(unique(x2_vec.begin(), x2_vec.end()), x2_vec.end());
       int nx2 = x2_vec.size();
       x2_min = x2_vec.front();
       x2_max = x2_vec.back();
 
-      x3_vec = tab[x3_name];
-      x3_vec_unsorted = tab[x3_name];
+      x3_vec_unsorted = table.column(x3_name);
+      x3_vec = x3_vec_unsorted;
       sort(x3_vec.begin(), x3_vec.end());
       x3_vec.erase(unique(x3_vec.begin(), x3_vec.end()), x3_vec.end());
       int nx3 = x3_vec.size();
       x3_min = x3_vec.front();
       x3_max = x3_vec.back();
 
-      x4_vec = tab[x4_name];
-      x4_vec_unsorted = tab[x4_name];
+      x4_vec_unsorted = table.column(x4_name);
+      x4_vec = x4_vec_unsorted;
       sort(x4_vec.begin(), x4_vec.end());
       x4_vec.erase(unique(x4_vec.begin(), x4_vec.end()), x4_vec.end());
       int nx4 = x4_vec.size();
@@ -678,177 +809,67 @@ namespace Gambit
       {
         std::string interp_name = interpolator_names[interp_index];
 
-        int n_points = (tab[interp_name]).size();
+        int n_points = table.column(interp_name).size();
 
         if (!allow_missing_pts && (nx1 * nx2 * nx3 * nx4 != n_points))
         {
           utils_error().raise(LOCAL_INFO, "ERROR! The number of grid points ("+std::to_string(n_points)+") does not agree with the number of unique 'x' and 'y' values ("+std::to_string(nx1)+" and "+std::to_string(nx2)+") for the interpolator '"+interp_name+"'.\n Check formatting of the file: '"+file_name_in+"'. This could be the case if the interpolation grid is missing points.");
         }
 
-        interp_data.push_back(tab[interp_name]);
+        interp_data.push_back(table.column(interp_name));
       }
+
+      // Index the grid points
+      grid = interp_grid_index({x1_vec, x2_vec, x3_vec, x4_vec}, {x1_vec_unsorted, x2_vec_unsorted, x3_vec_unsorted, x4_vec_unsorted});
     }
 
     // Destructor
     interp4d_collection::~interp4d_collection() {}
 
-    // Just some forward declarations...
-    void InterpIter(int Ntemp,double xi_1,double xi_2,std::vector<double>& fi,double test);
-
     // Evaluate a given interpolation
     double interp4d_collection::eval(double x1,double x2,double x3,double x4, size_t interp_index)
     {
-      double xi[] = {x1,x2,x3,x4};
-      std::vector<double> fi_values = interp_data[interp_index];
-
-      // Determine upper and lower bounds
-      double xi_upper[] = {0.0,0.0,0.0,0.0};
-      double xi_lower[] = {0.0,0.0,0.0,0.0};
+      const double xi[] = {x1,x2,x3,x4};
+      double xi_lower[4], xi_upper[4];
+      long rows[16];
 
-      // Determine edges (-1 to make sure it doesn't run over the last element)
-      for (size_t i=0;i<(x1_vec.size());i++)
-      {
-        // // In case of exact match
-        if (x1 == x1_vec[i])
-        {
-          xi_lower[0] = x1_vec[i];
-          xi_upper[0] = x1_vec[i];
-        }
-        // Otherwise bounds as normal
-        if (x1 > x1_vec[i] && x1 < x1_vec[i+1])
-        {
-          xi_lower[0] = x1_vec[i];
-          xi_upper[0] = x1_vec[i+1];
-        }
-        // End early if you have found all of the bounds
-        if (x1 < x1_vec[i] ) break;
-      }
-
-      for (size_t i=0;i<(x2_vec.size());i++)
-      {
-        if (x2 == x2_vec[i])
-        {
-          xi_lower[1] = x2_vec[i];
-          xi_upper[1] = x2_vec[i];
-        }
-        if (x2 > x2_vec[i] && x2 < x2_vec[i+1])
-        {
-          xi_lower[1] = x2_vec[i];
-          xi_upper[1] = x2_vec[i+1];
-        }
-        if (x2 < x2_vec[i]) break;
-      }
-
-      for (size_t i=0;i<(x3_vec.size());i++)
-      {
-        if (x3 == x3_vec[i])
-        {
-          xi_lower[2] = x3_vec[i];
-          xi_upper[2] = x3_vec[i];
-        }
-        if (x3 > x3_vec[i] && x3 < x3_vec[i+1])
-        {
-          xi_lower[2] = x3_vec[i];
-          xi_upper[2] = x3_vec[i+1];
-        }
-        if (x3 < x3_vec[i]) break;
-      }
-
-      for (size_t i=0;i<(x4_vec.size());i++)
+      // If failed to find all points needed for interpolation, throw an error.
+      // If the user allows missing pts, e.g. for additional cuts on what grid points were simulated, just return missing_point_val
+      if (not grid.find_corners(xi, rows, xi_lower, xi_upper))
       {
-        if (x4 == x4_vec[i])
-        {
-          xi_lower[3] = x4_vec[i];
-          xi_upper[3] = x4_vec[i];
-        }
-        if (x4 > x4_vec[i] && x4 < x4_vec[i+1])
-        {
-          xi_lower[3] = x4_vec[i];
-          xi_upper[3] = x4_vec[i+1];
-        }
-        if (x4 < x4_vec[i]) break;
+        if (not allow_missing_pts) utils_error().raise(LOCAL_INFO, "ERROR! 4D Interpolation fails for this parameter point.");
+        return missing_point_val;
       }
 
-      // Find the corresponding function values
-      // Using a default value of -1 as this is assumed not a valid result
-      std::vector<double> fi = {-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0};
-      bool test_u[] = {false,false,false,false};
-      bool test_l[] = {false,false,false,false};
-
-      //Loop over all interp_data, and match value to coresponding value.
-      for (size_t k=0;k<fi_values.size();k++)
-      {
-        // Reset Values
-        test_u[0] = false; test_u[1] = false; test_u[2] = false; test_u[3] = false;
-        test_l[0] = false; test_l[1] = false; test_l[2] = false; test_l[3] = false;
-
-        // Check whether the values correspond to any of the upper/lower values. skip calculation if not...
-        if (x1_vec_unsorted[k]==xi_upper[0]) { test_u[0]=true;}
-        if (x1_vec_unsorted[k]==xi_lower[0]) { test_l[0]=true;}
-        if (test_u[0]==false && test_l[0]==false) continue;
-
-        if (x2_vec_unsorted[k]==xi_upper[1]) { test_u[1]=true;}
-        if (x2_vec_unsorted[k]==xi_lower[1]) { test_l[1]=true;}
-        if (test_u[1]==false && test_l[1]==false) continue;
-
-        if (x3_vec_unsorted[k]==xi_upper[2]) { test_u[2]=true;}
-        if (x3_vec_unsorted[k]==xi_lower[2]) { test_l[2]=true;}
-        if (test_u[2]==false && test_l[2]==false) continue;
-
-        if (x4_vec_unsorted[k]==xi_upper[3]) { test_u[3]=true;}
-        if (x4_vec_unsorted[k]==xi_lower[3]) { test_l[3]=true;}
-        if (test_u[3]==false && test_l[3]==false) continue;
-
-        // Set the values of fi in the correct order
-        if (test_l[0] && test_l[1] && test_l[2] && test_l[3]) {fi[0] = fi_values[k];}
-        if (test_u[0] && test_l[1] && test_l[2] && test_l[3]) {fi[1] = fi_values[k];}
-        if (test_l[0] && test_u[1] && test_l[2] && test_l[3]) {fi[2] = fi_values[k];}
-        if (test_u[0] && test_u[1] && test_l[2] && test_l[3]) {fi[3] = fi_values[k];}
-        if (test_l[0] && test_l[1] && test_u[2] && test_l[3]) {fi[4] = fi_values[k];}
-        if (test_u[0] && test_l[1] && test_u[2] && test_l[3]) {fi[5] = fi_values[k];}
-        if (test_l[0] && test_u[1] && test_u[2] && test_l[3]) {fi[6] = fi_values[k];}
-        if (test_u[0] && test_u[1] && test_u[2] && test_l[3]) {fi[7] = fi_values[k];}
-        if (test_l[0] && test_l[1] && test_l[2] && test_u[3]) {fi[8] = fi_values[k];}
-        if (test_u[0] && test_l[1] && test_l[2] && test_u[3]) {fi[9] = fi_values[k];}
-        if (test_l[0] && test_u[1] && test_l[2] && test_u[3]) {fi[10] = fi_values[k];}
-        if (test_u[0] && test_u[1] && test_l[2] && test_u[3]) {fi[11] = fi_values[k];}
-        if (test_l[0] && test_l[1] && test_u[2] && test_u[3]) {fi[12] = fi_values[k];}
-        if (test_u[0] && test_l[1] && test_u[2] && test_u[3]) {fi[13] = fi_values[k];}
-        if (test_l[0] && test_u[1] && test_u[2] && test_u[3]) {fi[14] = fi_values[k];}
-        if (test_u[0] && test_u[1] && test_u[2] && test_u[3]) {fi[15] = fi_values[k];}
+      // Perform the actual calculation
+      const table_column& fi_values = interp_data[interp_index];
+      double fi[16];
+      for (size_t c = 0; c < 16; ++c) fi[c] = fi_values[rows[c]];
+      return multilinearinterp(4, fi, xi_lower, xi_upper, xi);
+    }
 
-      }
+    // Evaluate all interpolations at once, sharing the grid lookup
+    void interp4d_collection::eval(double x1,double x2,double x3,double x4, std::vector<double>& results)
+    {
+      const double xi[] = {x1,x2,x3,x4};
+      double xi_lower[4], xi_upper[4];
+      long rows[16];
+      results.resize(n_interpolators);
 
-      // If failed to find all points needed for interpolation, throw an error.
-      // If the user allows missing pts, e.g. for additional cuts on what grid points were simulated, just return missing_point_val
-      size_t index = 0;
-      while(index<16)
+      if (not grid.find_corners(xi, rows, xi_lower, xi_upper))
       {
-        // Checking against a default value
-        if (fi[index]==-1.0)
-        {
-          if (allow_missing_pts)
-          {
-            return missing_point_val;
-          } else {
-            utils_error().raise(LOCAL_INFO, "ERROR! 4D Interpolation fails for this parameter point.");
-          }
-        }
-        index++;
+        if (not allow_missing_pts) utils_error().raise(LOCAL_INFO, "ERROR! 4D Interpolation fails for this parameter point.");
+        std::fill(results.begin(), results.end(), missing_point_val);
+        return;
       }
 
-      // Variables to track repetitions
-      int it = 0;
-      int itmax = 4;
-
-      // Perform the actual Calculation
-      while (it < itmax)
+      for (size_t interp_index = 0; interp_index < n_interpolators; ++interp_index)
       {
-        InterpIter((itmax-it),xi_lower[it],xi_upper[it],fi,xi[it]);
-        it++;
+        const table_column& fi_values = interp_data[interp_index];
+        double fi[16];
+        for (size_t c = 0; c < 16; ++c) fi[c] = fi_values[rows[c]];
+        results[interp_index] = multilinearinterp(4, fi, xi_lower, xi_upper, xi);
       }
-
-      return fi[0];
     }
 
     // Check if point is inside interpolation range
@@ -872,16 +893,16 @@ namespace Gambit
       }
 
       // Read numerical values from data file.
-      ASCIItableReader tab(file_name_in);
+      table.read(file_name_in);
 
       // Check that there's more than 5 columns
-      if (tab.getncol() < 6)
+      if (table.getncol() < 6)
       {
         utils_error().raise(LOCAL_INFO, "ERROR! Less than six columns found in the input file '" + file_name_in + "'.");
       }
 
       // Check that the number of columns matches the number of column names
-      if (colnames_in.size() != (size_t) tab.getncol())
+      if (colnames_in.size() != (size_t) table.getncol())
       {
         utils_error().raise(LOCAL_INFO, "ERROR! Mismatch between number of columns and number of column names.");
       }
@@ -891,7 +912,7 @@ namespace Gambit
       missing_point_val = missing_pts_val;
 
       // Set the column names
-      tab.setcolnames(colnames_in);
+      table.setcolnames(colnames_in);
 
       // Save some names
       collection_name = collection_name_in;
@@ -907,40 +928,40 @@ namespace Gambit
       n_interpolators = interpolator_names.size();
 
       // Get unique entries of "xi" for the grid and grid size.
-      x1_vec = tab[x1_name];
-      x1_vec_unsorted = tab[x1_name];
+      x1_vec_unsorted = table.column(x1_name);
+      x1_vec = x1_vec_unsorted;
       sort(x1_vec.begin(), x1_vec.end());
       x1_vec.erase(unique(x1_vec.begin(), x1_vec.end()), x1_vec.end());
       int nx1 = x1_vec.size();
       x1_min = x1_vec.front();
       x1_max = x1_vec.back();
 
-      x2_vec = tab[x2_name];
-      x2_vec_unsorted = tab[x2_name];
+      x2_vec_unsorted = table.column(x2_name);
+      x2_vec = x2_vec_unsorted;
       sort(x2_vec.begin(), x2_vec.end());
       x2_vec.erase(unique(x2_vec.begin(), x2_vec.end()), x2_vec.end());
       int nx2 = x2_vec.size();
       x2_min = x2_vec.front();
       x2_max = x2_vec.back();
 
-      x3_vec = tab[x3_name];
-      x3_vec_unsorted = tab[x3_name];
+      x3_vec_unsorted = table.column(x3_name);
+      x3_vec = x3_vec_unsorted;
       sort(x3_vec.begin(), x3_vec.end());
       x3_vec.erase(unique(x3_vec.begin(), x3_vec.end()), x3_vec.end());
       int nx3 = x3_vec.size();
       x3_min = x3_vec.front();
       x3_max = x3_vec.back();
 
-      x4_vec = tab[x4_name];
-      x4_vec_unsorted = tab[x4_name];
+      x4_vec_unsorted = table.column(x4_name);
+      x4_vec = x4_vec_unsorted;
       sort(x4_vec.begin(), x4_vec.end());
       x4_vec.erase(unique(x4_vec.begin(), x4_vec.end()), x4_vec.end());
       int nx4 = x4_vec.size();
       x4_min = x4_vec.front();
       x4_max = x4_vec.back();
 
-      x5_vec = tab[x5_name];
-      x5_vec_unsorted = tab[x5_name];
+      x5_vec_unsorted = table.column(x5_name);
+      x5_vec = x5_vec_unsorted;
       sort(x5_vec.begin(), x5_vec.end());
       x5_vec.erase(unique(x5_vec.begin(), x5_vec.end()), x5_vec.end());
       int nx5 = x5_vec.size();
@@ -952,248 +973,67 @@ namespace Gambit
         // Store the interpolation data to be used later
         std::string interp_name = interpolator_names[interp_index];
 
-        int n_points = (tab[interp_name]).size();
+        int n_points = table.column(interp_name).size();
 
         if (!allow_missing_pts && (nx1 * nx2 * nx3 * nx4 * nx5 != n_points))
         {
           utils_error().raise(LOCAL_INFO, "ERROR! The number of grid points ("+std::to_string(n_points)+") does not agree with the number of unique 'x' and 'y' values ("+std::to_string(nx1)+" and "+std::to_string(nx2)+") for the interpolator '"+interp_name+"'.\n Check formatting of the file: '"+file_name_in+"'. This could be the case if the interpolation grid is missing points.");
         }
 
-        interp_data.push_back(tab[interp_name]);
+        interp_data.push_back(table.column(interp_name));
       }
+
+      // Index the grid points
+      grid = interp_grid_index({x1_vec, x2_vec, x3_vec, x4_vec, x5_vec}, {x1_vec_unsorted, x2_vec_unsorted, x3_vec_unsorted, x4_vec_unsorted, x5_vec_unsorted});
     }
 
     // Destructor
     interp5d_collection::~interp5d_collection() {}
 
-    // Just some forward declarations...
-    void InterpIter(int Ntemp,double xi_1,double xi_2,std::vector<double>& fi,double test);
-
     // Evaluate a given interpolation
     double interp5d_collection::eval(double x1,double x2,double x3,double x4, double x5, size_t interp_index)
     {
-      double xi[] = {x1,x2,x3,x4,x5};
-      std::vector<double> fi_values = interp_data[interp_index];
-
-      // Determine upper and lower bounds
-      double xi_upper[] = {0.0,0.0,0.0,0.0,0.0};
-      double xi_lower[] = {0.0,0.0,0.0,0.0,0.0};
-
-      // Determine edges
-      // This is split into 5 different loops since the number in each dimension may be different
-      for (size_t i=0;i<(x1_vec.size());i++)
-      {
-        // In case of exact match
-        if (x1 == x1_vec[i])
-        {
-          xi_lower[0] = x1_vec[i];
-          xi_upper[0] = x1_vec[i];
-        }
-        // Otherwise bounds as normal
-        if (x1 > x1_vec[i] && x1 < x1_vec[i+1])
-        {
-          xi_lower[0] = x1_vec[i];
-          xi_upper[0] = x1_vec[i+1];
-        }
-        // End early if you have found all of the bounds
-        if (x1 < x1_vec[i] ) break;
-      }
-
-      for (size_t i=0;i<(x2_vec.size());i++)
-      {
-        if (x2 == x2_vec[i])
-        {
-          xi_lower[1] = x2_vec[i];
-          xi_upper[1] = x2_vec[i];
-        }
-        if (x2 > x2_vec[i] && x2 < x2_vec[i+1])
-        {
-          xi_lower[1] = x2_vec[i];
-          xi_upper[1] = x2_vec[i+1];
-        }
-        if (x2 < x2_vec[i]) break;
-      }
-
-      for (size_t i=0;i<(x3_vec.size());i++)
-      {
-        if (x3 == x3_vec[i])
-        {
-          xi_lower[2] = x3_vec[i];
-          xi_upper[2] = x3_vec[i];
-        }
-        if (x3 > x3_vec[i] && x3 < x3_vec[i+1])
-        {
-          xi_lower[2] = x3_vec[i];
-          xi_upper[2] = x3_vec[i+1];
-        }
-        if (x3 < x3_vec[i]) break;
-      }
-
-      for (size_t i=0;i<(x4_vec.size());i++)
-      {
-        if (x4 == x4_vec[i])
-        {
-          xi_lower[3] = x4_vec[i];
-          xi_upper[3] = x4_vec[i];
-        }
-        if (x4 > x4_vec[i] && x4 < x4_vec[i+1])
-        {
-          xi_lower[3] = x4_vec[i];
-          xi_upper[3] = x4_vec[i+1];
-        }
-        if (x4 < x4_vec[i]) break;
-      }
-
-      for (size_t i=0;i<(x5_vec.size());i++)
-      {
-        if (x5 == x5_vec[i])
-        {
-          xi_lower[4] = x5_vec[i];
-          xi_upper[4] = x5_vec[i];
-        }
-        if (x5 > x5_vec[i] && x5 < x5_vec[i+1])
-        {
-          xi_lower[4] = x5_vec[i];
-          xi_upper[4] = x5_vec[i+1];
-        }
-        if (x5 < x5_vec[i]) break;
-      }
-
-      // Find the corresponding function values
-      // Using a default value of -1 as this is assumed not a valid result.
-      // Note: This will cause a problem if your interpolation is using -1.
-      //       However, this should not be the case in any scenarios I can envision.
-      std::vector<double> fi = {-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,
-                                -1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,-1.0,
-                                -1.0,-1.0,-1.0,-1.0};
-      bool test_u[] = {false,false,false,false,false};
-      bool test_l[] = {false,false,false,false,false};
-
-      //Loop over all interp_data, and match value to coresponding value.
-      for (size_t k=0;k<fi_values.size();k++)
-      {
-        // Reset Values
-        test_u[0] = false; test_u[1] = false; test_u[2] = false; test_u[3] = false; test_u[4] = false;
-        test_l[0] = false; test_l[1] = false; test_l[2] = false; test_l[3] = false; test_l[4] = false;
-
-        // Check whether the values correspond to any of the upper/lower values. skip calculation if not...
-        if (x1_vec_unsorted[k]==xi_upper[0]) { test_u[0]=true;}
-        if (x1_vec_unsorted[k]==xi_lower[0]) { test_l[0]=true;}
-        if (test_u[0]==false && test_l[0]==false) continue;
-
-        if (x2_vec_unsorted[k]==xi_upper[1]) { test_u[1]=true;}
-        if (x2_vec_unsorted[k]==xi_lower[1]) { test_l[1]=true;}
-        if (test_u[1]==false && test_l[1]==false) continue;
-
-        if (x3_vec_unsorted[k]==xi_upper[2]) { test_u[2]=true;}
-        if (x3_vec_unsorted[k]==xi_lower[2]) { test_l[2]=true;}
-        if (test_u[2]==false && test_l[2]==false) continue;
-
-        if (x4_vec_unsorted[k]==xi_upper[3]) { test_u[3]=true;}
-        if (x4_vec_unsorted[k]==xi_lower[3]) { test_l[3]=true;}
-        if (test_u[3]==false && test_l[3]==false) continue;
-
-        if (x5_vec_unsorted[k]==xi_upper[4]) { test_u[4]=true;}
-        if (x5_vec_unsorted[k]==xi_lower[4]) { test_l[4]=true;}
-        if (test_u[4]==false && test_l[4]==false) continue;
-
-        // Set the values of fi in the correct order
-        if (test_l[0] && test_l[1] && test_l[2] && test_l[3] && test_l[4]) {fi[0] = fi_values[k];}
-        if (test_u[0] && test_l[1] && test_l[2] && test_l[3] && test_l[4]) {fi[1] = fi_values[k];}
-        if (test_l[0] && test_u[1] && test_l[2] && test_l[3] && test_l[4]) {fi[2] = fi_values[k];}
-        if (test_u[0] && test_u[1] && test_l[2] && test_l[3] && test_l[4]) {fi[3] = fi_values[k];}
-        if (test_l[0] && test_l[1] && test_u[2] && test_l[3] && test_l[4]) {fi[4] = fi_values[k];}
-        if (test_u[0] && test_l[1] && test_u[2] && test_l[3] && test_l[4]) {fi[5] = fi_values[k];}
-        if (test_l[0] && test_u[1] && test_u[2] && test_l[3] && test_l[4]) {fi[6] = fi_values[k];}
-        if (test_u[0] && test_u[1] && test_u[2] && test_l[3] && test_l[4]) {fi[7] = fi_values[k];}
-        if (test_l[0] && test_l[1] && test_l[2] && test_u[3] && test_l[4]) {fi[8] = fi_values[k];}
-        if (test_u[0] && test_l[1] && test_l[2] && test_u[3] && test_l[4]) {fi[9] = fi_values[k];}
-        if (test_l[0] && test_u[1] && test_l[2] && test_u[3] && test_l[4]) {fi[10] = fi_values[k];}
-        if (test_u[0] && test_u[1] && test_l[2] && test_u[3] && test_l[4]) {fi[11] = fi_values[k];}
-        if (test_l[0] && test_l[1] && test_u[2] && test_u[3] && test_l[4]) {fi[12] = fi_values[k];}
-        if (test_u[0] && test_l[1] && test_u[2] && test_u[3] && test_l[4]) {fi[13] = fi_values[k];}
-        if (test_l[0] && test_u[1] && test_u[2] && test_u[3] && test_l[4]) {fi[14] = fi_values[k];}
-        if (test_u[0] && test_u[1] && test_u[2] && test_u[3] && test_l[4]) {fi[15] = fi_values[k];}
-        if (test_l[0] && test_l[1] && test_l[2] && test_l[3] && test_u[4]) {fi[16] = fi_values[k];}
-        if (test_u[0] && test_l[1] && test_l[2] && test_l[3] && test_u[4]) {fi[17] = fi_values[k];}
-        if (test_l[0] && test_u[1] && test_l[2] && test_l[3] && test_u[4]) {fi[18] = fi_values[k];}
-        if (test_u[0] && test_u[1] && test_l[2] && test_l[3] && test_u[4]) {fi[19] = fi_values[k];}
-        if (test_l[0] && test_l[1] && test_u[2] && test_l[3] && test_u[4]) {fi[20] = fi_values[k];}
-        if (test_u[0] && test_l[1] && test_u[2] && test_l[3] && test_u[4]) {fi[21] = fi_values[k];}
-        if (test_l[0] && test_u[1] && test_u[2] && test_l[3] && test_u[4]) {fi[22] = fi_values[k];}
-        if (test_u[0] && test_u[1] && test_u[2] && test_l[3] && test_u[4]) {fi[23] = fi_values[k];}
-        if (test_l[0] && test_l[1] && test_l[2] && test_u[3] && test_u[4]) {fi[24] = fi_values[k];}
-        if (test_u[0] && test_l[1] && test_l[2] && test_u[3] && test_u[4]) {fi[25] = fi_values[k];}
-        if (test_l[0] && test_u[1] && test_l[2] && test_u[3] && test_u[4]) {fi[26] = fi_values[k];}
-        if (test_u[0] && test_u[1] && test_l[2] && test_u[3] && test_u[4]) {fi[27] = fi_values[k];}
-        if (test_l[0] && test_l[1] && test_u[2] && test_u[3] && test_u[4]) {fi[28] = fi_values[k];}
-        if (test_u[0] && test_l[1] && test_u[2] && test_u[3] && test_u[4]) {fi[29] = fi_values[k];}
-        if (test_l[0] && test_u[1] && test_u[2] && test_u[3] && test_u[4]) {fi[30] = fi_values[k];}
-        if (test_u[0] && test_u[1] && test_u[2] && test_u[3] && test_u[4]) {fi[31] = fi_values[k];}
-
-      }
+      const double xi[] = {x1,x2,x3,x4,x5};
+      double xi_lower[5], xi_upper[5];
+      long rows[32];
 
       // If failed to find all points needed for interpolation, throw an error.
       // If the user allows missing pts, e.g. for additional cuts on what grid points were simulated, just return missing_point_val
-      size_t index = 0;
-      while(index<32)
-      {
-        // Checking against a default value
-        if (fi[index]==-1.0)
-        {
-          if (allow_missing_pts)
-          {
-            return missing_point_val;
-          } else {
-            utils_error().raise(LOCAL_INFO, "ERROR! 5D Interpolation fails for this parameter point.");
-          }
-        }
-        index++;
-      }
-
-      // Variables to track repetitions
-      int it = 0;
-      int itmax = 5;
-
-      // Perform the actual Calculation
-      while (it < itmax)
+      if (not grid.find_corners(xi, rows, xi_lower, xi_upper))
       {
-        InterpIter((itmax-it),xi_lower[it],xi_upper[it],fi,xi[it]);
-        it++;
+        if (not allow_missing_pts) utils_error().raise(LOCAL_INFO, "ERROR! 5D Interpolation fails for this parameter point.");
+        return missing_point_val;
       }
 
-      return fi[0];
+      // Perform the actual calculation
+      const table_column& fi_values = interp_data[interp_index];
+      double fi[32];
+      for (size_t c = 0; c < 32; ++c) fi[c] = fi_values[rows[c]];
+      return multilinearinterp(5, fi, xi_lower, xi_upper, xi);
     }
 
-    // Linear interpolation in 1D
-    double linearinterp1D(double x1, double x2, double y1, double y2, double xtest)
+    // Evaluate all interpolations at once, sharing the grid lookup
+    void interp5d_collection::eval(double x1,double x2,double x3,double x4, double x5, std::vector<double>& results)
     {
-      // Avoid NaNs
-      if(x2==x1) return y1;
-      return (y1 + (xtest-x1)/(x2-x1) * (y2 - y1));
-    }
+      const double xi[] = {x1,x2,x3,x4,x5};
+      double xi_lower[5], xi_upper[5];
+      long rows[32];
+      results.resize(n_interpolators);
 
-    // Function to evaluate set of 1D interps, requires careful formatting of original data...
-    void InterpIter(int Ntemp,double xi_1,double xi_2,std::vector<double>& fi,double test)
-    {
-      std::vector<double> vi;
-      size_t j=0;
-
-      // Loop over the number of required 1D interpolations
-      while(j < pow(2,Ntemp))
+      if (not grid.find_corners(xi, rows, xi_lower, xi_upper))
       {
-        if (fi.size() < j)
-        {
-          utils_error().raise(LOCAL_INFO, "ERROR! Something has gone wrong with sizes in InterpIter (4D/5D interpolation)");
-        }
-
-        vi.push_back(linearinterp1D(xi_1,xi_2,fi[j],fi[j+1],test));
-        j = j + 2;
+        if (not allow_missing_pts) utils_error().raise(LOCAL_INFO, "ERROR! 5D Interpolation fails for this parameter point.");
+        std::fill(results.begin(), results.end(), missing_point_val);
+        return;
       }
 
-      // Set values of fi to vi
-      fi.clear();
-      fi = vi;
+      for (size_t interp_index = 0; interp_index < n_interpolators; ++interp_index)
+      {
+        const table_column& fi_values = interp_data[interp_index];
+        double fi[32];
+        for (size_t c = 0; c < 32; ++c) fi[c] = fi_values[rows[c]];
+        results[interp_index] = multilinearinterp(5, fi, xi_lower, xi_upper, xi);
+      }
     }
 
     // Check if point is inside interpolation range
@@ -128,6 +128,13 @@ namespace Gambit
      assert_contains(inkey);
      _values[inkey]=value;
    }
+
+   /// Get a pointer to the stored value of a parameter
+   double* ModelParameters::getValuePtr(std::string const &inkey)
+   {
+     assert_contains(inkey);
+     return &_values.at(inkey);
+   }
   
    /// Set many parameter values using another ModelParameters object
    void ModelParameters::setValues(ModelParameters const& donor, bool missing_is_error)
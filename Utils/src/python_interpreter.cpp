@@ -39,7 +39,7 @@
       }
   
       /// Regular constructor. No access as it is private.
-      python_interpreter::python_interpreter()
+      python_interpreter::python_interpreter() : called_in_likelihood(false)
       {
         // Start the interpreter
         iptr = new pybind11::scoped_interpreter;
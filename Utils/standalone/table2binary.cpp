@@ -0,0 +1,104 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Stand-alone tool for converting ASCII tables
+///  to the binary table format, which is read by
+///  ASCIItableReader (and hence the interpolator
+///  collections) via memory mapping instead of
+///  being parsed.
+///
+///  By default each table is written next to the
+///  ASCII file, where it is picked up automatically
+///  as long as the ASCII file keeps the size and
+///  modification time recorded in the binary table.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+// GAMBIT headers
+#include "gambit/Utils/ascii_table_reader.hpp"
+
+// Annoying other things we need due to mostly unwanted dependencies
+#include "gambit/Utils/static_members.hpp"
+
+using namespace Gambit;
+
+void usage()
+{
+    std::cout << "\nusage: table2binary [options] <file> [<file> ...]"
+          "\n "
+          "\n  file     - ASCII table to convert"
+          "\n"
+          "\nOptions:"
+          "\n   -h/--help             Display this usage information"
+          "\n   -o/--out <path>       Name of the binary table (only for a single input file; default"
+          "\n                         is the name of the input file with '.gbt' appended)"
+          "\n" << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+  std::vector<std::string> files;
+  std::string outname;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string arg(argv[i]);
+    if (arg == "-h" or arg == "--help")
+    {
+      usage();
+      return 0;
+    }
+    else if (arg == "-o" or arg == "--out")
+    {
+      if (++i == argc)
+      {
+        usage();
+        return 1;
+      }
+      outname = argv[i];
+    }
+    else files.push_back(arg);
+  }
+
+  if (files.empty() or (not outname.empty() and files.size() > 1))
+  {
+    usage();
+    return 1;
+  }
+
+  try
+  {
+    for (const std::string& file : files)
+    {
+      if (ASCIItableReader::is_binary(file))
+      {
+        std::cout << "Skipping " << file << ", which is already a binary table." << std::endl;
+        continue;
+      }
+      ASCIItableReader table(file);
+      const std::string binfile = (outname.empty() ? ASCIItableReader::binary_name(file) : outname);
+      table.write_binary(binfile, file);
+      std::cout << "Wrote " << table.getncol() << " columns and " << table.getnrow() << " rows of " << file
+                << " to " << binfile << "." << std::endl;
+    }
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << "table2binary failed: " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
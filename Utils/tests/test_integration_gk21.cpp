@@ -0,0 +1,200 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Unit tests for the batched 21- and 51-point
+///  Gauss-Kronrod quadrature, against known
+///  integrals and against GSL's own GK21 and
+///  GK51 rules and adaptive integrator, and for
+///  the pooled GSL integration workspaces.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#include <cmath>
+#include <functional>
+#include <vector>
+
+#include "gambit/Utils/integration.hpp"
+#include "gambit/Utils/static_members.hpp"
+#include "unit_test.hpp"
+
+using namespace Gambit;
+using Utils::batch_integrand;
+
+/// Batch integrand for a single function of x
+batch_integrand batch(const std::function<double(double)>& f, int* calls = nullptr)
+{
+  return [f, calls](const double* x, size_t n, double* fx) { if (calls) ++*calls; for (size_t i = 0; i < n; ++i) fx[i] = f(x[i]); };
+}
+
+/// Batch integrand for the family f(k, x), k = 0..m-1
+batch_integrand family(const std::function<double(size_t, double)>& f, size_t m)
+{
+  return [f, m](const double* x, size_t n, double* fx) { for (size_t k = 0; k < m; ++k) for (size_t i = 0; i < n; ++i) fx[k*n+i] = f(k, x[i]); };
+}
+
+/// Integrate f over [a,b] with GSL's adaptive integrator using the GK21 rule
+double gsl_qag_gk21(const std::function<double(double)>& f, double a, double b, double abseps, double releps)
+{
+  gsl_function F;
+  F.function = &Utils::unwrap;
+  F.params = const_cast<std::function<double(double)>*>(&f);
+  Utils::integration_workspace ws(1000);
+  double result, error;
+  gsl_set_error_handler_off();
+  EXPECT(gsl_integration_qag(&F, a, b, abseps, releps, 1000, GSL_INTEG_GAUSS21, ws, &result, &error) == GSL_SUCCESS);
+  return result;
+}
+
+int main()
+{
+  const double releps = 1e-10;
+  double abserr;
+
+  // A polynomial of degree below 31 is integrated exactly by a single batch of one panel
+  int calls = 0;
+  EXPECT_CLOSE(Utils::integrate_gk21(batch([](double x) { return std::pow(x, 20); }, &calls), 0, 1, 0, releps, 1000, &abserr), 1.0/21, 1e-15);
+  EXPECT(calls == 1);
+  EXPECT(abserr <= releps/21);
+
+  // A single panel gives the same result and error estimate as GSL's rules, unless its error estimate is
+  // saturated at the variation of the integrand over it: like GSL's qag, the first panel is then always bisected
+  const std::vector<std::function<double(double)>> one_panel =
+  {
+    [](double x) { return std::exp(x); },
+    [](double x) { return std::pow(x, 20); },
+    [](double x) { return 1/(1+25*x*x); },
+    [](double x) { return std::sin(30*x); },
+    [](double x) { return 1.5; },
+  };
+  for (const auto& f : one_panel)
+  {
+    gsl_function F;
+    F.function = &Utils::unwrap;
+    F.params = const_cast<std::function<double(double)>*>(&f);
+    double gsl_result, gsl_abserr, resabs, resasc;
+    gsl_integration_qk21(&F, -1, 2, &gsl_result, &gsl_abserr, &resabs, &resasc);
+    if (gsl_abserr == resasc)
+    {
+      EXPECT_THROWS(Utils::integrate_gk21(batch(f), -1, 2, 1e300, 0, 1));
+      continue;
+    }
+    const double result = Utils::integrate_gk21(batch(f), -1, 2, 1e300, 0, 1, &abserr);
+    EXPECT_CLOSE(result, gsl_result, 1e-14*std::abs(gsl_result));
+    EXPECT_CLOSE(abserr, gsl_abserr, 1e-6*gsl_abserr);
+  }
+  for (const auto& f : one_panel)
+  {
+    gsl_function F;
+    F.function = &Utils::unwrap;
+    F.params = const_cast<std::function<double(double)>*>(&f);
+    double gsl_result, gsl_abserr, resabs, resasc;
+    gsl_integration_qk51(&F, -1, 2, &gsl_result, &gsl_abserr, &resabs, &resasc);
+    if (gsl_abserr == resasc)
+    {
+      EXPECT_THROWS(Utils::integrate_gk51(batch(f), -1, 2, 1e300, 0, 1));
+      continue;
+    }
+    const double result = Utils::integrate_gk51(batch(f), -1, 2, 1e300, 0, 1, &abserr);
+    EXPECT_CLOSE(result, gsl_result, 1e-14*std::abs(gsl_result));
+    EXPECT_CLOSE(abserr, gsl_abserr, 1e-6*gsl_abserr);
+  }
+  // A saturated first panel is bisected even when its error estimate is within the tolerance
+  const double saturated = Utils::integrate_gk21(batch([](double x) { return std::sin(30*x); }), -1, 2, 10, 0);
+  EXPECT_CLOSE(saturated, (std::cos(30.) - std::cos(60.))/30, 1e-4);
+
+  // Known integrals that need refinement: integrable singularities, a narrow peak, an oscillation
+  struct known_integral { std::function<double(double)> f; double a, b, exact; bool smooth; };
+  const double width = 1e-3;
+  const std::vector<known_integral> known =
+  {
+    {[](double x) { return 1/std::sqrt(x); }, 0, 1, 2, false},
+    {[](double x) { return std::log(x); }, 0, 1, -1, false},
+    {[width](double x) { return std::exp(-(x-0.3)*(x-0.3)/(2*width*width)); }, 0, 1, std::sqrt(2*M_PI)*width, true},
+    {[](double x) { return std::sin(50*x); }, 0, M_PI/10, 2.0/50, true},
+    {[](double x) { return 1/(1+x*x); }, -10, 10, 2*std::atan(10), true},
+  };
+  for (const auto& k : known)
+  {
+    const double result = Utils::integrate_gk21(batch(k.f), k.a, k.b, 0, releps, 1000, &abserr);
+    EXPECT_CLOSE(result, k.exact, 10*releps*std::abs(k.exact));
+    EXPECT(abserr <= releps*std::abs(result));
+    // GSL's adaptive GK21 integrator agrees to within the requested tolerance; without extrapolation
+    // it is not meant for singular integrands, so those are only compared to the known results
+    if (k.smooth) EXPECT_CLOSE(result, gsl_qag_gk21(k.f, k.a, k.b, 0, releps), 10*releps*std::abs(k.exact));
+  }
+
+  // A family of integrals sharing the same abscissae, each converged to its own tolerance
+  const size_t m = 6;
+  std::vector<double> abserrs;
+  std::vector<double> sines = Utils::integrate_gk21_family(family([](size_t k, double x) { return std::sin((k+1)*x); }, m),
+                                                           m, 0, M_PI, 1e-13, releps, 1000, &abserrs);
+  EXPECT(sines.size() == m and abserrs.size() == m);
+  for (size_t k = 0; k < m; ++k)
+  {
+    const double exact = (1 - std::cos((k+1)*M_PI))/(k+1);
+    // The even members vanish, so only an absolute tolerance makes sense for them
+    EXPECT_CLOSE(sines[k], exact, 1e-12);
+  }
+  auto damped = [](size_t k, double x) { return std::exp(-double(k+1)*x)*std::cos(20*x); };
+  std::vector<double> damped_family = Utils::integrate_gk21_family(family(damped, m), m, 0, 5, 0, releps, 1000, &abserrs);
+  for (size_t k = 0; k < m; ++k)
+  {
+    const double c = k+1;
+    const double exact = (c + std::exp(-5*c)*(20*std::sin(100.) - c*std::cos(100.)))/(c*c + 400);
+    EXPECT_CLOSE(damped_family[k], exact, 10*releps*std::abs(exact));
+    EXPECT(abserrs[k] <= releps*std::abs(damped_family[k]));
+    const double qag = gsl_qag_gk21([&damped, k](double x) { return damped(k, x); }, 0, 5, 0, releps);
+    EXPECT_CLOSE(damped_family[k], qag, 10*releps*std::abs(exact));
+  }
+
+  // The 51-point rule converges to the same family
+  std::vector<double> damped_family51 = Utils::integrate_gk51_family(family(damped, m), m, 0, 5, 0, releps, 1000, &abserrs);
+  for (size_t k = 0; k < m; ++k) EXPECT_CLOSE(damped_family51[k], damped_family[k], 10*releps*std::abs(damped_family[k]));
+
+  // The family agrees with integrating its members one by one
+  for (size_t k = 0; k < m; ++k)
+  {
+    const double single = Utils::integrate_gk21(batch([&damped, k](double x) { return damped(k, x); }), 0, 5, 0, releps);
+    EXPECT_CLOSE(damped_family[k], single, 10*releps*std::abs(single));
+  }
+
+  // Failing to reach the tolerance invalidates the point, whether the limit is reached first...
+  auto peak = [width](double x) { return std::exp(-(x-0.3)*(x-0.3)/(2*width*width)); };
+  EXPECT_THROWS(Utils::integrate_gk21(batch(peak), 0, 1, 0, releps, 4));
+  EXPECT_THROWS(Utils::integrate_gk21_family(family([&peak](size_t k, double x) { return k == 0 ? 1 : peak(x); }, 2), 2, 0, 1, 0, releps, 4));
+  // ...or the panels around a discontinuity become too narrow to bisect
+  const double edge = 1/std::sqrt(2.);
+  auto step = [edge](double x) { return x < edge ? 0 : 1; };
+  EXPECT_THROWS(Utils::integrate_gk21(batch(step), edge - 1e-3, edge + 2e-3, 0, 1e-13, 100000));
+  // A NaN also invalidates the point
+  EXPECT_THROWS(Utils::integrate_gk21(batch([](double x) { return x < 0.5 ? 1 : NAN; }), 0, 1, 0, releps));
+
+  // Pooled workspaces: nested workspaces are distinct, a released one is reused, and each has room for its limit
+  {
+    gsl_integration_workspace* outer_ptr;
+    gsl_integration_workspace* inner_ptr;
+    {
+      Utils::integration_workspace outer(200);
+      outer_ptr = outer;
+      {
+        Utils::integration_workspace inner(50);
+        inner_ptr = inner;
+        EXPECT(inner_ptr != outer_ptr);
+        EXPECT(inner_ptr->limit >= 50);
+      }
+      Utils::integration_workspace again(10);
+      EXPECT(static_cast<gsl_integration_workspace*>(again) == inner_ptr);
+      EXPECT(outer_ptr->limit >= 200);
+    }
+  }
+
+  return UnitTest::result();
+}
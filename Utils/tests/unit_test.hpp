@@ -0,0 +1,68 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Minimal helpers for the GAMBIT unit tests.
+///  Each test is a standalone executable that
+///  returns a non-zero exit code (and prints the
+///  failed checks) if any check fails.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#ifndef __unit_test_hpp__
+#define __unit_test_hpp__
+
+#include <cmath>
+#include <iostream>
+
+namespace Gambit
+{
+
+  namespace UnitTest
+  {
+
+    /// Number of failed checks so far
+    inline int& failures() { static int n = 0; return n; }
+
+    /// Record the outcome of a check
+    inline void check(bool ok, const char* what, const char* file, int line)
+    {
+      if (ok) return;
+      ++failures();
+      std::cerr << file << ":" << line << ": check failed: " << what << std::endl;
+    }
+
+    /// Record the outcome of a comparison of two numbers to within an absolute tolerance
+    inline void check_close(double a, double b, double tol, const char* what, const char* file, int line)
+    {
+      if (std::abs(a-b) <= tol) return;
+      ++failures();
+      std::cerr.precision(17);
+      std::cerr << file << ":" << line << ": check failed: " << what << " (" << a << " vs " << b << ", tolerance " << tol << ")" << std::endl;
+    }
+
+    /// Exit code for the test executable
+    inline int result()
+    {
+      if (failures() == 0) std::cout << "All checks passed." << std::endl;
+      else std::cerr << failures() << " check(s) failed." << std::endl;
+      return failures() == 0 ? 0 : 1;
+    }
+
+  }
+
+}
+
+#define EXPECT(X) Gambit::UnitTest::check((X), #X, __FILE__, __LINE__)
+#define EXPECT_CLOSE(A, B, TOL) Gambit::UnitTest::check_close((A), (B), (TOL), #A " == " #B, __FILE__, __LINE__)
+#define EXPECT_THROWS(X) do { bool thrown = false; try { X; } catch (...) { thrown = true; } \
+                              Gambit::UnitTest::check(thrown, #X " throws", __FILE__, __LINE__); } while (0)
+
+#endif // __unit_test_hpp__
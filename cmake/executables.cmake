@@ -27,12 +27,20 @@
 #          (c.j.chang@fys.uio.no)
 #  \date 2021 Feb
 #
+#  \author The GAMBIT Collaboration
+#  \date 2026 Oct
+#
 #************************************************
 
 # Add the module standalones
 add_custom_target(standalones)
 include(cmake/standalones.cmake)
 
+# Add the unit tests
+enable_testing()
+add_custom_target(tests)
+include(cmake/tests.cmake)
+
 # Add the main GAMBIT executable
 if(EXISTS "${PROJECT_SOURCE_DIR}/Core/")
   if (NOT EXCLUDE_FLEXIBLESUSY)
@@ -91,6 +99,15 @@ if(EXISTS "${PROJECT_SOURCE_DIR}/ScannerBit/")
   add_dependencies(standalones ScannerBit_standalone)
 endif()
 
+# Add tool for converting ASCII tables to the binary table format
+if(EXISTS "${PROJECT_SOURCE_DIR}/Utils/")
+  add_gambit_executable(table2binary ""
+                        SOURCES ${PROJECT_SOURCE_DIR}/Utils/standalone/table2binary.cpp
+                                ${GAMBIT_BASIC_COMMON_OBJECTS}
+                        )
+  set_target_properties(table2binary PROPERTIES RUNTIME_OUTPUT_DIRECTORY "${PROJECT_SOURCE_DIR}/Utils/bin")
+endif()
+
 # Add C++ hdf5 combine tool, if we have HDF5 libraries
 # There are a lot of annoying peripheral dependencies on GAMBIT things here, would be good to try and decouple things better
 if(HDF5_FOUND)
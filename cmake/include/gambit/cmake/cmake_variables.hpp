@@ -0,0 +1,96 @@
+// GAMBIT: Global and Modular BSM Inference Tool
+//************************************************
+/// \file
+///
+///  Configured options and settings for GAMBIT
+///
+///***********************************************
+///
+///  Authors:
+///
+///  \author Antje Putze
+///        (antje.putze@lapth.cnrs.fr)
+///  \date 2015 Apr, Sep
+///
+///  \author Pat Scott
+///        (p.scott@imperial.ac.uk)
+///  \date 2015 Apr
+///  \date 2017 Dec
+///
+///  \author Tomas Gonzalo
+///        (t.e.gonzalo@fys.uio.no)
+///  \date 2016 Sep
+///
+///  \author Anders Kvellestad
+///        (anders.kvellestad@fys.uio.no)
+///  \date 2021 Jul
+///
+///
+///
+///***********************************************
+
+#ifndef __cmake_variables_hpp__
+#define __cmake_variables_hpp__
+
+/// Gambit source directory
+#define GAMBIT_DIR "/root/repo"
+
+/// Name of the gambit executable
+#define GAMBIT_EXECUTABLE "gambit"
+
+/// Compiler supports C++14 features
+#define COMPILER_SUPPORTS_CXX14 1
+
+/// Compiler supports C++17 features
+/* #undef COMPILER_SUPPORTS_CXX17 */
+
+/// Found link.h in system paths
+#define HAVE_LINK_H 1
+
+/// Found Graphviz
+/* #undef HAVE_GRAPHVIZ */
+
+/// Found Mathematica
+/* #undef HAVE_MATHEMATICA */
+/* #undef MATHEMATICA_WSTP_H */
+/* #undef MATHEMATICA_KERNEL */
+/* #undef MATHEMATICA_WSTP_VERSION_MAJOR */
+/* #undef MATHEMATICA_WSTP_VERSION_MINOR */
+
+/// Python version info
+#define PYTHON_VERSION_MAJOR 3
+#define PYTHON_VERSION_MINOR 11
+
+/// Found/installed pybind11
+/* #undef HAVE_PYBIND11 */
+
+/// Leave out yoda
+/* #undef EXCLUDE_YODA */
+
+/// Leave out HepMC
+/* #undef EXCLUDE_HEPMC */
+
+/// Path to HepMC lib directory
+/* #undef HEPMC_LIB */
+
+/// Leave out ROOT
+#define EXCLUDE_ROOT 1
+
+/// Leave out RestFrames
+#define EXCLUDE_RESTFRAMES 1
+
+/// Path to RestFrames include directory
+/* #undef RESTFRAMES_INCLUDE */
+
+/// Suppress specific compiler warnings from external libraries
+#define SUPPRESS_LIBRARY_WARNINGS 1
+
+/// Version info
+/// @{
+#define GAMBIT_VERSION_MAJOR    2
+#define GAMBIT_VERSION_MINOR    5
+#define GAMBIT_VERSION_REVISION 1
+#define GAMBIT_VERSION_PATCH    ""
+/// @}
+
+#endif //// #defined__cmake_variables_hpp__
@@ -0,0 +1,69 @@
+# GAMBIT: Global and Modular BSM Inference Tool
+#************************************************
+# \file
+#
+#  CMake configuration script for the unit
+#  tests of GAMBIT.  Build them with 'make tests'
+#  and run them with ctest.
+#
+#************************************************
+#
+#  Authors (add name and date if you modify):
+#
+#  \author The GAMBIT Collaboration
+#  \date 2026 Oct
+#
+#************************************************
+
+add_gambit_test(test_integration_gk21 SOURCES ${PROJECT_SOURCE_DIR}/Utils/tests/test_integration_gk21.cpp
+                                       ${GAMBIT_ALL_COMMON_OBJECTS})
+
+if(EXISTS "${PROJECT_SOURCE_DIR}/Elements/")
+  add_gambit_test(test_decay_table SOURCES ${PROJECT_SOURCE_DIR}/Elements/tests/test_decay_table.cpp
+                                           ${GAMBIT_ALL_COMMON_OBJECTS})
+  add_gambit_test(test_funk_tape SOURCES ${PROJECT_SOURCE_DIR}/Elements/tests/test_funk_tape.cpp
+                                         ${GAMBIT_ALL_COMMON_OBJECTS})
+  add_gambit_test(test_spec_handle SOURCES ${PROJECT_SOURCE_DIR}/Elements/tests/test_spec_handle.cpp
+                                           ${GAMBIT_ALL_COMMON_OBJECTS})
+  add_gambit_test(test_concurrent_invalidation SOURCES ${PROJECT_SOURCE_DIR}/Elements/tests/test_concurrent_invalidation.cpp
+                                                       ${GAMBIT_ALL_COMMON_OBJECTS})
+endif()
+
+if(EXISTS "${PROJECT_SOURCE_DIR}/DarkBit/")
+  add_gambit_test(test_projected_disc_integral SOURCES ${PROJECT_SOURCE_DIR}/DarkBit/tests/test_projected_disc_integral.cpp
+                                                       ${GAMBIT_ALL_COMMON_OBJECTS})
+endif()
+
+if(EXISTS "${PROJECT_SOURCE_DIR}/ColliderBit/")
+  # The per-thread readers are only tested when HepMC is available
+  if(NOT EXCLUDE_HEPMC)
+    set(indexed_event_file_libs ${HEPMC_LDFLAGS})
+  endif()
+  add_gambit_test(test_indexed_event_file SOURCES ${PROJECT_SOURCE_DIR}/ColliderBit/tests/test_indexed_event_file.cpp
+                                                  ${PROJECT_SOURCE_DIR}/ColliderBit/src/indexed_event_file.cpp
+                                                  ${GAMBIT_ALL_COMMON_OBJECTS}
+                                          LIBRARIES ${indexed_event_file_libs})
+  if(NOT EXCLUDE_HEPMC)
+    add_dependencies(test_indexed_event_file hepmc)
+  endif()
+endif()
+
+if(WITH_MPI AND EXISTS "${PROJECT_SOURCE_DIR}/Printers/")
+  add_gambit_test(test_hdf5_collective_errors SOURCES ${PROJECT_SOURCE_DIR}/Printers/tests/test_hdf5_collective_errors.cpp
+                                                      ${GAMBIT_ALL_COMMON_OBJECTS})
+  foreach(nprocs 2 4)
+    add_test(NAME test_hdf5_collective_errors_np${nprocs}
+             COMMAND ${MPIEXEC_EXECUTABLE} ${MPIEXEC_NUMPROC_FLAG} ${nprocs} ${MPIEXEC_PREFLAGS} $<TARGET_FILE:test_hdf5_collective_errors>
+             WORKING_DIRECTORY ${PROJECT_BINARY_DIR}/tests)
+  endforeach()
+  # Collective writes need HDF5 built with MPI-IO support
+  if(HDF5_FOUND AND HDF5_IS_PARALLEL)
+    add_gambit_test(test_hdf5_collective_write SOURCES ${PROJECT_SOURCE_DIR}/Printers/tests/test_hdf5_collective_write.cpp
+                                                       ${GAMBIT_ALL_COMMON_OBJECTS})
+    foreach(nprocs 2 4)
+      add_test(NAME test_hdf5_collective_write_np${nprocs}
+               COMMAND ${MPIEXEC_EXECUTABLE} ${MPIEXEC_NUMPROC_FLAG} ${nprocs} ${MPIEXEC_PREFLAGS} $<TARGET_FILE:test_hdf5_collective_write>
+               WORKING_DIRECTORY ${PROJECT_BINARY_DIR}/tests)
+    endforeach()
+  endif()
+endif()
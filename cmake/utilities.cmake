@@ -41,6 +41,9 @@
 #          (anders.kvellestad@fys.uio.no)
 #  \date 2023 Mar
 #
+#  \author The GAMBIT Collaboration
+#  \date 2026 Oct
+#
 #************************************************
 
 include(CMakeParseArguments)
@@ -384,6 +387,16 @@ function(add_gambit_executable executablename LIBRARIES)
 
 endfunction()
 
+# Function to add a unit test.  Unit tests are built by the 'tests' target and run with ctest.
+function(add_gambit_test testname)
+  cmake_parse_arguments(ARG "" "" "SOURCES;LIBRARIES;ARGUMENTS;" ${ARGN})
+  add_gambit_executable(${testname} "${ARG_LIBRARIES}" SOURCES ${ARG_SOURCES})
+  target_include_directories(${testname} PRIVATE ${PROJECT_SOURCE_DIR}/Utils/tests)
+  set_target_properties(${testname} PROPERTIES RUNTIME_OUTPUT_DIRECTORY "${PROJECT_BINARY_DIR}/tests")
+  add_dependencies(tests ${testname})
+  add_test(NAME ${testname} COMMAND ${testname} ${ARG_ARGUMENTS} WORKING_DIRECTORY ${PROJECT_BINARY_DIR}/tests)
+endfunction()
+
 # Standalone harvester script
 set(STANDALONE_FACILITATOR ${PROJECT_SOURCE_DIR}/Elements/scripts/standalone_facilitator.py)
 
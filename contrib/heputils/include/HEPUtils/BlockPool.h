@@ -0,0 +1,120 @@
+// -*- C++ -*-
+//
+// This file is part of HEPUtils -- https://gitlab.com/hepcedar/heputils/
+// Copyright (C) 2013-2023 Andy Buckley <andy.buckley@cern.ch>
+//
+// Embedding of HEPUtils code in other projects is permitted provided this
+// notice is retained and the HEPUtils namespace and include path are changed.
+//
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+namespace HEPUtils {
+
+
+  /// @brief Per-thread cache of freed memory blocks of the size of T
+  ///
+  /// Used as the class-specific allocator of Particle and Jet: blocks freed
+  /// when an event is cleared are handed out again for the next event on the
+  /// same thread, so that the event loop stops hitting the heap after warm-up.
+  /// Blocks may be freed on a different thread to the one that allocated them.
+  template <typename T>
+  class BlockPool {
+  public:
+
+    /// Maximum number of cached blocks per thread
+    static const size_t max_cached = 1 << 16;
+
+    static void* allocate(size_t n) {
+      State& s = state();
+      if (n == sizeof(T) && s.head != nullptr) {
+        FreeBlock* b = s.head;
+        s.head = b->next;
+        --s.count;
+        return b;
+      }
+      return ::operator new(n);
+    }
+
+    static void deallocate(void* p, size_t n) {
+      if (p == nullptr) return;
+      State& s = state();
+      if (n != sizeof(T) || s.dead || s.count >= max_cached) {
+        ::operator delete(p);
+        return;
+      }
+      // Make sure the cache gets emptied when this thread exits
+      static thread_local Guard guard;
+      (void) guard;
+      FreeBlock* b = static_cast<FreeBlock*>(p);
+      b->next = s.head;
+      s.head = b;
+      ++s.count;
+    }
+
+
+  private:
+
+    struct FreeBlock { FreeBlock* next; };
+    static_assert(sizeof(T) >= sizeof(FreeBlock), "BlockPool blocks must be able to hold a pointer");
+
+    /// Cache state (trivially destructible, so still valid while other thread-locals are destroyed)
+    struct State {
+      FreeBlock* head;
+      size_t count;
+      bool dead;
+    };
+
+    static State& state() {
+      static thread_local State s = {nullptr, 0, false};
+      return s;
+    }
+
+    /// Frees the cached blocks at thread exit; later deallocations go straight to the heap
+    struct Guard {
+      ~Guard() {
+        State& s = state();
+        while (s.head != nullptr) {
+          FreeBlock* b = s.head;
+          s.head = b->next;
+          ::operator delete(b);
+        }
+        s.count = 0;
+        s.dead = true;
+      }
+    };
+
+  };
+
+
+  /// @brief Standard-library allocator that takes single objects from the BlockPool of their type
+  ///
+  /// Used for the node-based containers held by Jet, so that their nodes are
+  /// also reused from event to event.
+  template <typename T>
+  struct BlockAllocator {
+    typedef T value_type;
+
+    BlockAllocator() noexcept {}
+    template <typename U> BlockAllocator(const BlockAllocator<U>&) noexcept {}
+
+    T* allocate(size_t n) {
+      if (n == 1) return static_cast<T*>(BlockPool<T>::allocate(sizeof(T)));
+      return static_cast<T*>(::operator new(n*sizeof(T)));
+    }
+
+    void deallocate(T* p, size_t n) {
+      if (n == 1) BlockPool<T>::deallocate(p, sizeof(T));
+      else ::operator delete(p);
+    }
+  };
+
+  template <typename T, typename U>
+  bool operator == (const BlockAllocator<T>&, const BlockAllocator<U>&) { return true; }
+  template <typename T, typename U>
+  bool operator != (const BlockAllocator<T>&, const BlockAllocator<U>&) { return false; }
+
+
+}
@@ -115,15 +115,18 @@ namespace HEPUtils {
     void cloneTo(Event& e) const {
       e.set_weights(_weights);
       e.set_weight_errs(_weight_errs);
-      const std::vector<const Particle*> ps = particles();
+      const std::vector<const Particle*>& ps = particles();
       for (size_t i = 0; i < ps.size(); ++i) {
-        e.add_particle(new Particle(*ps[i]));
+        e.add_particle(new Particle(*ps[i]), false);
       }
+      e._sort_particles();
       for (const auto& kv : _jets ) {
-        const std::vector<const Jet*> js = jets(kv.first);
-        for (size_t i = 0; i < js.size(); ++i) {
-          e.add_jet(new Jet(*js[i]), kv.first);
+        // Fill each collection directly and sort it once, rather than on every add_jet
+        std::vector<const Jet*>& ejs = e._jets[kv.first];
+        for (size_t i = 0; i < kv.second.size(); ++i) {
+          ejs.push_back(new Jet(*kv.second[i]));
         }
+        std::sort(ejs.begin(), ejs.end(), _cmpPtDescPtr<Jet>);
       }
       e._pmiss = _pmiss;
       e._cseqs = _cseqs;
@@ -149,10 +152,12 @@ namespace HEPUtils {
       _muons.clear();
       _taus.clear();
 
-      // Jets
-      for (const std::string& jc : jet_collections()) clear_jets(jc);
-      _jets.clear();
-      _cseqs.clear();
+      // Jets, keeping the collection names and vector capacities for the next event
+      for (auto& kv : _jets) {
+        for (const Jet* j : kv.second) delete j;
+        kv.second.clear();
+      }
+      for (auto& kv : _cseqs) kv.second.reset();
 
       // MET
       _pmiss.clear();
@@ -383,6 +388,11 @@ namespace HEPUtils {
       return rtn;
     }
 
+    /// Get the jet collections keyed by name, without copying the names
+    const std::map<std::string, std::vector<const Jet*>>& jet_collection_map() const {
+      return _jets;
+    }
+
     
     /// @brief Set a jet collection
     ///
@@ -408,9 +418,10 @@ namespace HEPUtils {
     /// @note This resets the cluster sequence, but as a shared_ptr is used for storage,
     ///   any existing shared_ptr links to the previous one will keep it alive.
     void clear_jets(const std::string& key) {
-      for (const Jet* j : jets(key)) delete j;
-      _jets.erase(key);
-      _cseqs.erase(key);
+      std::vector<const Jet*>& js = _get_jets(key);
+      for (const Jet* j : js) delete j;
+      js.clear();
+      _cseqs[key].reset();
     }
     
 
@@ -457,7 +468,7 @@ namespace HEPUtils {
     /// @warning The CS should be new'd; Event will take ownership via a shared_ptr
     template <typename CS=FJNS::ClusterSequence>
     void set_clusterseq(std::shared_ptr<const CS> cseq, const std::string& key) {
-      if (_cseqs.find(key) != _cseqs.end() && !_cseqs.empty()) {
+      if (_cseqs.find(key) != _cseqs.end() && _cseqs.at(key)) {
 	throw std::runtime_error("Event::set_clusterseq() called for a non-empty jet collection");
       }
       _cseqs[key] =  cseq;
@@ -473,7 +484,7 @@ namespace HEPUtils {
     /// @todo How to run a more advanced CS like the active- or Voronoi-area ones?
     template <typename CS=FJNS::ClusterSequence>
     CSeqBasePtr emplace_clusterseq(std::vector<FJNS::PseudoJet>& jetparticles, const FJNS::JetDefinition& jetdef, const std::string& key) {
-      if (_cseqs.find(key) != _cseqs.end() && !_cseqs.empty()) {
+      if (_cseqs.find(key) != _cseqs.end() && _cseqs.at(key)) {
 	throw std::runtime_error("Event::emplace_clusterseq() called for a non-empty jet collection");
       }
       _cseqs[key] = std::make_shared<CS>(jetparticles, jetdef);
@@ -10,6 +10,7 @@
 
 #include "HEPUtils/FastJet.h"
 #include "HEPUtils/MathUtils.h"
+#include "HEPUtils/BlockPool.h"
 #include "HEPUtils/Vectors.h"
 
 namespace HEPUtils {
@@ -21,8 +22,8 @@ namespace HEPUtils {
   class Jet {
   public:
 
-    /// Typedef for tag PID -> counts dictionary
-    using TagCounts = std::map<int, int>;
+    /// Typedef for tag PID -> counts dictionary (nodes reused from event to event)
+    using TagCounts = std::map<int, int, std::less<int>, BlockAllocator<std::pair<const int, int>>>;
 
 
   private:
@@ -45,6 +46,13 @@ namespace HEPUtils {
 
   public:
 
+    /// @name Allocation from a per-thread block cache
+    /// @{
+    static void* operator new(size_t n) { return BlockPool<Jet>::allocate(n); }
+    static void operator delete(void* p, size_t n) { BlockPool<Jet>::deallocate(p, n); }
+    /// @}
+
+
     /// @name Constructors
     /// @{
 
@@ -135,9 +143,9 @@ namespace HEPUtils {
     /// @{
 
     /// Get the tags map (const)
-    const std::map<int,int>& tags() const { return _tags; }
+    const TagCounts& tags() const { return _tags; }
     /// Get the tags map (const)
-    std::map<int,int>& tags() { return _tags; }
+    TagCounts& tags() { return _tags; }
 
     /// Get the number of tags for the given PDG ID
     int ntags(int pdgid) const { auto it = _tags.find(pdgid); return (it == _tags.end()) ? 0 : it->second; }
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "HEPUtils/MathUtils.h"
+#include "HEPUtils/BlockPool.h"
 #include "HEPUtils/Vectors.h"
 
 namespace HEPUtils {
@@ -37,6 +38,13 @@ namespace HEPUtils {
 
   public:
 
+    /// @name Allocation from a per-thread block cache
+    /// @{
+    static void* operator new(size_t n) { return BlockPool<Particle>::allocate(n); }
+    static void operator delete(void* p, size_t n) { BlockPool<Particle>::deallocate(p, n); }
+    /// @}
+
+
     /// @name Constructors
     /// @{
 